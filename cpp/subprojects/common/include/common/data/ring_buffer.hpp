@@ -74,6 +74,14 @@ class RingBuffer final {
          */
         bool isFull() const;
 
+        /**
+         * Returns the position in the buffer, the next value will be written to. If the maximum capacity of the buffer
+         * has been reached, this corresponds to the position of the oldest value.
+         *
+         * @return The position
+         */
+        uint32 getPosition() const;
+
         /**
          * Adds a new value to the buffer. If the maximum capacity of the buffer has been reached, the oldest value will
          * be overwritten.
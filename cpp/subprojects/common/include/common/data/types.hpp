@@ -8,6 +8,8 @@
 
 typedef intptr_t intp;
 typedef uint8_t uint8;
+typedef uint16_t uint16;
 typedef uint32_t uint32;
+typedef uint64_t uint64;
 typedef float float32;
 typedef double float64;
@@ -0,0 +1,38 @@
+/*
+ * @author Michael Rapp (mrapp@ke.tu-darmstadt.de)
+ */
+#pragma once
+
+#include "common/rule_induction/checkpoint.hpp"
+
+
+/**
+ * Defines an interface for all classes that allow to exchange messages with another process, e.g., via a socket or
+ * shared memory. The messages use the binary format of the classes `CheckpointWriter` and `CheckpointReader`.
+ */
+class IChannel {
+
+    public:
+
+        virtual ~IChannel() { };
+
+        /**
+         * Sends a message to the other process.
+         *
+         * @param message   A reference to an object of type `CheckpointWriter` that stores the message
+         * @return          True, if the message has been sent successfully, false otherwise
+         */
+        virtual bool send(const CheckpointWriter& message) = 0;
+
+        /**
+         * Receives the next message from the other process. If no message is available yet, the function blocks until
+         * a message arrives.
+         *
+         * @param message   A reference to an object of type `CheckpointReader`, the message should be written to. Any
+         *                  values it stores before are discarded
+         * @return          True, if a message has been received successfully, false, if the other process has closed
+         *                  the channel or if an error occurred
+         */
+        virtual bool receive(CheckpointReader& message) = 0;
+
+};
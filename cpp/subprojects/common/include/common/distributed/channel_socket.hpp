@@ -0,0 +1,62 @@
+/*
+ * @author Michael Rapp (mrapp@ke.tu-darmstadt.de)
+ */
+#pragma once
+
+#include "common/distributed/channel.hpp"
+#include <memory>
+#include <string>
+
+
+/**
+ * An implementation of the type `IChannel` that exchanges messages with another process on the same machine via a
+ * Unix domain socket. Each message is preceded by its length in bytes.
+ */
+class SocketChannel final : public IChannel {
+
+    private:
+
+        int fd_;
+
+    public:
+
+        /**
+         * @param fd The file descriptor of a connected stream socket. It is closed when the channel is destroyed
+         */
+        SocketChannel(int fd);
+
+        ~SocketChannel();
+
+        SocketChannel(const SocketChannel& other) = delete;
+
+        SocketChannel& operator=(const SocketChannel& other) = delete;
+
+        /**
+         * Creates a socket at a specific path and waits until another process connects to it. If the socket cannot be
+         * created, or if no process connects to it before a timeout is reached, a `std::runtime_error` is thrown.
+         *
+         * @param path      The path of the socket. An existing socket at the given path is replaced, whereas other
+         *                  files are never removed
+         * @param timeout   The maximum number of seconds to wait for another process to connect
+         * @return          An unique pointer to an object of type `SocketChannel` that allows to exchange messages
+         *                  with the process that has connected to the socket
+         */
+        static std::unique_ptr<SocketChannel> listen(const std::string& path, uint32 timeout);
+
+        /**
+         * Connects to a socket that has been created by another process via the function `listen`. If the socket
+         * does not exist yet, the connection is retried until a timeout is reached.
+         *
+         * @param path      The path of the socket
+         * @param timeout   The maximum number of seconds to wait for the socket to become available
+         * @return          An unique pointer to an object of type `SocketChannel` that allows to exchange messages
+         *                  with the process that has created the socket or a null pointer, if no connection could be
+         *                  established
+         */
+        static std::unique_ptr<SocketChannel> connect(const std::string& path, uint32 timeout);
+
+        bool send(const CheckpointWriter& message) override;
+
+        bool receive(CheckpointReader& message) override;
+
+};
@@ -0,0 +1,59 @@
+/*
+ * @author Michael Rapp (mrapp@ke.tu-darmstadt.de)
+ */
+#pragma once
+
+#include "common/data/types.hpp"
+
+
+/**
+ * An enum that specifies the types of the messages that are sent by a coordinator, which induces rules, to the workers
+ * that search for refinements of the rules based on a shard of the features. Each message starts with its type,
+ * followed by its content.
+ */
+enum ShardMessage : uint8 {
+
+    /**
+     * Starts the induction of a new rule. Consists of the indices of the examples in the holdout set (only sent for the
+     * first rule), the coverage counts of all examples, the weights of all examples and the indices of the labels for
+     * which the rule may predict. The worker does not reply.
+     */
+    SHARD_BEGIN_RULE = 0,
+
+    /**
+     * Requests the best refinement of the current rule among some features of the worker's shard. Consists of the
+     * minimum coverage of a refinement and the indices of the features. The worker replies with the quality scores of
+     * the refinements that have been found for the individual features, followed by the best refinement, if any.
+     */
+    SHARD_FIND_REFINEMENT = 1,
+
+    /**
+     * Applies a refinement that has been found by the worker. Consists of the refinement. The worker replies with the
+     * indices of the examples whose statistics have been updated by the refinement.
+     */
+    SHARD_APPLY_REFINEMENT = 2,
+
+    /**
+     * Applies a refinement that has been found by another worker. Consists of the refinement and the indices of the
+     * examples whose statistics have been updated by the refinement. The worker does not reply.
+     */
+    SHARD_FILTER_REFINEMENT = 3,
+
+    /**
+     * Stops the worker. The worker does not reply.
+     */
+    SHARD_SHUTDOWN = 4
+
+};
+
+/**
+ * Returns the index of the shard a specific feature belongs to. The features are assigned to the shards in a
+ * round-robin fashion.
+ *
+ * @param featureIndex  The index of the feature
+ * @param numShards     The total number of shards
+ * @return              The index of the shard
+ */
+static inline uint32 getShardIndex(uint32 featureIndex, uint32 numShards) {
+    return featureIndex % numShards;
+}
@@ -0,0 +1,94 @@
+/*
+ * @author Michael Rapp (mrapp@ke.tu-darmstadt.de)
+ */
+#pragma once
+
+#include "common/distributed/channel.hpp"
+#include "common/head_refinement/head_refinement_factory.hpp"
+#include "common/input/feature_matrix.hpp"
+#include "common/input/label_matrix.hpp"
+#include "common/input/nominal_feature_mask.hpp"
+#include "common/rule_refinement/refinement.hpp"
+#include "common/sampling/weight_vector_dense.hpp"
+#include "common/statistics/statistics_provider_factory.hpp"
+#include "common/thresholds/thresholds_factory.hpp"
+#include <memory>
+#include <unordered_map>
+
+
+/**
+ * Searches for refinements of rules based on a shard of the features on behalf of a coordinator, e.g., an object of
+ * type `ShardedRuleInduction` in another process, that decides which features are assigned to the worker. The worker
+ * maintains its own copy of the statistics, as well as caches of the sorted and filtered feature vectors of its
+ * features. Only the refinements that are chosen by the coordinator, and the examples they cover, are exchanged.
+ *
+ * The worker must be given the same training data and configuration as the coordinator.
+ */
+class ShardWorker final {
+
+    private:
+
+        std::shared_ptr<IStatisticsProvider> statisticsProviderPtr_;
+
+        std::unique_ptr<IThresholds> thresholdsPtr_;
+
+        uint32 numThreads_;
+
+        std::unique_ptr<DenseWeightVector<float64>> weightsPtr_;
+
+        std::unique_ptr<IIndexVector> labelIndicesPtr_;
+
+        std::unique_ptr<IThresholdsSubset> thresholdsSubsetPtr_;
+
+        std::unordered_map<uint32, std::unique_ptr<IRuleRefinement>> ruleRefinements_;
+
+        std::unique_ptr<Refinement> bestRefinementPtr_;
+
+        void beginRule(CheckpointReader& message);
+
+        void findRefinement(CheckpointReader& message, CheckpointWriter& reply);
+
+        void applyRefinement(CheckpointReader& message, CheckpointWriter& reply);
+
+        void filterRefinement(CheckpointReader& message);
+
+    public:
+
+        /**
+         * @param statisticsProviderFactoryPtr  A shared pointer to an object of type `IStatisticsProviderFactory` that
+         *                                      provides access to the statistics which serve as the basis for learning
+         *                                      rules
+         * @param thresholdsFactoryPtr          A shared pointer to an object of type `IThresholdsFactory` that allows
+         *                                      to create objects that provide access to the thresholds that may be used
+         *                                      by the conditions of rules
+         * @param headRefinementFactoryPtr      A shared pointer to an object of type `IHeadRefinementFactory` that
+         *                                      allows to create instances of the class that should be used to find the
+         *                                      heads of rules
+         * @param nominalFeatureMaskPtr         A shared pointer to an object of type `INominalFeatureMask` that
+         *                                      provides access to the information whether individual features are
+         *                                      nominal or not
+         * @param featureMatrixPtr              A shared pointer to an object of type `IFeatureMatrix` that provides
+         *                                      access to the feature values of the training examples
+         * @param labelMatrixPtr                A shared pointer to an object of type `ILabelMatrix` that provides
+         *                                      access to the labels of the training examples
+         * @param numThreads                    The number of CPU threads to be used to search for potential refinements
+         *                                      of a rule in parallel. Must be at least 1
+         */
+        ShardWorker(std::shared_ptr<IStatisticsProviderFactory> statisticsProviderFactoryPtr,
+                    std::shared_ptr<IThresholdsFactory> thresholdsFactoryPtr,
+                    std::shared_ptr<IHeadRefinementFactory> headRefinementFactoryPtr,
+                    std::shared_ptr<INominalFeatureMask> nominalFeatureMaskPtr,
+                    std::shared_ptr<IFeatureMatrix> featureMatrixPtr, std::shared_ptr<ILabelMatrix> labelMatrixPtr,
+                    uint32 numThreads);
+
+        /**
+         * Processes the messages that are received via a channel until the coordinator stops the worker.
+         *
+         * @param channel   A reference to an object of type `IChannel` that allows to exchange messages with the
+         *                  coordinator
+         * @return          True, if the worker has been stopped by the coordinator, false, if the channel has been
+         *                  closed or if an invalid message has been received
+         */
+        bool serve(IChannel& channel);
+
+};
@@ -0,0 +1,178 @@
+/*
+ * @author Michael Rapp (mrapp@ke.tu-darmstadt.de)
+ */
+#pragma once
+
+#include "common/data/types.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+
+/**
+ * Stores the values and attributes that have been read from an ARFF file. If the file is given in the dense format,
+ * the values are stored in a Fortran-contiguous array, as expected by the class `FortranContiguousFeatureMatrix`. If
+ * it is given in the sparse format, they are stored in the compressed sparse column (CSC) format, as expected by the
+ * class `CscFeatureMatrix`. The values of nominal attributes are represented by the indices of the values in the order
+ * of their declaration and missing values are represented by NaN.
+ */
+class ArffData final {
+
+    private:
+
+        uint32 numRows_;
+
+        uint32 numCols_;
+
+        bool sparse_;
+
+        std::vector<float32> values_;
+
+        std::vector<uint32> rowIndices_;
+
+        std::vector<uint32> colIndices_;
+
+        std::vector<std::string> attributeNames_;
+
+        std::vector<std::vector<std::string>> nominalValues_;
+
+        std::vector<bool> nominal_;
+
+    public:
+
+        /**
+         * @param numRows   The number of rows
+         * @param numCols   The number of columns
+         * @param sparse    True, if the values are stored in the CSC format, false, if they are stored in a
+         *                  Fortran-contiguous array
+         * @param numValues The number of values to be stored
+         */
+        ArffData(uint32 numRows, uint32 numCols, bool sparse, uint32 numValues);
+
+        /**
+         * Returns the number of rows, i.e., the number of instances.
+         *
+         * @return The number of rows
+         */
+        uint32 getNumRows() const;
+
+        /**
+         * Returns the number of columns, i.e., the number of attributes.
+         *
+         * @return The number of columns
+         */
+        uint32 getNumCols() const;
+
+        /**
+         * Returns whether the values are stored in the CSC format or not.
+         *
+         * @return True, if the values are stored in the CSC format, false, if they are stored in a Fortran-contiguous
+         *         array
+         */
+        bool isSparse() const;
+
+        /**
+         * Returns the number of values that are stored.
+         *
+         * @return The number of values
+         */
+        uint32 getNumValues() const;
+
+        /**
+         * Returns a pointer to an array of type `float32`, shape `(numValues)`, that stores the values. If the values
+         * are stored in a Fortran-contiguous array, the array has shape `(numRows, numCols)`.
+         *
+         * @return A pointer to the array
+         */
+        float32* getValues();
+
+        /**
+         * Returns a pointer to an array of type `uint32`, shape `(numValues)`, that stores the row-indices of the
+         * values, if they are stored in the CSC format.
+         *
+         * @return A pointer to the array
+         */
+        uint32* getRowIndices();
+
+        /**
+         * Returns a pointer to an array of type `uint32`, shape `(numCols + 1)`, that stores the indices of the first
+         * element in `getValues` and `getRowIndices` that corresponds to a certain column, if the values are stored in
+         * the CSC format. The index at the last position is equal to `numValues`.
+         *
+         * @return A pointer to the array
+         */
+        uint32* getColIndices();
+
+        /**
+         * Adds a numerical attribute.
+         *
+         * @param name The name of the attribute
+         */
+        void addAttribute(const std::string& name);
+
+        /**
+         * Adds a nominal attribute.
+         *
+         * @param name      The name of the attribute
+         * @param values    The values of the attribute in the order of their declaration
+         */
+        void addAttribute(const std::string& name, std::vector<std::string>&& values);
+
+        /**
+         * Returns the name of a specific attribute.
+         *
+         * @param attributeIndex    The index of the attribute
+         * @return                  A reference to an object of type `std::string` that stores the name
+         */
+        const std::string& getAttributeName(uint32 attributeIndex) const;
+
+        /**
+         * Returns whether a specific attribute is nominal or not.
+         *
+         * @param attributeIndex    The index of the attribute
+         * @return                  True, if the attribute is nominal, false otherwise
+         */
+        bool isNominal(uint32 attributeIndex) const;
+
+        /**
+         * Returns the values of a specific nominal attribute in the order of their declaration.
+         *
+         * @param attributeIndex    The index of the attribute
+         * @return                  A reference to an object of type `std::vector` that stores the values
+         */
+        const std::vector<std::string>& getNominalValues(uint32 attributeIndex) const;
+
+};
+
+/**
+ * Allows to read data sets from ARFF files that are given in the dense or sparse format. Numerical (`numeric`, `real`
+ * or `integer`) and nominal attributes are supported. The data section of a file is mapped into memory and split into
+ * chunks of lines that are parsed in parallel. Values are written directly into the arrays of an object of type
+ * `ArffData`, without creating intermediate copies of the data set in other formats. Values must not contain line
+ * breaks.
+ */
+class ArffReader final {
+
+    private:
+
+        uint32 numThreads_;
+
+    public:
+
+        /**
+         * @param numThreads The number of CPU threads to be used to parse the file in parallel. Must be at least 1
+         */
+        ArffReader(uint32 numThreads);
+
+        /**
+         * Reads a data set from an ARFF file.
+         *
+         * @param path  The path of the file
+         * @param error A reference to an object of type `std::string`, a description of the error should be written to,
+         *              if the file cannot be read
+         * @return      An unique pointer to an object of type `ArffData` that stores the data set that has been read or
+         *              a null pointer, if the file cannot be read
+         */
+        std::unique_ptr<ArffData> read(const std::string& path, std::string& error) const;
+
+};
@@ -0,0 +1,72 @@
+/*
+ * @author Michael Rapp (mrapp@ke.tu-darmstadt.de)
+ */
+#pragma once
+
+#include <cstdint>
+
+
+/**
+ * The structs that are defined by the Arrow C data interface (see
+ * https://arrow.apache.org/docs/format/CDataInterface.html). They allow to exchange columnar data with other libraries
+ * that implement the interface without depending on the Arrow library. The definitions must not be changed, as they
+ * are part of a stable ABI.
+ */
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+extern "C" {
+
+    struct ArrowSchema {
+
+        const char* format;
+
+        const char* name;
+
+        const char* metadata;
+
+        int64_t flags;
+
+        int64_t n_children;
+
+        struct ArrowSchema** children;
+
+        struct ArrowSchema* dictionary;
+
+        void (*release)(struct ArrowSchema*);
+
+        void* private_data;
+
+    };
+
+    struct ArrowArray {
+
+        int64_t length;
+
+        int64_t null_count;
+
+        int64_t offset;
+
+        int64_t n_buffers;
+
+        int64_t n_children;
+
+        const void** buffers;
+
+        struct ArrowArray** children;
+
+        struct ArrowArray* dictionary;
+
+        void (*release)(struct ArrowArray*);
+
+        void* private_data;
+
+    };
+
+}
+
+#endif
@@ -0,0 +1,257 @@
+/*
+ * @author Michael Rapp (mrapp@ke.tu-darmstadt.de)
+ */
+#pragma once
+
+#include "common/data/types.hpp"
+#include "common/input/arrow.hpp"
+#include <cmath>
+#include <string>
+#include <vector>
+
+
+/**
+ * An enum that specifies all physical types of the values in a column of an `ArrowTable` that are supported.
+ */
+enum ArrowType : uint32 {
+    ARROW_BOOLEAN = 0,
+    ARROW_INT8 = 1,
+    ARROW_INT16 = 2,
+    ARROW_INT32 = 3,
+    ARROW_INT64 = 4,
+    ARROW_UINT8 = 5,
+    ARROW_UINT16 = 6,
+    ARROW_UINT32 = 7,
+    ARROW_UINT64 = 8,
+    ARROW_FLOAT32 = 9,
+    ARROW_FLOAT64 = 10
+};
+
+/**
+ * Provides access to the buffers of a column of an `ArrowTable`.
+ */
+struct ArrowColumn {
+
+    /**
+     * The name of the column.
+     */
+    std::string name;
+
+    /**
+     * The physical type of the values. If the column is dictionary-encoded, this is the type of the indices.
+     */
+    ArrowType type;
+
+    /**
+     * A pointer to the buffer that stores the values.
+     */
+    const void* values;
+
+    /**
+     * A pointer to the bitmap that specifies which values are valid or a null pointer, if all values are valid.
+     */
+    const uint8* validity;
+
+    /**
+     * The position of the first value of the table in `values` and `validity`.
+     */
+    uint64 offset;
+
+    /**
+     * True, if the column is dictionary-encoded, false otherwise.
+     */
+    bool nominal;
+
+    /**
+     * The values of the dictionary, if the column is dictionary-encoded.
+     */
+    std::vector<std::string> nominalValues;
+
+};
+
+/**
+ * A table that provides column-wise access to a record batch, or any other struct array, that has been exported via the
+ * Arrow C data interface. The buffers of the producer are accessed in place, i.e., they are never copied. Columns of
+ * booleans, integers or floating point values are supported, as well as dictionary-encoded columns with string values,
+ * whose indices are used as the values of nominal features. Null values are considered to be missing.
+ *
+ * The table takes ownership of the given structs and releases them when it is destroyed, which allows the producer to
+ * free its buffers.
+ */
+class ArrowTable final {
+
+    private:
+
+        ArrowSchema schema_;
+
+        ArrowArray array_;
+
+        uint32 numRows_;
+
+        std::vector<ArrowColumn> columns_;
+
+        std::string error_;
+
+    public:
+
+        /**
+         * @param schema    A pointer to a struct of type `ArrowSchema` that describes the record batch. Its content is
+         *                  moved into the table and the original struct is marked as released
+         * @param array     A pointer to a struct of type `ArrowArray` that stores the record batch. Its content is
+         *                  moved into the table and the original struct is marked as released
+         */
+        ArrowTable(ArrowSchema* schema, ArrowArray* array);
+
+        ~ArrowTable();
+
+        ArrowTable(const ArrowTable& other) = delete;
+
+        ArrowTable& operator=(const ArrowTable& other) = delete;
+
+        /**
+         * Returns whether the record batch is supported or not.
+         *
+         * @return True, if the record batch is supported, false otherwise
+         */
+        bool isValid() const;
+
+        /**
+         * Returns a description of the reason why the record batch is not supported.
+         *
+         * @return A reference to an object of type `std::string` that stores the description or an empty string, if
+         *         the record batch is supported
+         */
+        const std::string& getError() const;
+
+        /**
+         * Returns the number of rows in the table.
+         *
+         * @return The number of rows
+         */
+        uint32 getNumRows() const;
+
+        /**
+         * Returns the number of columns in the table.
+         *
+         * @return The number of columns
+         */
+        uint32 getNumCols() const;
+
+        /**
+         * Returns a specific column.
+         *
+         * @param columnIndex   The index of the column
+         * @return              A reference to an object of type `ArrowColumn` that provides access to the column
+         */
+        const ArrowColumn& getColumn(uint32 columnIndex) const;
+
+        /**
+         * Copies the values in a specific column, which must store non-negative integers without any missing values,
+         * into an array of type `uint32`.
+         *
+         * @param columnIndex   The index of the column
+         * @param array         A pointer to an array of type `uint32`, the values should be written to
+         * @param stride        The distance between the positions in the array, consecutive values should be written
+         *                      to
+         * @return              True, if the values have been copied successfully, false, if the column does not store
+         *                      integers or if it contains missing values or values that cannot be represented as
+         *                      `uint32`
+         */
+        bool fetchColumn(uint32 columnIndex, uint32* array, uint32 stride) const;
+
+        /**
+         * Invokes a function for each value in a specific column. Missing values are represented by NaN.
+         *
+         * @tparam Function     The type of the function. It must accept the index of a row (`uint32`) and the value at
+         *                      the row (`float32`) as arguments
+         * @param columnIndex   The index of the column
+         * @param function      The function to be invoked
+         */
+        template<class Function>
+        void forEach(uint32 columnIndex, Function function) const;
+
+};
+
+/**
+ * Invokes a function for each value in a buffer of a specific type.
+ *
+ * @tparam T            The type of the values in the buffer
+ * @tparam Function     The type of the function
+ * @param column        A reference to an object of type `ArrowColumn` that provides access to the buffer
+ * @param numRows       The number of rows
+ * @param function      The function to be invoked
+ */
+template<class T, class Function>
+static inline void forEachValue(const ArrowColumn& column, uint32 numRows, Function& function) {
+    const T* values = static_cast<const T*>(column.values) + column.offset;
+    const uint8* validity = column.validity;
+    uint64 offset = column.offset;
+
+    for (uint32 i = 0; i < numRows; i++) {
+        uint64 position = offset + i;
+
+        if (validity != nullptr && !(validity[position >> 3] & (1 << (position & 7)))) {
+            function(i, (float32) NAN);
+        } else {
+            function(i, (float32) values[i]);
+        }
+    }
+}
+
+template<class Function>
+void ArrowTable::forEach(uint32 columnIndex, Function function) const {
+    const ArrowColumn& column = columns_[columnIndex];
+    uint32 numRows = numRows_;
+
+    switch (column.type) {
+        case ARROW_BOOLEAN: {
+            const uint8* values = static_cast<const uint8*>(column.values);
+            const uint8* validity = column.validity;
+            uint64 offset = column.offset;
+
+            for (uint32 i = 0; i < numRows; i++) {
+                uint64 position = offset + i;
+
+                if (validity != nullptr && !(validity[position >> 3] & (1 << (position & 7)))) {
+                    function(i, (float32) NAN);
+                } else {
+                    function(i, (float32) ((values[position >> 3] >> (position & 7)) & 1));
+                }
+            }
+
+            break;
+        }
+        case ARROW_INT8:
+            forEachValue<int8_t>(column, numRows, function);
+            break;
+        case ARROW_INT16:
+            forEachValue<int16_t>(column, numRows, function);
+            break;
+        case ARROW_INT32:
+            forEachValue<int32_t>(column, numRows, function);
+            break;
+        case ARROW_INT64:
+            forEachValue<int64_t>(column, numRows, function);
+            break;
+        case ARROW_UINT8:
+            forEachValue<uint8_t>(column, numRows, function);
+            break;
+        case ARROW_UINT16:
+            forEachValue<uint16_t>(column, numRows, function);
+            break;
+        case ARROW_UINT32:
+            forEachValue<uint32_t>(column, numRows, function);
+            break;
+        case ARROW_UINT64:
+            forEachValue<uint64_t>(column, numRows, function);
+            break;
+        case ARROW_FLOAT32:
+            forEachValue<float>(column, numRows, function);
+            break;
+        case ARROW_FLOAT64:
+            forEachValue<double>(column, numRows, function);
+            break;
+        default:
+            break;
+    }
+}
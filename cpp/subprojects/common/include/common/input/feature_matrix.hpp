@@ -42,4 +42,15 @@ class IFeatureMatrix {
         virtual void fetchFeatureVector(uint32 featureIndex,
                                         std::unique_ptr<FeatureVector>& featureVectorPtr) const = 0;
 
+        /**
+         * Returns a feature vector that stores the indices of the training examples, as well as their feature values,
+         * for a specific feature, sorted by the feature values in increasing order. The feature vector must not be
+         * modified, as it may be shared with other callers.
+         *
+         * @param featureIndex  The index of the feature
+         * @return              A shared pointer to an object of type `FeatureVector` that stores the sorted feature
+         *                      vector
+         */
+        virtual std::shared_ptr<const FeatureVector> fetchSortedFeatureVector(uint32 featureIndex) const = 0;
+
 };
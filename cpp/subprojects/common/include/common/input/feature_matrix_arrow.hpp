@@ -0,0 +1,37 @@
+/*
+ * @author Michael Rapp (mrapp@ke.tu-darmstadt.de)
+ */
+#pragma once
+
+#include "common/input/arrow_table.hpp"
+#include "common/input/feature_matrix.hpp"
+
+
+/**
+ * Implements column-wise read-only access to the feature values of individual training examples that are stored in the
+ * columns of an `ArrowTable`. The feature values are read from the buffers of the producer of the table, i.e., they
+ * are not copied into a separate array beforehand. The values of dictionary-encoded columns are represented by the
+ * indices of the values in the dictionary.
+ */
+class ArrowFeatureMatrix final : public IFeatureMatrix {
+
+    private:
+
+        std::shared_ptr<const ArrowTable> tablePtr_;
+
+    public:
+
+        /**
+         * @param tablePtr A shared pointer to an object of type `ArrowTable` that stores the feature values
+         */
+        ArrowFeatureMatrix(std::shared_ptr<const ArrowTable> tablePtr);
+
+        uint32 getNumRows() const override;
+
+        uint32 getNumCols() const override;
+
+        void fetchFeatureVector(uint32 featureIndex, std::unique_ptr<FeatureVector>& featureVectorPtr) const override;
+
+        std::shared_ptr<const FeatureVector> fetchSortedFeatureVector(uint32 featureIndex) const override;
+
+};
@@ -87,4 +87,6 @@ class CscFeatureMatrix final : public IFeatureMatrix {
 
         void fetchFeatureVector(uint32 featureIndex, std::unique_ptr<FeatureVector>& featureVectorPtr) const override;
 
+        std::shared_ptr<const FeatureVector> fetchSortedFeatureVector(uint32 featureIndex) const override;
+
 };
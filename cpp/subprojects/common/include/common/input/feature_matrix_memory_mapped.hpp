@@ -0,0 +1,69 @@
+/*
+ * @author Michael Rapp (mrapp@ke.tu-darmstadt.de)
+ */
+#pragma once
+
+#include "common/input/feature_matrix.hpp"
+#include <string>
+
+
+/**
+ * A feature matrix that provides column-wise access to the feature values of the training examples, which are stored
+ * in a file that is mapped into memory. Only the parts of the file that correspond to the features that are accessed
+ * are read from disk by the operating system, which allows to use data sets that do not fit into memory.
+ *
+ * The file must start with a header that consists of the magic number `0x4D464C52`, the version of the format, which
+ * must be 1, the number of examples and the number of features (each stored as an `uint32`). The header is followed by
+ * an entry for each feature that consists of the position of the feature's data in the file (`uint64`, must be a
+ * multiple of 4), the number of elements that are stored for the feature (`uint32`) and flags that specify how the
+ * feature is stored (`uint32`). If the flag `1` is not set, the feature is stored in a dense format and its data
+ * consists of the feature values of all examples (`float32`). If it is set, the feature is stored in a sparse format and
+ * its data consists of the indices of the examples with non-zero feature values (`uint32`), followed by their feature
+ * values (`float32`). In both cases, the feature values are followed by a bitmap (one bit per element, least
+ * significant bit first), where set bits indicate missing feature values. If the flag `2` is set, which requires the
+ * flag `1` to be set as well, the elements are sorted by their feature values in increasing order, followed by the
+ * elements with missing feature values. Such features must not be sorted again when they are accessed. All values are
+ * stored in little-endian byte order.
+ */
+class MemoryMappedFeatureMatrix final : public IFeatureMatrix {
+
+    private:
+
+        const uint8* data_;
+
+        uint64 size_;
+
+        uint32 numRows_;
+
+        uint32 numCols_;
+
+    public:
+
+        /**
+         * @param path The path of the file that stores the feature values
+         */
+        MemoryMappedFeatureMatrix(const std::string& path);
+
+        MemoryMappedFeatureMatrix(const MemoryMappedFeatureMatrix& other) = delete;
+
+        MemoryMappedFeatureMatrix& operator=(const MemoryMappedFeatureMatrix& other) = delete;
+
+        ~MemoryMappedFeatureMatrix();
+
+        /**
+         * Returns whether the file has successfully been opened and is well-formed or not. If this is not the case, the
+         * matrix does not provide access to any features.
+         *
+         * @return True, if the file has successfully been opened, false otherwise
+         */
+        bool isOpen() const;
+
+        uint32 getNumRows() const override;
+
+        uint32 getNumCols() const override;
+
+        void fetchFeatureVector(uint32 featureIndex, std::unique_ptr<FeatureVector>& featureVectorPtr) const override;
+
+        std::shared_ptr<const FeatureVector> fetchSortedFeatureVector(uint32 featureIndex) const override;
+
+};
@@ -0,0 +1,42 @@
+/*
+ * @author Michael Rapp (mrapp@ke.tu-darmstadt.de)
+ */
+#pragma once
+
+#include "common/input/feature_matrix.hpp"
+#include <vector>
+
+
+/**
+ * A feature matrix that wraps another feature matrix and sorts the feature values of all features once, when it is
+ * created. The sorted feature vectors are shared by all objects that access them, e.g., by several models that are
+ * trained on the same data concurrently. As the feature matrix is not modified after its creation, it may be accessed
+ * by several threads at the same time.
+ */
+class PresortedFeatureMatrix final : public IFeatureMatrix {
+
+    private:
+
+        std::shared_ptr<IFeatureMatrix> featureMatrixPtr_;
+
+        std::vector<std::shared_ptr<const FeatureVector>> sortedFeatureVectors_;
+
+    public:
+
+        /**
+         * @param featureMatrixPtr  A shared pointer to an object of type `IFeatureMatrix` that provides access to the
+         *                          feature values of the training examples
+         * @param numThreads        The number of CPU threads to be used to sort the feature values of different
+         *                          features in parallel. Must be at least 1
+         */
+        PresortedFeatureMatrix(std::shared_ptr<IFeatureMatrix> featureMatrixPtr, uint32 numThreads);
+
+        uint32 getNumRows() const override;
+
+        uint32 getNumCols() const override;
+
+        void fetchFeatureVector(uint32 featureIndex, std::unique_ptr<FeatureVector>& featureVectorPtr) const override;
+
+        std::shared_ptr<const FeatureVector> fetchSortedFeatureVector(uint32 featureIndex) const override;
+
+};
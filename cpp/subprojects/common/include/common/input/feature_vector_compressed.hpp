@@ -0,0 +1,187 @@
+/*
+ * @author Michael Rapp (mrapp@ke.tu-darmstadt.de)
+ */
+#pragma once
+
+#include "common/input/feature_vector.hpp"
+#include <memory>
+#include <vector>
+
+
+/**
+ * The number of elements in a block of example indices that are encoded by an object of type
+ * `CompressedFeatureVector`.
+ */
+const uint32 COMPRESSED_BLOCK_SIZE = 128;
+
+/**
+ * A compressed representation of a `FeatureVector` that is sorted in ascending order by its values.
+ *
+ * The example indices are split into blocks of `COMPRESSED_BLOCK_SIZE` elements. The indices in each block are either
+ * stored as offsets to the smallest index in the block (frame-of-reference) or as zigzag-encoded differences between
+ * consecutive indices, depending on which one of these representations requires fewer bits per index. The resulting
+ * integers are bit-packed using the minimum number of bits required by the block. The indices of examples with missing
+ * feature values are stored separately.
+ *
+ * As the values are sorted, they are either stored as runs of equal values, consisting of the distinct values and the
+ * position after the last element of each run, or as rank codes, i.e., as bit-packed indices into a table of the
+ * distinct values, or as they are, depending on which one of these representations requires the least memory.
+ *
+ * The compression is lossless, i.e., decompressing the vector results in the same order of indices and values as in
+ * the original vector. The elements can also be accessed without decompressing the entire vector via a
+ * `const_iterator`, which decodes a single block at a time.
+ */
+class CompressedFeatureVector final {
+
+    private:
+
+        /**
+         * Stores the meta data of a block of bit-packed example indices.
+         */
+        struct Block {
+
+            /**
+             * The position of the first word in the array of bit-packed integers that belongs to the block.
+             */
+            uint32 offset;
+
+            /**
+             * The smallest index in the block, if frame-of-reference encoding is used, or the first index in the
+             * block, if delta encoding is used.
+             */
+            uint32 base;
+
+            /**
+             * The number of bits per integer.
+             */
+            uint8 width;
+
+            /**
+             * True, if delta encoding is used, false, if frame-of-reference encoding is used.
+             */
+            bool delta;
+
+        };
+
+        uint32 numElements_;
+
+        std::vector<Block> blocks_;
+
+        std::vector<uint32> words_;
+
+        std::vector<float32> values_;
+
+        std::vector<uint32> runEnds_;
+
+        uint8 codeWidth_;
+
+        std::vector<uint32> codeWords_;
+
+        std::vector<uint32> missingIndices_;
+
+        void decodeBlock(uint32 blockIndex, IndexedValue<float32>* buffer) const;
+
+    public:
+
+        /**
+         * @param featureVector A reference to an object of type `FeatureVector` that should be compressed. It must be
+         *                      sorted in ascending order by its values
+         */
+        CompressedFeatureVector(const FeatureVector& featureVector);
+
+        /**
+         * An iterator that provides random read-only access to the elements in the vector. When an element is
+         * accessed, the block it belongs to is decoded, unless it is the block that has been decoded most recently.
+         * Consequently, traversing the elements in ascending or descending order decodes each block only once.
+         */
+        class BlockIterator final {
+
+            private:
+
+                const CompressedFeatureVector* vector_;
+
+                uint32 blockIndex_;
+
+                IndexedValue<float32> buffer_[COMPRESSED_BLOCK_SIZE];
+
+            public:
+
+                /**
+                 * @param vector A reference to the `CompressedFeatureVector`, the iterator provides access to
+                 */
+                BlockIterator(const CompressedFeatureVector& vector);
+
+                /**
+                 * Returns the element at a specific position. The returned reference remains valid until an element
+                 * that belongs to a different block is accessed.
+                 *
+                 * @param position  The position of the element
+                 * @return          A reference to the element at the given position
+                 */
+                inline const IndexedValue<float32>& operator[](uint32 position) {
+                    uint32 blockIndex = position / COMPRESSED_BLOCK_SIZE;
+
+                    if (blockIndex != blockIndex_) {
+                        vector_->decodeBlock(blockIndex, buffer_);
+                        blockIndex_ = blockIndex;
+                    }
+
+                    return buffer_[position % COMPRESSED_BLOCK_SIZE];
+                }
+
+        };
+
+        /**
+         * An iterator that provides random read-only access to the elements in the vector.
+         */
+        typedef BlockIterator const_iterator;
+
+        /**
+         * An iterator that provides read-only access to the indices of examples with missing feature values.
+         */
+        typedef std::vector<uint32>::const_iterator missing_index_const_iterator;
+
+        /**
+         * Returns a `const_iterator` to the beginning of the vector.
+         *
+         * @return A `const_iterator` to the beginning
+         */
+        const_iterator cbegin() const;
+
+        /**
+         * Returns a `missing_index_const_iterator` to the beginning of the indices of examples with missing feature
+         * values.
+         *
+         * @return A `missing_index_const_iterator` to the beginning
+         */
+        missing_index_const_iterator missing_indices_cbegin() const;
+
+        /**
+         * Returns a `missing_index_const_iterator` to the end of the indices of examples with missing feature values.
+         *
+         * @return A `missing_index_const_iterator` to the end
+         */
+        missing_index_const_iterator missing_indices_cend() const;
+
+        /**
+         * Returns the number of elements in the vector.
+         *
+         * @return The number of elements in the vector
+         */
+        uint32 getNumElements() const;
+
+        /**
+         * Returns the number of bytes that are used to store the compressed vector.
+         *
+         * @return The number of bytes
+         */
+        uint64 getNumBytes() const;
+
+        /**
+         * Decompresses the vector.
+         *
+         * @return An unique pointer to an object of type `FeatureVector` that stores the decompressed vector
+         */
+        std::unique_ptr<FeatureVector> decompress() const;
+
+};
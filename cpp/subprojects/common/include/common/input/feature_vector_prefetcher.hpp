@@ -0,0 +1,133 @@
+/*
+ * @author Michael Rapp (mrapp@ke.tu-darmstadt.de)
+ */
+#pragma once
+
+#include "common/input/feature_matrix.hpp"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+
+/**
+ * Fetches sorted feature vectors from a feature matrix in a background thread, in the order in which they have been
+ * requested, such that they are available when they are needed. At most a certain number of feature vectors that have
+ * been fetched, but not yet been retrieved, are kept in memory at the same time. Requests that have been passed by the
+ * retrieved feature vectors by more than this number of requests are considered to be unused and are discarded. The
+ * same number of feature vectors that have been retrieved most recently are retained, such that they must not be
+ * fetched again if they are retrieved again shortly afterwards. Older ones are evicted once newer ones have been
+ * retrieved. Callers that use a feature vector must therefore hold the shared pointer they have retrieved, rather than
+ * retrieving the feature vector again.
+ *
+ * This allows to search for refinements of rules based on feature matrices that do not fit into memory, e.g., objects
+ * of type `MemoryMappedFeatureMatrix`, whose feature vectors are read from disk while other feature vectors are
+ * processed.
+ */
+class FeatureVectorPrefetcher final {
+
+    private:
+
+        std::shared_ptr<IFeatureMatrix> featureMatrixPtr_;
+
+        uint32 windowSize_;
+
+        std::mutex mutex_;
+
+        std::condition_variable condition_;
+
+        /**
+         * A feature vector that has been fetched in the background, but not yet been retrieved.
+         */
+        struct WindowEntry {
+
+            /**
+             * A shared pointer to an object of type `FeatureVector` that stores the feature vector.
+             */
+            std::shared_ptr<const FeatureVector> vectorPtr;
+
+            /**
+             * The position of the corresponding request in the order in which the feature vectors have been requested.
+             */
+            uint32 requestIndex;
+
+        };
+
+        std::deque<std::pair<uint32, uint32>> queue_;
+
+        std::unordered_set<uint32> queuedFeatureIndices_;
+
+        std::unordered_map<uint32, WindowEntry> window_;
+
+        std::unordered_map<uint32, std::shared_ptr<const FeatureVector>> retained_;
+
+        std::deque<uint32> retainedOrder_;
+
+        uint32 numRequests_;
+
+        uint32 numPassedRequests_;
+
+        bool loading_;
+
+        uint32 loadingFeatureIndex_;
+
+        uint32 generation_;
+
+        bool stopped_;
+
+        std::thread thread_;
+
+        void run();
+
+        bool isPassed(uint32 requestIndex) const;
+
+        void evictPassedEntries();
+
+        std::shared_ptr<const FeatureVector> retain(uint32 featureIndex,
+                                                    std::shared_ptr<const FeatureVector> featureVectorPtr);
+
+    public:
+
+        /**
+         * @param featureMatrixPtr  A shared pointer to an object of type `IFeatureMatrix` that provides access to the
+         *                          feature values of the training examples
+         * @param windowSize        The maximum number of feature vectors that have been fetched, but not yet been
+         *                          retrieved, as well as the number of feature vectors that have been retrieved most
+         *                          recently, to be kept in memory at the same time. Must be at least 1
+         */
+        FeatureVectorPrefetcher(std::shared_ptr<IFeatureMatrix> featureMatrixPtr, uint32 windowSize);
+
+        FeatureVectorPrefetcher(const FeatureVectorPrefetcher& other) = delete;
+
+        FeatureVectorPrefetcher& operator=(const FeatureVectorPrefetcher& other) = delete;
+
+        ~FeatureVectorPrefetcher();
+
+        /**
+         * Requests the sorted feature vector that corresponds to a specific feature to be fetched in the background.
+         * Requests for features that have already been requested or retrieved are ignored.
+         *
+         * @param featureIndex The index of the feature
+         */
+        void prefetch(uint32 featureIndex);
+
+        /**
+         * Discards all feature vectors that have been requested, fetched or retrieved.
+         */
+        void clear();
+
+        /**
+         * Retrieves the sorted feature vector that corresponds to a specific feature. If the feature vector has been
+         * retrieved recently and is still retained, it is returned without fetching it again. If it is currently fetched in the
+         * background, the function waits until it is available. If it has not been requested, or if its request has
+         * not been processed yet, it is fetched by the calling thread. This function may be called concurrently.
+         *
+         * @param featureIndex  The index of the feature
+         * @return              A shared pointer to an object of type `FeatureVector` that stores the sorted feature
+         *                      vector
+         */
+        std::shared_ptr<const FeatureVector> get(uint32 featureIndex);
+
+};
@@ -11,6 +11,8 @@ class IStatisticsProvider;
 class IStatisticsProviderFactory;
 class IPartitionSampling;
 class IPartitionSamplingFactory;
+class IInstanceSubSampling;
+class IInstanceSubSamplingFactory;
 class SinglePartition;
 class BiPartition;
 
@@ -66,4 +68,30 @@ class ILabelMatrix {
         virtual std::unique_ptr<IPartitionSampling> createPartitionSampling(
             const IPartitionSamplingFactory& factory) const = 0;
 
+        /**
+         * Creates and returns a new instance of the class `IInstanceSubSampling`, based on the type of this label
+         * matrix.
+         *
+         * @param factory   A reference to an object of type `IInstanceSubSamplingFactory` that should be used to create
+         *                  the instance
+         * @param partition A reference to an object of type `SinglePartition` that provides access to the indices of
+         *                  the training examples that are included in the training set
+         * @return          An unique pointer to an object of type `IInstanceSubSampling` that has been created
+         */
+        virtual std::unique_ptr<IInstanceSubSampling> createInstanceSubSampling(
+            const IInstanceSubSamplingFactory& factory, const SinglePartition& partition) const = 0;
+
+        /**
+         * Creates and returns a new instance of the class `IInstanceSubSampling`, based on the type of this label
+         * matrix.
+         *
+         * @param factory   A reference to an object of type `IInstanceSubSamplingFactory` that should be used to create
+         *                  the instance
+         * @param partition A reference to an object of type `BiPartition` that provides access to the indices of the
+         *                  training examples that are included in the training set and the holdout set, respectively
+         * @return          An unique pointer to an object of type `IInstanceSubSampling` that has been created
+         */
+        virtual std::unique_ptr<IInstanceSubSampling> createInstanceSubSampling(
+            const IInstanceSubSamplingFactory& factory, BiPartition& partition) const = 0;
+
 };
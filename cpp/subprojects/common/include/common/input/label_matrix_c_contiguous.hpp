@@ -7,31 +7,126 @@
 #include "common/data/functions.hpp"
 #include "common/input/label_matrix.hpp"
 #include "common/data/vector_dense.hpp"
+#include <memory>
 
 
 /**
- * Implements random read-only access to the labels of individual training examples that are stored in a pre-allocated
- * C-contiguous array.
+ * The maximum number of time slots, whose indices can be stored using the type `uint16`.
+ */
+const uint32 MAX_NUM_COMPACT_TIME_SLOTS = 65536;
+
+/**
+ * Implements random read-only access to the labels of individual training examples, i.e., to the time slots the
+ * examples belong to, as well as to the ground truth of the individual time slots. The indices of the time slots are
+ * either stored using the type `uint32` or, if there are at most `MAX_NUM_COMPACT_TIME_SLOTS` time slots, using the
+ * more compact type `uint16`.
  */
 class CContiguousLabelMatrix final : public ILabelMatrix {
 
     private:
 
-        DenseVector<uint32> timeSlots_;
+        uint32 numRows_;
+
+        uint32 numTimeSlots_;
+
+        std::unique_ptr<DenseVector<uint32>> timeSlotVectorPtr_;
+
+        std::unique_ptr<DenseVector<uint16>> compactTimeSlotVectorPtr_;
+
+        std::unique_ptr<DenseVector<uint32>> valueVectorPtr_;
+
+        const uint32* timeSlots_;
+
+        const uint16* compactTimeSlots_;
+
+        const uint32* values_;
 
         DenseVector<uint32> indices_;
 
-        DenseVector<uint32> values_;
+        uint32 numSubsetRows_;
+
+        const uint32* subsetIndices_;
 
     public:
 
         /**
          * @param numRows   The number of rows in the label matrix
          * @param numCols   The number of columns in the label matrix
-         * @param array     A pointer to a C-contiguous array of type `uint32` that stores the labels
+         * @param array     A pointer to a C-contiguous array of type `uint32` that stores the labels. The first column
+         *                  must store the time slot and the second one the ground truth of the time slot each example
+         *                  belongs to. Consecutive examples with the same time slot are considered to belong to the
+         *                  same time slot. The indices of the time slots are stored using the type `uint16`, if
+         *                  possible
          */
         CContiguousLabelMatrix(uint32 numRows, uint32 numCols, const uint32* array);
 
+        /**
+         * Creates a label matrix that provides access to arrays that are owned by the caller, i.e., the arrays are not
+         * copied and must not be freed as long as the label matrix is in use.
+         *
+         * @param numRows       The number of rows in the label matrix
+         * @param numTimeSlots  The number of time slots
+         * @param timeSlots     A pointer to an array of type `uint32`, shape `(numRows)`, that stores the index of the
+         *                      time slot each example belongs to. The indices must be in increasing order and must be
+         *                      less than `numTimeSlots`
+         * @param values        A pointer to an array of type `uint32`, shape `(numTimeSlots)`, that stores the ground
+         *                      truth of each time slot
+         */
+        CContiguousLabelMatrix(uint32 numRows, uint32 numTimeSlots, const uint32* timeSlots, const uint32* values);
+
+        /**
+         * Creates a label matrix that provides access to arrays that are owned by the caller, i.e., the arrays are not
+         * copied and must not be freed as long as the label matrix is in use.
+         *
+         * @param numRows       The number of rows in the label matrix
+         * @param numTimeSlots  The number of time slots. Must be at most `MAX_NUM_COMPACT_TIME_SLOTS`
+         * @param timeSlots     A pointer to an array of type `uint16`, shape `(numRows)`, that stores the index of the
+         *                      time slot each example belongs to. The indices must be in increasing order and must be
+         *                      less than `numTimeSlots`
+         * @param values        A pointer to an array of type `uint32`, shape `(numTimeSlots)`, that stores the ground
+         *                      truth of each time slot
+         */
+        CContiguousLabelMatrix(uint32 numRows, uint32 numTimeSlots, const uint16* timeSlots, const uint32* values);
+
+        /**
+         * Creates a label matrix that provides access to arrays that are owned by the caller and only includes a subset
+         * of the examples, e.g., the training examples of a single cross validation fold, in the training data. The
+         * remaining examples keep their indices, such that the feature values of all examples can be used as they
+         * are, but they must not affect the predictions of a model.
+         *
+         * @param numRows           The number of rows in the label matrix
+         * @param numTimeSlots      The number of time slots that contain at least one example in the subset
+         * @param timeSlots         A pointer to an array of type `uint32`, shape `(numRows)`, that stores the index of
+         *                          the time slot each example belongs to. The indices must be in increasing order and
+         *                          must be less than `numTimeSlots`
+         * @param values            A pointer to an array of type `uint32`, shape `(numTimeSlots)`, that stores the
+         *                          ground truth of each time slot
+         * @param numSubsetRows     The number of examples in the subset
+         * @param subsetIndices     A pointer to an array of type `uint32`, shape `(numSubsetRows)`, that stores the
+         *                          indices of the examples in the subset in increasing order
+         */
+        CContiguousLabelMatrix(uint32 numRows, uint32 numTimeSlots, const uint32* timeSlots, const uint32* values,
+                               uint32 numSubsetRows, const uint32* subsetIndices);
+
+        /**
+         * Creates a label matrix that provides access to arrays that are owned by the caller and only includes a subset
+         * of the examples in the training data.
+         *
+         * @param numRows           The number of rows in the label matrix
+         * @param numTimeSlots      The number of time slots that contain at least one example in the subset. Must be
+         *                          at most `MAX_NUM_COMPACT_TIME_SLOTS`
+         * @param timeSlots         A pointer to an array of type `uint16`, shape `(numRows)`, that stores the index of
+         *                          the time slot each example belongs to. The indices must be in increasing order and
+         *                          must be less than `numTimeSlots`
+         * @param values            A pointer to an array of type `uint32`, shape `(numTimeSlots)`, that stores the
+         *                          ground truth of each time slot
+         * @param numSubsetRows     The number of examples in the subset
+         * @param subsetIndices     A pointer to an array of type `uint32`, shape `(numSubsetRows)`, that stores the
+         *                          indices of the examples in the subset in increasing order
+         */
+        CContiguousLabelMatrix(uint32 numRows, uint32 numTimeSlots, const uint16* timeSlots, const uint32* values,
+                               uint32 numSubsetRows, const uint32* subsetIndices);
+
         /**
          * An iterator that provides read-only access to the values in the label matrix.
          */
@@ -39,10 +134,48 @@ class CContiguousLabelMatrix final : public ILabelMatrix {
 
         typedef DenseVector<uint32>::const_iterator index_const_iterator;
 
+        typedef DenseVector<uint16>::const_iterator compact_index_const_iterator;
+
+        /**
+         * Returns whether the indices of the time slots are stored using the type `uint16` or not.
+         *
+         * @return True, if the indices are stored using the type `uint16`, false, if they are stored using the type
+         *         `uint32`
+         */
+        bool hasCompactTimeSlots() const;
+
+        /**
+         * Returns an `index_const_iterator` to the beginning of the indices of the time slots the examples belong to.
+         * May only be used if the function `hasCompactTimeSlots` returns false.
+         *
+         * @return An `index_const_iterator` to the beginning
+         */
         index_const_iterator time_slots_cbegin() const;
 
+        /**
+         * Returns an `index_const_iterator` to the end of the indices of the time slots the examples belong to. May
+         * only be used if the function `hasCompactTimeSlots` returns false.
+         *
+         * @return An `index_const_iterator` to the end
+         */
         index_const_iterator time_slots_cend() const;
 
+        /**
+         * Returns a `compact_index_const_iterator` to the beginning of the indices of the time slots the examples
+         * belong to. May only be used if the function `hasCompactTimeSlots` returns true.
+         *
+         * @return A `compact_index_const_iterator` to the beginning
+         */
+        compact_index_const_iterator compact_time_slots_cbegin() const;
+
+        /**
+         * Returns a `compact_index_const_iterator` to the end of the indices of the time slots the examples belong to.
+         * May only be used if the function `hasCompactTimeSlots` returns true.
+         *
+         * @return A `compact_index_const_iterator` to the end
+         */
+        compact_index_const_iterator compact_time_slots_cend() const;
+
         value_const_iterator values_cbegin() const;
 
         value_const_iterator values_cend() const;
@@ -51,6 +184,37 @@ class CContiguousLabelMatrix final : public ILabelMatrix {
 
         index_const_iterator indices_cend() const;
 
+        /**
+         * Returns whether the label matrix only includes a subset of the examples in the training data or not.
+         *
+         * @return True, if only a subset of the examples is included, false otherwise
+         */
+        bool isSubset() const;
+
+        /**
+         * Returns an `index_const_iterator` to the beginning of the indices of the examples in the subset. May only be
+         * used if the function `isSubset` returns true.
+         *
+         * @return An `index_const_iterator` to the beginning
+         */
+        index_const_iterator subset_indices_cbegin() const;
+
+        /**
+         * Returns an `index_const_iterator` to the end of the indices of the examples in the subset. May only be used
+         * if the function `isSubset` returns true.
+         *
+         * @return An `index_const_iterator` to the end
+         */
+        index_const_iterator subset_indices_cend() const;
+
+        /**
+         * Returns the number of examples that are included in the training data. If the label matrix only includes a
+         * subset of the examples, this is less than the number of rows.
+         *
+         * @return The number of examples
+         */
+        uint32 getNumSubsetRows() const;
+
         uint32 getNumRows() const override;
 
         uint32 getNumCols() const override;
@@ -63,4 +227,10 @@ class CContiguousLabelMatrix final : public ILabelMatrix {
         std::unique_ptr<IPartitionSampling> createPartitionSampling(
             const IPartitionSamplingFactory& factory) const override;
 
+        std::unique_ptr<IInstanceSubSampling> createInstanceSubSampling(
+            const IInstanceSubSamplingFactory& factory, const SinglePartition& partition) const override;
+
+        std::unique_ptr<IInstanceSubSampling> createInstanceSubSampling(
+            const IInstanceSubSamplingFactory& factory, BiPartition& partition) const override;
+
 };
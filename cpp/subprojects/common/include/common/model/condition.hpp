@@ -5,6 +5,9 @@
 
 #include "common/data/types.hpp"
 
+// Forward declarations
+class CheckpointWriter;
+class CheckpointReader;
 
 /**
  * An enum that specifies all possible types of operators used by a condition of a rule.
@@ -68,4 +71,18 @@ class Condition {
          */
         uint32 numCovered;
 
+        /**
+         * Serializes the condition into the binary format that is used to exchange it with other processes.
+         *
+         * @param writer A reference to an object of type `CheckpointWriter`, the condition should be written to
+         */
+        void serialize(CheckpointWriter& writer) const;
+
+        /**
+         * Restores the condition from the binary format that is used to exchange it with other processes.
+         *
+         * @param reader A reference to an object of type `CheckpointReader`, the condition should be read from
+         */
+        void deserialize(CheckpointReader& reader);
+
 };
@@ -0,0 +1,150 @@
+/*
+ * @author Michael Rapp (mrapp@ke.tu-darmstadt.de)
+ */
+#pragma once
+
+#include "common/data/types.hpp"
+#include <string>
+#include <vector>
+
+
+/**
+ * Allows to serialize the state of the induction of rules into a compact binary format, consisting of the raw bytes of
+ * individual values, and to write it to a file. The same format is used for the messages that are exchanged with other
+ * processes.
+ */
+class CheckpointWriter final {
+
+    private:
+
+        std::vector<uint8> buffer_;
+
+    public:
+
+        /**
+         * Appends a single value.
+         *
+         * @tparam T    The type of the value
+         * @param value The value to be appended
+         */
+        template<class T>
+        void write(T value);
+
+        /**
+         * Appends several values that are stored in an array.
+         *
+         * @tparam T            The type of the values
+         * @param array         A pointer to an array of template type `T`, shape `(numElements)`, that stores the
+         *                      values to be appended
+         * @param numElements   The number of values to be appended
+         */
+        template<class T>
+        void writeArray(const T* array, uint32 numElements);
+
+        /**
+         * Appends all values that have been appended to another writer.
+         *
+         * @param writer A reference to an object of type `CheckpointWriter` that stores the values to be appended
+         */
+        void append(const CheckpointWriter& writer);
+
+        /**
+         * Returns the number of bytes that have been appended so far.
+         *
+         * @return The number of bytes
+         */
+        uint32 getNumBytes() const;
+
+        /**
+         * Returns a pointer to the bytes that have been appended so far.
+         *
+         * @return A pointer to an array of type `uint8`, shape `(getNumBytes())`, that stores the bytes
+         */
+        const uint8* getData() const;
+
+        /**
+         * Discards all values that have been appended so far.
+         */
+        void clear();
+
+        /**
+         * Writes all values that have been appended so far to a file. The values are written to a temporary file first,
+         * which is flushed to the disk and replaces the given file afterwards, such that an existing file is never left
+         * in an incomplete state.
+         *
+         * @param path  The path of the file
+         * @return      True, if the file has been written successfully, false otherwise
+         */
+        bool save(const std::string& path) const;
+
+};
+
+/**
+ * Allows to read values from a file, or a message, that has been written by a `CheckpointWriter`.
+ */
+class CheckpointReader final {
+
+    private:
+
+        std::vector<uint8> buffer_;
+
+        uint32 position_;
+
+        bool valid_;
+
+    public:
+
+        CheckpointReader();
+
+        /**
+         * Reads all values from a file.
+         *
+         * @param path  The path of the file
+         * @return      True, if the file has been read successfully, false otherwise
+         */
+        bool load(const std::string& path);
+
+        /**
+         * Discards all values and provides space for a specific number of bytes that must be written to the returned
+         * array before the values can be read, e.g., the bytes of a message that has been received from another process.
+         *
+         * @param numBytes  The number of bytes
+         * @return          A pointer to an array of type `uint8`, shape `(numBytes)`, the bytes should be written to
+         */
+        uint8* allocate(uint32 numBytes);
+
+        /**
+         * Reads the next value.
+         *
+         * @tparam T    The type of the value
+         * @return      The value that has been read or 0, if no more values are available
+         */
+        template<class T>
+        T read();
+
+        /**
+         * Reads several values and stores them in an array.
+         *
+         * @tparam T            The type of the values
+         * @param array         A pointer to an array of template type `T`, shape `(numElements)`, the values should be
+         *                      written to
+         * @param numElements   The number of values to be read
+         */
+        template<class T>
+        void readArray(T* array, uint32 numElements);
+
+        /**
+         * Returns the number of bytes that have not been read yet.
+         *
+         * @return The number of bytes
+         */
+        uint32 getNumRemainingBytes() const;
+
+        /**
+         * Returns whether all values that have been read so far have been available or not.
+         *
+         * @return True, if all values have been available, false otherwise
+         */
+        bool isValid() const;
+
+};
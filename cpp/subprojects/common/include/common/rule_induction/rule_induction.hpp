@@ -9,6 +9,7 @@
 #include "common/sampling/weight_vector.hpp"
 #include "common/sampling/partition.hpp"
 #include "common/statistics/statistics_provider.hpp"
+#include "common/stopping/cancellation_token.hpp"
 #include "common/thresholds/thresholds.hpp"
 #include <utility>
 
@@ -36,7 +37,7 @@ class IRuleInduction {
          */
         virtual void induceDefaultRule(IStatisticsProvider& statisticsProvider,
                                        const IHeadRefinementFactory* headRefinementFactory,
-                                       IModelBuilder& modelBuilder) const = 0;
+                                       IModelBuilder& modelBuilder) = 0;
 
         /**
          * Induces a new rule.
@@ -56,11 +57,29 @@ class IRuleInduction {
          *                                  generator to be used
          * @param modelBuilder              A reference to an object of type `IModelBuilder`, the rule should be added
          *                                  to
+         * @param currentQuality            The quality of the current model
+         * @param cancellationToken         A reference to an object of type `CancellationToken` that is checked while
+         *                                  searching for the conditions of the rule. If the induction of rules has been
+         *                                  canceled, no rule is induced
          * @return                          True, if a rule has been induced, false otherwise
          */
         virtual std::pair<bool, float64> induceRule(IThresholds& thresholds, const IIndexVector& labelIndices,
                                 const IWeightVector& weights, IPartition& partition,
                                 IFeatureSubSampling& featureSubSampling, RNG& rng, IModelBuilder& modelBuilder,
-                                float64 currentQuality) const = 0;
+                                float64 currentQuality, const CancellationToken& cancellationToken) = 0;
+
+        /**
+         * Writes the state of the algorithm, which is needed to resume the induction of rules from a checkpoint.
+         *
+         * @param writer A reference to an object of type `CheckpointWriter`, the state should be written to
+         */
+        virtual void writeState(CheckpointWriter& writer) const = 0;
+
+        /**
+         * Restores the state of the algorithm from a checkpoint.
+         *
+         * @param reader A reference to an object of type `CheckpointReader`, the state should be read from
+         */
+        virtual void readState(CheckpointReader& reader) = 0;
 
 };
@@ -0,0 +1,73 @@
+/*
+ * @author Michael Rapp (mrapp@ke.tu-darmstadt.de)
+ */
+#pragma once
+
+#include "common/rule_induction/rule_induction.hpp"
+#include <queue>
+
+
+/**
+ * Allows to induce classification rules using a top-down greedy search, where the search for the first condition of
+ * several consecutive rules is based on a single scan of the sampled features. Among the first conditions that have
+ * been found for the individual features, up to `batchSize` ones are retained, such that the examples they cover do not
+ * overlap by more than a certain fraction. The retained conditions serve as the starting points of the following rules.
+ * Each one of them is re-evaluated with respect to the updated statistics, which only requires to consider a single
+ * feature, instead of scanning all features again. A rule is only added to the model if it improves the quality of the
+ * model. Once all retained conditions have been used, the next rule is induced by scanning all sampled features again.
+ *
+ * Only the search for the first condition of a rule benefits from the shared scan. The following conditions are found
+ * by scanning all sampled features, as usual. However, these scans only consider the examples that are covered by the
+ * rule, whereas the search for the first condition must consider all examples and is therefore typically the most
+ * expensive one. The rules of a batch cannot be refined jointly, because each rule must be refined with respect to the
+ * statistics that result from applying the preceding ones.
+ */
+class BatchRuleInduction final : public IRuleInduction {
+
+    private:
+
+        uint32 batchSize_;
+
+        float32 maxOverlap_;
+
+        float32 minSupport_;
+
+        intp maxConditions_;
+
+        uint32 numThreads_;
+
+        std::queue<Condition> pendingConditions_;
+
+    public:
+
+        /**
+         * @param batchSize                 The maximum number of rules to be induced based on a single scan of the
+         *                                  sampled features. Must be at least 1
+         * @param maxOverlap                The maximum fraction of the examples covered by the first condition of a
+         *                                  rule that may also be covered by the first conditions of the preceding rules
+         *                                  in the same batch. Must be in [0, 1]
+         * @param minSupport                The minimum fraction of the training examples that must be covered by a
+         *                                  rule. Must be in [0, 1)
+         * @param maxConditions             The maximum number of conditions to be included in a rule's body. Must be at
+         *                                  least 1 or -1, if the number of conditions should not be restricted
+         * @param numThreads                The number of CPU threads to be used to search for potential refinements of
+         *                                  a rule in parallel. Must be at least 1
+         */
+        BatchRuleInduction(uint32 batchSize, float32 maxOverlap, float32 minSupport, intp maxConditions,
+                           uint32 numThreads);
+
+        void induceDefaultRule(IStatisticsProvider& statisticsProvider,
+                               const IHeadRefinementFactory* headRefinementFactory,
+                               IModelBuilder& modelBuilder) override;
+
+        std::pair<bool, float64> induceRule(IThresholds& thresholds, const IIndexVector& labelIndices,
+                                            const IWeightVector& weights, IPartition& partition,
+                                            IFeatureSubSampling& featureSubSampling, RNG& rng,
+                                            IModelBuilder& modelBuilder, float64 currentQuality,
+                                            const CancellationToken& cancellationToken) override;
+
+        void writeState(CheckpointWriter& writer) const override;
+
+        void readState(CheckpointReader& reader) override;
+
+};
@@ -0,0 +1,57 @@
+/*
+ * @author Michael Rapp (mrapp@ke.tu-darmstadt.de)
+ */
+#pragma once
+
+#include "common/rule_induction/rule_induction.hpp"
+
+
+/**
+ * Allows to induce classification rules using a top-down beam search, where new conditions are added iteratively to
+ * the (initially empty) bodies of several candidate rules. At each iteration, the refinements of all rules that are
+ * contained by the beam are taken into account and the `beamWidth` best ones are retained. The search stops if none of
+ * the rules in the beam can be improved anymore. The best rule that has been encountered during the search is induced.
+ * The refinements of all rules in the beam are searched for concurrently. Refinements that result in the same conditions
+ * as a better one, albeit in a different order, are not retained.
+ */
+class BeamSearchRuleInduction final : public IRuleInduction {
+
+    private:
+
+        uint32 beamWidth_;
+
+        float32 minSupport_;
+
+        intp maxConditions_;
+
+        uint32 numThreads_;
+
+    public:
+
+        /**
+         * @param beamWidth                 The maximum number of rules to be retained at each iteration. Must be at
+         *                                  least 1
+         * @param minSupport                The minimum fraction of the training examples that must be covered by a
+         *                                  rule. Must be in [0, 1)
+         * @param maxConditions             The maximum number of conditions to be included in a rule's body. Must be at
+         *                                  least 1 or -1, if the number of conditions should not be restricted
+         * @param numThreads                The number of CPU threads to be used to search for potential refinements of
+         *                                  the rules in the beam in parallel. Must be at least 1
+         */
+        BeamSearchRuleInduction(uint32 beamWidth, float32 minSupport, intp maxConditions, uint32 numThreads);
+
+        void induceDefaultRule(IStatisticsProvider& statisticsProvider,
+                               const IHeadRefinementFactory* headRefinementFactory,
+                               IModelBuilder& modelBuilder) override;
+
+        std::pair<bool, float64> induceRule(IThresholds& thresholds, const IIndexVector& labelIndices,
+                                            const IWeightVector& weights, IPartition& partition,
+                                            IFeatureSubSampling& featureSubSampling, RNG& rng,
+                                            IModelBuilder& modelBuilder, float64 currentQuality,
+                                            const CancellationToken& cancellationToken) override;
+
+        void writeState(CheckpointWriter& writer) const override;
+
+        void readState(CheckpointReader& reader) override;
+
+};
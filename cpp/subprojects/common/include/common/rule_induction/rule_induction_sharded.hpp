@@ -0,0 +1,76 @@
+/*
+ * @author Michael Rapp (mrapp@ke.tu-darmstadt.de)
+ */
+#pragma once
+
+#include "common/rule_induction/rule_induction.hpp"
+#include "common/distributed/channel.hpp"
+#include <vector>
+
+
+/**
+ * Allows to induce classification rules using a top-down greedy search, like the class `TopDownRuleInduction`, where
+ * the search for refinements is distributed among several worker processes. Each worker is responsible for a shard of
+ * the features, i.e., it maintains the sorted and filtered feature vectors of its features and searches for the best
+ * refinement among them. At each iteration, the best refinements of the individual shards are collected and the best
+ * one among them is chosen. It is applied by the worker that has found it, which reports the examples whose coverage
+ * has changed, such that the other workers can apply it as well without accessing the feature values.
+ *
+ * The workers must be objects of type `ShardWorker` that have been given the same training data and configuration as
+ * the coordinator. The rules are identical to the ones induced by a `TopDownRuleInduction` without screening. If the
+ * communication with a worker fails, a `std::runtime_error` is thrown. Checkpoints are not supported, as the state of
+ * the workers is not part of them.
+ */
+class ShardedRuleInduction final : public IRuleInduction {
+
+    private:
+
+        std::unique_ptr<std::vector<std::shared_ptr<IChannel>>> channelsPtr_;
+
+        float32 minSupport_;
+
+        intp maxConditions_;
+
+        IStatisticsProvider* statisticsProvider_;
+
+        bool initialized_;
+
+        void send(uint32 shardIndex, const CheckpointWriter& message);
+
+        void receive(uint32 shardIndex, CheckpointReader& reply);
+
+        void broadcast(const CheckpointWriter& message, uint32 excludedShard);
+
+    public:
+
+        /**
+         * @param channelsPtr   An unique pointer to a vector that stores a shared pointer to an object of type
+         *                      `IChannel` for each shard that allows to exchange messages with the corresponding worker
+         * @param minSupport    The minimum fraction of the training examples that must be covered by a rule. Must be
+         *                      in [0, 1)
+         * @param maxConditions The maximum number of conditions to be included in a rule's body. Must be at least 1 or
+         *                      -1, if the number of conditions should not be restricted
+         */
+        ShardedRuleInduction(std::unique_ptr<std::vector<std::shared_ptr<IChannel>>> channelsPtr,
+                             float32 minSupport, intp maxConditions);
+
+        /**
+         * Stops all workers.
+         */
+        ~ShardedRuleInduction();
+
+        void induceDefaultRule(IStatisticsProvider& statisticsProvider,
+                               const IHeadRefinementFactory* headRefinementFactory,
+                               IModelBuilder& modelBuilder) override;
+
+        std::pair<bool, float64> induceRule(IThresholds& thresholds, const IIndexVector& labelIndices,
+                                            const IWeightVector& weights, IPartition& partition,
+                                            IFeatureSubSampling& featureSubSampling, RNG& rng,
+                                            IModelBuilder& modelBuilder, float64 currentQuality,
+                                            const CancellationToken& cancellationToken) override;
+
+        void writeState(CheckpointWriter& writer) const override;
+
+        void readState(CheckpointReader& reader) override;
+
+};
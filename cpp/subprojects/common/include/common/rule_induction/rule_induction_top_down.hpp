@@ -10,6 +10,10 @@
  * Allows to induce classification rules using a top-down greedy search, where new conditions are added iteratively to
  * the (initially empty) body of a rule. At each iteration, the refinement that improves the rule the most is chosen.
  * The search stops if no refinement results in an improvement.
+ *
+ * Optionally, the features can be screened before searching for the best refinement. In such case, the quality of the
+ * refinements that can be obtained for each feature is estimated based on a sample of the examples first. Only the
+ * features with the best estimates are taken into account by the exact search afterwards.
  */
 class TopDownRuleInduction : public IRuleInduction {
 
@@ -19,6 +23,10 @@ class TopDownRuleInduction : public IRuleInduction {
 
         intp maxConditions_;
 
+        float32 screeningSampleSize_;
+
+        uint32 numScreenedFeatures_;
+
         uint32 numThreads_;
 
     public:
@@ -28,18 +36,28 @@ class TopDownRuleInduction : public IRuleInduction {
          *                                  rule. Must be in [0, 1)
          * @param maxConditions             The maximum number of conditions to be included in a rule's body. Must be at
          *                                  least 1 or -1, if the number of conditions should not be restricted
+         * @param screeningSampleSize       The fraction of the examples to be used for screening the features. Must be
+         *                                  in (0, 1]. If 1, the features are not screened
+         * @param numScreenedFeatures       The number of features with the best estimates to be retained by the
+         *                                  screening. Must be at least 1
          * @param numThreads                The number of CPU threads to be used to search for potential refinements of
          *                                  a rule in parallel. Must be at least 1
          */
-        TopDownRuleInduction(float32 minSupport, intp maxConditions, uint32 numThreads);
+        TopDownRuleInduction(float32 minSupport, intp maxConditions, float32 screeningSampleSize,
+                             uint32 numScreenedFeatures, uint32 numThreads);
 
         void induceDefaultRule(IStatisticsProvider& statisticsProvider,
                                const IHeadRefinementFactory* headRefinementFactory,
-                               IModelBuilder& modelBuilder) const override;
+                               IModelBuilder& modelBuilder) override;
 
         std::pair<bool, float64> induceRule(IThresholds& thresholds, const IIndexVector& labelIndices,
                                             const IWeightVector& weights, IPartition& partition,
                                             IFeatureSubSampling& featureSubSampling, RNG& rng,
-                                            IModelBuilder& modelBuilder, float64 currentQuality) const override;
+                                            IModelBuilder& modelBuilder, float64 currentQuality,
+                                            const CancellationToken& cancellationToken) override;
+
+        void writeState(CheckpointWriter& writer) const override;
+
+        void readState(CheckpointReader& reader) override;
 
 };
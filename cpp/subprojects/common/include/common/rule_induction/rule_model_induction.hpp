@@ -37,13 +37,16 @@ class IRuleModelInduction {
          *                              generator to be used
          * @param modelBuilder          A reference to an object of type `IModelBuilder`, the induced rules should be
          *                              added to
+         * @param initialModel          A pointer to an object of type `RuleModel` that contains rules that have been
+         *                              induced previously and should be continued or a null pointer, if the rules
+         *                              should be induced from scratch
          * @return                      An unique pointer to an object of type `RuleModel` that consists of the rules
          *                              that have been induced
          */
         virtual std::unique_ptr<RuleModel> induceRules(std::shared_ptr<INominalFeatureMask> nominalFeatureMaskPtr,
                                                        std::shared_ptr<IFeatureMatrix> featureMatrixPtr,
                                                        std::shared_ptr<ILabelMatrix> labelMatrixPtr, RNG& rng,
-                                                       IModelBuilder& modelBuilder,
+                                                       IModelBuilder& modelBuilder, const RuleModel* initialModel,
                                                        PredictionVisitor groundTruthVisitor,
                                                        PredictionVisitor predictionVisitor) = 0;
 
@@ -10,13 +10,19 @@
 #include "common/sampling/partition_sampling.hpp"
 #include "common/statistics/statistics_provider_factory.hpp"
 #include "common/stopping/stopping_criterion.hpp"
+#include "common/stopping/cancellation_token.hpp"
 #include "common/thresholds/thresholds_factory.hpp"
 #include <forward_list>
+#include <string>
 
 
 /**
  * Allows to sequentially induce several rules, starting with a default rule, that will be added to a resulting
- * `RuleModel`.
+ * `RuleModel`. Optionally, the induction of rules may be continued from an existing `RuleModel`, whose rules are
+ * applied to the training examples first. Furthermore, the state of the induction of rules may periodically be written
+ * to a checkpoint file, such that an interrupted run can be resumed with the same result as an uninterrupted one. A
+ * checkpoint is only used for resuming, if it has been written for the same training data. If a checkpoint cannot be
+ * written, a `std::runtime_error` is thrown.
  */
 class SequentialRuleModelInduction : public IRuleModelInduction {
 
@@ -40,6 +46,18 @@ class SequentialRuleModelInduction : public IRuleModelInduction {
 
         std::unique_ptr<std::forward_list<std::shared_ptr<IStoppingCriterion>>> stoppingCriteriaPtr_;
 
+        std::shared_ptr<CancellationToken> cancellationTokenPtr_;
+
+        uint32 maxInheritedRules_;
+
+        bool verifyInheritedRules_;
+
+        uint32 numThreads_;
+
+        std::string checkpointPath_;
+
+        uint32 checkpointInterval_;
+
     public:
 
         /**
@@ -72,6 +90,21 @@ class SequentialRuleModelInduction : public IRuleModelInduction {
          * @param stoppingCriteriaPtr                   An unique pointer to a list that contains the stopping criteria,
          *                                              which should be used to decide whether additional rules should
          *                                              be induced or not
+         * @param cancellationTokenPtr                  A shared pointer to an object of type `CancellationToken` that
+         *                                              allows to cancel the induction of rules, even while a rule is
+         *                                              being induced
+         * @param maxInheritedRules                     The maximum number of rules to be inherited from an existing
+         *                                              model or 0, if all (used) rules should be inherited
+         * @param verifyInheritedRules                  True, if rules that are inherited from an existing model should
+         *                                              only be retained if they improve the quality of the model with
+         *                                              respect to the current training examples, false otherwise
+         * @param numThreads                            The number of CPU threads to be used to apply the rules that are
+         *                                              inherited from an existing model in parallel. Must be at least 1
+         * @param checkpointPath                        The path of the file, checkpoints should be written to, or an
+         *                                              empty string, if no checkpoints should be written. If the file
+         *                                              exists, the induction of rules is resumed from the checkpoint
+         * @param checkpointInterval                    The number of rules after which a checkpoint should be written.
+         *                                              Must be at least 1
          */
         SequentialRuleModelInduction(
             std::shared_ptr<IStatisticsProviderFactory> statisticsProviderFactoryPtr,
@@ -81,12 +114,16 @@ class SequentialRuleModelInduction : public IRuleModelInduction {
             std::shared_ptr<IInstanceSubSamplingFactory> instanceSubSamplingFactoryPtr,
             std::shared_ptr<IFeatureSubSamplingFactory> featureSubSamplingFactoryPtr,
             std::shared_ptr<IPartitionSamplingFactory> partitionSamplingFactoryPtr,
-            std::unique_ptr<std::forward_list<std::shared_ptr<IStoppingCriterion>>> stoppingCriteriaPtr);
+            std::unique_ptr<std::forward_list<std::shared_ptr<IStoppingCriterion>>> stoppingCriteriaPtr,
+            std::shared_ptr<CancellationToken> cancellationTokenPtr, uint32 maxInheritedRules,
+            bool verifyInheritedRules, uint32 numThreads, const std::string& checkpointPath,
+            uint32 checkpointInterval);
 
         std::unique_ptr<RuleModel> induceRules(std::shared_ptr<INominalFeatureMask> nominalFeatureMaskPtr,
                                                std::shared_ptr<IFeatureMatrix> featureMatrixPtr,
                                                std::shared_ptr<ILabelMatrix> labelMatrixPtr, RNG& rng,
-                                               IModelBuilder& modelBuilder, PredictionVisitor groundTruthVisitor,
+                                               IModelBuilder& modelBuilder, const RuleModel* initialModel,
+                                               PredictionVisitor groundTruthVisitor,
                                                PredictionVisitor predictionVisitor) override;
 
 };
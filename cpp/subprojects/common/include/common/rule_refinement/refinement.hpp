@@ -34,4 +34,20 @@ class Refinement final : public Condition {
          */
         intp previous;
 
+        /**
+         * Serializes the refinement, including the head of the refined rule, into the binary format that is used to
+         * exchange it with other processes.
+         *
+         * @param writer A reference to an object of type `CheckpointWriter`, the refinement should be written to
+         */
+        void serialize(CheckpointWriter& writer) const;
+
+        /**
+         * Restores the refinement, including the head of the refined rule, from the binary format that is used to
+         * exchange it with other processes.
+         *
+         * @param reader A reference to an object of type `CheckpointReader`, the refinement should be read from
+         */
+        void deserialize(CheckpointReader& reader);
+
 };
\ No newline at end of file
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "common/rule_refinement/refinement.hpp"
+#include "common/stopping/cancellation_token.hpp"
 #include <memory>
 
 
@@ -19,13 +20,41 @@ class IRuleRefinement {
         /**
          * Finds the best refinement of an existing rule.
          *
-         * @param currentHead A pointer to an object of type `AbstractEvaluatedPrediction`, representing the head of the
-         *                    existing rule or a null pointer, if no rule exists yet
+         * @param currentHead         A pointer to an object of type `AbstractEvaluatedPrediction`, representing the head
+         *                            of the existing rule or a null pointer, if no rule exists yet
+         * @param minCoverage         The minimum number of examples that must be covered by the refinement
+         * @param cancellationToken   A reference to an object of type `CancellationToken` that is checked periodically
+         *                            while the examples are processed. If the induction of rules has been canceled, the
+         *                            search is aborted and the refinement that has been found so far must be discarded
          */
-        virtual void findRefinement(const AbstractEvaluatedPrediction* currentHead, uint32 minCoverage) = 0;
+        virtual void findRefinement(const AbstractEvaluatedPrediction* currentHead, uint32 minCoverage,
+                                    const CancellationToken& cancellationToken) = 0;
 
         /**
-         * Returns the best refinement that has been found by the function `findRefinement`.
+         * Evaluates a given condition, which has been found previously, with respect to the current statistics, instead
+         * of searching for the best refinement. The condition must use the feature the refinement corresponds to.
+         *
+         * @param condition     A reference to an object of type `Condition` that should be evaluated
+         * @param minCoverage   The minimum number of examples that must be covered by the condition
+         */
+        virtual void evaluateCondition(const Condition& condition, uint32 minCoverage) = 0;
+
+        /**
+         * Estimates the quality score of the best refinement of an existing rule based on a sample of the available
+         * examples. The estimate is much cheaper to compute than the exact search conducted by the function
+         * `findRefinement` and may be used to decide whether the exact search is worthwhile.
+         *
+         * @param sampleSize    The fraction of the available examples to be used for estimating the quality score. Must
+         *                      be in (0, 1]
+         * @param minCoverage   The minimum number of examples that must be covered by the refinement
+         * @return              The estimated quality score or infinity, if no refinement could be evaluated
+         */
+        virtual float64 estimateQuality(float32 sampleSize, uint32 minCoverage) = 0;
+
+        /**
+         * Returns the best refinement that has been found by the function `findRefinement` or the condition that has
+         * been evaluated by the function `evaluateCondition`. If no head could be found for the condition, the head of
+         * the refinement is a null pointer.
          *
          * @return An unique pointer to an object of type `Refinement` that stores information about the best refinement
          *         that has been found
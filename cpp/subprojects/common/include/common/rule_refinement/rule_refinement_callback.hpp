@@ -25,6 +25,10 @@ class IRuleRefinementCallback {
          */
         class Result final {
 
+            private:
+
+                std::shared_ptr<const Vector> vectorPtr_;
+
             public:
 
                 /**
@@ -40,6 +44,21 @@ class IRuleRefinementCallback {
 
                 }
 
+                /**
+                 * @param statistics        A reference to an object of type `IImmutableStatistics` that should be used
+                 *                          to search for potential refinements
+                 * @param weights           A reference to an object of template type `WeightVector` that provides
+                 *                          access to the weights of the elements in `vectorPtr`
+                 * @param vectorPtr         A shared pointer to an object of template type `Vector` that should be used
+                 *                          to search for potential refinements. It is kept alive as long as the result
+                 *                          exists
+                 */
+                Result(const IImmutableStatistics& statistics, const WeightVector& weights,
+                       std::shared_ptr<const Vector> vectorPtr)
+                    : vectorPtr_(vectorPtr), statistics_(statistics), weights_(weights), vector_(*vectorPtr_) {
+
+                }
+
                 /**
                  * A reference to an object of type `IImmutableStatistics` that should be used to search for potential
                  * refinements.
@@ -70,4 +89,30 @@ class IRuleRefinementCallback {
          */
         virtual std::unique_ptr<Result> get() = 0;
 
+        /**
+         * Invokes the callback and returns its result. Unlike the function `get`, the vector is not filtered, i.e., it
+         * contains the elements for all available examples, including the ones that are not covered by the current
+         * rule. Whether an element is covered or not must be checked via the function `isCovered`. This is cheaper
+         * than the function `get`, if only a few elements of the vector are used.
+         *
+         * @return An unique pointer to an object of type `Result` that stores references to the statistics and the
+         *         vector that may be used to search for potential refinements
+         */
+        virtual std::unique_ptr<Result> getUnfiltered() = 0;
+
+        /**
+         * Returns the total number of available examples, including the ones that are not covered by the current rule.
+         *
+         * @return The total number of examples
+         */
+        virtual uint32 getNumExamples() const = 0;
+
+        /**
+         * Returns whether the element at a specific index is covered by the current rule or not.
+         *
+         * @param index The index of the element
+         * @return      True, if the element is covered, false otherwise
+         */
+        virtual bool isCovered(uint32 index) const = 0;
+
 };
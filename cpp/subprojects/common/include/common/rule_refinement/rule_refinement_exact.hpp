@@ -6,10 +6,50 @@
 #include "common/rule_refinement/rule_refinement.hpp"
 #include "common/rule_refinement/rule_refinement_callback.hpp"
 #include "common/input/feature_vector.hpp"
+#include "common/input/feature_vector_compressed.hpp"
 #include "common/sampling/weight_vector.hpp"
 #include "common/head_refinement/head_refinement.hpp"
 
 
+/**
+ * Defines an interface for callbacks that may be invoked by the class `ExactRuleRefinement` in order to retrieve the
+ * data that is required to search for potential refinements. In addition to an uncompressed feature vector, a callback
+ * may provide a feature vector of type `CompressedFeatureVector`, which can be searched without decompressing it.
+ */
+class IExactRuleRefinementCallback : public IRuleRefinementCallback<FeatureVector, IWeightVector> {
+
+    public:
+
+        /**
+         * The data that is provided via the callback's functions `getCompressed` and `getCompressedUnfiltered`.
+         */
+        typedef IRuleRefinementCallback<CompressedFeatureVector, IWeightVector>::Result CompressedResult;
+
+        virtual ~IExactRuleRefinementCallback() { };
+
+        /**
+         * Invokes the callback and returns its result, if the feature vector is available in compressed form and does
+         * not need to be filtered. Otherwise, the function `get` must be used instead.
+         *
+         * @return An unique pointer to an object of type `CompressedResult` that stores references to the statistics
+         *         and the compressed feature vector that may be used to search for potential refinements or a null
+         *         pointer, if no compressed feature vector is available
+         */
+        virtual std::unique_ptr<CompressedResult> getCompressed() = 0;
+
+        /**
+         * Invokes the callback and returns its result, if the feature vector is available in compressed form. Like the
+         * function `getUnfiltered`, the vector is not filtered. Otherwise, the function `getUnfiltered` must be used
+         * instead.
+         *
+         * @return An unique pointer to an object of type `CompressedResult` that stores references to the statistics
+         *         and the compressed feature vector that may be used to search for potential refinements or a null
+         *         pointer, if no compressed feature vector is available
+         */
+        virtual std::unique_ptr<CompressedResult> getCompressedUnfiltered() = 0;
+
+};
+
 /**
  * Allows to find the best refinements of existing rules, which result from adding a new condition that correspond to a
  * certain feature. The thresholds that may be used by the new condition result from the feature values of all training
@@ -33,10 +73,24 @@ class ExactRuleRefinement final : public IRuleRefinement {
 
         bool nominal_;
 
-        std::unique_ptr<IRuleRefinementCallback<FeatureVector, IWeightVector>> callbackPtr_;
+        std::unique_ptr<IExactRuleRefinementCallback> callbackPtr_;
 
         std::unique_ptr<Refinement> refinementPtr_;
 
+        template<class Vector>
+        void findRefinementInternally(const Vector& featureVector, const IImmutableStatistics& statistics,
+                                      const IWeightVector& weights, const AbstractEvaluatedPrediction* currentHead,
+                                      uint32 minCoverage, const CancellationToken& cancellationToken);
+
+        template<class Vector>
+        void evaluateConditionInternally(const Vector& featureVector, const IImmutableStatistics& statistics,
+                                         const IWeightVector& weights, const Condition& condition,
+                                         uint32 minCoverage);
+
+        template<class Vector>
+        float64 estimateQualityInternally(const Vector& featureVector, const IImmutableStatistics& statistics,
+                                          const IWeightVector& weights, float32 sampleSize, uint32 minCoverage);
+
     public:
 
         /**
@@ -48,14 +102,19 @@ class ExactRuleRefinement final : public IRuleRefinement {
          *                          existing rule
          * @param featureIndex      The index of the feature, the new condition corresponds to
          * @param nominal           True, if the feature at index `featureIndex` is nominal, false otherwise
-         * @param callbackPtr       An unique pointer to an object of type `IRuleRefinementCallback` that allows to
-         *                          retrieve a feature vector for the given feature
+         * @param callbackPtr       An unique pointer to an object of type `IExactRuleRefinementCallback` that allows
+         *                          to retrieve a feature vector for the given feature
          */
         ExactRuleRefinement(std::unique_ptr<IHeadRefinement> headRefinementPtr, const T& labelIndices,
                             uint32 numExamples, uint32 featureIndex, bool nominal,
-                            std::unique_ptr<IRuleRefinementCallback<FeatureVector, IWeightVector>> callbackPtr);
+                            std::unique_ptr<IExactRuleRefinementCallback> callbackPtr);
+
+        void findRefinement(const AbstractEvaluatedPrediction* currentHead, uint32 minCoverage,
+                            const CancellationToken& cancellationToken) override;
+
+        void evaluateCondition(const Condition& condition, uint32 minCoverage) override;
 
-        void findRefinement(const AbstractEvaluatedPrediction* currentHead, uint32 minCoverage) override;
+        float64 estimateQuality(float32 sampleSize, uint32 minCoverage) override;
 
         std::unique_ptr<Refinement> pollRefinement() override;
 
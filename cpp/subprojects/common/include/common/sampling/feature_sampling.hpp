@@ -7,6 +7,11 @@
 #include "common/sampling/random.hpp"
 #include <memory>
 
+// Forward declarations
+class CheckpointWriter;
+class CheckpointReader;
+class Refinement;
+
 
 /**
  * Defines an interface for all classes that implement a strategy for sub-sampling features.
@@ -26,6 +31,30 @@ class IFeatureSubSampling {
          */
         virtual const IIndexVector& subSample(RNG& rng) = 0;
 
+        /**
+         * Notifies the sub-sampling about the improvement of a rule's quality score that results from the best
+         * refinement that has been found for a specific feature. This function is called for each feature that has
+         * been contained in a sub-sample once the search for refinements has been completed.
+         *
+         * @param featureIndex  The index of the feature
+         * @param gain          The improvement of the quality score or 0, if no refinement improves the rule
+         */
+        virtual void recordGain(uint32 featureIndex, float64 gain) = 0;
+
+        /**
+         * Writes the state of the sub-sampling, which is needed to resume the induction of rules from a checkpoint.
+         *
+         * @param writer A reference to an object of type `CheckpointWriter`, the state should be written to
+         */
+        virtual void writeState(CheckpointWriter& writer) const = 0;
+
+        /**
+         * Restores the state of the sub-sampling from a checkpoint.
+         *
+         * @param reader A reference to an object of type `CheckpointReader`, the state should be read from
+         */
+        virtual void readState(CheckpointReader& reader) = 0;
+
 };
 
 /**
@@ -46,3 +75,26 @@ class IFeatureSubSamplingFactory {
         virtual std::unique_ptr<IFeatureSubSampling> create(uint32 numFeatures) const = 0;
 
 };
+
+/**
+ * Reports the gain in terms of the quality score that has been achieved by the refinement that has been found for a
+ * feature to an object of type `IFeatureSubSampling`.
+ *
+ * @param featureSubSampling    A reference to an object of type `IFeatureSubSampling`, the gain should be reported to
+ * @param featureIndex          The index of the feature
+ * @param found                 True, if a refinement has been found for the feature, false otherwise
+ * @param qualityScore          The quality score of the refinement
+ * @param baselineQuality       The quality score, the quality score of the refinement should be compared to
+ */
+void recordGain(IFeatureSubSampling& featureSubSampling, uint32 featureIndex, bool found, float64 qualityScore,
+                float64 baselineQuality);
+
+/**
+ * Reports the gain in terms of the quality score that has been achieved by a refinement to an object of type
+ * `IFeatureSubSampling`.
+ *
+ * @param featureSubSampling    A reference to an object of type `IFeatureSubSampling`, the gain should be reported to
+ * @param refinement            A reference to an object of type `Refinement` that has been found for a feature
+ * @param baselineQuality       The quality score, the quality score of the refinement should be compared to
+ */
+void recordGain(IFeatureSubSampling& featureSubSampling, const Refinement& refinement, float64 baselineQuality);
@@ -0,0 +1,40 @@
+/*
+ * @author Michael Rapp (mrapp@ke.tu-darmstadt.de)
+ */
+#pragma once
+
+#include "common/sampling/feature_sampling.hpp"
+
+
+/**
+ * Allows to create instances of the type `IFeatureSubSampling` that select a subset of the available features without
+ * replacement, where the probability of a feature to be selected is proportional to the gains in terms of the rules'
+ * quality scores that have been achieved by the feature in the past. To ensure that all features are explored, a
+ * certain fraction of the probability mass is distributed uniformly among all features.
+ */
+class AdaptiveFeatureSubsetSelectionFactory final : public IFeatureSubSamplingFactory {
+
+    private:
+
+        float32 sampleSize_;
+
+        float32 decay_;
+
+        float32 explorationRate_;
+
+    public:
+
+        /**
+         * @param sampleSize        The fraction of features to be included in the sample (e.g. a value of 0.6
+         *                          corresponds to 60 % of the available features). Must be in (0, 1) or 0, if the
+         *                          default sample size `floor(log2(num_features - 1) + 1)` should be used
+         * @param decay             The factor, the gain that is recorded for a feature is multiplied by each time the
+         *                          feature is used, before it is replaced by a greater gain. Must be in [0, 1]
+         * @param explorationRate   The fraction of the probability mass to be distributed uniformly among all
+         *                          features. Must be in (0, 1]
+         */
+        AdaptiveFeatureSubsetSelectionFactory(float32 sampleSize, float32 decay, float32 explorationRate);
+
+        std::unique_ptr<IFeatureSubSampling> create(uint32 numFeatures) const override;
+
+};
@@ -8,8 +8,11 @@
 #include <memory>
 
 // Forward declarations
+class CContiguousLabelMatrix;
 class BiPartition;
 class SinglePartition;
+class CheckpointWriter;
+class CheckpointReader;
 
 
 /**
@@ -30,6 +33,20 @@ class IInstanceSubSampling {
          */
         virtual const IWeightVector& subSample(RNG& rng) = 0;
 
+        /**
+         * Writes the state of the sub-sampling, which is needed to resume the induction of rules from a checkpoint.
+         *
+         * @param writer A reference to an object of type `CheckpointWriter`, the state should be written to
+         */
+        virtual void writeState(CheckpointWriter& writer) const = 0;
+
+        /**
+         * Restores the state of the sub-sampling from a checkpoint.
+         *
+         * @param reader A reference to an object of type `CheckpointReader`, the state should be read from
+         */
+        virtual void readState(CheckpointReader& reader) = 0;
+
 };
 
 
@@ -45,20 +62,26 @@ class IInstanceSubSamplingFactory {
         /**
          * Creates and returns a new object of type `IInstanceSubSampling`.
          *
+         * @param labelMatrix   A reference to an object of type `CContiguousLabelMatrix` that provides access to the
+         *                      labels and time slots of the training examples
          * @param partition     A reference to an object of type `SinglePartition` that provides access to the indices
          *                      of the training examples that are included in the training set
          * @return              An unique pointer to an object of type `IInstanceSubSampling` that has been created
          */
-        virtual std::unique_ptr<IInstanceSubSampling> create(const SinglePartition& partition) const = 0;
+        virtual std::unique_ptr<IInstanceSubSampling> create(const CContiguousLabelMatrix& labelMatrix,
+                                                             const SinglePartition& partition) const = 0;
 
         /**
          * Creates and returns a new object of type `IInstanceSubSampling`.
          *
+         * @param labelMatrix   A reference to an object of type `CContiguousLabelMatrix` that provides access to the
+         *                      labels and time slots of the training examples
          * @param partition     A reference to an object of type `BiPartition` that provides access to the indices of
          *                      the training examples that are included in the training set and the holdout set,
          *                      respectively
          * @return              An unique pointer to an object of type `IInstanceSubSampling` that has been created
          */
-        virtual std::unique_ptr<IInstanceSubSampling> create(BiPartition& partition) const = 0;
+        virtual std::unique_ptr<IInstanceSubSampling> create(const CContiguousLabelMatrix& labelMatrix,
+                                                             BiPartition& partition) const = 0;
 
 };
@@ -14,8 +14,10 @@ class NoInstanceSubSamplingFactory final : public IInstanceSubSamplingFactory {
 
     public:
 
-        std::unique_ptr<IInstanceSubSampling> create(const SinglePartition& partition) const override;
+        std::unique_ptr<IInstanceSubSampling> create(const CContiguousLabelMatrix& labelMatrix,
+                                                     const SinglePartition& partition) const override;
 
-        std::unique_ptr<IInstanceSubSampling> create(BiPartition& partition) const override;
+        std::unique_ptr<IInstanceSubSampling> create(const CContiguousLabelMatrix& labelMatrix,
+                                                     BiPartition& partition) const override;
 
 };
@@ -24,8 +24,10 @@ class RandomInstanceSubsetSelectionFactory final : public IInstanceSubSamplingFa
          */
         RandomInstanceSubsetSelectionFactory(float32 sampleSize);
 
-        std::unique_ptr<IInstanceSubSampling> create(const SinglePartition& partition) const override;
+        std::unique_ptr<IInstanceSubSampling> create(const CContiguousLabelMatrix& labelMatrix,
+                                                     const SinglePartition& partition) const override;
 
-        std::unique_ptr<IInstanceSubSampling> create(BiPartition& partition) const override;
+        std::unique_ptr<IInstanceSubSampling> create(const CContiguousLabelMatrix& labelMatrix,
+                                                     BiPartition& partition) const override;
 
 };
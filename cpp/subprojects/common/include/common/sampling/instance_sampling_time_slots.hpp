@@ -0,0 +1,37 @@
+/*
+ * @author Michael Rapp (mrapp@ke.tu-darmstadt.de)
+ */
+#pragma once
+
+#include "common/sampling/instance_sampling.hpp"
+
+
+/**
+ * Allows to create instances of the type `IInstanceSubSampling` that select a subset of the available time slots
+ * without replacement and include all training examples that belong to the selected time slots. The time slots may be
+ * selected individually or in blocks of consecutive time slots.
+ */
+class TimeSlotSubsetSelectionFactory final : public IInstanceSubSamplingFactory {
+
+    private:
+
+        float32 sampleSize_;
+
+        uint32 blockSize_;
+
+    public:
+
+        /**
+         * @param sampleSize    The fraction of blocks to be included in the sample (e.g. a value of 0.6 corresponds to
+         *                      60 % of the available blocks). Must be in (0, 1)
+         * @param blockSize     The number of consecutive time slots that belong to a single block. Must be at least 1
+         */
+        TimeSlotSubsetSelectionFactory(float32 sampleSize, uint32 blockSize);
+
+        std::unique_ptr<IInstanceSubSampling> create(const CContiguousLabelMatrix& labelMatrix,
+                                                     const SinglePartition& partition) const override;
+
+        std::unique_ptr<IInstanceSubSampling> create(const CContiguousLabelMatrix& labelMatrix,
+                                                     BiPartition& partition) const override;
+
+};
@@ -5,8 +5,11 @@
 
 #include "common/data/types.hpp"
 #include <memory>
+#include <vector>
 
 // Forward declarations
+class ILabelMatrix;
+class IStatistics;
 class IInstanceSubSampling;
 class IInstanceSubSamplingFactory;
 class IThresholdsSubset;
@@ -25,16 +28,25 @@ class IPartition {
 
         virtual ~IPartition() { };
 
+        /**
+         * Returns the total number of examples in the training set and the holdout set.
+         *
+         * @return The total number of examples
+         */
+        virtual uint32 getNumElements() const = 0;
+
         /**
          * Creates and returns a new instance of the class `IInstanceSubSampling`, based on the type of this partition
          * matrix.
          *
          * @param factory       A reference to an object of type `IInstanceSubSamplingFactory` that should be used to
          *                      create the instance
+         * @param labelMatrix   A reference to an object of type `ILabelMatrix` that provides access to the labels of the
+         *                      training examples
          * @return              An unique pointer to an object of type `IInstanceSubSampling` that has been created
          */
         virtual std::unique_ptr<IInstanceSubSampling> createInstanceSubSampling(
-            const IInstanceSubSamplingFactory& factory) = 0;
+            const IInstanceSubSamplingFactory& factory, const ILabelMatrix& labelMatrix) = 0;
 
         /**
          * Calculates and returns a quality score that assesses the quality of a rule's prediction for all examples that
@@ -67,4 +79,20 @@ class IPartition {
         virtual void recalculatePrediction(const IThresholdsSubset& thresholdsSubset,
                                            const ICoverageState& coverageState, Refinement& refinement) = 0;
 
+        /**
+         * Marks the statistics that correspond to the examples in the holdout set, such that they are not used for
+         * learning rules, but only for evaluating the predictions of the model.
+         *
+         * @param statistics A reference to an object of type `IStatistics` that should be marked
+         */
+        virtual void markHoldoutStatistics(IStatistics& statistics) const = 0;
+
+        /**
+         * Returns the indices of the examples that belong to the holdout set, e.g., to mark the statistics of another
+         * process accordingly.
+         *
+         * @return An unique pointer to a vector that stores the indices of the examples in the holdout set
+         */
+        virtual std::unique_ptr<std::vector<uint32>> getHoldoutIndices() const = 0;
+
 };
@@ -132,15 +132,10 @@ class BiPartition : public IPartition {
          */
         const BinaryDokVector& getSecondSet();
 
-        /**
-         * Returns the total number of elements.
-         *
-         * @return The total number of elements
-         */
-        uint32 getNumElements() const;
+        uint32 getNumElements() const override;
 
         std::unique_ptr<IInstanceSubSampling> createInstanceSubSampling(
-            const IInstanceSubSamplingFactory& factory) override;
+            const IInstanceSubSamplingFactory& factory, const ILabelMatrix& labelMatrix) override;
 
         float64 evaluateOutOfSample(const IThresholdsSubset& thresholdsSubset, const ICoverageState& coverageState,
                                     const AbstractPrediction& head) override;
@@ -148,4 +143,8 @@ class BiPartition : public IPartition {
         void recalculatePrediction(const IThresholdsSubset& thresholdsSubset, const ICoverageState& coverageState,
                                    Refinement& refinement) override;
 
+        void markHoldoutStatistics(IStatistics& statistics) const override;
+
+        std::unique_ptr<std::vector<uint32>> getHoldoutIndices() const override;
+
 };
@@ -0,0 +1,39 @@
+/*
+ * @author Michael Rapp (mrapp@ke.tu-darmstadt.de)
+ */
+#pragma once
+
+#include "common/sampling/partition_sampling.hpp"
+
+
+/**
+ * Allows to create objects of the type `IPartitionSampling` that split the training examples into a training set and a
+ * holdout set, such that all examples that belong to the same time slot are included in the same set. Consecutive time
+ * slots are grouped into blocks of a fixed size. Either the last blocks, or blocks that are evenly spread across the
+ * entire period of time, are used as the holdout set.
+ */
+class TimeSlotBiPartitionSamplingFactory final : public IPartitionSamplingFactory {
+
+    private:
+
+        float32 holdoutSetSize_;
+
+        uint32 blockSize_;
+
+        bool interleaved_;
+
+    public:
+
+        /**
+         * @param holdoutSetSize    The fraction of blocks to be included in the holdout set (e.g. a value of 0.2
+         *                          corresponds to 20 % of the available blocks). Must be in (0, 1)
+         * @param blockSize         The number of consecutive time slots that belong to a single block. Must be at
+         *                          least 1
+         * @param interleaved       True, if the blocks in the holdout set should be evenly spread across the entire
+         *                          period of time, false, if the last blocks should be used as the holdout set
+         */
+        TimeSlotBiPartitionSamplingFactory(float32 holdoutSetSize, uint32 blockSize, bool interleaved);
+
+        std::unique_ptr<IPartitionSampling> create(const CContiguousLabelMatrix& labelMatrix) const override;
+
+};
@@ -43,15 +43,10 @@ class SinglePartition : public IPartition {
          */
         const_iterator cend() const;
 
-        /**
-         * Returns the number of elements that are contained in the partition.
-         *
-         * @return The number of elements
-         */
-        uint32 getNumElements() const;
+        uint32 getNumElements() const override;
 
         std::unique_ptr<IInstanceSubSampling> createInstanceSubSampling(
-            const IInstanceSubSamplingFactory& factory) override;
+            const IInstanceSubSamplingFactory& factory, const ILabelMatrix& labelMatrix) override;
 
         float64 evaluateOutOfSample(const IThresholdsSubset& thresholdsSubset, const ICoverageState& coverageState,
                                     const AbstractPrediction& head) override;
@@ -59,4 +54,8 @@ class SinglePartition : public IPartition {
         void recalculatePrediction(const IThresholdsSubset& thresholdsSubset, const ICoverageState& coverageState,
                                    Refinement& refinement) override;
 
+        void markHoldoutStatistics(IStatistics& statistics) const override;
+
+        std::unique_ptr<std::vector<uint32>> getHoldoutIndices() const override;
+
 };
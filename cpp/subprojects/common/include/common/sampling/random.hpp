@@ -32,4 +32,19 @@ class RNG final {
          */
         uint32 random(uint32 min, uint32 max);
 
+        /**
+         * Returns the current state of the random number generator.
+         *
+         * @return The current state
+         */
+        uint32 getState() const;
+
+        /**
+         * Sets the state of the random number generator, e.g., to restore a state that has been obtained via the
+         * function `getState` before.
+         *
+         * @param randomState The state to be set
+         */
+        void setState(uint32 randomState);
+
 };
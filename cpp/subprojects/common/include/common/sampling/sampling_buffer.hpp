@@ -0,0 +1,89 @@
+/*
+ * @author Michael Rapp (mrapp@ke.tu-darmstadt.de)
+ */
+#pragma once
+
+#include "common/data/types.hpp"
+
+// Forward declarations
+class CheckpointWriter;
+class CheckpointReader;
+
+
+/**
+ * Provides memory that is allocated once and reused by subsequent invocations of the functions that sample a subset of
+ * `numTotal` elements, e.g. features, examples or time slots, without replacement. It consists of a persistent
+ * permutation of the positions `[0, numTotal)`, which allows to perform a partial Fisher-Yates shuffle, as well as of a
+ * bitmap that allows to keep track of selected positions. Both are only allocated when they are accessed for the first
+ * time.
+ */
+class SamplingBuffer final {
+
+    private:
+
+        uint32 numTotal_;
+
+        uint32* permutation_;
+
+        uint32* bitmap_;
+
+    public:
+
+        /**
+         * @param numTotal The total number of elements to sample from
+         */
+        SamplingBuffer(uint32 numTotal);
+
+        ~SamplingBuffer();
+
+        SamplingBuffer(const SamplingBuffer& other) = delete;
+
+        SamplingBuffer& operator=(const SamplingBuffer& other) = delete;
+
+        /**
+         * Returns the total number of elements to sample from.
+         *
+         * @return The total number of elements
+         */
+        uint32 getNumTotal() const;
+
+        /**
+         * Returns a pointer to the permutation of the positions `[0, numTotal)`. The permutation is initialized when
+         * this function is called for the first time. Afterwards, it must only be modified by swapping elements, such
+         * that it remains a valid permutation.
+         *
+         * @return A pointer to an array of type `uint32`, shape `(numTotal)` that stores the permutation
+         */
+        uint32* getPermutation();
+
+        /**
+         * Marks the element at a specific position as selected, unless it has already been marked before.
+         *
+         * @param position  The position of the element
+         * @return          True, if the element has been marked, false, if it has already been marked before
+         */
+        bool mark(uint32 position);
+
+        /**
+         * Removes the mark from the element at a specific position. Every mark must be removed when sampling is
+         * finished, such that the bitmap can be reused without resetting it entirely.
+         *
+         * @param position The position of the element
+         */
+        void unmark(uint32 position);
+
+        /**
+         * Writes the permutation, which depends on all previous samples, to a checkpoint.
+         *
+         * @param writer A reference to an object of type `CheckpointWriter`, the permutation should be written to
+         */
+        void writeState(CheckpointWriter& writer) const;
+
+        /**
+         * Restores the permutation from a checkpoint.
+         *
+         * @param reader A reference to an object of type `CheckpointReader`, the permutation should be read from
+         */
+        void readState(CheckpointReader& reader);
+
+};
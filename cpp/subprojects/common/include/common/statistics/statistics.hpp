@@ -86,10 +86,53 @@ class IStatistics : virtual public IImmutableStatistics {
 
         virtual void increaseCoverageCount(uint32 statisticIndex) = 0;
 
+        /**
+         * Returns the number of rules that cover a specific statistic.
+         *
+         * @param statisticIndex    The index of the statistic
+         * @return                  The number of rules that cover the statistic
+         */
+        virtual uint32 getCoverageCount(uint32 statisticIndex) const = 0;
+
         virtual void updatePredictions() = 0;
 
+        /**
+         * Calculates and returns a quality score that assesses the current predictions with respect to all statistics
+         * that do not belong to the holdout set, regardless of whether they have been sampled or not.
+         *
+         * @return The quality score that has been calculated
+         */
+        virtual float64 evaluatePredictions() const = 0;
+
+        /**
+         * Marks a specific statistic as a part of the holdout set, i.e., it is not used for learning rules anymore, but
+         * only for evaluating the predictions of the model via the function `evaluateHoldoutPredictions`.
+         *
+         * @param statisticIndex The index of the statistic that should be marked
+         */
+        virtual void addHoldoutStatistic(uint32 statisticIndex) = 0;
+
+        /**
+         * Calculates and returns a quality score that assesses the current predictions with respect to the statistics
+         * that have been marked as a part of the holdout set.
+         *
+         * @return The quality score that has been calculated or NaN, if no statistics have been marked
+         */
+        virtual float64 evaluateHoldoutPredictions() const = 0;
+
         virtual std::unique_ptr<std::vector<uint32>> getGroundTruth() const = 0;
 
         virtual std::unique_ptr<std::vector<uint32>> getPredictions() const = 0;
 
+        /**
+         * Creates and returns an object of type `IStatistics` that keeps track of the statistics that are covered by a
+         * rule independently of these statistics. It starts with a copy of the statistics that are currently covered.
+         * The functions `resetCoveredStatistics` and `updateCoveredStatistic` of the returned object only affect its own
+         * copy, whereas all other statistics, e.g., the coverage counts and the predictions of the current model, are
+         * shared with, and must only be modified via, the original object.
+         *
+         * @return An unique pointer to an object of type `IStatistics` that has been created
+         */
+        virtual std::unique_ptr<IStatistics> isolateCoveredStatistics() = 0;
+
 };
@@ -0,0 +1,58 @@
+/*
+ * @author Michael Rapp (mrapp@ke.tu-darmstadt.de)
+ */
+#pragma once
+
+#include "common/data/types.hpp"
+#include <atomic>
+#include <chrono>
+
+
+/**
+ * Allows to cancel the induction of rules, either explicitly, e.g. from a different thread, or implicitly, once a
+ * certain time limit has been exceeded. Unlike a stopping criterion, which is only tested after a rule has been
+ * induced, the token is also checked while searching for the conditions of a rule. If the induction of rules is
+ * canceled, the rule that is currently being induced is discarded. A token must only be used for a single induction
+ * of rules, i.e., once it has been canceled, a new token must be created for starting another one.
+ */
+class CancellationToken final {
+
+    private:
+
+        typedef std::chrono::steady_clock timer;
+
+        typedef std::chrono::seconds timer_unit;
+
+        std::atomic<bool> cancelled_;
+
+        timer_unit timeLimit_;
+
+        std::chrono::time_point<timer> deadline_;
+
+    public:
+
+        /**
+         * @param timeLimit The time limit in seconds or 0, if no time limit should be used
+         */
+        CancellationToken(uint32 timeLimit);
+
+        /**
+         * Starts the timer that is used to check whether the time limit has been exceeded. Must be called before the
+         * induction of rules is started. A cancellation that has been requested before is retained.
+         */
+        void start();
+
+        /**
+         * Cancels the induction of rules. This function may be called from any thread.
+         */
+        void cancel();
+
+        /**
+         * Returns whether the induction of rules has been canceled or the time limit has been exceeded. This function
+         * may be called from multiple threads in parallel.
+         *
+         * @return True, if the induction of rules has been canceled, false otherwise
+         */
+        bool isCancelled() const;
+
+};
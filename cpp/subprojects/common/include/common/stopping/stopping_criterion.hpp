@@ -6,6 +6,10 @@
 #include "common/sampling/partition.hpp"
 #include "common/statistics/statistics.hpp"
 
+// Forward declarations
+class CheckpointWriter;
+class CheckpointReader;
+
 
 /**
  * Defines an interface for all stopping criteria that allow to decide whether additional rules should be induced or
@@ -56,8 +60,25 @@ class IStoppingCriterion {
          * @return              A value of the enum `Result` that specifies whether the induction of rules should be
          *                      continued (`CONTINUE`), whether the current number of rules should be stored as a
          *                      potential point for stopping while continuing to induce rules (`STORE_STOP`), or if the
-         *                      induction of rules should be forced to be stopped (`FORCE_STOP`)
+         *                      induction of rules should be forced to be stopped (`FORCE_STOP`). Once a criterion has
+         *                      stored a potential point for stopping, it must report it, or a replacement, whenever it
+         *                      is tested afterwards
          */
         virtual Result test(const IPartition& partition, const IStatistics& statistics, uint32 numRules) = 0;
 
+        /**
+         * Writes the state of the stopping criterion, which is needed to resume the induction of rules from a
+         * checkpoint.
+         *
+         * @param writer A reference to an object of type `CheckpointWriter`, the state should be written to
+         */
+        virtual void writeState(CheckpointWriter& writer) const = 0;
+
+        /**
+         * Restores the state of the stopping criterion from a checkpoint.
+         *
+         * @param reader A reference to an object of type `CheckpointReader`, the state should be read from
+         */
+        virtual void readState(CheckpointReader& reader) = 0;
+
 };
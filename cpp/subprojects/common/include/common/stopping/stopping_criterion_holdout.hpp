@@ -0,0 +1,47 @@
+/*
+ * @author Michael Rapp (mrapp@ke.tu-darmstadt.de)
+ */
+#pragma once
+
+#include "common/stopping/stopping_criterion.hpp"
+
+
+/**
+ * A stopping criterion that keeps track of the quality of the model on the holdout set after each rule and stops the
+ * induction of rules, or stores the number of rules that resulted in the best quality as a potential point for
+ * stopping, if the quality has not improved over a certain number of consecutive rules. Once a potential point for
+ * stopping has been stored, it is updated whenever the quality improves afterwards, such that the best number of rules
+ * with respect to all rules induced so far is used.
+ */
+class HoldoutStoppingCriterion final : public IStoppingCriterion {
+
+    private:
+
+        uint32 patience_;
+
+        bool forceStop_;
+
+        float64 bestQuality_;
+
+        uint32 bestNumRules_;
+
+        bool stored_;
+
+    public:
+
+        /**
+         * @param patience  The number of consecutive rules that may not improve the quality of the model on the holdout
+         *                  set, before the induction of rules is stopped. Must be at least 1
+         * @param forceStop True, if the induction of rules should be forced to be stopped, if the quality has not
+         *                  improved, false, if the number of rules that resulted in the best quality should only be
+         *                  stored as a potential point for stopping
+         */
+        HoldoutStoppingCriterion(uint32 patience, bool forceStop);
+
+        Result test(const IPartition& partition, const IStatistics& statistics, uint32 numRules) override;
+
+        void writeState(CheckpointWriter& writer) const override;
+
+        void readState(CheckpointReader& reader) override;
+
+};
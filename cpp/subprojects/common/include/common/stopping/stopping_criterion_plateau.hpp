@@ -0,0 +1,48 @@
+/*
+ * @author Michael Rapp (mrapp@ke.tu-darmstadt.de)
+ */
+#pragma once
+
+#include "common/stopping/stopping_criterion.hpp"
+#include "common/data/ring_buffer.hpp"
+
+
+/**
+ * A stopping criterion that keeps track of the quality of the model after each rule and stops the induction of rules,
+ * or stores the current number of rules as a potential point for stopping, if the quality has not improved by more
+ * than a certain threshold over a window of recent rules. Once a potential point for stopping has been stored, it is
+ * retained and reported whenever the criterion is tested.
+ */
+class PlateauStoppingCriterion final : public IStoppingCriterion {
+
+    private:
+
+        RingBuffer<float64> buffer_;
+
+        float64 minImprovement_;
+
+        bool forceStop_;
+
+        uint32 storedNumRules_;
+
+    public:
+
+        /**
+         * @param windowSize        The number of rules, the improvement of the model's quality should be calculated
+         *                          over. Must be at least 1
+         * @param minImprovement    The minimum improvement in terms of the model's quality over the given number of
+         *                          rules. Must be at least 0
+         * @param forceStop         True, if the induction of rules should be forced to be stopped, if the improvement
+         *                          falls below the threshold, false, if the number of rules at the beginning of the
+         *                          window, where the first plateau has been reached, should only be stored as a
+         *                          potential point for stopping
+         */
+        PlateauStoppingCriterion(uint32 windowSize, float64 minImprovement, bool forceStop);
+
+        Result test(const IPartition& partition, const IStatistics& statistics, uint32 numRules) override;
+
+        void writeState(CheckpointWriter& writer) const override;
+
+        void readState(CheckpointReader& reader) override;
+
+};
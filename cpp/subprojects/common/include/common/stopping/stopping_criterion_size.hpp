@@ -24,4 +24,8 @@ class SizeStoppingCriterion final : public IStoppingCriterion {
 
         Result test(const IPartition& partition, const IStatistics& statistics, uint32 numRules) override;
 
+        void writeState(CheckpointWriter& writer) const override;
+
+        void readState(CheckpointReader& reader) override;
+
 };
@@ -33,4 +33,8 @@ class TimeStoppingCriterion final : public IStoppingCriterion {
 
         Result test(const IPartition& partition, const IStatistics& statistics, uint32 numRules) override;
 
+        void writeState(CheckpointWriter& writer) const override;
+
+        void readState(CheckpointReader& reader) override;
+
 };
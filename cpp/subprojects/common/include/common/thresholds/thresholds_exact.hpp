@@ -11,8 +11,28 @@
  */
 class ExactThresholdsFactory final : public IThresholdsFactory {
 
+    private:
+
+        bool compressCache_;
+
+        uint32 prefetchWindow_;
+
     public:
 
+        ExactThresholdsFactory();
+
+        /**
+         * @param compressCache     True, if the feature vectors that are cached by the thresholds should be stored in
+         *                          a compressed form, which reduces the memory footprint of the cache at the expense of
+         *                          decompressing the feature vectors whenever they are accessed, unless they have been
+         *                          accessed recently, false otherwise
+         * @param prefetchWindow    The maximum number of feature vectors to be prefetched in the background, if the
+         *                          feature vectors should not be cached, but fetched from the feature matrix whenever
+         *                          they are needed, or 0, if they should be cached. If the feature vectors are not
+         *                          cached, the argument `compressCache` is ignored
+         */
+        ExactThresholdsFactory(bool compressCache, uint32 prefetchWindow);
+
         std::unique_ptr<IThresholds> create(
             std::shared_ptr<IFeatureMatrix> featureMatrixPtr,
             std::shared_ptr<INominalFeatureMask> nominalFeatureMaskPtr,
@@ -72,12 +72,75 @@ class IThresholdsSubset {
          */
         virtual void filterThresholds(const Condition& condition) = 0;
 
+        /**
+         * Filters the thresholds in the same way as the function `filterThresholds(Refinement)` and additionally
+         * stores the indices of the examples whose statistics have been updated, in the order of the updates. This
+         * allows to apply the same refinement to another object of type `IThresholdsSubset` via the function
+         * `filterThresholds(Condition, const uint32*, uint32)`.
+         *
+         * @param refinement    A reference to an object of type `Refinement` that stores information about the
+         *                      refinement
+         * @param indices       A reference to an object of type `std::vector`, the indices should be added to
+         */
+        virtual void filterThresholds(Refinement& refinement, std::vector<uint32>& indices) = 0;
+
+        /**
+         * Identifies the examples whose statistics would be updated by the function
+         * `filterThresholds(Refinement, std::vector)`, without filtering the thresholds. If `refinement.covered` is
+         * true, the identified examples are the ones that are covered by the refined rule. Otherwise, the refined rule
+         * covers all examples that are covered by the current rule, except for the identified ones.
+         *
+         * @param refinement    A reference to an object of type `Refinement` that stores information about the
+         *                      refinement
+         * @param indices       A reference to an object of type `std::vector`, the indices should be added to
+         */
+        virtual void getUpdatedIndices(const Refinement& refinement, std::vector<uint32>& indices) = 0;
+
+        /**
+         * Filters the thresholds in the same way as the function `filterThresholds(Refinement)` does for a refinement
+         * that has been found by another object of type `IThresholdsSubset`, e.g., in another process that has access
+         * to the feature values of the condition's feature. Instead of the feature values, the indices of the examples
+         * whose statistics have been updated by the other object are given.
+         *
+         * @param condition     A reference to an object of type `Condition` that stores information about the
+         *                      condition
+         * @param indices       A pointer to an array of type `uint32`, shape `(numIndices)`, that stores the indices
+         *                      that have been obtained via the function `filterThresholds(Refinement, std::vector)`
+         * @param numIndices    The number of indices
+         */
+        virtual void filterThresholds(const Condition& condition, const uint32* indices, uint32 numIndices) = 0;
+
         /**
          * Resets the filtered thresholds. This reverts the effects of all previous calls to the functions
          * `filterThresholds(Refinement)` or `filterThresholds(Condition)`.
          */
         virtual void resetThresholds() = 0;
 
+        /**
+         * Creates and returns a copy of this subset, which may be filtered independently afterwards. Feature vectors
+         * that have already been filtered are shared by the copy and the original subset. They are only copied when
+         * either of the subsets needs to filter them further (copy-on-write).
+         *
+         * @return An unique pointer to an object of type `IThresholdsSubset` that has been created
+         */
+        virtual std::unique_ptr<IThresholdsSubset> copy() const = 0;
+
+        /**
+         * Keeps track of the statistics that are covered by the current rule independently of other subsets, which
+         * share the same statistics. Only the statistics that are affected by the covered examples are copied. They are
+         * kept up to date when the subset is filtered or copied and are discarded when it is reset. This allows to
+         * search for refinements of several subsets concurrently.
+         */
+        virtual void isolateStatistics() = 0;
+
+        /**
+         * Returns whether a specific example is covered by the current rule or not.
+         *
+         * @param exampleIndex  The index of the example
+         * @return              True, if the example is covered, false otherwise
+         */
+        virtual bool isCovered(uint32 exampleIndex) const = 0;
+
         /**
          * Returns an object of type `ICoverageState` that keeps track of the elements that are covered by the
          * refinement that has been applied via the function `applyRefinement`.
@@ -37,6 +37,11 @@ bool RingBuffer<T>::isFull() const {
     return full_;
 }
 
+template<class T>
+uint32 RingBuffer<T>::getPosition() const {
+    return pos_;
+}
+
 template<class T>
 std::pair<bool, T> RingBuffer<T>::push(T value) {
     std::pair<bool, T> result;
@@ -30,6 +30,8 @@ uint32 VectorConstView<T>::getNumElements() const {
 
 template class VectorConstView<uint8>;
 template class VectorConstView<const uint8>;
+template class VectorConstView<uint16>;
+template class VectorConstView<const uint16>;
 template class VectorConstView<uint32>;
 template class VectorConstView<const uint32>;
 template class VectorConstView<float32>;
@@ -68,6 +70,7 @@ T& VectorView<T>::operator[](uint32 pos) {
 }
 
 template class VectorView<uint8>;
+template class VectorView<uint16>;
 template class VectorView<uint32>;
 template class VectorView<float32>;
 template class VectorView<float64>;
@@ -0,0 +1,214 @@
+#include "common/distributed/channel_socket.hpp"
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+
+/**
+ * Initializes the address of a Unix domain socket.
+ *
+ * @param address   A reference to a struct of type `sockaddr_un` that should be initialized
+ * @param path      The path of the socket
+ * @return          True, if the address has been initialized, false, if the path is too long
+ */
+static inline bool initAddress(sockaddr_un& address, const std::string& path) {
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+
+    if (path.size() >= sizeof(address.sun_path)) {
+        return false;
+    }
+
+    std::memcpy(address.sun_path, path.c_str(), path.size());
+    return true;
+}
+
+/**
+ * Writes a specific number of bytes to a socket.
+ *
+ * @param fd        The file descriptor of the socket
+ * @param bytes     A pointer to an array of type `uint8`, shape `(numBytes)`, that stores the bytes to be written
+ * @param numBytes  The number of bytes to be written
+ * @return          True, if all bytes have been written, false otherwise
+ */
+static inline bool writeBytes(int fd, const uint8* bytes, uint32 numBytes) {
+    uint32 numWritten = 0;
+
+    while (numWritten < numBytes) {
+        // The flag `MSG_NOSIGNAL` prevents the process from being terminated if the other process has exited...
+        ssize_t result = ::send(fd, bytes + numWritten, numBytes - numWritten, MSG_NOSIGNAL);
+
+        if (result < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            return false;
+        }
+
+        numWritten += (uint32) result;
+    }
+
+    return true;
+}
+
+/**
+ * Reads a specific number of bytes from a socket.
+ *
+ * @param fd        The file descriptor of the socket
+ * @param bytes     A pointer to an array of type `uint8`, shape `(numBytes)`, the bytes should be written to
+ * @param numBytes  The number of bytes to be read
+ * @return          True, if all bytes have been read, false otherwise
+ */
+static inline bool readBytes(int fd, uint8* bytes, uint32 numBytes) {
+    uint32 numRead = 0;
+
+    while (numRead < numBytes) {
+        ssize_t result = ::recv(fd, bytes + numRead, numBytes - numRead, 0);
+
+        if (result < 0 && errno == EINTR) {
+            continue;
+        } else if (result <= 0) {
+            return false;
+        }
+
+        numRead += (uint32) result;
+    }
+
+    return true;
+}
+
+SocketChannel::SocketChannel(int fd)
+    : fd_(fd) {
+
+}
+
+SocketChannel::~SocketChannel() {
+    ::close(fd_);
+}
+
+std::unique_ptr<SocketChannel> SocketChannel::listen(const std::string& path, uint32 timeout) {
+    sockaddr_un address;
+
+    if (!initAddress(address, path)) {
+        throw std::runtime_error("The path of the socket \"" + path + "\" is too long");
+    }
+
+    // A stale socket that has been left behind by a previous worker is replaced, whereas other files are never
+    // removed...
+    struct stat fileStat;
+
+    if (::lstat(path.c_str(), &fileStat) == 0) {
+        if (!S_ISSOCK(fileStat.st_mode)) {
+            throw std::runtime_error("Cannot create socket at \"" + path + "\", because a file that is not a socket "
+                                     + "already exists at this path");
+        }
+
+        ::unlink(path.c_str());
+    }
+
+    int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+
+    if (fd < 0) {
+        throw std::runtime_error("Failed to create socket at \"" + path + "\": " + std::strerror(errno));
+    }
+
+    if (::bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || ::listen(fd, 1) != 0) {
+        std::string error = std::strerror(errno);
+        ::close(fd);
+        throw std::runtime_error("Failed to create socket at \"" + path + "\": " + error);
+    }
+
+    // Wait until another process connects to the socket or the timeout is reached...
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::seconds(timeout);
+    pollfd pollFd;
+    pollFd.fd = fd;
+    pollFd.events = POLLIN;
+    int connectionFd = -1;
+
+    while (true) {
+        std::chrono::milliseconds remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now());
+        int result = ::poll(&pollFd, 1, remaining.count() > 0 ? (int) remaining.count() : 0);
+
+        if (result > 0) {
+            connectionFd = ::accept(fd, nullptr, nullptr);
+
+            if (connectionFd >= 0 || errno != EINTR) {
+                break;
+            }
+        } else if (result == 0 || errno != EINTR) {
+            break;
+        }
+    }
+
+    // Once a connection has been established, the socket is not needed anymore...
+    std::string error = connectionFd < 0 ? std::strerror(errno) : "";
+    ::close(fd);
+    ::unlink(path.c_str());
+
+    if (connectionFd < 0) {
+        if (std::chrono::steady_clock::now() >= deadline) {
+            throw std::runtime_error("No process connected to the socket at \"" + path + "\" within "
+                                     + std::to_string(timeout) + " seconds");
+        }
+
+        throw std::runtime_error("Failed to accept connection at socket \"" + path + "\": " + error);
+    }
+
+    return std::make_unique<SocketChannel>(connectionFd);
+}
+
+std::unique_ptr<SocketChannel> SocketChannel::connect(const std::string& path, uint32 timeout) {
+    sockaddr_un address;
+
+    if (!initAddress(address, path)) {
+        return nullptr;
+    }
+
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::seconds(timeout);
+
+    while (true) {
+        int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+
+        if (fd < 0) {
+            return nullptr;
+        }
+
+        if (::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0) {
+            return std::make_unique<SocketChannel>(fd);
+        }
+
+        ::close(fd);
+
+        // The other process may not have created the socket yet...
+        if (std::chrono::steady_clock::now() >= deadline) {
+            return nullptr;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+}
+
+bool SocketChannel::send(const CheckpointWriter& message) {
+    uint32 numBytes = message.getNumBytes();
+    return writeBytes(fd_, reinterpret_cast<const uint8*>(&numBytes), sizeof(numBytes))
+           && writeBytes(fd_, message.getData(), numBytes);
+}
+
+bool SocketChannel::receive(CheckpointReader& message) {
+    uint32 numBytes;
+
+    if (!readBytes(fd_, reinterpret_cast<uint8*>(&numBytes), sizeof(numBytes))) {
+        return false;
+    }
+
+    return readBytes(fd_, message.allocate(numBytes), numBytes);
+}
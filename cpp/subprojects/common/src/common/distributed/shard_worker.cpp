@@ -0,0 +1,210 @@
+#include "common/distributed/shard_worker.hpp"
+#include "common/distributed/shard_protocol.hpp"
+#include "common/indices/index_vector_full.hpp"
+#include "common/indices/index_vector_partial.hpp"
+#include "omp.h"
+#include <vector>
+
+
+ShardWorker::ShardWorker(std::shared_ptr<IStatisticsProviderFactory> statisticsProviderFactoryPtr,
+                         std::shared_ptr<IThresholdsFactory> thresholdsFactoryPtr,
+                         std::shared_ptr<IHeadRefinementFactory> headRefinementFactoryPtr,
+                         std::shared_ptr<INominalFeatureMask> nominalFeatureMaskPtr,
+                         std::shared_ptr<IFeatureMatrix> featureMatrixPtr,
+                         std::shared_ptr<ILabelMatrix> labelMatrixPtr, uint32 numThreads)
+    : statisticsProviderPtr_(labelMatrixPtr->createStatisticsProvider(*statisticsProviderFactoryPtr)),
+      thresholdsPtr_(thresholdsFactoryPtr->create(featureMatrixPtr, nominalFeatureMaskPtr, statisticsProviderPtr_,
+                                                  headRefinementFactoryPtr)),
+      numThreads_(numThreads), bestRefinementPtr_(std::make_unique<Refinement>()) {
+    // The coordinator does not induce a default rule, i.e., the rules are evaluated the same way from the beginning...
+    statisticsProviderPtr_->switchRuleEvaluation();
+}
+
+void ShardWorker::beginRule(CheckpointReader& message) {
+    IStatistics& statistics = statisticsProviderPtr_->get();
+
+    // Mark the statistics in the holdout set...
+    uint32 numHoldout = message.read<uint32>();
+
+    for (uint32 i = 0; i < numHoldout; i++) {
+        statistics.addHoldoutStatistic(message.read<uint32>());
+    }
+
+    // Apply the predictions of the rules that have been added to the coordinator's model since the previous rule...
+    uint32 numStatistics = message.read<uint32>();
+    bool predictionsChanged = false;
+
+    for (uint32 i = 0; i < numStatistics; i++) {
+        uint32 coverageCount = message.read<uint32>();
+
+        while (statistics.getCoverageCount(i) < coverageCount) {
+            statistics.increaseCoverageCount(i);
+            predictionsChanged = true;
+        }
+    }
+
+    if (predictionsChanged) {
+        statistics.updatePredictions();
+    }
+
+    // Restore the weights of the examples. The subset of the thresholds that refers to the previous weights must be
+    // discarded first...
+    thresholdsSubsetPtr_.reset();
+    uint32 numWeights = message.read<uint32>();
+    uint32 numNonZeroWeights = message.read<uint32>();
+    weightsPtr_ = std::make_unique<DenseWeightVector<float64>>(numWeights);
+    message.readArray<float64>(weightsPtr_->begin(), numWeights);
+    weightsPtr_->setNumNonZeroWeights(numNonZeroWeights);
+
+    // Restore the indices of the labels for which the rule may predict...
+    bool partial = message.read<uint8>() != 0;
+    uint32 numLabelIndices = message.read<uint32>();
+
+    if (partial) {
+        std::unique_ptr<PartialIndexVector> labelIndicesPtr = std::make_unique<PartialIndexVector>(numLabelIndices);
+        message.readArray<uint32>(labelIndicesPtr->begin(), numLabelIndices);
+        labelIndicesPtr_ = std::move(labelIndicesPtr);
+    } else {
+        labelIndicesPtr_ = std::make_unique<FullIndexVector>(numLabelIndices);
+    }
+
+    thresholdsSubsetPtr_ = thresholdsPtr_->createSubset(*weightsPtr_);
+    bestRefinementPtr_ = std::make_unique<Refinement>();
+}
+
+void ShardWorker::findRefinement(CheckpointReader& message, CheckpointWriter& reply) {
+    uint32 minCoverage = message.read<uint32>();
+    uint32 numFeatures = message.read<uint32>();
+    std::vector<uint32> featureIndices(numFeatures);
+    message.readArray<uint32>(featureIndices.data(), numFeatures);
+
+    if (!message.isValid()) {
+        return;
+    }
+
+    // For each feature, create an object of type `IRuleRefinement`...
+    for (uint32 i = 0; i < numFeatures; i++) {
+        uint32 featureIndex = featureIndices[i];
+        ruleRefinements_[featureIndex] = labelIndicesPtr_->createRuleRefinement(*thresholdsSubsetPtr_, featureIndex);
+    }
+
+    // Search for the best condition among the features in parallel...
+    const AbstractEvaluatedPrediction* bestHead = bestRefinementPtr_->headPtr.get();
+    std::vector<uint32>* featureIndicesPtr = &featureIndices;
+    std::unordered_map<uint32, std::unique_ptr<IRuleRefinement>>* ruleRefinementsPtr = &ruleRefinements_;
+
+    // If the induction of rules is canceled, the coordinator discards the refinements reported by the workers.
+    // Therefore, the search conducted by a worker is never canceled...
+    CancellationToken cancellationToken(0);
+    const CancellationToken* cancellationTokenPtr = &cancellationToken;
+
+    #pragma omp parallel for firstprivate(numFeatures) firstprivate(featureIndicesPtr) \
+    firstprivate(ruleRefinementsPtr) firstprivate(bestHead) firstprivate(minCoverage) \
+    firstprivate(cancellationTokenPtr) schedule(dynamic) num_threads(numThreads_)
+    for (intp i = 0; i < numFeatures; i++) {
+        uint32 featureIndex = (*featureIndicesPtr)[i];
+        ruleRefinementsPtr->find(featureIndex)->second->findRefinement(bestHead, minCoverage, *cancellationTokenPtr);
+    }
+
+    // Report the quality scores of the refinements that have been found for the different features and pick the best
+    // one in the order of the features, such that ties are broken the same way as in a single process...
+    std::unique_ptr<Refinement> bestRefinementPtr;
+    const Refinement* bestRefinement = bestRefinementPtr_.get();
+
+    for (uint32 i = 0; i < numFeatures; i++) {
+        uint32 featureIndex = featureIndices[i];
+        std::unique_ptr<Refinement> refinementPtr = ruleRefinements_.find(featureIndex)->second->pollRefinement();
+        const AbstractEvaluatedPrediction* head = refinementPtr->headPtr.get();
+        reply.write<uint8>(head != nullptr ? 1 : 0);
+        reply.write<float64>(head != nullptr ? head->overallQualityScore : 0);
+
+        if (refinementPtr->isBetterThan(*bestRefinement)) {
+            bestRefinementPtr = std::move(refinementPtr);
+            bestRefinement = bestRefinementPtr.get();
+        }
+    }
+
+    ruleRefinements_.clear();
+
+    if (bestRefinementPtr) {
+        reply.write<uint8>(1);
+        bestRefinementPtr->serialize(reply);
+    } else {
+        reply.write<uint8>(0);
+    }
+}
+
+void ShardWorker::applyRefinement(CheckpointReader& message, CheckpointWriter& reply) {
+    std::unique_ptr<Refinement> refinementPtr = std::make_unique<Refinement>();
+    refinementPtr->deserialize(message);
+
+    if (!message.isValid()) {
+        return;
+    }
+
+    // Apply the refinement and record the examples whose statistics are updated...
+    std::vector<uint32> indices;
+    thresholdsSubsetPtr_->filterThresholds(*refinementPtr, indices);
+
+    uint32 numIndices = (uint32) indices.size();
+    reply.write<uint32>(numIndices);
+    reply.writeArray<uint32>(indices.data(), numIndices);
+    bestRefinementPtr_ = std::move(refinementPtr);
+}
+
+void ShardWorker::filterRefinement(CheckpointReader& message) {
+    std::unique_ptr<Refinement> refinementPtr = std::make_unique<Refinement>();
+    refinementPtr->deserialize(message);
+    uint32 numIndices = message.read<uint32>();
+
+    std::vector<uint32> indices(numIndices);
+    message.readArray<uint32>(indices.data(), numIndices);
+
+    if (!message.isValid()) {
+        return;
+    }
+
+    thresholdsSubsetPtr_->filterThresholds(*refinementPtr, indices.data(), numIndices);
+    bestRefinementPtr_ = std::move(refinementPtr);
+}
+
+bool ShardWorker::serve(IChannel& channel) {
+    CheckpointReader message;
+    CheckpointWriter reply;
+
+    while (channel.receive(message)) {
+        uint8 type = message.read<uint8>();
+        reply.clear();
+
+        switch (type) {
+            case SHARD_BEGIN_RULE:
+                beginRule(message);
+                break;
+            case SHARD_FIND_REFINEMENT:
+                findRefinement(message, reply);
+                break;
+            case SHARD_APPLY_REFINEMENT:
+                applyRefinement(message, reply);
+                break;
+            case SHARD_FILTER_REFINEMENT:
+                filterRefinement(message);
+                break;
+            case SHARD_SHUTDOWN:
+                return true;
+            default:
+                return false;
+        }
+
+        if (!message.isValid()) {
+            return false;
+        }
+
+        if (type == SHARD_FIND_REFINEMENT || type == SHARD_APPLY_REFINEMENT) {
+            if (!channel.send(reply)) {
+                return false;
+            }
+        }
+    }
+
+    return false;
+}
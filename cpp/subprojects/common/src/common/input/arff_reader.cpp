@@ -0,0 +1,780 @@
+#include "common/input/arff_reader.hpp"
+#include "omp.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <limits>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <unordered_map>
+
+
+/**
+ * The number of chunks per thread the data section of a file is split into.
+ */
+const uint32 CHUNKS_PER_THREAD = 4;
+
+/**
+ * Provides access to the attributes of a data set, which are needed to parse the values in an ARFF file.
+ */
+struct ArffAttributeInfo {
+
+    /**
+     * The names of the attributes.
+     */
+    std::vector<std::string> names;
+
+    /**
+     * For each attribute, a map that assigns the indices to the values of the attribute, if it is nominal, or an empty
+     * map, if it is numerical.
+     */
+    std::vector<std::unordered_map<std::string, uint32>> nominalIndices;
+
+    /**
+     * Whether the individual attributes are nominal or not.
+     */
+    std::vector<uint8> nominal;
+
+};
+
+/**
+ * Stores the instances that have been parsed from a contiguous range of lines in the data section of an ARFF file.
+ */
+struct ArffChunk {
+
+    /**
+     * A pointer to the first character of the range.
+     */
+    const char* begin;
+
+    /**
+     * A pointer to the character past the last character of the range.
+     */
+    const char* end;
+
+    /**
+     * The number of instances in the range.
+     */
+    uint32 numRows;
+
+    /**
+     * The index of the first instance in the range.
+     */
+    uint32 rowOffset;
+
+    /**
+     * The row-indices of the values in the range, if the file is given in the sparse format. The indices are relative
+     * to `rowOffset`.
+     */
+    std::vector<uint32> rowIndices;
+
+    /**
+     * The column-indices of the values in the range, if the file is given in the sparse format.
+     */
+    std::vector<uint32> colIndices;
+
+    /**
+     * The values in the range, if the file is given in the sparse format.
+     */
+    std::vector<float32> values;
+
+    /**
+     * A description of the error that occurred while parsing the range or an empty string, if no error occurred.
+     */
+    std::string error;
+
+};
+
+/**
+ * Returns whether a character is a whitespace or not.
+ *
+ * @param c The character
+ * @return  True, if the character is a whitespace, false otherwise
+ */
+static inline bool isWhitespace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\f' || c == '\v';
+}
+
+/**
+ * Removes leading and trailing whitespace from a range of characters.
+ *
+ * @param begin A reference to a pointer to the first character of the range
+ * @param end   A reference to a pointer to the end of the range
+ */
+static inline void trim(const char*& begin, const char*& end) {
+    while (begin < end && isWhitespace(*begin)) {
+        begin++;
+    }
+
+    while (end > begin && isWhitespace(*(end - 1))) {
+        end--;
+    }
+}
+
+/**
+ * Searches for the next line that is neither empty nor a comment.
+ *
+ * @param position  A reference to a pointer to the position where the search should start. It is updated to point to
+ *                  the line following the one that has been found
+ * @param end       A pointer to the end of the text
+ * @param lineBegin A reference to a pointer, the first non-whitespace character of the line should be written to
+ * @param lineEnd   A reference to a pointer, the end of the line, excluding trailing whitespace, should be written to
+ * @return          True, if a line has been found, false, if the end of the text has been reached
+ */
+static inline bool nextLine(const char*& position, const char* end, const char*& lineBegin, const char*& lineEnd) {
+    while (position < end) {
+        lineBegin = position;
+        const char* newline = static_cast<const char*>(std::memchr(position, '\n', end - position));
+        lineEnd = newline != nullptr ? newline : end;
+        position = newline != nullptr ? newline + 1 : end;
+        trim(lineBegin, lineEnd);
+
+        if (lineBegin < lineEnd && *lineBegin != '%') {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Returns whether a range of characters starts with a specific keyword, regardless of its case.
+ *
+ * @param begin     A pointer to the first character of the range
+ * @param end       A pointer to the end of the range
+ * @param keyword   The keyword in lower case
+ * @return          True, if the range starts with the keyword, false otherwise
+ */
+static inline bool startsWithKeyword(const char* begin, const char* end, const char* keyword) {
+    uint32 length = std::strlen(keyword);
+
+    if ((uint32) (end - begin) < length) {
+        return false;
+    }
+
+    for (uint32 i = 0; i < length; i++) {
+        if (std::tolower(begin[i]) != keyword[i]) {
+            return false;
+        }
+    }
+
+    return begin + length == end || isWhitespace(begin[length]) || begin[length] == '{';
+}
+
+/**
+ * Returns the position of the first occurrence of a specific delimiter within a range of characters that is not
+ * enclosed in single or double quotes.
+ *
+ * @param begin     A pointer to the first character of the range
+ * @param end       A pointer to the end of the range
+ * @param delimiter A function that returns whether a character is a delimiter or not
+ * @return          A pointer to the delimiter or `end`, if the range does not contain the delimiter
+ */
+template<class Delimiter>
+static inline const char* findUnquoted(const char* begin, const char* end, Delimiter delimiter) {
+    char quote = '\0';
+
+    for (const char* position = begin; position < end; position++) {
+        char c = *position;
+
+        if (quote != '\0') {
+            if (c == '\\') {
+                position++;
+            } else if (c == quote) {
+                quote = '\0';
+            }
+        } else if (c == '\'' || c == '"') {
+            quote = c;
+        } else if (delimiter(c)) {
+            return position;
+        }
+    }
+
+    return end;
+}
+
+/**
+ * Removes the single or double quotes that enclose a range of characters, if any, and replaces escape sequences.
+ *
+ * @param begin A pointer to the first character of the range
+ * @param end   A pointer to the end of the range
+ * @param value A reference to an object of type `std::string`, the result should be written to
+ */
+static inline void unquote(const char* begin, const char* end, std::string& value) {
+    value.clear();
+
+    if (end - begin >= 2 && (*begin == '\'' || *begin == '"') && *(end - 1) == *begin) {
+        for (const char* position = begin + 1; position < end - 1; position++) {
+            char c = *position;
+
+            if (c == '\\' && position + 1 < end - 1) {
+                position++;
+                c = *position;
+
+                switch (c) {
+                    case 'n':
+                        c = '\n';
+                        break;
+                    case 'r':
+                        c = '\r';
+                        break;
+                    case 't':
+                        c = '\t';
+                        break;
+                    default:
+                        break;
+                }
+            }
+
+            value.push_back(c);
+        }
+    } else {
+        value.append(begin, end);
+    }
+}
+
+/**
+ * Parses a value of a specific attribute.
+ *
+ * @param begin             A pointer to the first character of the value
+ * @param end               A pointer to the end of the value
+ * @param attributeInfo     A reference to an object of type `ArffAttributeInfo` that provides access to the attributes
+ * @param attributeIndex    The index of the attribute
+ * @param buffer            A reference to an object of type `std::string` that may be used to store temporary results
+ * @param value             A reference to a value of type `float32`, the value should be written to
+ * @return                  True, if the value has been parsed successfully, false otherwise
+ */
+static inline bool parseValue(const char* begin, const char* end, const ArffAttributeInfo& attributeInfo,
+                              uint32 attributeIndex, std::string& buffer, float32& value) {
+    trim(begin, end);
+
+    if (end - begin == 1 && *begin == '?') {
+        value = NAN;
+        return true;
+    }
+
+    unquote(begin, end, buffer);
+
+    if (attributeInfo.nominal[attributeIndex]) {
+        const std::unordered_map<std::string, uint32>& nominalIndices = attributeInfo.nominalIndices[attributeIndex];
+        auto it = nominalIndices.find(buffer);
+
+        if (it == nominalIndices.end()) {
+            return false;
+        }
+
+        value = (float32) it->second;
+        return true;
+    }
+
+    const char* number = buffer.c_str();
+    char* numberEnd;
+    float64 result = std::strtod(number, &numberEnd);
+    value = (float32) result;
+    return numberEnd != number && *numberEnd == '\0';
+}
+
+/**
+ * Creates and returns a description of an error that occurred while parsing a value.
+ *
+ * @param begin             A pointer to the first character of the value
+ * @param end               A pointer to the end of the value
+ * @param attributeInfo     A reference to an object of type `ArffAttributeInfo` that provides access to the attributes
+ * @param attributeIndex    The index of the attribute
+ * @return                  An object of type `std::string` that stores the description
+ */
+static inline std::string createValueError(const char* begin, const char* end,
+                                           const ArffAttributeInfo& attributeInfo, uint32 attributeIndex) {
+    trim(begin, end);
+    return "Invalid value '" + std::string(begin, end) + "' of attribute '" + attributeInfo.names[attributeIndex]
+           + "'";
+}
+
+/**
+ * Parses the header of an ARFF file.
+ *
+ * @param begin         A pointer to the beginning of the file
+ * @param end           A pointer to the end of the file
+ * @param data          A reference to an object of type `ArffData`, the attributes should be added to
+ * @param attributeInfo A reference to an object of type `ArffAttributeInfo`, the attributes should be added to
+ * @param dataBegin     A reference to a pointer, the position of the first line of the data section should be written
+ *                      to
+ * @param error         A reference to an object of type `std::string`, a description of the error should be written to,
+ *                      if the header is malformed
+ * @return              True, if the header has been parsed successfully, false otherwise
+ */
+static inline bool parseHeader(const char* begin, const char* end, ArffData& data, ArffAttributeInfo& attributeInfo,
+                               const char*& dataBegin, std::string& error) {
+    const char* position = begin;
+    const char* lineBegin;
+    const char* lineEnd;
+    std::string name;
+    std::string value;
+
+    while (nextLine(position, end, lineBegin, lineEnd)) {
+        if (startsWithKeyword(lineBegin, lineEnd, "@data")) {
+            dataBegin = position;
+            return true;
+        } else if (startsWithKeyword(lineBegin, lineEnd, "@attribute")) {
+            const char* nameBegin = lineBegin + std::strlen("@attribute");
+            const char* typeEnd = lineEnd;
+            trim(nameBegin, typeEnd);
+            const char* nameEnd = findUnquoted(nameBegin, typeEnd, [](char c) {
+                return isWhitespace(c) || c == '{';
+            });
+            const char* typeBegin = nameEnd;
+            trim(typeBegin, typeEnd);
+            unquote(nameBegin, nameEnd, name);
+
+            if (typeBegin < typeEnd && *typeBegin == '{') {
+                if (*(typeEnd - 1) != '}') {
+                    error = "Malformed declaration of attribute '" + name + "'";
+                    return false;
+                }
+
+                std::vector<std::string> values;
+                std::unordered_map<std::string, uint32> nominalIndices;
+                const char* valueBegin = typeBegin + 1;
+                const char* valuesEnd = typeEnd - 1;
+
+                while (valueBegin < valuesEnd) {
+                    const char* valueEnd = findUnquoted(valueBegin, valuesEnd, [](char c) {
+                        return c == ',';
+                    });
+                    const char* next = valueEnd + 1;
+                    trim(valueBegin, valueEnd);
+                    unquote(valueBegin, valueEnd, value);
+                    nominalIndices.emplace(value, (uint32) values.size());
+                    values.push_back(value);
+                    valueBegin = next;
+                }
+
+                data.addAttribute(name, std::move(values));
+                attributeInfo.nominalIndices.push_back(std::move(nominalIndices));
+                attributeInfo.nominal.push_back(1);
+            } else if (startsWithKeyword(typeBegin, typeEnd, "numeric")
+                       || startsWithKeyword(typeBegin, typeEnd, "real")
+                       || startsWithKeyword(typeBegin, typeEnd, "integer")) {
+                data.addAttribute(name);
+                attributeInfo.nominalIndices.emplace_back();
+                attributeInfo.nominal.push_back(0);
+            } else {
+                error = "Unsupported type of attribute '" + name + "': " + std::string(typeBegin, typeEnd);
+                return false;
+            }
+
+            attributeInfo.names.push_back(name);
+        } else if (!startsWithKeyword(lineBegin, lineEnd, "@relation")) {
+            error = "Unexpected line in header: " + std::string(lineBegin, lineEnd);
+            return false;
+        }
+    }
+
+    error = "Missing data section";
+    return false;
+}
+
+/**
+ * Splits the data section of an ARFF file into chunks that consist of complete lines.
+ *
+ * @param begin     A pointer to the first line of the data section
+ * @param end       A pointer to the end of the data section
+ * @param numChunks The maximum number of chunks
+ * @param chunks    A reference to an object of type `std::vector`, the chunks should be written to
+ */
+static inline void splitIntoChunks(const char* begin, const char* end, uint32 numChunks,
+                                   std::vector<ArffChunk>& chunks) {
+    uint64 chunkSize = ((end - begin) / numChunks) + 1;
+    const char* position = begin;
+
+    while (position < end) {
+        const char* chunkEnd = position + std::min<uint64>(chunkSize, end - position);
+
+        if (chunkEnd < end) {
+            const char* newline = static_cast<const char*>(std::memchr(chunkEnd, '\n', end - chunkEnd));
+            chunkEnd = newline != nullptr ? newline + 1 : end;
+        }
+
+        ArffChunk chunk;
+        chunk.begin = position;
+        chunk.end = chunkEnd;
+        chunk.numRows = 0;
+        chunk.rowOffset = 0;
+        chunks.push_back(std::move(chunk));
+        position = chunkEnd;
+    }
+}
+
+/**
+ * Counts the instances in a chunk.
+ *
+ * @param chunk A reference to an object of type `ArffChunk` that stores the chunk
+ */
+static inline void countRows(ArffChunk& chunk) {
+    const char* position = chunk.begin;
+    const char* lineBegin;
+    const char* lineEnd;
+    uint32 numRows = 0;
+
+    while (nextLine(position, chunk.end, lineBegin, lineEnd)) {
+        numRows++;
+    }
+
+    chunk.numRows = numRows;
+}
+
+/**
+ * Parses the instances in a chunk that are given in the dense format and writes their values into a
+ * Fortran-contiguous array.
+ *
+ * @param chunk         A reference to an object of type `ArffChunk` that stores the chunk
+ * @param attributeInfo A reference to an object of type `ArffAttributeInfo` that provides access to the attributes
+ * @param values        A pointer to the Fortran-contiguous array, the values should be written to
+ * @param numRows       The total number of instances
+ */
+static inline void parseDenseChunk(ArffChunk& chunk, const ArffAttributeInfo& attributeInfo, float32* values,
+                                   uint32 numRows) {
+    uint32 numCols = attributeInfo.names.size();
+    const char* position = chunk.begin;
+    const char* lineBegin;
+    const char* lineEnd;
+    std::string buffer;
+    uint32 r = chunk.rowOffset;
+
+    while (nextLine(position, chunk.end, lineBegin, lineEnd)) {
+        if (*lineBegin == '{') {
+            chunk.error = "Instances must not be given in both, the dense and the sparse format";
+            return;
+        }
+
+        const char* valueBegin = lineBegin;
+
+        for (uint32 c = 0; c < numCols; c++) {
+            const char* valueEnd = findUnquoted(valueBegin, lineEnd, [](char character) {
+                return character == ',';
+            });
+
+            if (valueBegin > lineEnd || (valueEnd == lineEnd && c + 1 < numCols)
+                || (valueEnd < lineEnd && c + 1 == numCols)) {
+                chunk.error = "Expected " + std::to_string(numCols) + " values per instance";
+                return;
+            }
+
+            if (!parseValue(valueBegin, valueEnd, attributeInfo, c, buffer, values[((uint64) c * numRows) + r])) {
+                chunk.error = createValueError(valueBegin, valueEnd, attributeInfo, c);
+                return;
+            }
+
+            valueBegin = valueEnd + 1;
+        }
+
+        r++;
+    }
+}
+
+/**
+ * Parses the instances in a chunk that are given in the sparse format.
+ *
+ * @param chunk         A reference to an object of type `ArffChunk` that stores the chunk
+ * @param attributeInfo A reference to an object of type `ArffAttributeInfo` that provides access to the attributes
+ */
+static inline void parseSparseChunk(ArffChunk& chunk, const ArffAttributeInfo& attributeInfo) {
+    uint32 numCols = attributeInfo.names.size();
+    const char* position = chunk.begin;
+    const char* lineBegin;
+    const char* lineEnd;
+    std::string buffer;
+    uint32 r = 0;
+
+    while (nextLine(position, chunk.end, lineBegin, lineEnd)) {
+        if (*lineBegin != '{' || *(lineEnd - 1) != '}') {
+            chunk.error = "Instances must not be given in both, the dense and the sparse format";
+            return;
+        }
+
+        const char* entryBegin = lineBegin + 1;
+        const char* entriesEnd = lineEnd - 1;
+
+        while (entryBegin < entriesEnd) {
+            const char* entryEnd = findUnquoted(entryBegin, entriesEnd, [](char c) {
+                return c == ',';
+            });
+            const char* next = entryEnd + 1;
+            trim(entryBegin, entryEnd);
+
+            if (entryBegin < entryEnd) {
+                char* indexEnd;
+                unsigned long index = std::strtoul(entryBegin, &indexEnd, 10);
+
+                if (indexEnd == entryBegin || indexEnd >= entryEnd || !isWhitespace(*indexEnd) || index >= numCols) {
+                    chunk.error = "Invalid entry '" + std::string(entryBegin, entryEnd) + "' of a sparse instance";
+                    return;
+                }
+
+                uint32 c = (uint32) index;
+                float32 value;
+
+                if (!parseValue(indexEnd, entryEnd, attributeInfo, c, buffer, value)) {
+                    chunk.error = createValueError(indexEnd, entryEnd, attributeInfo, c);
+                    return;
+                }
+
+                chunk.rowIndices.push_back(r);
+                chunk.colIndices.push_back(c);
+                chunk.values.push_back(value);
+            }
+
+            entryBegin = next;
+        }
+
+        r++;
+    }
+
+    chunk.numRows = r;
+}
+
+/**
+ * Reads a data set from the content of an ARFF file.
+ *
+ * @param begin         A pointer to the beginning of the file
+ * @param end           A pointer to the end of the file
+ * @param numThreads    The number of CPU threads to be used to parse the file in parallel
+ * @param error         A reference to an object of type `std::string`, a description of the error should be written to,
+ *                      if the file cannot be parsed
+ * @return              An unique pointer to an object of type `ArffData` that stores the data set or a null pointer,
+ *                      if the file cannot be parsed
+ */
+static inline std::unique_ptr<ArffData> parse(const char* begin, const char* end, uint32 numThreads,
+                                              std::string& error) {
+    // The attributes are collected in a temporary object, as the number of instances is not yet known...
+    ArffData header(0, 0, false, 0);
+    ArffAttributeInfo attributeInfo;
+    const char* dataBegin;
+
+    if (!parseHeader(begin, end, header, attributeInfo, dataBegin, error)) {
+        return nullptr;
+    }
+
+    // The format is determined by the first instance...
+    const char* position = dataBegin;
+    const char* lineBegin;
+    const char* lineEnd;
+    bool sparse = nextLine(position, end, lineBegin, lineEnd) && *lineBegin == '{';
+
+    std::vector<ArffChunk> chunks;
+    splitIntoChunks(dataBegin, end, numThreads * CHUNKS_PER_THREAD, chunks);
+    uint32 numChunks = chunks.size();
+    uint32 numCols = attributeInfo.names.size();
+    std::vector<ArffChunk>* chunksPtr = &chunks;
+    const ArffAttributeInfo* attributeInfoPtr = &attributeInfo;
+    std::unique_ptr<ArffData> dataPtr;
+
+    if (sparse) {
+        #pragma omp parallel for firstprivate(numChunks) firstprivate(chunksPtr) firstprivate(attributeInfoPtr) \
+        schedule(dynamic) num_threads(numThreads)
+        for (intp i = 0; i < numChunks; i++) {
+            parseSparseChunk((*chunksPtr)[i], *attributeInfoPtr);
+        }
+    } else {
+        #pragma omp parallel for firstprivate(numChunks) firstprivate(chunksPtr) schedule(dynamic) \
+        num_threads(numThreads)
+        for (intp i = 0; i < numChunks; i++) {
+            countRows((*chunksPtr)[i]);
+        }
+    }
+
+    uint64 numRows = 0;
+    uint64 numValues = 0;
+
+    for (uint32 i = 0; i < numChunks; i++) {
+        ArffChunk& chunk = chunks[i];
+
+        if (!chunk.error.empty()) {
+            error = chunk.error;
+            return nullptr;
+        }
+
+        chunk.rowOffset = (uint32) numRows;
+        numRows += chunk.numRows;
+        numValues += chunk.values.size();
+    }
+
+    if (!sparse) {
+        numValues = numRows * numCols;
+    }
+
+    if (numRows > std::numeric_limits<uint32>::max() || numValues > std::numeric_limits<uint32>::max()) {
+        error = "Data set is too large";
+        return nullptr;
+    }
+
+    dataPtr = std::make_unique<ArffData>((uint32) numRows, numCols, sparse, (uint32) numValues);
+
+    for (uint32 i = 0; i < numCols; i++) {
+        if (header.isNominal(i)) {
+            std::vector<std::string> values = header.getNominalValues(i);
+            dataPtr->addAttribute(header.getAttributeName(i), std::move(values));
+        } else {
+            dataPtr->addAttribute(header.getAttributeName(i));
+        }
+    }
+
+    if (sparse) {
+        // The values of all chunks are arranged by their columns. As the chunks are processed in order, the
+        // row-indices that correspond to each column are sorted...
+        uint32* colIndices = dataPtr->getColIndices();
+        uint32* rowIndices = dataPtr->getRowIndices();
+        float32* values = dataPtr->getValues();
+
+        for (uint32 i = 0; i < numChunks; i++) {
+            for (auto it = chunks[i].colIndices.cbegin(); it != chunks[i].colIndices.cend(); it++) {
+                colIndices[*it + 1]++;
+            }
+        }
+
+        for (uint32 i = 0; i < numCols; i++) {
+            colIndices[i + 1] += colIndices[i];
+        }
+
+        std::vector<uint32> positions(colIndices, colIndices + numCols);
+
+        for (uint32 i = 0; i < numChunks; i++) {
+            ArffChunk& chunk = chunks[i];
+            uint32 numChunkValues = chunk.values.size();
+
+            for (uint32 j = 0; j < numChunkValues; j++) {
+                uint32 n = positions[chunk.colIndices[j]]++;
+                rowIndices[n] = chunk.rowOffset + chunk.rowIndices[j];
+                values[n] = chunk.values[j];
+            }
+
+            // The memory of each chunk is released as early as possible...
+            std::vector<uint32>().swap(chunk.rowIndices);
+            std::vector<uint32>().swap(chunk.colIndices);
+            std::vector<float32>().swap(chunk.values);
+        }
+    } else {
+        float32* values = dataPtr->getValues();
+        uint32 numTotalRows = (uint32) numRows;
+
+        #pragma omp parallel for firstprivate(numChunks) firstprivate(chunksPtr) firstprivate(attributeInfoPtr) \
+        firstprivate(values) firstprivate(numTotalRows) schedule(dynamic) num_threads(numThreads)
+        for (intp i = 0; i < numChunks; i++) {
+            parseDenseChunk((*chunksPtr)[i], *attributeInfoPtr, values, numTotalRows);
+        }
+
+        for (uint32 i = 0; i < numChunks; i++) {
+            if (!chunks[i].error.empty()) {
+                error = chunks[i].error;
+                return nullptr;
+            }
+        }
+    }
+
+    return dataPtr;
+}
+
+ArffData::ArffData(uint32 numRows, uint32 numCols, bool sparse, uint32 numValues)
+    : numRows_(numRows), numCols_(numCols), sparse_(sparse), values_(numValues), rowIndices_(sparse ? numValues : 0),
+      colIndices_(sparse ? numCols + 1 : 0, 0) {
+
+}
+
+uint32 ArffData::getNumRows() const {
+    return numRows_;
+}
+
+uint32 ArffData::getNumCols() const {
+    return numCols_;
+}
+
+bool ArffData::isSparse() const {
+    return sparse_;
+}
+
+uint32 ArffData::getNumValues() const {
+    return values_.size();
+}
+
+float32* ArffData::getValues() {
+    return values_.data();
+}
+
+uint32* ArffData::getRowIndices() {
+    return rowIndices_.data();
+}
+
+uint32* ArffData::getColIndices() {
+    return colIndices_.data();
+}
+
+void ArffData::addAttribute(const std::string& name) {
+    attributeNames_.push_back(name);
+    nominalValues_.emplace_back();
+    nominal_.push_back(false);
+}
+
+void ArffData::addAttribute(const std::string& name, std::vector<std::string>&& values) {
+    attributeNames_.push_back(name);
+    nominalValues_.push_back(std::move(values));
+    nominal_.push_back(true);
+}
+
+const std::string& ArffData::getAttributeName(uint32 attributeIndex) const {
+    return attributeNames_[attributeIndex];
+}
+
+bool ArffData::isNominal(uint32 attributeIndex) const {
+    return nominal_[attributeIndex];
+}
+
+const std::vector<std::string>& ArffData::getNominalValues(uint32 attributeIndex) const {
+    return nominalValues_[attributeIndex];
+}
+
+ArffReader::ArffReader(uint32 numThreads)
+    : numThreads_(numThreads) {
+
+}
+
+std::unique_ptr<ArffData> ArffReader::read(const std::string& path, std::string& error) const {
+    int fileDescriptor = open(path.c_str(), O_RDONLY);
+
+    if (fileDescriptor < 0) {
+        error = "Unable to read file '" + path + "'";
+        return nullptr;
+    }
+
+    struct stat fileStatus;
+    std::unique_ptr<ArffData> dataPtr;
+
+    if (fstat(fileDescriptor, &fileStatus) == 0 && fileStatus.st_size > 0) {
+        uint64 size = (uint64) fileStatus.st_size;
+        void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+        if (data != MAP_FAILED) {
+            // The file is read sequentially...
+            madvise(data, size, MADV_SEQUENTIAL);
+            const char* begin = static_cast<const char*>(data);
+            dataPtr = parse(begin, begin + size, numThreads_, error);
+
+            if (!dataPtr) {
+                error += " in file '" + path + "'";
+            }
+
+            munmap(data, size);
+        }
+    }
+
+    close(fileDescriptor);
+
+    if (!dataPtr && error.empty()) {
+        error = "Unable to read file '" + path + "'";
+    }
+
+    return dataPtr;
+}
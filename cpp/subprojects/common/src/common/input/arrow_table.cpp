@@ -0,0 +1,239 @@
+#include "common/input/arrow_table.hpp"
+#include <cstring>
+#include <limits>
+
+
+/**
+ * Determines the physical type of the values in an array, given the format string of the array.
+ *
+ * @param format    The format string
+ * @param type      A reference to a value of the enum `ArrowType`, the type should be written to
+ * @return          True, if the type is supported, false otherwise
+ */
+static inline bool getType(const char* format, ArrowType& type) {
+    if (format == nullptr || format[0] == '\0' || format[1] != '\0') {
+        return false;
+    }
+
+    switch (format[0]) {
+        case 'b':
+            type = ARROW_BOOLEAN;
+            return true;
+        case 'c':
+            type = ARROW_INT8;
+            return true;
+        case 's':
+            type = ARROW_INT16;
+            return true;
+        case 'i':
+            type = ARROW_INT32;
+            return true;
+        case 'l':
+            type = ARROW_INT64;
+            return true;
+        case 'C':
+            type = ARROW_UINT8;
+            return true;
+        case 'S':
+            type = ARROW_UINT16;
+            return true;
+        case 'I':
+            type = ARROW_UINT32;
+            return true;
+        case 'L':
+            type = ARROW_UINT64;
+            return true;
+        case 'f':
+            type = ARROW_FLOAT32;
+            return true;
+        case 'g':
+            type = ARROW_FLOAT64;
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * Reads the values of a dictionary that stores strings.
+ *
+ * @param schema    A reference to a struct of type `ArrowSchema` that describes the dictionary
+ * @param array     A reference to a struct of type `ArrowArray` that stores the dictionary
+ * @param values    A reference to an object of type `std::vector`, the values should be written to
+ * @return          True, if the values have been read successfully, false otherwise
+ */
+static inline bool readDictionary(const ArrowSchema& schema, const ArrowArray& array,
+                                  std::vector<std::string>& values) {
+    if (schema.format == nullptr || array.n_buffers < 3) {
+        return false;
+    }
+
+    bool largeOffsets = std::strcmp(schema.format, "U") == 0;
+
+    if (!largeOffsets && std::strcmp(schema.format, "u") != 0) {
+        return false;
+    }
+
+    uint64 numValues = (uint64) array.length;
+    uint64 offset = (uint64) array.offset;
+    const uint8* validity = array.null_count != 0 ? static_cast<const uint8*>(array.buffers[0]) : nullptr;
+    const char* data = static_cast<const char*>(array.buffers[2]);
+
+    for (uint64 i = 0; i < numValues; i++) {
+        uint64 position = offset + i;
+
+        if (validity != nullptr && !(validity[position >> 3] & (1 << (position & 7)))) {
+            values.emplace_back();
+        } else if (largeOffsets) {
+            const int64_t* offsets = static_cast<const int64_t*>(array.buffers[1]);
+            values.emplace_back(&data[offsets[position]], offsets[position + 1] - offsets[position]);
+        } else {
+            const int32_t* offsets = static_cast<const int32_t*>(array.buffers[1]);
+            values.emplace_back(&data[offsets[position]], offsets[position + 1] - offsets[position]);
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Copies the values in a buffer of a specific integer type into an array of type `uint32`.
+ *
+ * @tparam T        The type of the values in the buffer
+ * @param column    A reference to an object of type `ArrowColumn` that provides access to the buffer
+ * @param numRows   The number of rows
+ * @param array     A pointer to the array, the values should be written to
+ * @param stride    The distance between the positions in the array, consecutive values should be written to
+ * @return          True, if all values have been copied successfully, false, if any value is missing or cannot be
+ *                  represented as an `uint32`
+ */
+template<class T>
+static inline bool copyIntegers(const ArrowColumn& column, uint32 numRows, uint32* array, uint32 stride) {
+    const T* values = static_cast<const T*>(column.values) + column.offset;
+    const uint8* validity = column.validity;
+
+    for (uint32 i = 0; i < numRows; i++) {
+        uint64 position = column.offset + i;
+        T value = values[i];
+
+        if ((validity != nullptr && !(validity[position >> 3] & (1 << (position & 7)))) || value < 0
+            || (uint64) value > std::numeric_limits<uint32>::max()) {
+            return false;
+        }
+
+        array[(uint64) i * stride] = (uint32) value;
+    }
+
+    return true;
+}
+
+ArrowTable::ArrowTable(ArrowSchema* schema, ArrowArray* array)
+    : schema_(*schema), array_(*array), numRows_(0) {
+    // The structs are moved into the table, i.e., they must not be released by the caller...
+    schema->release = nullptr;
+    array->release = nullptr;
+
+    if (schema_.release == nullptr || array_.release == nullptr) {
+        error_ = "The record batch has already been released";
+        return;
+    }
+
+    if (schema_.format == nullptr || std::strcmp(schema_.format, "+s") != 0
+        || schema_.n_children != array_.n_children) {
+        error_ = "Only record batches or struct arrays are supported";
+        return;
+    }
+
+    if (array_.length < 0 || array_.length > std::numeric_limits<uint32>::max()) {
+        error_ = "The number of rows is not supported";
+        return;
+    }
+
+    if (array_.null_count != 0 && array_.n_buffers > 0 && array_.buffers[0] != nullptr) {
+        error_ = "Record batches with null rows are not supported";
+        return;
+    }
+
+    numRows_ = (uint32) array_.length;
+    uint64 numCols = (uint64) schema_.n_children;
+
+    for (uint64 i = 0; i < numCols; i++) {
+        const ArrowSchema& childSchema = *schema_.children[i];
+        const ArrowArray& childArray = *array_.children[i];
+        ArrowColumn column;
+        column.name = childSchema.name != nullptr ? childSchema.name : "";
+        column.nominal = childSchema.dictionary != nullptr;
+
+        if (!getType(childSchema.format, column.type) || childArray.n_buffers < 2
+            || childArray.length < array_.offset + array_.length
+            || (numRows_ > 0 && childArray.buffers[1] == nullptr)
+            || (column.nominal && (column.type == ARROW_BOOLEAN || column.type == ARROW_FLOAT32
+                                   || column.type == ARROW_FLOAT64 || childArray.dictionary == nullptr
+                                   || !readDictionary(*childSchema.dictionary, *childArray.dictionary,
+                                                      column.nominalValues)))) {
+            error_ = "Column '" + column.name + "' has an unsupported type";
+            columns_.clear();
+            return;
+        }
+
+        column.values = childArray.buffers[1];
+        column.validity = childArray.null_count != 0 ? static_cast<const uint8*>(childArray.buffers[0]) : nullptr;
+        column.offset = (uint64) (childArray.offset + array_.offset);
+        columns_.push_back(std::move(column));
+    }
+}
+
+ArrowTable::~ArrowTable() {
+    if (array_.release != nullptr) {
+        array_.release(&array_);
+    }
+
+    if (schema_.release != nullptr) {
+        schema_.release(&schema_);
+    }
+}
+
+bool ArrowTable::isValid() const {
+    return error_.empty();
+}
+
+const std::string& ArrowTable::getError() const {
+    return error_;
+}
+
+uint32 ArrowTable::getNumRows() const {
+    return numRows_;
+}
+
+uint32 ArrowTable::getNumCols() const {
+    return columns_.size();
+}
+
+const ArrowColumn& ArrowTable::getColumn(uint32 columnIndex) const {
+    return columns_[columnIndex];
+}
+
+bool ArrowTable::fetchColumn(uint32 columnIndex, uint32* array, uint32 stride) const {
+    const ArrowColumn& column = columns_[columnIndex];
+
+    switch (column.type) {
+        case ARROW_INT8:
+            return copyIntegers<int8_t>(column, numRows_, array, stride);
+        case ARROW_INT16:
+            return copyIntegers<int16_t>(column, numRows_, array, stride);
+        case ARROW_INT32:
+            return copyIntegers<int32_t>(column, numRows_, array, stride);
+        case ARROW_INT64:
+            return copyIntegers<int64_t>(column, numRows_, array, stride);
+        case ARROW_UINT8:
+            return copyIntegers<uint8_t>(column, numRows_, array, stride);
+        case ARROW_UINT16:
+            return copyIntegers<uint16_t>(column, numRows_, array, stride);
+        case ARROW_UINT32:
+            return copyIntegers<uint32_t>(column, numRows_, array, stride);
+        case ARROW_UINT64:
+            return copyIntegers<uint64_t>(column, numRows_, array, stride);
+        default:
+            return false;
+    }
+}
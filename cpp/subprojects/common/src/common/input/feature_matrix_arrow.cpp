@@ -0,0 +1,43 @@
+#include "common/input/feature_matrix_arrow.hpp"
+
+
+ArrowFeatureMatrix::ArrowFeatureMatrix(std::shared_ptr<const ArrowTable> tablePtr)
+    : tablePtr_(tablePtr) {
+
+}
+
+uint32 ArrowFeatureMatrix::getNumRows() const {
+    return tablePtr_->getNumRows();
+}
+
+uint32 ArrowFeatureMatrix::getNumCols() const {
+    return tablePtr_->getNumCols();
+}
+
+void ArrowFeatureMatrix::fetchFeatureVector(uint32 featureIndex,
+                                            std::unique_ptr<FeatureVector>& featureVectorPtr) const {
+    featureVectorPtr = std::make_unique<FeatureVector>(tablePtr_->getNumRows());
+    FeatureVector* featureVector = featureVectorPtr.get();
+    FeatureVector::iterator vectorIterator = featureVector->begin();
+    uint32 i = 0;
+
+    tablePtr_->forEach(featureIndex, [&](uint32 index, float32 value) {
+        if (value != value) {
+            // The value is NaN (because comparisons to NaN always evaluate to false)...
+            featureVector->addMissingIndex(index);
+        } else {
+            vectorIterator[i].index = index;
+            vectorIterator[i].value = value;
+            i++;
+        }
+    });
+
+    featureVector->setNumElements(i, true);
+}
+
+std::shared_ptr<const FeatureVector> ArrowFeatureMatrix::fetchSortedFeatureVector(uint32 featureIndex) const {
+    std::unique_ptr<FeatureVector> featureVectorPtr;
+    this->fetchFeatureVector(featureIndex, featureVectorPtr);
+    featureVectorPtr->sortByValues();
+    return std::move(featureVectorPtr);
+}
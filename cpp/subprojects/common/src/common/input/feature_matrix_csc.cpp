@@ -60,3 +60,10 @@ void CscFeatureMatrix::fetchFeatureVector(uint32 featureIndex, std::unique_ptr<F
 
     featureVectorPtr->setNumElements(i, true);
 }
+
+std::shared_ptr<const FeatureVector> CscFeatureMatrix::fetchSortedFeatureVector(uint32 featureIndex) const {
+    std::unique_ptr<FeatureVector> featureVectorPtr;
+    this->fetchFeatureVector(featureIndex, featureVectorPtr);
+    featureVectorPtr->sortByValues();
+    return std::move(featureVectorPtr);
+}
@@ -45,3 +45,10 @@ void FortranContiguousFeatureMatrix::fetchFeatureVector(uint32 featureIndex,
 
     featureVectorPtr->setNumElements(i, true);
 }
+
+std::shared_ptr<const FeatureVector> FortranContiguousFeatureMatrix::fetchSortedFeatureVector(uint32 featureIndex) const {
+    std::unique_ptr<FeatureVector> featureVectorPtr;
+    this->fetchFeatureVector(featureIndex, featureVectorPtr);
+    featureVectorPtr->sortByValues();
+    return std::move(featureVectorPtr);
+}
@@ -0,0 +1,223 @@
+#include "common/input/feature_matrix_memory_mapped.hpp"
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+const uint32 MAGIC_NUMBER = 0x4D464C52;
+
+const uint32 VERSION = 1;
+
+const uint64 HEADER_SIZE = 4 * sizeof(uint32);
+
+const uint64 ENTRY_SIZE = sizeof(uint64) + (2 * sizeof(uint32));
+
+const uint32 FLAG_SPARSE = 1;
+
+const uint32 FLAG_SORTED = 2;
+
+/**
+ * Provides access to the entry of a specific feature in a file that stores feature values in a columnar format.
+ */
+struct ColumnEntry {
+
+    /**
+     * The position of the feature's data in the file.
+     */
+    uint64 offset;
+
+    /**
+     * The number of elements that are stored for the feature.
+     */
+    uint32 numElements;
+
+    /**
+     * True, if the feature is stored in a sparse format, false otherwise.
+     */
+    bool sparse;
+
+    /**
+     * True, if the elements are sorted by their feature values, false otherwise.
+     */
+    bool sorted;
+
+};
+
+/**
+ * Reads a value of a specific type from a given position in memory, regardless of its alignment.
+ *
+ * @tparam T    The type of the value
+ * @param data  A pointer to the position in memory
+ * @return      The value that has been read
+ */
+template<class T>
+static inline T readValue(const uint8* data) {
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    return value;
+}
+
+/**
+ * Reads the entry of a specific feature.
+ *
+ * @param data          A pointer to the beginning of the file
+ * @param featureIndex  The index of the feature
+ * @return              A struct of type `ColumnEntry` that stores the entry
+ */
+static inline ColumnEntry readColumnEntry(const uint8* data, uint32 featureIndex) {
+    const uint8* entry = &data[HEADER_SIZE + (featureIndex * ENTRY_SIZE)];
+    ColumnEntry columnEntry;
+    columnEntry.offset = readValue<uint64>(entry);
+    columnEntry.numElements = readValue<uint32>(&entry[sizeof(uint64)]);
+    uint32 flags = readValue<uint32>(&entry[sizeof(uint64) + sizeof(uint32)]);
+    columnEntry.sparse = (flags & FLAG_SPARSE) != 0;
+    columnEntry.sorted = (flags & FLAG_SORTED) != 0;
+    return columnEntry;
+}
+
+/**
+ * Returns the number of bytes that are occupied by the data of a feature.
+ *
+ * @param columnEntry   A reference to an object of type `ColumnEntry` that stores the entry of the feature
+ * @return              The number of bytes
+ */
+static inline uint64 getColumnSize(const ColumnEntry& columnEntry) {
+    uint64 numElements = columnEntry.numElements;
+    uint64 numIndexBytes = columnEntry.sparse ? numElements * sizeof(uint32) : 0;
+    return numIndexBytes + (numElements * sizeof(float32)) + ((numElements + 7) / 8);
+}
+
+/**
+ * Returns whether a file that is mapped into memory is well-formed or not, i.e., whether the header and the data of
+ * all features are located within the file. The indices of sparse features are not validated, as this would require to
+ * read the entire file.
+ *
+ * @param data  A pointer to the beginning of the file
+ * @param size  The size of the file in bytes
+ * @return      True, if the file is well-formed, false otherwise
+ */
+static inline bool isWellFormed(const uint8* data, uint64 size) {
+    if (size < HEADER_SIZE || readValue<uint32>(data) != MAGIC_NUMBER
+        || readValue<uint32>(&data[sizeof(uint32)]) != VERSION) {
+        return false;
+    }
+
+    uint32 numRows = readValue<uint32>(&data[2 * sizeof(uint32)]);
+    uint64 numCols = readValue<uint32>(&data[3 * sizeof(uint32)]);
+
+    if (size < HEADER_SIZE + (numCols * ENTRY_SIZE)) {
+        return false;
+    }
+
+    for (uint32 i = 0; i < numCols; i++) {
+        ColumnEntry columnEntry = readColumnEntry(data, i);
+
+        if (columnEntry.offset % sizeof(float32) != 0 || columnEntry.offset > size
+            || getColumnSize(columnEntry) > size - columnEntry.offset
+            || (!columnEntry.sparse && columnEntry.numElements != numRows)
+            || (columnEntry.sparse && columnEntry.numElements > numRows)
+            || (columnEntry.sorted && !columnEntry.sparse)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+MemoryMappedFeatureMatrix::MemoryMappedFeatureMatrix(const std::string& path)
+    : data_(nullptr), size_(0), numRows_(0), numCols_(0) {
+    int fileDescriptor = open(path.c_str(), O_RDONLY);
+
+    if (fileDescriptor >= 0) {
+        struct stat fileStatus;
+
+        if (fstat(fileDescriptor, &fileStatus) == 0 && fileStatus.st_size > 0) {
+            uint64 size = (uint64) fileStatus.st_size;
+            void* data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fileDescriptor, 0);
+
+            if (data != MAP_FAILED) {
+                const uint8* bytes = static_cast<const uint8*>(data);
+
+                if (isWellFormed(bytes, size)) {
+                    data_ = bytes;
+                    size_ = size;
+                    numRows_ = readValue<uint32>(&bytes[2 * sizeof(uint32)]);
+                    numCols_ = readValue<uint32>(&bytes[3 * sizeof(uint32)]);
+                } else {
+                    munmap(data, size);
+                }
+            }
+        }
+
+        // The mapping remains valid after the file has been closed...
+        close(fileDescriptor);
+    }
+}
+
+MemoryMappedFeatureMatrix::~MemoryMappedFeatureMatrix() {
+    if (data_ != nullptr) {
+        munmap(const_cast<uint8*>(data_), size_);
+    }
+}
+
+bool MemoryMappedFeatureMatrix::isOpen() const {
+    return data_ != nullptr;
+}
+
+uint32 MemoryMappedFeatureMatrix::getNumRows() const {
+    return numRows_;
+}
+
+uint32 MemoryMappedFeatureMatrix::getNumCols() const {
+    return numCols_;
+}
+
+void MemoryMappedFeatureMatrix::fetchFeatureVector(uint32 featureIndex,
+                                                   std::unique_ptr<FeatureVector>& featureVectorPtr) const {
+    ColumnEntry columnEntry = readColumnEntry(data_, featureIndex);
+    uint32 numElements = columnEntry.numElements;
+    const uint8* columnData = &data_[columnEntry.offset];
+    const uint32* indices = nullptr;
+
+    if (columnEntry.sparse) {
+        indices = reinterpret_cast<const uint32*>(columnData);
+        columnData = &columnData[numElements * sizeof(uint32)];
+    }
+
+    const float32* values = reinterpret_cast<const float32*>(columnData);
+    const uint8* missing = &columnData[numElements * sizeof(float32)];
+    featureVectorPtr = std::make_unique<FeatureVector>(numElements);
+    FeatureVector::iterator vectorIterator = featureVectorPtr->begin();
+    uint32 n = 0;
+
+    for (uint32 i = 0; i < numElements; i++) {
+        uint32 index = indices != nullptr ? indices[i] : i;
+
+        // Elements with invalid indices are ignored...
+        if (index < numRows_) {
+            if (missing[i / 8] & (1 << (i % 8))) {
+                featureVectorPtr->addMissingIndex(index);
+            } else {
+                vectorIterator[n].index = index;
+                vectorIterator[n].value = values[i];
+                n++;
+            }
+        }
+    }
+
+    featureVectorPtr->setNumElements(n, true);
+}
+
+std::shared_ptr<const FeatureVector> MemoryMappedFeatureMatrix::fetchSortedFeatureVector(uint32 featureIndex) const {
+    std::unique_ptr<FeatureVector> featureVectorPtr;
+    this->fetchFeatureVector(featureIndex, featureVectorPtr);
+
+    // Features that have been sorted in advance must not be sorted again...
+    if (!readColumnEntry(data_, featureIndex).sorted) {
+        featureVectorPtr->sortByValues();
+    }
+
+    return std::move(featureVectorPtr);
+}
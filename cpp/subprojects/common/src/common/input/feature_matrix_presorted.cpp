@@ -0,0 +1,43 @@
+#include "common/input/feature_matrix_presorted.hpp"
+#include "common/data/arrays.hpp"
+#include "omp.h"
+
+
+PresortedFeatureMatrix::PresortedFeatureMatrix(std::shared_ptr<IFeatureMatrix> featureMatrixPtr, uint32 numThreads)
+    : featureMatrixPtr_(featureMatrixPtr), sortedFeatureVectors_(featureMatrixPtr->getNumCols()) {
+    uint32 numFeatures = featureMatrixPtr->getNumCols();
+    const IFeatureMatrix* featureMatrixRawPtr = featureMatrixPtr.get();
+    std::vector<std::shared_ptr<const FeatureVector>>* sortedFeatureVectorsPtr = &sortedFeatureVectors_;
+
+    #pragma omp parallel for firstprivate(numFeatures) firstprivate(featureMatrixRawPtr) \
+    firstprivate(sortedFeatureVectorsPtr) schedule(dynamic) num_threads(numThreads)
+    for (intp i = 0; i < numFeatures; i++) {
+        (*sortedFeatureVectorsPtr)[i] = featureMatrixRawPtr->fetchSortedFeatureVector(i);
+    }
+}
+
+uint32 PresortedFeatureMatrix::getNumRows() const {
+    return featureMatrixPtr_->getNumRows();
+}
+
+uint32 PresortedFeatureMatrix::getNumCols() const {
+    return featureMatrixPtr_->getNumCols();
+}
+
+void PresortedFeatureMatrix::fetchFeatureVector(uint32 featureIndex,
+                                                std::unique_ptr<FeatureVector>& featureVectorPtr) const {
+    // The feature vector is copied from the sorted one, as the caller may modify it...
+    const FeatureVector& sortedFeatureVector = *sortedFeatureVectors_[featureIndex];
+    uint32 numElements = sortedFeatureVector.getNumElements();
+    featureVectorPtr = std::make_unique<FeatureVector>(numElements);
+    copyArray(sortedFeatureVector.cbegin(), featureVectorPtr->begin(), numElements);
+
+    for (auto it = sortedFeatureVector.missing_indices_cbegin(); it != sortedFeatureVector.missing_indices_cend();
+         it++) {
+        featureVectorPtr->addMissingIndex(*it);
+    }
+}
+
+std::shared_ptr<const FeatureVector> PresortedFeatureMatrix::fetchSortedFeatureVector(uint32 featureIndex) const {
+    return sortedFeatureVectors_[featureIndex];
+}
@@ -0,0 +1,302 @@
+#include "common/input/feature_vector_compressed.hpp"
+#include <algorithm>
+#include <limits>
+
+
+/**
+ * Returns the number of bits that are required to represent a specific integer.
+ *
+ * @param value The integer
+ * @return      The number of bits
+ */
+static inline uint32 getNumBits(uint64 value) {
+    uint32 numBits = 0;
+
+    while (value > 0) {
+        numBits++;
+        value >>= 1;
+    }
+
+    return numBits;
+}
+
+/**
+ * Maps a signed difference between two example indices to an unsigned integer, such that differences with a small
+ * absolute value result in small integers.
+ *
+ * @param difference    The difference
+ * @return              The unsigned integer
+ */
+static inline uint64 encodeZigzag(int64_t difference) {
+    return difference < 0 ? (((uint64) -difference) << 1) - 1 : ((uint64) difference) << 1;
+}
+
+/**
+ * Maps an unsigned integer that has been created via the function `encodeZigzag` back to the original difference.
+ *
+ * @param value The unsigned integer
+ * @return      The difference, represented by its two's complement
+ */
+static inline uint32 decodeZigzag(uint32 value) {
+    return (value >> 1) ^ (0 - (value & 1));
+}
+
+/**
+ * Writes an integer with a specific number of bits into an array of bit-packed integers.
+ *
+ * @param words     A pointer to an array of type `uint32` that stores the bit-packed integers
+ * @param position  The position of the first bit to be written
+ * @param width     The number of bits to be written
+ * @param value     The integer to be written
+ */
+static inline void packInteger(uint32* words, uint64 position, uint32 width, uint32 value) {
+    uint64 wordIndex = position >> 5;
+    uint32 shift = (uint32) (position & 31);
+    words[wordIndex] |= value << shift;
+
+    if (shift + width > 32) {
+        words[wordIndex + 1] |= value >> (32 - shift);
+    }
+}
+
+/**
+ * Reads a specific number of integers from an array of bit-packed integers.
+ *
+ * @param words         A pointer to an array of type `uint32` that stores the bit-packed integers. The array must
+ *                      contain at least one additional word after the last one that stores the integers
+ * @param width         The number of bits per integer
+ * @param numIntegers   The number of integers to be read
+ * @param buffer        A pointer to an array of type `uint32`, shape `(numIntegers)`, the integers should be written to
+ */
+static inline void unpackIntegers(const uint32* words, uint32 width, uint32 numIntegers, uint32* buffer) {
+    if (width == 0) {
+        for (uint32 i = 0; i < numIntegers; i++) {
+            buffer[i] = 0;
+        }
+    } else {
+        uint64 mask = (((uint64) 1) << width) - 1;
+
+        for (uint32 i = 0; i < numIntegers; i++) {
+            uint64 position = (uint64) i * width;
+            uint64 wordIndex = position >> 5;
+            uint64 window = ((uint64) words[wordIndex]) | (((uint64) words[wordIndex + 1]) << 32);
+            buffer[i] = (uint32) ((window >> (position & 31)) & mask);
+        }
+    }
+}
+
+CompressedFeatureVector::CompressedFeatureVector(const FeatureVector& featureVector)
+    : numElements_(featureVector.getNumElements()) {
+    FeatureVector::const_iterator iterator = featureVector.cbegin();
+    uint32 numBlocks = (numElements_ + COMPRESSED_BLOCK_SIZE - 1) / COMPRESSED_BLOCK_SIZE;
+    blocks_.reserve(numBlocks);
+
+    // Encode the example indices block-wise...
+    for (uint32 i = 0; i < numBlocks; i++) {
+        uint32 start = i * COMPRESSED_BLOCK_SIZE;
+        uint32 end = std::min(start + COMPRESSED_BLOCK_SIZE, numElements_);
+        uint32 firstIndex = iterator[start].index;
+        uint32 minIndex = firstIndex;
+        uint32 maxIndex = firstIndex;
+        uint64 maxDifference = 0;
+
+        for (uint32 j = start + 1; j < end; j++) {
+            uint32 index = iterator[j].index;
+            minIndex = std::min(minIndex, index);
+            maxIndex = std::max(maxIndex, index);
+            int64_t difference = (int64_t) index - (int64_t) iterator[j - 1].index;
+            maxDifference = std::max(maxDifference, encodeZigzag(difference));
+        }
+
+        uint32 referenceWidth = getNumBits(maxIndex - minIndex);
+        uint32 deltaWidth = getNumBits(maxDifference);
+        Block block;
+        block.offset = (uint32) words_.size();
+        block.delta = deltaWidth < referenceWidth;
+        block.base = block.delta ? firstIndex : minIndex;
+        block.width = (uint8) (block.delta ? deltaWidth : referenceWidth);
+
+        if (block.width > 0) {
+            uint64 numWords = (((uint64) (end - start) * block.width) + 31) >> 5;
+            words_.resize(words_.size() + numWords, 0);
+            uint32* words = &words_[block.offset];
+
+            for (uint32 j = start; j < end; j++) {
+                uint32 value;
+
+                if (block.delta) {
+                    int64_t difference = j > start ? (int64_t) iterator[j].index - (int64_t) iterator[j - 1].index : 0;
+                    value = (uint32) encodeZigzag(difference);
+                } else {
+                    value = iterator[j].index - minIndex;
+                }
+
+                packInteger(words, (uint64) (j - start) * block.width, block.width, value);
+            }
+        }
+
+        blocks_.push_back(block);
+    }
+
+    // Add an additional word, which allows to read two consecutive words at once when unpacking the integers...
+    words_.push_back(0);
+    words_.shrink_to_fit();
+
+    // Encode the values in the representation that requires the least memory...
+    uint32 numDistinctValues = 0;
+
+    for (uint32 i = 0; i < numElements_; i++) {
+        if (i == 0 || iterator[i].value != iterator[i - 1].value) {
+            numDistinctValues++;
+        }
+    }
+
+    uint32 width = numDistinctValues > 0 ? getNumBits(numDistinctValues - 1) : 0;
+    uint64 numCodeWords = (((uint64) numElements_ * width) + 31) >> 5;
+    uint64 numBytesRaw = (uint64) numElements_ * sizeof(float32);
+    uint64 numBytesRuns = (uint64) numDistinctValues * (sizeof(float32) + sizeof(uint32));
+    uint64 numBytesCodes = ((uint64) numDistinctValues * sizeof(float32)) + ((numCodeWords + 1) * sizeof(uint32));
+    codeWidth_ = (uint8) width;
+
+    if (numBytesRuns <= numBytesCodes && numBytesRuns < numBytesRaw) {
+        // Store the values as runs of equal values...
+        values_.reserve(numDistinctValues);
+        runEnds_.reserve(numDistinctValues);
+
+        for (uint32 i = 0; i < numElements_; i++) {
+            float32 value = iterator[i].value;
+
+            if (i == 0 || value != values_.back()) {
+                if (i > 0) {
+                    runEnds_.push_back(i);
+                }
+
+                values_.push_back(value);
+            }
+        }
+
+        runEnds_.push_back(numElements_);
+    } else if (numBytesCodes < numBytesRaw) {
+        // Store the values as rank codes. An additional word is added, which allows to read two consecutive words at
+        // once when unpacking the codes...
+        values_.reserve(numDistinctValues);
+        codeWords_.resize(numCodeWords + 1, 0);
+        uint32 code = 0;
+
+        for (uint32 i = 0; i < numElements_; i++) {
+            float32 value = iterator[i].value;
+
+            if (i == 0 || value != values_.back()) {
+                code = (uint32) values_.size();
+                values_.push_back(value);
+            }
+
+            if (width > 0) {
+                packInteger(codeWords_.data(), (uint64) i * width, width, code);
+            }
+        }
+    } else {
+        // Store the values as they are...
+        values_.reserve(numElements_);
+
+        for (uint32 i = 0; i < numElements_; i++) {
+            values_.push_back(iterator[i].value);
+        }
+    }
+
+    for (auto it = featureVector.missing_indices_cbegin(); it != featureVector.missing_indices_cend(); it++) {
+        missingIndices_.push_back(*it);
+    }
+
+    missingIndices_.shrink_to_fit();
+}
+
+void CompressedFeatureVector::decodeBlock(uint32 blockIndex, IndexedValue<float32>* buffer) const {
+    const Block& block = blocks_[blockIndex];
+    uint32 start = blockIndex * COMPRESSED_BLOCK_SIZE;
+    uint32 numElements = std::min(COMPRESSED_BLOCK_SIZE, numElements_ - start);
+    uint32 integers[COMPRESSED_BLOCK_SIZE];
+
+    // Decode the example indices...
+    unpackIntegers(words_.data() + block.offset, block.width, numElements, integers);
+    uint32 base = block.base;
+
+    if (block.delta) {
+        for (uint32 i = 0; i < numElements; i++) {
+            base += decodeZigzag(integers[i]);
+            buffer[i].index = base;
+        }
+    } else {
+        for (uint32 i = 0; i < numElements; i++) {
+            buffer[i].index = base + integers[i];
+        }
+    }
+
+    // Decode the values...
+    if (!runEnds_.empty()) {
+        uint32 run = (uint32) (std::upper_bound(runEnds_.cbegin(), runEnds_.cend(), start) - runEnds_.cbegin());
+
+        for (uint32 i = 0; i < numElements; i++) {
+            while (runEnds_[run] <= start + i) {
+                run++;
+            }
+
+            buffer[i].value = values_[run];
+        }
+    } else if (!codeWords_.empty()) {
+        // As the number of elements in a block is a multiple of 32, the codes of each block start at a new word...
+        unpackIntegers(codeWords_.data() + ((uint64) start * codeWidth_ >> 5), codeWidth_, numElements, integers);
+
+        for (uint32 i = 0; i < numElements; i++) {
+            buffer[i].value = values_[integers[i]];
+        }
+    } else {
+        for (uint32 i = 0; i < numElements; i++) {
+            buffer[i].value = values_[start + i];
+        }
+    }
+}
+
+CompressedFeatureVector::BlockIterator::BlockIterator(const CompressedFeatureVector& vector)
+    : vector_(&vector), blockIndex_(std::numeric_limits<uint32>::max()) {
+
+}
+
+CompressedFeatureVector::const_iterator CompressedFeatureVector::cbegin() const {
+    return BlockIterator(*this);
+}
+
+CompressedFeatureVector::missing_index_const_iterator CompressedFeatureVector::missing_indices_cbegin() const {
+    return missingIndices_.cbegin();
+}
+
+CompressedFeatureVector::missing_index_const_iterator CompressedFeatureVector::missing_indices_cend() const {
+    return missingIndices_.cend();
+}
+
+uint32 CompressedFeatureVector::getNumElements() const {
+    return numElements_;
+}
+
+uint64 CompressedFeatureVector::getNumBytes() const {
+    return sizeof(CompressedFeatureVector) + (blocks_.capacity() * sizeof(Block))
+           + (words_.capacity() * sizeof(uint32)) + (values_.capacity() * sizeof(float32))
+           + (runEnds_.capacity() * sizeof(uint32)) + (codeWords_.capacity() * sizeof(uint32))
+           + (missingIndices_.capacity() * sizeof(uint32));
+}
+
+std::unique_ptr<FeatureVector> CompressedFeatureVector::decompress() const {
+    std::unique_ptr<FeatureVector> featureVectorPtr = std::make_unique<FeatureVector>(numElements_);
+    FeatureVector::iterator iterator = featureVectorPtr->begin();
+    uint32 numBlocks = (uint32) blocks_.size();
+
+    for (uint32 i = 0; i < numBlocks; i++) {
+        decodeBlock(i, &iterator[i * COMPRESSED_BLOCK_SIZE]);
+    }
+
+    for (auto it = missingIndices_.cbegin(); it != missingIndices_.cend(); it++) {
+        featureVectorPtr->addMissingIndex(*it);
+    }
+
+    return featureVectorPtr;
+}
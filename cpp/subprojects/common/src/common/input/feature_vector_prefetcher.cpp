@@ -0,0 +1,172 @@
+#include "common/input/feature_vector_prefetcher.hpp"
+
+
+FeatureVectorPrefetcher::FeatureVectorPrefetcher(std::shared_ptr<IFeatureMatrix> featureMatrixPtr, uint32 windowSize)
+    : featureMatrixPtr_(featureMatrixPtr), windowSize_(windowSize), numRequests_(0), numPassedRequests_(0),
+      loading_(false), loadingFeatureIndex_(0), generation_(0), stopped_(false) {
+    thread_ = std::thread(&FeatureVectorPrefetcher::run, this);
+}
+
+FeatureVectorPrefetcher::~FeatureVectorPrefetcher() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+    }
+
+    condition_.notify_all();
+    thread_.join();
+}
+
+bool FeatureVectorPrefetcher::isPassed(uint32 requestIndex) const {
+    // A request is passed, if a feature vector that has been requested more than `windowSize_` requests later has
+    // already been retrieved...
+    return requestIndex + windowSize_ < numPassedRequests_;
+}
+
+void FeatureVectorPrefetcher::evictPassedEntries() {
+    for (auto it = window_.begin(); it != window_.end();) {
+        if (isPassed(it->second.requestIndex)) {
+            it = window_.erase(it);
+        } else {
+            it++;
+        }
+    }
+}
+
+std::shared_ptr<const FeatureVector> FeatureVectorPrefetcher::retain(
+        uint32 featureIndex, std::shared_ptr<const FeatureVector> featureVectorPtr) {
+    // If the same feature vector has been retained by another thread in the meantime, the existing one is used...
+    auto result = retained_.emplace(featureIndex, std::move(featureVectorPtr));
+    std::shared_ptr<const FeatureVector> retainedVectorPtr = result.first->second;
+
+    if (result.second) {
+        retainedOrder_.push_back(featureIndex);
+
+        // The feature vectors that have been retrieved least recently are evicted. They are not freed as long as the
+        // callers that currently use them hold them...
+        while (retainedOrder_.size() > windowSize_) {
+            retained_.erase(retainedOrder_.front());
+            retainedOrder_.pop_front();
+        }
+    }
+
+    return retainedVectorPtr;
+}
+
+void FeatureVectorPrefetcher::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (true) {
+        // Wait until a feature vector has been requested and there is space left in the window...
+        condition_.wait(lock, [this] {
+            return stopped_ || (!queue_.empty() && window_.size() < windowSize_);
+        });
+
+        if (stopped_) {
+            return;
+        }
+
+        uint32 featureIndex = queue_.front().first;
+        uint32 requestIndex = queue_.front().second;
+        queue_.pop_front();
+
+        // Requests that have been processed by the calling thread in the meantime, or that have been passed, are
+        // skipped...
+        if (queuedFeatureIndices_.erase(featureIndex) == 0 || isPassed(requestIndex)) {
+            continue;
+        }
+
+        uint32 generation = generation_;
+        loading_ = true;
+        loadingFeatureIndex_ = featureIndex;
+        lock.unlock();
+        std::shared_ptr<const FeatureVector> featureVectorPtr = featureMatrixPtr_->fetchSortedFeatureVector(
+            featureIndex);
+        lock.lock();
+        loading_ = false;
+
+        // Feature vectors that have been discarded while they were fetched are not added to the window...
+        if (generation == generation_) {
+            WindowEntry& entry = window_[featureIndex];
+            entry.vectorPtr = std::move(featureVectorPtr);
+            entry.requestIndex = requestIndex;
+        }
+
+        condition_.notify_all();
+    }
+}
+
+void FeatureVectorPrefetcher::prefetch(uint32 featureIndex) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if ((loading_ && loadingFeatureIndex_ == featureIndex) || window_.find(featureIndex) != window_.end()
+            || retained_.find(featureIndex) != retained_.end() || !queuedFeatureIndices_.insert(featureIndex).second) {
+            return;
+        }
+
+        queue_.emplace_back(featureIndex, numRequests_);
+        numRequests_++;
+    }
+
+    condition_.notify_all();
+}
+
+void FeatureVectorPrefetcher::clear() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        generation_++;
+        queue_.clear();
+        queuedFeatureIndices_.clear();
+        window_.clear();
+        retained_.clear();
+        retainedOrder_.clear();
+        numRequests_ = 0;
+        numPassedRequests_ = 0;
+    }
+
+    condition_.notify_all();
+}
+
+std::shared_ptr<const FeatureVector> FeatureVectorPrefetcher::get(uint32 featureIndex) {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (true) {
+        auto retainedIterator = retained_.find(featureIndex);
+
+        if (retainedIterator != retained_.end()) {
+            return retainedIterator->second;
+        }
+
+        auto windowIterator = window_.find(featureIndex);
+
+        if (windowIterator != window_.end()) {
+            uint32 requestIndex = windowIterator->second.requestIndex;
+            std::shared_ptr<const FeatureVector> featureVectorPtr = retain(featureIndex,
+                                                                           std::move(windowIterator->second.vectorPtr));
+            window_.erase(windowIterator);
+
+            // Feature vectors that have been requested before the retrieved one, but have not been retrieved within
+            // the window, are not expected to be used anymore...
+            if (requestIndex + 1 > numPassedRequests_) {
+                numPassedRequests_ = requestIndex + 1;
+                evictPassedEntries();
+            }
+
+            lock.unlock();
+            condition_.notify_all();
+            return featureVectorPtr;
+        } else if (loading_ && loadingFeatureIndex_ == featureIndex) {
+            condition_.wait(lock);
+        } else {
+            break;
+        }
+    }
+
+    // The feature vector has not been fetched in the background, i.e., it must be fetched by the calling thread...
+    queuedFeatureIndices_.erase(featureIndex);
+    lock.unlock();
+    std::shared_ptr<const FeatureVector> featureVectorPtr = featureMatrixPtr_->fetchSortedFeatureVector(featureIndex);
+    lock.lock();
+    return retain(featureIndex, std::move(featureVectorPtr));
+}
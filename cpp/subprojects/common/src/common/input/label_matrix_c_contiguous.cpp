@@ -4,53 +4,179 @@
 #include "common/sampling/instance_sampling.hpp"
 
 
-CContiguousLabelMatrix::CContiguousLabelMatrix(uint32 numRows, uint32 numCols, const uint32* array)
-    : timeSlots_(DenseVector<uint32>(numRows)), indices_(DenseVector<uint32>(numRows)),
-      values_(DenseVector<uint32>(numRows)) {
-    DenseVector<uint32>::iterator timeSlotIterator = timeSlots_.begin();
-    DenseVector<uint32>::iterator indexIterator = indices_.begin();
-    DenseVector<uint32>::iterator valueIterator = values_.begin();
-    uint32 exampleIndex = 0;
+/**
+ * Determines the number of time slots, given the labels of several examples that are stored in a C-contiguous array.
+ *
+ * @param numRows   The number of rows in the array
+ * @param numCols   The number of columns in the array
+ * @param array     A pointer to a C-contiguous array of type `uint32` that stores the labels
+ * @return          The number of time slots
+ */
+static inline uint32 countTimeSlots(uint32 numRows, uint32 numCols, const uint32* array) {
+    uint32 numTimeSlots = numRows > 0 ? 1 : 0;
+
+    for (uint32 i = 1; i < numRows; i++) {
+        if (array[i * numCols] != array[(i - 1) * numCols]) {
+            numTimeSlots++;
+        }
+    }
+
+    return numTimeSlots;
+}
+
+/**
+ * Copies the indices of the time slots the examples belong to, as well as the ground truth of the individual time slots,
+ * from a C-contiguous array.
+ *
+ * @tparam TimeSlot The type of the indices of the time slots
+ * @param numRows   The number of rows in the array
+ * @param numCols   The number of columns in the array
+ * @param array     A pointer to a C-contiguous array of type `uint32` that stores the labels
+ * @param timeSlots A pointer to an array of template type `TimeSlot`, shape `(numRows)`, the index of the time slot
+ *                  each example belongs to should be written to
+ * @param values    A pointer to an array of type `uint32`, shape `(numTimeSlots)`, the ground truth of each time slot
+ *                  should be written to
+ * @param indices   A pointer to an array of type `uint32`, shape `(numTimeSlots + 1)`, the index of the first example
+ *                  that belongs to each time slot should be written to
+ */
+template<typename TimeSlot>
+static inline void copyLabels(uint32 numRows, uint32 numCols, const uint32* array, TimeSlot* timeSlots,
+                              uint32* values, uint32* indices) {
+    uint32 timeSlotIndex = 0;
+
+    if (numRows > 0) {
+        timeSlots[0] = (TimeSlot) timeSlotIndex;
+        indices[timeSlotIndex] = 0;
+        values[timeSlotIndex] = array[1];
+        uint32 previousTimestamp = array[0];
+
+        for (uint32 exampleIndex = 1; exampleIndex < numRows; exampleIndex++) {
+            uint32 offset = exampleIndex * numCols;
+            uint32 timestamp = array[offset];
+
+            if (timestamp != previousTimestamp) {
+                timeSlotIndex++;
+                indices[timeSlotIndex] = exampleIndex;
+                values[timeSlotIndex] = array[offset + 1];
+                previousTimestamp = timestamp;
+            }
+
+            timeSlots[exampleIndex] = (TimeSlot) timeSlotIndex;
+        }
+
+        timeSlotIndex++;
+    }
+
+    indices[timeSlotIndex] = numRows;
+}
+
+/**
+ * Determines the index of the first example that belongs to each time slot.
+ *
+ * @tparam TimeSlot     The type of the indices of the time slots
+ * @param numRows       The number of examples
+ * @param numTimeSlots  The number of time slots
+ * @param timeSlots     A pointer to an array of template type `TimeSlot`, shape `(numRows)`, that stores the index of
+ *                      the time slot each example belongs to in increasing order. Indices that are out of range do
+ *                      not result in writing past the end of the array `indices`
+ * @param indices       A pointer to an array of type `uint32`, shape `(numTimeSlots + 1)`, the indices should be
+ *                      written to
+ */
+template<typename TimeSlot>
+static inline void initializeIndices(uint32 numRows, uint32 numTimeSlots, const TimeSlot* timeSlots,
+                                     uint32* indices) {
     uint32 timeSlotIndex = 0;
-    timeSlotIterator[exampleIndex] = timeSlotIndex;
-    indexIterator[timeSlotIndex] = exampleIndex;
-    valueIterator[timeSlotIndex] = array[1];
-    uint32 previousTimestamp = array[0];
 
-    for (exampleIndex = exampleIndex + 1; exampleIndex < numRows; exampleIndex++) {
-        uint32 offset = exampleIndex * numCols;
-        uint32 timestamp = array[offset];
+    for (uint32 exampleIndex = 0; exampleIndex < numRows; exampleIndex++) {
+        uint32 currentTimeSlotIndex = timeSlots[exampleIndex];
 
-        if (timestamp != previousTimestamp) {
+        while (timeSlotIndex <= currentTimeSlotIndex && timeSlotIndex < numTimeSlots) {
+            indices[timeSlotIndex] = exampleIndex;
             timeSlotIndex++;
-            indexIterator[timeSlotIndex] = exampleIndex;
-            valueIterator[timeSlotIndex] = array[offset + 1];
-            previousTimestamp = timestamp;
         }
+    }
 
-        timeSlotIterator[exampleIndex] = timeSlotIndex;
+    while (timeSlotIndex <= numTimeSlots) {
+        indices[timeSlotIndex] = numRows;
+        timeSlotIndex++;
     }
+}
+
+CContiguousLabelMatrix::CContiguousLabelMatrix(uint32 numRows, uint32 numCols, const uint32* array)
+    : numRows_(numRows), numTimeSlots_(countTimeSlots(numRows, numCols, array)),
+      valueVectorPtr_(std::make_unique<DenseVector<uint32>>(numTimeSlots_)), timeSlots_(nullptr),
+      compactTimeSlots_(nullptr), values_(valueVectorPtr_->cbegin()),
+      indices_(DenseVector<uint32>(numTimeSlots_ + 1)), numSubsetRows_(numRows), subsetIndices_(nullptr) {
+    if (numTimeSlots_ <= MAX_NUM_COMPACT_TIME_SLOTS) {
+        compactTimeSlotVectorPtr_ = std::make_unique<DenseVector<uint16>>(numRows);
+        compactTimeSlots_ = compactTimeSlotVectorPtr_->cbegin();
+        copyLabels(numRows, numCols, array, compactTimeSlotVectorPtr_->begin(), valueVectorPtr_->begin(),
+                   indices_.begin());
+    } else {
+        timeSlotVectorPtr_ = std::make_unique<DenseVector<uint32>>(numRows);
+        timeSlots_ = timeSlotVectorPtr_->cbegin();
+        copyLabels(numRows, numCols, array, timeSlotVectorPtr_->begin(), valueVectorPtr_->begin(), indices_.begin());
+    }
+}
 
-    uint32 numTimeSlots = timeSlotIndex + 1;
-    indexIterator[timeSlotIndex + 1] = numRows;
-    indices_.setNumElements(numTimeSlots + 1, true);
-    values_.setNumElements(numTimeSlots, true);
+CContiguousLabelMatrix::CContiguousLabelMatrix(uint32 numRows, uint32 numTimeSlots, const uint32* timeSlots,
+                                               const uint32* values)
+    : numRows_(numRows), numTimeSlots_(numTimeSlots), timeSlots_(timeSlots), compactTimeSlots_(nullptr),
+      values_(values), indices_(DenseVector<uint32>(numTimeSlots + 1)), numSubsetRows_(numRows),
+      subsetIndices_(nullptr) {
+    initializeIndices(numRows, numTimeSlots, timeSlots, indices_.begin());
+}
+
+CContiguousLabelMatrix::CContiguousLabelMatrix(uint32 numRows, uint32 numTimeSlots, const uint32* timeSlots,
+                                               const uint32* values, uint32 numSubsetRows,
+                                               const uint32* subsetIndices)
+    : CContiguousLabelMatrix(numRows, numTimeSlots, timeSlots, values) {
+    numSubsetRows_ = numSubsetRows;
+    subsetIndices_ = subsetIndices;
+}
+
+CContiguousLabelMatrix::CContiguousLabelMatrix(uint32 numRows, uint32 numTimeSlots, const uint16* timeSlots,
+                                               const uint32* values)
+    : numRows_(numRows), numTimeSlots_(numTimeSlots), timeSlots_(nullptr), compactTimeSlots_(timeSlots),
+      values_(values), indices_(DenseVector<uint32>(numTimeSlots + 1)), numSubsetRows_(numRows),
+      subsetIndices_(nullptr) {
+    initializeIndices(numRows, numTimeSlots, timeSlots, indices_.begin());
+}
+
+CContiguousLabelMatrix::CContiguousLabelMatrix(uint32 numRows, uint32 numTimeSlots, const uint16* timeSlots,
+                                               const uint32* values, uint32 numSubsetRows,
+                                               const uint32* subsetIndices)
+    : CContiguousLabelMatrix(numRows, numTimeSlots, timeSlots, values) {
+    numSubsetRows_ = numSubsetRows;
+    subsetIndices_ = subsetIndices;
+}
+
+bool CContiguousLabelMatrix::hasCompactTimeSlots() const {
+    return compactTimeSlots_ != nullptr;
 }
 
 CContiguousLabelMatrix::index_const_iterator CContiguousLabelMatrix::time_slots_cbegin() const {
-    return timeSlots_.cbegin();
+    return timeSlots_;
 }
 
 CContiguousLabelMatrix::index_const_iterator CContiguousLabelMatrix::time_slots_cend() const {
-    return timeSlots_.cend();
+    return &timeSlots_[numRows_];
+}
+
+CContiguousLabelMatrix::compact_index_const_iterator CContiguousLabelMatrix::compact_time_slots_cbegin() const {
+    return compactTimeSlots_;
+}
+
+CContiguousLabelMatrix::compact_index_const_iterator CContiguousLabelMatrix::compact_time_slots_cend() const {
+    return &compactTimeSlots_[numRows_];
 }
 
 CContiguousLabelMatrix::value_const_iterator CContiguousLabelMatrix::values_cbegin() const {
-    return values_.cbegin();
+    return values_;
 }
 
 CContiguousLabelMatrix::value_const_iterator CContiguousLabelMatrix::values_cend() const {
-    return values_.cend();
+    return &values_[numTimeSlots_];
 }
 
 CContiguousLabelMatrix::index_const_iterator CContiguousLabelMatrix::indices_cbegin() const {
@@ -61,8 +187,24 @@ CContiguousLabelMatrix::index_const_iterator CContiguousLabelMatrix::indices_cen
     return indices_.cend();
 }
 
+bool CContiguousLabelMatrix::isSubset() const {
+    return numSubsetRows_ < numRows_;
+}
+
+CContiguousLabelMatrix::index_const_iterator CContiguousLabelMatrix::subset_indices_cbegin() const {
+    return subsetIndices_;
+}
+
+CContiguousLabelMatrix::index_const_iterator CContiguousLabelMatrix::subset_indices_cend() const {
+    return &subsetIndices_[numSubsetRows_];
+}
+
+uint32 CContiguousLabelMatrix::getNumSubsetRows() const {
+    return numSubsetRows_;
+}
+
 uint32 CContiguousLabelMatrix::getNumRows() const {
-    return timeSlots_.getNumElements();
+    return numRows_;
 }
 
 uint32 CContiguousLabelMatrix::getNumCols() const {
@@ -70,7 +212,7 @@ uint32 CContiguousLabelMatrix::getNumCols() const {
 }
 
 uint32 CContiguousLabelMatrix::getNumTimeSlots() const {
-    return values_.getNumElements();
+    return numTimeSlots_;
 }
 
 std::unique_ptr<IStatisticsProvider> CContiguousLabelMatrix::createStatisticsProvider(
@@ -82,3 +224,13 @@ std::unique_ptr<IPartitionSampling> CContiguousLabelMatrix::createPartitionSampl
         const IPartitionSamplingFactory& factory) const {
     return factory.create(*this);
 }
+
+std::unique_ptr<IInstanceSubSampling> CContiguousLabelMatrix::createInstanceSubSampling(
+        const IInstanceSubSamplingFactory& factory, const SinglePartition& partition) const {
+    return factory.create(*this, partition);
+}
+
+std::unique_ptr<IInstanceSubSampling> CContiguousLabelMatrix::createInstanceSubSampling(
+        const IInstanceSubSamplingFactory& factory, BiPartition& partition) const {
+    return factory.create(*this, partition);
+}
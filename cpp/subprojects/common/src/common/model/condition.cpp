@@ -1,4 +1,6 @@
 #include "common/model/condition.hpp"
+#include "common/rule_induction/checkpoint.hpp"
+
 
 Condition::Condition() {
 
@@ -9,3 +11,23 @@ Condition::Condition(const Condition& condition)
       start(condition.start), end(condition.end), covered(condition.covered), numCovered(condition.numCovered) {
 
 }
+
+void Condition::serialize(CheckpointWriter& writer) const {
+    writer.write<uint32>(featureIndex);
+    writer.write<uint32>((uint32) comparator);
+    writer.write<float32>(threshold);
+    writer.write<intp>(start);
+    writer.write<intp>(end);
+    writer.write<uint8>(covered ? 1 : 0);
+    writer.write<uint32>(numCovered);
+}
+
+void Condition::deserialize(CheckpointReader& reader) {
+    featureIndex = reader.read<uint32>();
+    comparator = (Comparator) reader.read<uint32>();
+    threshold = reader.read<float32>();
+    start = reader.read<intp>();
+    end = reader.read<intp>();
+    covered = reader.read<uint8>() != 0;
+    numCovered = reader.read<uint32>();
+}
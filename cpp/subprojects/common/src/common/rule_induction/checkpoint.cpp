@@ -0,0 +1,162 @@
+#include "common/rule_induction/checkpoint.hpp"
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <fcntl.h>
+#include <unistd.h>
+
+
+template<class T>
+void CheckpointWriter::write(T value) {
+    this->writeArray<T>(&value, 1);
+}
+
+template<class T>
+void CheckpointWriter::writeArray(const T* array, uint32 numElements) {
+    const uint8* bytes = reinterpret_cast<const uint8*>(array);
+    buffer_.insert(buffer_.end(), bytes, bytes + (numElements * sizeof(T)));
+}
+
+void CheckpointWriter::append(const CheckpointWriter& writer) {
+    buffer_.insert(buffer_.end(), writer.buffer_.begin(), writer.buffer_.end());
+}
+
+uint32 CheckpointWriter::getNumBytes() const {
+    return (uint32) buffer_.size();
+}
+
+const uint8* CheckpointWriter::getData() const {
+    return buffer_.data();
+}
+
+void CheckpointWriter::clear() {
+    buffer_.clear();
+}
+
+bool CheckpointWriter::save(const std::string& path) const {
+    std::string tmpPath = path + ".tmp";
+    int fd = open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+    if (fd < 0) {
+        return false;
+    }
+
+    const uint8* data = buffer_.data();
+    size_t numRemainingBytes = buffer_.size();
+    bool success = true;
+
+    while (numRemainingBytes > 0) {
+        ssize_t numBytes = ::write(fd, data, numRemainingBytes);
+
+        if (numBytes < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            success = false;
+            break;
+        }
+
+        data += numBytes;
+        numRemainingBytes -= (size_t) numBytes;
+    }
+
+    // The temporary file must be flushed to the disk before it replaces the given file. Otherwise, the given file may
+    // be empty after a system crash...
+    success = success && fsync(fd) == 0;
+    success = close(fd) == 0 && success;
+
+    if (!success || std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+        std::remove(tmpPath.c_str());
+        return false;
+    }
+
+    // Flush the directory to make sure that the renaming persists...
+    std::string::size_type separator = path.find_last_of('/');
+    std::string directory = separator == std::string::npos ? "." : (separator == 0 ? "/" : path.substr(0, separator));
+    int directoryFd = open(directory.c_str(), O_RDONLY | O_DIRECTORY);
+
+    if (directoryFd < 0) {
+        return false;
+    }
+
+    success = fsync(directoryFd) == 0;
+    close(directoryFd);
+    return success;
+}
+
+CheckpointReader::CheckpointReader()
+    : position_(0), valid_(true) {
+
+}
+
+bool CheckpointReader::load(const std::string& path) {
+    std::ifstream stream(path, std::ios::binary);
+
+    if (!stream) {
+        return false;
+    }
+
+    buffer_.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    position_ = 0;
+    valid_ = true;
+    return true;
+}
+
+uint8* CheckpointReader::allocate(uint32 numBytes) {
+    buffer_.resize(numBytes);
+    position_ = 0;
+    valid_ = true;
+    return buffer_.data();
+}
+
+template<class T>
+T CheckpointReader::read() {
+    T value = 0;
+    this->readArray<T>(&value, 1);
+    return value;
+}
+
+template<class T>
+void CheckpointReader::readArray(T* array, uint32 numElements) {
+    uint32 numBytes = numElements * sizeof(T);
+
+    if (numBytes > this->getNumRemainingBytes()) {
+        valid_ = false;
+        return;
+    }
+
+    std::memcpy(array, &buffer_[position_], numBytes);
+    position_ += numBytes;
+}
+
+uint32 CheckpointReader::getNumRemainingBytes() const {
+    return (uint32) buffer_.size() - position_;
+}
+
+bool CheckpointReader::isValid() const {
+    return valid_;
+}
+
+template void CheckpointWriter::write<uint8>(uint8 value);
+template void CheckpointWriter::write<intp>(intp value);
+template void CheckpointWriter::write<uint32>(uint32 value);
+template void CheckpointWriter::write<uint64>(uint64 value);
+template void CheckpointWriter::write<float32>(float32 value);
+template void CheckpointWriter::write<float64>(float64 value);
+template void CheckpointWriter::writeArray<uint8>(const uint8* array, uint32 numElements);
+template void CheckpointWriter::writeArray<uint32>(const uint32* array, uint32 numElements);
+template void CheckpointWriter::writeArray<float32>(const float32* array, uint32 numElements);
+template void CheckpointWriter::writeArray<float64>(const float64* array, uint32 numElements);
+template uint8 CheckpointReader::read<uint8>();
+template intp CheckpointReader::read<intp>();
+template uint32 CheckpointReader::read<uint32>();
+template uint64 CheckpointReader::read<uint64>();
+template float32 CheckpointReader::read<float32>();
+template float64 CheckpointReader::read<float64>();
+template void CheckpointReader::readArray<uint8>(uint8* array, uint32 numElements);
+template void CheckpointReader::readArray<uint32>(uint32* array, uint32 numElements);
+template void CheckpointReader::readArray<float32>(float32* array, uint32 numElements);
+template void CheckpointReader::readArray<float64>(float64* array, uint32 numElements);
@@ -0,0 +1,343 @@
+#include "common/rule_induction/rule_induction_batch.hpp"
+#include "common/rule_induction/checkpoint.hpp"
+#include "omp.h"
+#include <algorithm>
+#include <vector>
+
+
+/**
+ * Searches for the best refinements of the current rule, one for each of the given features, and adds those that
+ * improve the rule to a vector.
+ *
+ * @param thresholdsSubset      A reference to an object of type `IThresholdsSubset` that corresponds to the examples
+ *                              that are covered by the current rule
+ * @param labelIndices          A reference to an object of type `IIndexVector` that provides access to the indices of
+ *                              the labels for which the refinements may predict
+ * @param featureIndices        A reference to an object of type `IIndexVector` that provides access to the indices of
+ *                              the features that should be considered
+ * @param currentHead           A pointer to an object of type `AbstractEvaluatedPrediction` that corresponds to the
+ *                              head of the current rule or a null pointer, if the rule's body is empty
+ * @param featureSubSampling    A reference to an object of type `IFeatureSubSampling`, the gains of the refinements
+ *                              should be reported to
+ * @param minCoverage           The minimum number of examples that must be covered by the refinements
+ * @param numThreads            The number of CPU threads to be used
+ * @param currentQuality        The quality of the current model
+ * @param cancellationToken     A reference to an object of type `CancellationToken` that is checked for each feature
+ * @param refinements           A reference to a vector, the refinements should be added to
+ * @return                      True, if all features have been considered, false, if the induction of rules has been
+ *                              canceled
+ */
+static inline bool findRefinements(IThresholdsSubset& thresholdsSubset, const IIndexVector& labelIndices,
+                                   const IIndexVector& featureIndices, const AbstractEvaluatedPrediction* currentHead,
+                                   IFeatureSubSampling& featureSubSampling, uint32 minCoverage, uint32 numThreads,
+                                   float64 currentQuality, const CancellationToken& cancellationToken,
+                                   std::vector<std::unique_ptr<Refinement>>& refinements) {
+    uint32 numFeatures = featureIndices.getNumElements();
+    float64 baselineQuality = currentHead != nullptr ? currentHead->overallQualityScore : currentQuality;
+    std::vector<std::unique_ptr<IRuleRefinement>> ruleRefinements;
+    std::vector<std::unique_ptr<IRuleRefinement>>* ruleRefinementsPtr = &ruleRefinements;
+    const CancellationToken* cancellationTokenPtr = &cancellationToken;
+    ruleRefinements.reserve(numFeatures);
+
+    // For each feature, create an object of type `IRuleRefinement`...
+    for (uint32 i = 0; i < numFeatures; i++) {
+        uint32 featureIndex = featureIndices.getIndex(i);
+        ruleRefinements.push_back(labelIndices.createRuleRefinement(thresholdsSubset, featureIndex));
+    }
+
+    // Search for the best condition for each of the features...
+    #pragma omp parallel for firstprivate(numFeatures) firstprivate(ruleRefinementsPtr) firstprivate(currentHead) \
+    firstprivate(minCoverage) firstprivate(cancellationTokenPtr) schedule(dynamic) num_threads(numThreads)
+    for (intp i = 0; i < numFeatures; i++) {
+        if (!cancellationTokenPtr->isCancelled()) {
+            (*ruleRefinementsPtr)[i]->findRefinement(currentHead, minCoverage, *cancellationTokenPtr);
+        }
+    }
+
+    if (cancellationToken.isCancelled()) {
+        return false;
+    }
+
+    // Add all refinements that improve the rule to the vector...
+    for (uint32 i = 0; i < numFeatures; i++) {
+        std::unique_ptr<Refinement> refinementPtr = ruleRefinements[i]->pollRefinement();
+        recordGain(featureSubSampling, *refinementPtr, baselineQuality);
+
+        if (refinementPtr->headPtr.get() != nullptr) {
+            refinements.push_back(std::move(refinementPtr));
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Retains the first conditions that should be used by the following rules. The given refinements are considered in the
+ * given order and a refinement is retained if the fraction of the examples it covers that are also covered by the
+ * current rule or any of the previously retained refinements does not exceed a certain threshold. The examples that are
+ * covered by a refinement are identified based on the feature vector of the refinement's feature, without filtering the
+ * thresholds.
+ *
+ * @param thresholdsSubset      A reference to an object of type `IThresholdsSubset` that corresponds to a rule with an
+ *                              empty body
+ * @param refinements           A reference to a vector that stores the refinements of the rule with an empty body,
+ *                              sorted by their quality. The first refinement must correspond to the current rule
+ * @param numExamples           The total number of examples
+ * @param maxRetained           The maximum number of refinements to be retained
+ * @param maxOverlap            The maximum fraction of the examples covered by a refinement that may also be covered
+ *                              by the current rule or the previously retained refinements
+ * @param conditions            A reference to a queue, the retained refinements should be added to
+ */
+static inline void retainRefinements(IThresholdsSubset& thresholdsSubset,
+                                     const std::vector<std::unique_ptr<Refinement>>& refinements, uint32 numExamples,
+                                     uint32 maxRetained, float32 maxOverlap, std::queue<Condition>& conditions) {
+    uint32 numRefinements = (uint32) refinements.size();
+    std::vector<bool> coveredExamples(numExamples, false);
+    uint32 numCoveredExamples = 0;
+    std::vector<uint32> indices;
+
+    for (uint32 i = 0; i < numRefinements && conditions.size() < maxRetained; i++) {
+        // Identify the examples whose coverage is affected by the refinement...
+        const Refinement& refinement = *refinements[i];
+        indices.clear();
+        thresholdsSubset.getUpdatedIndices(refinement, indices);
+        uint32 numIndices = (uint32) indices.size();
+        uint32 numOverlappingIndices = 0;
+
+        for (uint32 j = 0; j < numIndices; j++) {
+            if (coveredExamples[indices[j]]) {
+                numOverlappingIndices++;
+            }
+        }
+
+        // If the refinement does not cover the identified examples, it covers all others...
+        bool covered = refinement.covered;
+        uint32 numCovered = covered ? numIndices : numExamples - numIndices;
+        uint32 numOverlapping = covered ? numOverlappingIndices : numCoveredExamples - numOverlappingIndices;
+
+        if (i == 0 || numOverlapping <= maxOverlap * numCovered) {
+            if (covered) {
+                for (uint32 j = 0; j < numIndices; j++) {
+                    uint32 index = indices[j];
+
+                    if (!coveredExamples[index]) {
+                        coveredExamples[index] = true;
+                        numCoveredExamples++;
+                    }
+                }
+            } else {
+                std::vector<bool> uncoveredExamples(numExamples, false);
+
+                for (uint32 j = 0; j < numIndices; j++) {
+                    uncoveredExamples[indices[j]] = true;
+                }
+
+                for (uint32 j = 0; j < numExamples; j++) {
+                    if (!uncoveredExamples[j] && !coveredExamples[j]) {
+                        coveredExamples[j] = true;
+                        numCoveredExamples++;
+                    }
+                }
+            }
+
+            // The first refinement corresponds to the current rule and must not be retained...
+            if (i > 0) {
+                conditions.push(refinement);
+            }
+        }
+    }
+}
+
+/**
+ * Refines a rule, whose body consists of a single condition, by adding further conditions using a top-down greedy
+ * search. If the resulting rule improves the quality of the model, it is added to the model. Each condition requires to
+ * scan all sampled features, restricted to the examples that are covered by the rule.
+ *
+ * @param thresholdsSubset      A reference to an object of type `IThresholdsSubset` that has been filtered by applying
+ *                              the first condition of the rule
+ * @param refinementPtr         An unique pointer to an object of type `Refinement` that corresponds to the first
+ *                              condition of the rule
+ * @param labelIndices          A reference to an object of type `IIndexVector` that provides access to the indices of
+ *                              the labels for which the rule may predict
+ * @param featureSubSampling    A reference to an object of type `IFeatureSubSampling` that should be used for sampling
+ *                              the features that may be used by a new condition
+ * @param rng                   A reference to an object of type `RNG` that implements the random number generator to
+ *                              be used
+ * @param minCoverage           The minimum number of examples that must be covered by the rule
+ * @param maxConditions         The maximum number of conditions to be included in the rule's body or -1
+ * @param numThreads            The number of CPU threads to be used
+ * @param modelBuilder          A reference to an object of type `IModelBuilder`, the rule should be added to
+ * @param currentQuality        The quality of the current model
+ * @param cancellationToken     A reference to an object of type `CancellationToken` that is checked for each feature
+ * @return                      A `std::pair` that stores whether the rule has been added to the model, as well as the
+ *                              quality of the model
+ */
+static inline std::pair<bool, float64> refineRule(IThresholdsSubset& thresholdsSubset,
+                                                  std::unique_ptr<Refinement> refinementPtr,
+                                                  const IIndexVector& labelIndices,
+                                                  IFeatureSubSampling& featureSubSampling, RNG& rng,
+                                                  uint32 minCoverage, intp maxConditions, uint32 numThreads,
+                                                  IModelBuilder& modelBuilder, float64 currentQuality,
+                                                  const CancellationToken& cancellationToken) {
+    ConditionList conditions;
+    conditions.addCondition(*refinementPtr);
+    uint32 numConditions = 1;
+    std::unique_ptr<Refinement> bestRefinementPtr = std::move(refinementPtr);
+    bool foundRefinement = true;
+
+    while (foundRefinement && (maxConditions == -1 || numConditions < maxConditions)) {
+        foundRefinement = false;
+
+        // Sample features...
+        const IIndexVector& sampledFeatureIndices = featureSubSampling.subSample(rng);
+
+        // Pick the best refinement among the refinements that have been found for the different features...
+        std::vector<std::unique_ptr<Refinement>> refinements;
+
+        // If the induction of rules has been canceled, the incomplete rule is discarded...
+        if (!findRefinements(thresholdsSubset, labelIndices, sampledFeatureIndices, bestRefinementPtr->headPtr.get(),
+                             featureSubSampling, minCoverage, numThreads, currentQuality, cancellationToken,
+                             refinements)) {
+            return std::make_pair(false, currentQuality);
+        }
+
+        for (auto it = refinements.begin(); it != refinements.end(); it++) {
+            std::unique_ptr<Refinement>& currentRefinementPtr = *it;
+
+            if (currentRefinementPtr->isBetterThan(*bestRefinementPtr)) {
+                bestRefinementPtr = std::move(currentRefinementPtr);
+                foundRefinement = true;
+            }
+        }
+
+        if (foundRefinement) {
+            // Filter the current subset of thresholds by applying the best refinement that has been found...
+            thresholdsSubset.filterThresholds(*bestRefinementPtr);
+
+            // Add the new condition...
+            conditions.addCondition(*bestRefinementPtr);
+            numConditions++;
+        }
+    }
+
+    const AbstractEvaluatedPrediction& bestHead = *bestRefinementPtr->headPtr;
+    float64 qualityScore = bestHead.overallQualityScore;
+
+    if (qualityScore < currentQuality) {
+        // Update the statistics by applying the predictions of the new rule...
+        thresholdsSubset.applyPrediction(bestHead);
+
+        // Add the induced rule to the model...
+        modelBuilder.addRule(conditions, bestHead);
+        return std::make_pair(true, qualityScore);
+    } else {
+        return std::make_pair(false, currentQuality);
+    }
+}
+
+BatchRuleInduction::BatchRuleInduction(uint32 batchSize, float32 maxOverlap, float32 minSupport, intp maxConditions,
+                                       uint32 numThreads)
+    : batchSize_(batchSize), maxOverlap_(maxOverlap), minSupport_(minSupport), maxConditions_(maxConditions),
+      numThreads_(numThreads) {
+
+}
+
+void BatchRuleInduction::induceDefaultRule(IStatisticsProvider& statisticsProvider,
+                                           const IHeadRefinementFactory* headRefinementFactory,
+                                           IModelBuilder& modelBuilder) {
+    pendingConditions_ = std::queue<Condition>();
+    statisticsProvider.switchRuleEvaluation();
+}
+
+std::pair<bool, float64> BatchRuleInduction::induceRule(IThresholds& thresholds, const IIndexVector& labelIndices,
+                                                        const IWeightVector& weights, IPartition& partition,
+                                                        IFeatureSubSampling& featureSubSampling, RNG& rng,
+                                                        IModelBuilder& modelBuilder, float64 currentQuality,
+                                                        const CancellationToken& cancellationToken) {
+    uint32 minCoverage = (uint32) (minSupport_ * partition.getNumElements());
+
+    // Start with the first conditions that have been retained previously, until a rule that improves the quality of the
+    // model has been found. The condition is re-evaluated with respect to the current statistics, which only requires
+    // to consider a single feature...
+    while (!pendingConditions_.empty()) {
+        Condition condition = pendingConditions_.front();
+        pendingConditions_.pop();
+
+        if (cancellationToken.isCancelled()) {
+            return std::make_pair(false, currentQuality);
+        }
+
+        std::unique_ptr<IThresholdsSubset> thresholdsSubsetPtr = thresholds.createSubset(weights);
+        std::unique_ptr<IRuleRefinement> ruleRefinementPtr =
+            labelIndices.createRuleRefinement(*thresholdsSubsetPtr, condition.featureIndex);
+        ruleRefinementPtr->evaluateCondition(condition, minCoverage);
+        std::unique_ptr<Refinement> refinementPtr = ruleRefinementPtr->pollRefinement();
+        recordGain(featureSubSampling, *refinementPtr, currentQuality);
+
+        if (refinementPtr->headPtr.get() != nullptr) {
+            thresholdsSubsetPtr->filterThresholds(*refinementPtr);
+            std::pair<bool, float64> result = refineRule(*thresholdsSubsetPtr, std::move(refinementPtr),
+                                                         labelIndices, featureSubSampling, rng, minCoverage,
+                                                         maxConditions_, numThreads_, modelBuilder, currentQuality,
+                                                         cancellationToken);
+
+            if (result.first) {
+                return result;
+            }
+        }
+    }
+
+    // Search for the first condition among all sampled features...
+    std::unique_ptr<IThresholdsSubset> thresholdsSubsetPtr = thresholds.createSubset(weights);
+    const IIndexVector& sampledFeatureIndices = featureSubSampling.subSample(rng);
+    std::vector<std::unique_ptr<Refinement>> refinements;
+
+    if (!findRefinements(*thresholdsSubsetPtr, labelIndices, sampledFeatureIndices, nullptr, featureSubSampling,
+                         minCoverage, numThreads_, currentQuality, cancellationToken, refinements)) {
+        return std::make_pair(false, currentQuality);
+    }
+
+    if (refinements.empty()) {
+        // No rule could be induced, because no useful condition could be found. This might be the case, if all examples
+        // have the same values for the considered features.
+        return std::make_pair(false, currentQuality);
+    }
+
+    std::sort(refinements.begin(), refinements.end(),
+              [](const std::unique_ptr<Refinement>& a, const std::unique_ptr<Refinement>& b) {
+        return a->isBetterThan(*b);
+    });
+
+    // Retain further conditions for the following rules, before the thresholds are filtered by applying the best
+    // condition...
+    if (batchSize_ > 1) {
+        retainRefinements(*thresholdsSubsetPtr, refinements, thresholds.getNumExamples(), batchSize_ - 1,
+                          maxOverlap_, pendingConditions_);
+    }
+
+    thresholdsSubsetPtr->filterThresholds(*refinements[0]);
+    return refineRule(*thresholdsSubsetPtr, std::move(refinements[0]), labelIndices, featureSubSampling, rng,
+                      minCoverage, maxConditions_, numThreads_, modelBuilder, currentQuality, cancellationToken);
+}
+
+void BatchRuleInduction::writeState(CheckpointWriter& writer) const {
+    // The pending conditions of the current batch are written in the order they will be used...
+    std::queue<Condition> pendingConditions = pendingConditions_;
+    writer.write<uint32>((uint32) pendingConditions.size());
+
+    while (!pendingConditions.empty()) {
+        pendingConditions.front().serialize(writer);
+        pendingConditions.pop();
+    }
+}
+
+void BatchRuleInduction::readState(CheckpointReader& reader) {
+    pendingConditions_ = std::queue<Condition>();
+    uint32 numPendingConditions = reader.read<uint32>();
+
+    for (uint32 i = 0; i < numPendingConditions; i++) {
+        Condition condition;
+        condition.deserialize(reader);
+        pendingConditions_.push(condition);
+    }
+}
@@ -0,0 +1,310 @@
+#include "common/rule_induction/rule_induction_beam_search.hpp"
+#include "common/rule_induction/checkpoint.hpp"
+#include "omp.h"
+#include <algorithm>
+#include <set>
+#include <tuple>
+#include <vector>
+
+
+/**
+ * A rule that is contained by the beam.
+ */
+struct BeamEntry {
+
+    /**
+     * An unique pointer to an object of type `IThresholdsSubset` that corresponds to the examples that are covered by
+     * the rule.
+     */
+    std::unique_ptr<IThresholdsSubset> thresholdsSubsetPtr;
+
+    /**
+     * The conditions in the rule's body (in the order they have been learned).
+     */
+    ConditionList conditions;
+
+    /**
+     * An unique pointer to the refinement that has been applied most recently. It provides access to the rule's head.
+     * May be a null pointer, if the rule's body is empty.
+     */
+    std::unique_ptr<Refinement> refinementPtr;
+
+};
+
+/**
+ * A refinement of a rule in the beam that may be included in the next beam.
+ */
+struct Candidate {
+
+    /**
+     * The index of the rule in the beam the refinement corresponds to.
+     */
+    uint32 beamIndex;
+
+    /**
+     * An unique pointer to the refinement.
+     */
+    std::unique_ptr<Refinement> refinementPtr;
+
+};
+
+/**
+ * A canonical representation of the conditions of a rule, which is independent of the order of the conditions.
+ */
+typedef std::vector<std::tuple<uint32, uint32, float32>> CanonicalConditions;
+
+/**
+ * Returns the canonical representation of the conditions of a rule in the beam after a refinement has been applied.
+ *
+ * @param beamEntry     A reference to a struct of type `BeamEntry` that stores the rule
+ * @param refinement    A reference to an object of type `Refinement` that stores the refinement
+ * @return              The canonical representation of the conditions
+ */
+static inline CanonicalConditions getCanonicalConditions(const BeamEntry& beamEntry, const Refinement& refinement) {
+    CanonicalConditions conditions;
+    conditions.reserve(beamEntry.conditions.getNumConditions() + 1);
+
+    for (auto it = beamEntry.conditions.cbegin(); it != beamEntry.conditions.cend(); it++) {
+        const Condition& condition = *it;
+        conditions.emplace_back(condition.featureIndex, (uint32) condition.comparator, condition.threshold);
+    }
+
+    conditions.emplace_back(refinement.featureIndex, (uint32) refinement.comparator, refinement.threshold);
+    std::sort(conditions.begin(), conditions.end());
+    return conditions;
+}
+
+/**
+ * Searches for the best refinements of all rules in the beam concurrently, one for each of the given features and each
+ * rule, and adds them to a vector of candidates.
+ *
+ * @param beam                  A reference to a vector that stores the rules in the beam
+ * @param labelIndices          A reference to an object of type `IIndexVector` that provides access to the indices of
+ *                              the labels for which the refinements may predict
+ * @param featureIndices        A reference to an object of type `IIndexVector` that provides access to the indices of
+ *                              the features that should be considered
+ * @param featureSubSampling    A reference to an object of type `IFeatureSubSampling`, the gains of the refinements
+ *                              should be reported to
+ * @param minCoverage           The minimum number of examples that must be covered by the refinements
+ * @param numThreads            The number of CPU threads to be used
+ * @param currentQuality        The quality of the current model
+ * @param cancellationToken     A reference to an object of type `CancellationToken` that is checked for each feature
+ * @param candidates            A reference to a vector, the refinements should be added to
+ * @return                      True, if all features have been considered, false, if the induction of rules has been
+ *                              canceled
+ */
+static inline bool findRefinements(std::vector<std::unique_ptr<BeamEntry>>& beam, const IIndexVector& labelIndices,
+                                   const IIndexVector& featureIndices, IFeatureSubSampling& featureSubSampling,
+                                   uint32 minCoverage, uint32 numThreads, float64 currentQuality,
+                                   const CancellationToken& cancellationToken, std::vector<Candidate>& candidates) {
+    uint32 beamSize = (uint32) beam.size();
+    uint32 numFeatures = featureIndices.getNumElements();
+    uint32 numRefinements = beamSize * numFeatures;
+    std::vector<const AbstractEvaluatedPrediction*> currentHeads;
+    std::vector<const AbstractEvaluatedPrediction*>* currentHeadsPtr = &currentHeads;
+    std::vector<std::unique_ptr<IRuleRefinement>> ruleRefinements;
+    std::vector<std::unique_ptr<IRuleRefinement>>* ruleRefinementsPtr = &ruleRefinements;
+    const CancellationToken* cancellationTokenPtr = &cancellationToken;
+    currentHeads.reserve(beamSize);
+    ruleRefinements.reserve(numRefinements);
+
+    // For each rule in the beam and each feature, create an object of type `IRuleRefinement`...
+    for (uint32 i = 0; i < beamSize; i++) {
+        BeamEntry& beamEntry = *beam[i];
+        IThresholdsSubset* thresholdsSubset = beamEntry.thresholdsSubsetPtr.get();
+        currentHeads.push_back(beamEntry.refinementPtr.get() != nullptr ? beamEntry.refinementPtr->headPtr.get()
+                                                                        : nullptr);
+
+        for (uint32 j = 0; j < numFeatures; j++) {
+            uint32 featureIndex = featureIndices.getIndex(j);
+            ruleRefinements.push_back(labelIndices.createRuleRefinement(*thresholdsSubset, featureIndex));
+        }
+    }
+
+    // Search for the best condition for each of the rules and features...
+    #pragma omp parallel for firstprivate(numRefinements) firstprivate(numFeatures) \
+    firstprivate(ruleRefinementsPtr) firstprivate(currentHeadsPtr) firstprivate(minCoverage) \
+    firstprivate(cancellationTokenPtr) schedule(dynamic) num_threads(numThreads)
+    for (intp i = 0; i < numRefinements; i++) {
+        if (!cancellationTokenPtr->isCancelled()) {
+            const AbstractEvaluatedPrediction* currentHead = (*currentHeadsPtr)[i / numFeatures];
+            (*ruleRefinementsPtr)[i]->findRefinement(currentHead, minCoverage, *cancellationTokenPtr);
+        }
+    }
+
+    if (cancellationToken.isCancelled()) {
+        return false;
+    }
+
+    // Add all refinements that improve the rules to the candidates...
+    for (uint32 i = 0; i < numRefinements; i++) {
+        uint32 beamIndex = i / numFeatures;
+        const AbstractEvaluatedPrediction* currentHead = currentHeads[beamIndex];
+        float64 baselineQuality = currentHead != nullptr ? currentHead->overallQualityScore : currentQuality;
+        std::unique_ptr<Refinement> refinementPtr = ruleRefinements[i]->pollRefinement();
+        recordGain(featureSubSampling, *refinementPtr, baselineQuality);
+
+        if (refinementPtr->headPtr.get() != nullptr) {
+            Candidate candidate;
+            candidate.beamIndex = beamIndex;
+            candidate.refinementPtr = std::move(refinementPtr);
+            candidates.push_back(std::move(candidate));
+        }
+    }
+
+    return true;
+}
+
+BeamSearchRuleInduction::BeamSearchRuleInduction(uint32 beamWidth, float32 minSupport, intp maxConditions,
+                                                 uint32 numThreads)
+    : beamWidth_(beamWidth), minSupport_(minSupport), maxConditions_(maxConditions), numThreads_(numThreads) {
+
+}
+
+void BeamSearchRuleInduction::induceDefaultRule(IStatisticsProvider& statisticsProvider,
+                                                const IHeadRefinementFactory* headRefinementFactory,
+                                                IModelBuilder& modelBuilder) {
+    statisticsProvider.switchRuleEvaluation();
+}
+
+std::pair<bool, float64> BeamSearchRuleInduction::induceRule(IThresholds& thresholds,
+                                                             const IIndexVector& labelIndices,
+                                                             const IWeightVector& weights, IPartition& partition,
+                                                             IFeatureSubSampling& featureSubSampling, RNG& rng,
+                                                             IModelBuilder& modelBuilder, float64 currentQuality,
+                                                             const CancellationToken& cancellationToken) {
+    uint32 minCoverage = (uint32) (minSupport_ * partition.getNumElements());
+    // The total number of conditions of the rules in the beam
+    uint32 numConditions = 0;
+    // The rules that are currently contained by the beam
+    std::vector<std::unique_ptr<BeamEntry>> beam;
+    // An unique pointer to the best rule found so far
+    std::unique_ptr<BeamEntry> bestEntryPtr;
+
+    // Start with a single rule with an empty body. The statistics are shared by all rules in the beam. To be able to
+    // search for the refinements of several rules concurrently, each one of them keeps track of the statistics it
+    // covers on its own. They are copied together with the subset of the thresholds that corresponds to a rule...
+    std::unique_ptr<BeamEntry> initialEntryPtr = std::make_unique<BeamEntry>();
+    initialEntryPtr->thresholdsSubsetPtr = thresholds.createSubset(weights);
+    initialEntryPtr->thresholdsSubsetPtr->isolateStatistics();
+    beam.push_back(std::move(initialEntryPtr));
+
+    // Search for the best refinements until none of the rules in the beam can be improved anymore or the maximum number
+    // of conditions has been reached...
+    while (!beam.empty()) {
+        std::vector<std::unique_ptr<BeamEntry>> nextBeam;
+
+        if (maxConditions_ == -1 || numConditions < maxConditions_) {
+            std::vector<Candidate> candidates;
+            uint32 beamSize = (uint32) beam.size();
+
+            // Sample features...
+            const IIndexVector& sampledFeatureIndices = featureSubSampling.subSample(rng);
+
+            // Search for the best refinements of the rules in the beam. If the induction of rules has been canceled,
+            // the incomplete rules in the beam are discarded...
+            if (!findRefinements(beam, labelIndices, sampledFeatureIndices, featureSubSampling, minCoverage,
+                                 numThreads_, currentQuality, cancellationToken, candidates)) {
+                return std::make_pair(false, currentQuality);
+            }
+
+            // Retain the best refinements. Refinements that result in the same conditions as a better one, albeit in a
+            // different order, are discarded...
+            std::stable_sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) {
+                return a.refinementPtr->isBetterThan(*b.refinementPtr);
+            });
+            std::set<CanonicalConditions> selectedConditions;
+            uint32 numSelected = 0;
+
+            for (uint32 i = 0; i < candidates.size() && numSelected < beamWidth_; i++) {
+                Candidate& candidate = candidates[i];
+                CanonicalConditions conditions = getCanonicalConditions(*beam[candidate.beamIndex],
+                                                                        *candidate.refinementPtr);
+
+                if (selectedConditions.insert(std::move(conditions)).second) {
+                    if (i != numSelected) {
+                        std::swap(candidates[numSelected], candidate);
+                    }
+
+                    numSelected++;
+                }
+            }
+
+            // Keep track of how many of the retained refinements correspond to each rule in the beam. The subset of
+            // the thresholds that corresponds to a rule does only need to be copied if it is refined multiple times...
+            std::vector<uint32> numRefinements(beamSize, 0);
+
+            for (uint32 i = 0; i < numSelected; i++) {
+                numRefinements[candidates[i].beamIndex]++;
+            }
+
+            // Apply the retained refinements to obtain the rules in the next beam...
+            for (uint32 i = 0; i < numSelected; i++) {
+                Candidate& candidate = candidates[i];
+                BeamEntry& beamEntry = *beam[candidate.beamIndex];
+                IThresholdsSubset* thresholdsSubset = beamEntry.thresholdsSubsetPtr.get();
+                std::unique_ptr<BeamEntry> refinedEntryPtr = std::make_unique<BeamEntry>();
+
+                if (--numRefinements[candidate.beamIndex] > 0) {
+                    refinedEntryPtr->thresholdsSubsetPtr = thresholdsSubset->copy();
+                    refinedEntryPtr->conditions = beamEntry.conditions;
+                } else {
+                    refinedEntryPtr->thresholdsSubsetPtr = std::move(beamEntry.thresholdsSubsetPtr);
+                    refinedEntryPtr->conditions = std::move(beamEntry.conditions);
+                }
+
+                // Filter the subset of thresholds by applying the refinement...
+                refinedEntryPtr->thresholdsSubsetPtr->filterThresholds(*candidate.refinementPtr);
+
+                // Add the new condition...
+                refinedEntryPtr->conditions.addCondition(*candidate.refinementPtr);
+                refinedEntryPtr->refinementPtr = std::move(candidate.refinementPtr);
+                nextBeam.push_back(std::move(refinedEntryPtr));
+            }
+
+            numConditions++;
+        }
+
+        // Keep track of the best rule among the ones that have not been refined any further. A rule that has been
+        // refined does not need to be considered, because its refinements are guaranteed to be better...
+        for (auto it = beam.begin(); it != beam.end(); it++) {
+            std::unique_ptr<BeamEntry>& beamEntryPtr = *it;
+
+            if (beamEntryPtr->thresholdsSubsetPtr.get() != nullptr && beamEntryPtr->refinementPtr.get() != nullptr
+                && (bestEntryPtr.get() == nullptr
+                    || beamEntryPtr->refinementPtr->isBetterThan(*bestEntryPtr->refinementPtr))) {
+                bestEntryPtr = std::move(beamEntryPtr);
+            }
+        }
+
+        beam = std::move(nextBeam);
+    }
+
+    if (bestEntryPtr.get() == nullptr) {
+        // No rule could be induced, because no useful condition could be found. This might be the case, if all examples
+        // have the same values for the considered features.
+        return std::make_pair(false, currentQuality);
+    } else {
+        const AbstractEvaluatedPrediction& bestHead = *bestEntryPtr->refinementPtr->headPtr;
+        float64 qualityScore = bestHead.overallQualityScore;
+
+        if (qualityScore < currentQuality) {
+            // Update the statistics by applying the predictions of the new rule...
+            bestEntryPtr->thresholdsSubsetPtr->applyPrediction(bestHead);
+
+            // Add the induced rule to the model...
+            modelBuilder.addRule(bestEntryPtr->conditions, bestHead);
+            return std::make_pair(true, qualityScore);
+        } else {
+            return std::make_pair(false, currentQuality);
+        }
+    }
+}
+
+void BeamSearchRuleInduction::writeState(CheckpointWriter& writer) const {
+
+}
+
+void BeamSearchRuleInduction::readState(CheckpointReader& reader) {
+
+}
@@ -0,0 +1,297 @@
+#include "common/rule_induction/rule_induction_sharded.hpp"
+#include "common/rule_induction/checkpoint.hpp"
+#include "common/distributed/shard_protocol.hpp"
+#include <stdexcept>
+#include <string>
+
+
+/**
+ * Writes the content of a message of type `SHARD_BEGIN_RULE`.
+ *
+ * @param message       A reference to an object of type `CheckpointWriter`, the message should be written to
+ * @param statistics    A reference to an object of type `IStatistics` that stores the coverage counts of the examples
+ * @param labelIndices  A reference to an object of type `IIndexVector` that provides access to the indices of the
+ *                      labels for which the rule may predict
+ * @param weights       A reference to an object of type `IWeightVector` that provides access to the weights of the
+ *                      individual training examples
+ * @param partition     A reference to an object of type `IPartition` that provides access to the indices of the
+ *                      examples in the holdout set or a null pointer, if they should not be included
+ */
+static inline void writeBeginRule(CheckpointWriter& message, const IStatistics& statistics,
+                                  const IIndexVector& labelIndices, const IWeightVector& weights,
+                                  const IPartition* partition) {
+    message.write<uint8>(SHARD_BEGIN_RULE);
+
+    if (partition != nullptr) {
+        std::unique_ptr<std::vector<uint32>> holdoutIndicesPtr = partition->getHoldoutIndices();
+        uint32 numHoldout = (uint32) holdoutIndicesPtr->size();
+        message.write<uint32>(numHoldout);
+        message.writeArray<uint32>(holdoutIndicesPtr->data(), numHoldout);
+    } else {
+        message.write<uint32>(0);
+    }
+
+    uint32 numStatistics = statistics.getNumStatistics();
+    message.write<uint32>(numStatistics);
+
+    for (uint32 i = 0; i < numStatistics; i++) {
+        message.write<uint32>(statistics.getCoverageCount(i));
+    }
+
+    message.write<uint32>(numStatistics);
+    message.write<uint32>(weights.getNumNonZeroWeights());
+
+    for (uint32 i = 0; i < numStatistics; i++) {
+        message.write<float64>(weights.getWeight(i));
+    }
+
+    uint32 numLabelIndices = labelIndices.getNumElements();
+    bool partial = labelIndices.isPartial();
+    message.write<uint8>(partial ? 1 : 0);
+    message.write<uint32>(numLabelIndices);
+
+    if (partial) {
+        for (uint32 i = 0; i < numLabelIndices; i++) {
+            message.write<uint32>(labelIndices.getIndex(i));
+        }
+    }
+}
+
+/**
+ * Throws a `std::runtime_error` that reports that the communication with a specific worker has failed.
+ *
+ * @param shardIndex    The index of the shard the worker is responsible for
+ * @param reason        A description of the operation that has failed
+ */
+static inline void throwShardError(uint32 shardIndex, const std::string& reason) {
+    throw std::runtime_error("Failed to " + reason + " worker of shard " + std::to_string(shardIndex));
+}
+
+ShardedRuleInduction::ShardedRuleInduction(std::unique_ptr<std::vector<std::shared_ptr<IChannel>>> channelsPtr,
+                                           float32 minSupport, intp maxConditions)
+    : channelsPtr_(std::move(channelsPtr)), minSupport_(minSupport), maxConditions_(maxConditions),
+      statisticsProvider_(nullptr), initialized_(false) {
+
+}
+
+ShardedRuleInduction::~ShardedRuleInduction() {
+    // Workers that cannot be reached anymore are ignored, as they do not need to be stopped...
+    CheckpointWriter message;
+    message.write<uint8>(SHARD_SHUTDOWN);
+
+    for (auto it = channelsPtr_->begin(); it != channelsPtr_->end(); it++) {
+        (*it)->send(message);
+    }
+}
+
+void ShardedRuleInduction::send(uint32 shardIndex, const CheckpointWriter& message) {
+    if (!(*channelsPtr_)[shardIndex]->send(message)) {
+        throwShardError(shardIndex, "send message to");
+    }
+}
+
+void ShardedRuleInduction::receive(uint32 shardIndex, CheckpointReader& reply) {
+    if (!(*channelsPtr_)[shardIndex]->receive(reply)) {
+        throwShardError(shardIndex, "receive reply from");
+    }
+}
+
+void ShardedRuleInduction::broadcast(const CheckpointWriter& message, uint32 excludedShard) {
+    uint32 numShards = (uint32) channelsPtr_->size();
+
+    for (uint32 i = 0; i < numShards; i++) {
+        if (i != excludedShard) {
+            send(i, message);
+        }
+    }
+}
+
+void ShardedRuleInduction::induceDefaultRule(IStatisticsProvider& statisticsProvider,
+                                             const IHeadRefinementFactory* headRefinementFactory,
+                                             IModelBuilder& modelBuilder) {
+    // The statistics are retained, as the workers must be kept in sync with them...
+    statisticsProvider_ = &statisticsProvider;
+    statisticsProvider.switchRuleEvaluation();
+}
+
+std::pair<bool, float64> ShardedRuleInduction::induceRule(IThresholds& thresholds, const IIndexVector& labelIndices,
+                                                          const IWeightVector& weights, IPartition& partition,
+                                                          IFeatureSubSampling& featureSubSampling, RNG& rng,
+                                                          IModelBuilder& modelBuilder, float64 currentQuality,
+                                                          const CancellationToken& cancellationToken) {
+    uint32 numShards = (uint32) channelsPtr_->size();
+    uint32 minCoverage = (uint32) (minSupport_ * partition.getNumElements());
+    // A (stack-allocated) list that contains the conditions in the rule's body (in the order they have been learned)
+    ConditionList conditions;
+    // The total number of conditions
+    uint32 numConditions = 0;
+    // An unique pointer to the best refinement of the current rule
+    std::unique_ptr<Refinement> bestRefinementPtr = std::make_unique<Refinement>();
+    // A pointer to the head of the best rule found so far
+    AbstractEvaluatedPrediction* bestHead = nullptr;
+    // Whether a refinement of the current rule has been found
+    bool foundRefinement = true;
+    // The messages that are sent to, and received from, the workers
+    CheckpointWriter message;
+    std::vector<CheckpointReader> replies(numShards);
+
+    // Create a new subset of the given thresholds. It is kept in sync with the workers, but its feature values are
+    // never accessed...
+    std::unique_ptr<IThresholdsSubset> thresholdsSubsetPtr = thresholds.createSubset(weights);
+
+    // Bring the statistics of the workers up to date. The holdout set is only sent for the first rule...
+    writeBeginRule(message, statisticsProvider_->get(), labelIndices, weights, initialized_ ? nullptr : &partition);
+    initialized_ = true;
+
+    broadcast(message, numShards);
+
+    // Search for the best refinement until no improvement in terms of the rule's quality score is possible anymore or
+    // the maximum number of conditions has been reached...
+    while (foundRefinement && (maxConditions_ == -1 || numConditions < maxConditions_)) {
+        foundRefinement = false;
+
+        // Sample features and assign them to the shards they belong to...
+        const IIndexVector& sampledFeatureIndices = featureSubSampling.subSample(rng);
+        uint32 numSampledFeatures = sampledFeatureIndices.getNumElements();
+        std::vector<std::vector<uint32>> shardFeatureIndices(numShards);
+
+        for (uint32 i = 0; i < numSampledFeatures; i++) {
+            uint32 featureIndex = sampledFeatureIndices.getIndex(i);
+            shardFeatureIndices[getShardIndex(featureIndex, numShards)].push_back(featureIndex);
+        }
+
+        // Request the best refinement among the sampled features of each shard. The workers search in parallel...
+        for (uint32 i = 0; i < numShards; i++) {
+            const std::vector<uint32>& featureIndices = shardFeatureIndices[i];
+            uint32 numFeatures = (uint32) featureIndices.size();
+            message.clear();
+            message.write<uint8>(SHARD_FIND_REFINEMENT);
+            message.write<uint32>(minCoverage);
+            message.write<uint32>(numFeatures);
+            message.writeArray<uint32>(featureIndices.data(), numFeatures);
+
+            send(i, message);
+        }
+
+        for (uint32 i = 0; i < numShards; i++) {
+            receive(i, replies[i]);
+        }
+
+        // If the induction of rules has been canceled, the incomplete rule is discarded...
+        if (cancellationToken.isCancelled()) {
+            return std::make_pair(false, currentQuality);
+        }
+
+        // The quality score, the refinements that have been found for the different features are compared to...
+        float64 baselineQuality = bestHead != nullptr ? bestHead->overallQualityScore : currentQuality;
+
+        // Report the gains that have been achieved for the individual features. The replies of the workers store them
+        // in the order of the sampled features...
+        for (uint32 i = 0; i < numSampledFeatures; i++) {
+            uint32 featureIndex = sampledFeatureIndices.getIndex(i);
+            CheckpointReader& reply = replies[getShardIndex(featureIndex, numShards)];
+            bool found = reply.read<uint8>() != 0;
+            float64 qualityScore = reply.read<float64>();
+            recordGain(featureSubSampling, featureIndex, found, qualityScore, baselineQuality);
+        }
+
+        // Collect the best refinements that have been found by the individual workers...
+        std::vector<std::unique_ptr<Refinement>> candidates(numShards);
+
+        for (uint32 i = 0; i < numShards; i++) {
+            CheckpointReader& reply = replies[i];
+
+            if (reply.read<uint8>() != 0) {
+                candidates[i] = std::make_unique<Refinement>();
+                candidates[i]->deserialize(reply);
+            }
+
+            if (!reply.isValid()) {
+                throwShardError(i, "read the refinements reported by the");
+            }
+        }
+
+        // Pick the best refinement in the order of the sampled features, such that ties are broken the same way as in a
+        // single process...
+        for (uint32 i = 0; i < numSampledFeatures; i++) {
+            uint32 featureIndex = sampledFeatureIndices.getIndex(i);
+            std::unique_ptr<Refinement>& candidatePtr = candidates[getShardIndex(featureIndex, numShards)];
+
+            if (candidatePtr && candidatePtr->featureIndex == featureIndex
+                && candidatePtr->isBetterThan(*bestRefinementPtr)) {
+                bestRefinementPtr = std::move(candidatePtr);
+                foundRefinement = true;
+            }
+        }
+
+        if (foundRefinement) {
+            bestHead = bestRefinementPtr->headPtr.get();
+
+            // The refinement is applied by the worker that has found it, which reports the examples whose coverage
+            // has changed...
+            uint32 ownerShard = getShardIndex(bestRefinementPtr->featureIndex, numShards);
+            CheckpointReader& reply = replies[ownerShard];
+            message.clear();
+            message.write<uint8>(SHARD_APPLY_REFINEMENT);
+            bestRefinementPtr->serialize(message);
+
+            send(ownerShard, message);
+            receive(ownerShard, reply);
+
+            uint32 numIndices = reply.read<uint32>();
+            std::vector<uint32> indices(numIndices);
+            reply.readArray<uint32>(indices.data(), numIndices);
+
+            if (!reply.isValid()) {
+                throwShardError(ownerShard, "read the covered examples reported by the");
+            }
+
+            // Apply the refinement to the other workers and the subset of the coordinator...
+            message.clear();
+            message.write<uint8>(SHARD_FILTER_REFINEMENT);
+            bestRefinementPtr->serialize(message);
+            message.write<uint32>(numIndices);
+            message.writeArray<uint32>(indices.data(), numIndices);
+
+            broadcast(message, ownerShard);
+
+            thresholdsSubsetPtr->filterThresholds(*bestRefinementPtr, indices.data(), numIndices);
+
+            // Add the new condition...
+            conditions.addCondition(*bestRefinementPtr);
+            numConditions++;
+        }
+    }
+
+    if (bestHead == nullptr) {
+        // No rule could be induced, because no useful condition could be found. This might be the case, if all examples
+        // have the same values for the considered features.
+        return std::make_pair(false, currentQuality);
+    } else {
+        float64 qualityScore = bestHead->overallQualityScore;
+
+        if (qualityScore < currentQuality) {
+            // Update the statistics by applying the predictions of the new rule. The workers are updated when the next
+            // rule is induced...
+            thresholdsSubsetPtr->applyPrediction(*bestHead);
+
+            // Add the induced rule to the model...
+            modelBuilder.addRule(conditions, *bestHead);
+            return std::make_pair(true, qualityScore);
+        } else {
+            return std::make_pair(false, currentQuality);
+        }
+    }
+}
+
+void ShardedRuleInduction::writeState(CheckpointWriter& writer) const {
+    // The workers' sorted and filtered feature vectors, as well as their statistics, cannot be stored in the checkpoint
+    // of the coordinator. Therefore, checkpoints are rejected...
+    throw std::runtime_error("Checkpoints are not supported when the search for refinements is distributed among "
+                             "several workers");
+}
+
+void ShardedRuleInduction::readState(CheckpointReader& reader) {
+    throw std::runtime_error("Checkpoints are not supported when the search for refinements is distributed among "
+                             "several workers");
+}
@@ -1,26 +1,31 @@
 #include "common/rule_induction/rule_induction_top_down.hpp"
+#include "common/rule_induction/checkpoint.hpp"
 #include "common/indices/index_vector_full.hpp"
 #include "omp.h"
+#include <algorithm>
 #include <unordered_map>
+#include <vector>
 
 
-TopDownRuleInduction::TopDownRuleInduction(float32 minSupport, intp maxConditions, uint32 numThreads)
-    : minSupport_(minSupport), maxConditions_(maxConditions), numThreads_(numThreads) {
+TopDownRuleInduction::TopDownRuleInduction(float32 minSupport, intp maxConditions, float32 screeningSampleSize,
+                                           uint32 numScreenedFeatures, uint32 numThreads)
+    : minSupport_(minSupport), maxConditions_(maxConditions), screeningSampleSize_(screeningSampleSize),
+      numScreenedFeatures_(numScreenedFeatures), numThreads_(numThreads) {
 
 }
 
 void TopDownRuleInduction::induceDefaultRule(IStatisticsProvider& statisticsProvider,
                                              const IHeadRefinementFactory* headRefinementFactory,
-                                             IModelBuilder& modelBuilder) const {
+                                             IModelBuilder& modelBuilder) {
     statisticsProvider.switchRuleEvaluation();
 }
 
 std::pair<bool, float64> TopDownRuleInduction::induceRule(IThresholds& thresholds, const IIndexVector& labelIndices,
                                                           const IWeightVector& weights, IPartition& partition,
                                                           IFeatureSubSampling& featureSubSampling, RNG& rng,
-                                                          IModelBuilder& modelBuilder, float64 currentQuality) const {
-    uint32 numExamples = thresholds.getNumExamples();
-    uint32 minCoverage = (uint32) (minSupport_ * numExamples);
+                                                          IModelBuilder& modelBuilder, float64 currentQuality,
+                                                          const CancellationToken& cancellationToken) {
+    uint32 minCoverage = (uint32) (minSupport_ * partition.getNumElements());
     // The label indices for which the next refinement of the rule may predict
     const IIndexVector* currentLabelIndices = &labelIndices;
     // A (stack-allocated) list that contains the conditions in the rule's body (in the order they have been learned)
@@ -34,6 +39,8 @@ std::pair<bool, float64> TopDownRuleInduction::induceRule(IThresholds& threshold
     std::unique_ptr<Refinement> bestRefinementPtr = std::make_unique<Refinement>();
     // A pointer to the head of the best rule found so far
     AbstractEvaluatedPrediction* bestHead = nullptr;
+    // A pointer to the token that is checked by the individual threads
+    const CancellationToken* cancellationTokenPtr = &cancellationToken;
     // Whether a refinement of the current rule has been found
     bool foundRefinement = true;
 
@@ -57,20 +64,72 @@ std::pair<bool, float64> TopDownRuleInduction::induceRule(IThresholds& threshold
             ruleRefinements[featureIndex] = std::move(ruleRefinementPtr);
         }
 
+        // The positions of the features to be considered by the search for the best condition...
+        std::vector<uint32> featurePositions(numSampledFeatures);
+        std::vector<uint32>* featurePositionsPtr = &featurePositions;
+
+        for (uint32 i = 0; i < numSampledFeatures; i++) {
+            featurePositions[i] = i;
+        }
+
+        // Screen the features, if necessary, and retain those with the best estimates...
+        if (screeningSampleSize_ < 1 && numSampledFeatures > numScreenedFeatures_) {
+            std::vector<float64> qualityScores(numSampledFeatures);
+            std::vector<float64>* qualityScoresPtr = &qualityScores;
+            float32 sampleSize = screeningSampleSize_;
+
+            #pragma omp parallel for firstprivate(numSampledFeatures) firstprivate(ruleRefinementsPtr) \
+            firstprivate(qualityScoresPtr) firstprivate(sampleSize) firstprivate(minCoverage) \
+            firstprivate(cancellationTokenPtr) schedule(dynamic) num_threads(numThreads_)
+            for (intp i = 0; i < numSampledFeatures; i++) {
+                if (!cancellationTokenPtr->isCancelled()) {
+                    uint32 featureIndex = sampledFeatureIndices.getIndex((uint32) i);
+                    std::unique_ptr<IRuleRefinement>& ruleRefinementPtr =
+                        ruleRefinementsPtr->find(featureIndex)->second;
+                    (*qualityScoresPtr)[i] = ruleRefinementPtr->estimateQuality(sampleSize, minCoverage);
+                }
+            }
+
+            if (cancellationToken.isCancelled()) {
+                return std::make_pair(false, currentQuality);
+            }
+
+            std::partial_sort(featurePositions.begin(), featurePositions.begin() + numScreenedFeatures_,
+                              featurePositions.end(), [&qualityScores](uint32 a, uint32 b) {
+                return qualityScores[a] < qualityScores[b];
+            });
+            featurePositions.resize(numScreenedFeatures_);
+        }
+
+        uint32 numFeatures = (uint32) featurePositions.size();
+
         // Search for the best condition among all available features to be added to the current rule...
-        #pragma omp parallel for firstprivate(numSampledFeatures) firstprivate(ruleRefinementsPtr) \
-        firstprivate(bestHead) schedule(dynamic) num_threads(numThreads_)
-        for (intp i = 0; i < numSampledFeatures; i++) {
-            uint32 featureIndex = sampledFeatureIndices.getIndex((uint32) i);
-            std::unique_ptr<IRuleRefinement>& ruleRefinementPtr = ruleRefinementsPtr->find(featureIndex)->second;
-            ruleRefinementPtr->findRefinement(bestHead, minCoverage);
+        #pragma omp parallel for firstprivate(numFeatures) firstprivate(featurePositionsPtr) \
+        firstprivate(ruleRefinementsPtr) firstprivate(bestHead) firstprivate(cancellationTokenPtr) schedule(dynamic) \
+        num_threads(numThreads_)
+        for (intp i = 0; i < numFeatures; i++) {
+            // Once the induction of rules has been canceled, the remaining features are skipped...
+            if (!cancellationTokenPtr->isCancelled()) {
+                uint32 featureIndex = sampledFeatureIndices.getIndex((*featurePositionsPtr)[i]);
+                std::unique_ptr<IRuleRefinement>& ruleRefinementPtr = ruleRefinementsPtr->find(featureIndex)->second;
+                ruleRefinementPtr->findRefinement(bestHead, minCoverage, *cancellationTokenPtr);
+            }
         }
 
+        // If the induction of rules has been canceled, the incomplete rule is discarded...
+        if (cancellationToken.isCancelled()) {
+            return std::make_pair(false, currentQuality);
+        }
+
+        // The quality score, the refinements that have been found for the different features are compared to...
+        float64 baselineQuality = bestHead != nullptr ? bestHead->overallQualityScore : currentQuality;
+
         // Pick the best refinement among the refinements that have been found for the different features...
-        for (intp i = 0; i < numSampledFeatures; i++) {
-            uint32 featureIndex = sampledFeatureIndices.getIndex((uint32) i);
+        for (intp i = 0; i < numFeatures; i++) {
+            uint32 featureIndex = sampledFeatureIndices.getIndex(featurePositions[i]);
             std::unique_ptr<IRuleRefinement>& ruleRefinementPtr = ruleRefinements.find(featureIndex)->second;
             std::unique_ptr<Refinement> refinementPtr = ruleRefinementPtr->pollRefinement();
+            recordGain(featureSubSampling, *refinementPtr, baselineQuality);
 
             if (refinementPtr->isBetterThan(*bestRefinementPtr)) {
                 bestRefinementPtr = std::move(refinementPtr);
@@ -109,3 +168,11 @@ std::pair<bool, float64> TopDownRuleInduction::induceRule(IThresholds& threshold
         }
     }
 }
+
+void TopDownRuleInduction::writeState(CheckpointWriter& writer) const {
+
+}
+
+void TopDownRuleInduction::readState(CheckpointReader& reader) {
+
+}
@@ -1,12 +1,58 @@
 #include "common/rule_induction/rule_model_induction_sequential.hpp"
+#include "common/rule_induction/checkpoint.hpp"
+#include "common/model/body_empty.hpp"
+#include "common/model/body_conjunctive.hpp"
+#include "common/model/head_full.hpp"
+#include "common/model/head_partial.hpp"
+#include "common/head_refinement/prediction_full.hpp"
+#include "common/head_refinement/prediction_partial.hpp"
+#include "common/data/matrix_dense.hpp"
+#include "common/data/arrays.hpp"
+#include <unordered_map>
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <cstdio>
+#include <stdexcept>
 
 
+typedef std::unordered_map<uint32, std::unique_ptr<FeatureVector>> FeatureVectorMap;
+
+typedef std::pair<const ConjunctiveBody*, const IHead*> InheritedRule;
+
+const uint32 CHECKPOINT_MAGIC = 0x50434C52;
+
+const uint32 CHECKPOINT_VERSION = 3;
+
+const uint64 FINGERPRINT_OFFSET = 14695981039346656037ULL;
+
+const uint64 FINGERPRINT_PRIME = 1099511628211ULL;
+
+
+/**
+ * Tests all available stopping criteria. Each criterion that has stored a potential point for stopping reports the
+ * point it considers best with respect to all rules induced so far whenever it is tested. If several criteria report
+ * different points, the smallest number of rules is used, i.e., the induction of rules stops at the earliest point that
+ * is considered best by any of them, regardless of the order of the criteria.
+ *
+ * @param stoppingCriteria  A reference to an object of type `std::forward_list` that stores the stopping criteria
+ * @param partition         A reference to an object of type `IPartition` that provides access to the indices of the
+ *                          training examples that belong to the training set and the holdout set, respectively
+ * @param statistics        A reference to an object of type `IStatistics` that provides access to the statistics
+ * @param numRules          The number of rules induced so far
+ * @param numUsedRules      A reference to the number of used rules, which should be updated
+ * @return                  An object of type `IStoppingCriterion::Result` that specifies whether the induction of rules
+ *                          should be forced to be stopped (`FORCE_STOP`) or not (`CONTINUE`)
+ */
 static inline IStoppingCriterion::Result testStoppingCriteria(
         std::forward_list<std::shared_ptr<IStoppingCriterion>>& stoppingCriteria, const IPartition& partition,
-        const IStatistics& statistics, uint32 numRules) {
+        const IStatistics& statistics, uint32 numRules, uint32& numUsedRules) {
     IStoppingCriterion::Result result;
     result.action = IStoppingCriterion::Action::CONTINUE;
+    uint32 numStoredRules = 0;
 
+    // All criteria are tested, even if the induction of rules is forced to be stopped by one of them, to make sure that
+    // the potential points for stopping are up-to-date...
     for (auto it = stoppingCriteria.begin(); it != stoppingCriteria.end(); it++) {
         std::shared_ptr<IStoppingCriterion>& stoppingCriterionPtr = *it;
         IStoppingCriterion::Result stoppingCriterionResult = stoppingCriterionPtr->test(partition, statistics,
@@ -15,13 +61,18 @@ static inline IStoppingCriterion::Result testStoppingCriteria(
 
         switch (action) {
             case IStoppingCriterion::Action::FORCE_STOP: {
-                result.action = action;
-                result.numRules = stoppingCriterionResult.numRules;
-                return result;
+                if (result.action != IStoppingCriterion::Action::FORCE_STOP) {
+                    result.action = action;
+                    result.numRules = stoppingCriterionResult.numRules;
+                }
+
+                break;
             }
             case IStoppingCriterion::Action::STORE_STOP: {
-                result.action = action;
-                result.numRules = stoppingCriterionResult.numRules;
+                if (numStoredRules == 0 || stoppingCriterionResult.numRules < numStoredRules) {
+                    numStoredRules = stoppingCriterionResult.numRules;
+                }
+
                 break;
             }
             default: {
@@ -30,9 +81,667 @@ static inline IStoppingCriterion::Result testStoppingCriteria(
         }
     }
 
+    if (numStoredRules > 0) {
+        numUsedRules = numStoredRules;
+    }
+
     return result;
 }
 
+/**
+ * Returns whether a feature value satisfies a condition or not. To be consistent with the function
+ * `ConjunctiveBody::covers`, missing feature values (NaN) satisfy all conditions, except for those that use the ==
+ * operator.
+ *
+ * @param comparator    The type of the operator that is used by the condition
+ * @param threshold     The threshold that is used by the condition
+ * @param featureValue  The feature value
+ * @return              True, if the feature value satisfies the condition, false otherwise
+ */
+static inline bool satisfiesCondition(Comparator comparator, float32 threshold, float32 featureValue) {
+    switch (comparator) {
+        case LEQ: {
+            return !(featureValue > threshold);
+        }
+        case GR: {
+            return !(featureValue <= threshold);
+        }
+        case EQ: {
+            return !(featureValue != threshold);
+        }
+        default: {
+            return !(featureValue == threshold);
+        }
+    }
+}
+
+/**
+ * Removes all examples that do not satisfy a single condition from an array that specifies whether individual examples
+ * are covered or not.
+ *
+ * @param featureVector     A reference to an object of type `FeatureVector` that stores the feature values of the
+ *                          training examples for the feature that is used by the condition
+ * @param comparator        The type of the operator that is used by the condition
+ * @param threshold         The threshold that is used by the condition
+ * @param coverageArray     A pointer to an array of type `uint8`, shape `(numExamples)`, that specifies whether
+ *                          individual examples are covered (1) or not (0)
+ * @param tmpArray          A pointer to an array of type `uint8`, shape `(numExamples)`, that is used to temporarily
+ *                          store values
+ * @param numExamples       The total number of training examples
+ */
+static inline void filterCoverage(const FeatureVector& featureVector, Comparator comparator, float32 threshold,
+                                  uint8* coverageArray, uint8* tmpArray, uint32 numExamples) {
+    // Examples with missing feature values are treated like examples with a feature value of NaN...
+    if (!satisfiesCondition(comparator, threshold, std::numeric_limits<float32>::quiet_NaN())) {
+        for (auto it = featureVector.missing_indices_cbegin(); it != featureVector.missing_indices_cend(); it++) {
+            coverageArray[*it] = 0;
+        }
+    }
+
+    // The feature values of examples that are not contained by a (sparse) feature vector are zero...
+    if (satisfiesCondition(comparator, threshold, 0)) {
+        for (auto it = featureVector.cbegin(); it != featureVector.cend(); it++) {
+            if (!satisfiesCondition(comparator, threshold, it->value)) {
+                coverageArray[it->index] = 0;
+            }
+        }
+    } else {
+        setArrayToZeros(tmpArray, numExamples);
+
+        for (auto it = featureVector.cbegin(); it != featureVector.cend(); it++) {
+            if (satisfiesCondition(comparator, threshold, it->value)) {
+                tmpArray[it->index] = 1;
+            }
+        }
+
+        for (auto it = featureVector.missing_indices_cbegin(); it != featureVector.missing_indices_cend(); it++) {
+            tmpArray[*it] = coverageArray[*it];
+        }
+
+        for (uint32 i = 0; i < numExamples; i++) {
+            coverageArray[i] &= tmpArray[i];
+        }
+    }
+}
+
+static inline void filterCoverage(const FeatureVectorMap& featureVectors, Comparator comparator,
+                                  ConjunctiveBody::index_const_iterator indexIterator,
+                                  ConjunctiveBody::threshold_const_iterator thresholdIterator, uint32 numConditions,
+                                  uint8* coverageArray, uint8* tmpArray, uint32 numExamples) {
+    for (uint32 i = 0; i < numConditions; i++) {
+        const FeatureVector& featureVector = *featureVectors.find(indexIterator[i])->second;
+        filterCoverage(featureVector, comparator, thresholdIterator[i], coverageArray, tmpArray, numExamples);
+    }
+}
+
+/**
+ * Identifies the training examples that are covered by a conjunctive body. As the feature matrix provides column-wise
+ * access to the feature values, the conditions are tested for all examples at once, one condition after the other.
+ *
+ * @param body              A reference to an object of type `ConjunctiveBody`
+ * @param featureVectors    A reference to a map that stores the feature vectors for all features that are used by the
+ *                          body
+ * @param coverageArray     A pointer to an array of type `uint8`, shape `(numExamples)`, the information whether
+ *                          individual examples are covered (1) or not (0) should be written to
+ * @param tmpArray          A pointer to an array of type `uint8`, shape `(numExamples)`, that is used to temporarily
+ *                          store values
+ * @param numExamples       The total number of training examples
+ */
+static inline void calculateCoverage(const ConjunctiveBody& body, const FeatureVectorMap& featureVectors,
+                                     uint8* coverageArray, uint8* tmpArray, uint32 numExamples) {
+    setArrayToValue<uint8>(coverageArray, numExamples, 1);
+    filterCoverage(featureVectors, LEQ, body.leq_indices_cbegin(), body.leq_thresholds_cbegin(), body.getNumLeq(),
+                   coverageArray, tmpArray, numExamples);
+    filterCoverage(featureVectors, GR, body.gr_indices_cbegin(), body.gr_thresholds_cbegin(), body.getNumGr(),
+                   coverageArray, tmpArray, numExamples);
+    filterCoverage(featureVectors, EQ, body.eq_indices_cbegin(), body.eq_thresholds_cbegin(), body.getNumEq(),
+                   coverageArray, tmpArray, numExamples);
+    filterCoverage(featureVectors, NEQ, body.neq_indices_cbegin(), body.neq_thresholds_cbegin(), body.getNumNeq(),
+                   coverageArray, tmpArray, numExamples);
+}
+
+static inline float64 evaluateCoverage(IStatistics& statistics, const IHeadRefinementFactory& headRefinementFactory,
+                                       const FullIndexVector& labelIndices, const uint8* coverageArray,
+                                       uint32 numExamples) {
+    // The quality is calculated with respect to all training examples...
+    statistics.resetSampledStatistics();
+
+    for (uint32 i = 0; i < numExamples; i++) {
+        statistics.addSampledStatistic(i, 1);
+    }
+
+    std::unique_ptr<IStatisticsSubset> statisticsSubsetPtr = statistics.createSubset(labelIndices);
+
+    for (uint32 i = 0; i < numExamples; i++) {
+        if (coverageArray[i]) {
+            statisticsSubsetPtr->addToSubset(i, 1);
+        }
+    }
+
+    std::unique_ptr<IHeadRefinement> headRefinementPtr = headRefinementFactory.create(labelIndices);
+    const IScoreVector& scoreVector = headRefinementPtr->calculatePrediction(*statisticsSubsetPtr, false, false);
+    return scoreVector.overallQualityScore;
+}
+
+static inline void addConditions(ConditionList& conditions, Comparator comparator,
+                                 ConjunctiveBody::index_const_iterator indexIterator,
+                                 ConjunctiveBody::threshold_const_iterator thresholdIterator, uint32 numConditions) {
+    for (uint32 i = 0; i < numConditions; i++) {
+        Condition condition;
+        condition.featureIndex = indexIterator[i];
+        condition.comparator = comparator;
+        condition.threshold = thresholdIterator[i];
+        condition.start = 0;
+        condition.end = 0;
+        condition.covered = true;
+        condition.numCovered = 0;
+        conditions.addCondition(condition);
+    }
+}
+
+static inline void addRule(IModelBuilder& modelBuilder, const ConditionList& conditions, const IHead& head) {
+    auto fullHeadVisitor = [&](const FullHead& fullHead) {
+        uint32 numElements = fullHead.getNumElements();
+        FullPrediction prediction(numElements);
+        copyArray(fullHead.scores_cbegin(), prediction.scores_begin(), numElements);
+        modelBuilder.addRule(conditions, prediction);
+    };
+    auto partialHeadVisitor = [&](const PartialHead& partialHead) {
+        uint32 numElements = partialHead.getNumElements();
+        PartialPrediction prediction(numElements);
+        copyArray(partialHead.scores_cbegin(), prediction.scores_begin(), numElements);
+        copyArray(partialHead.indices_cbegin(), prediction.indices_begin(), numElements);
+        modelBuilder.addRule(conditions, prediction);
+    };
+    head.visit(fullHeadVisitor, partialHeadVisitor);
+}
+
+static inline void addRule(IModelBuilder& modelBuilder, const ConjunctiveBody& body, const IHead& head) {
+    ConditionList conditions;
+    addConditions(conditions, LEQ, body.leq_indices_cbegin(), body.leq_thresholds_cbegin(), body.getNumLeq());
+    addConditions(conditions, GR, body.gr_indices_cbegin(), body.gr_thresholds_cbegin(), body.getNumGr());
+    addConditions(conditions, EQ, body.eq_indices_cbegin(), body.eq_thresholds_cbegin(), body.getNumEq());
+    addConditions(conditions, NEQ, body.neq_indices_cbegin(), body.neq_thresholds_cbegin(), body.getNumNeq());
+    addRule(modelBuilder, conditions, head);
+}
+
+/**
+ * An implementation of the type `IModelBuilder` that forwards all rules to another builder. In addition, it serializes
+ * the rules, as well as the predictions of the model after each rule, such that they can be written to a checkpoint.
+ */
+class CheckpointRecorder final : public IModelBuilder {
+
+    private:
+
+        IModelBuilder& modelBuilder_;
+
+        CheckpointWriter writer_;
+
+        uint32 numRules_;
+
+    public:
+
+        /**
+         * @param modelBuilder A reference to an object of type `IModelBuilder`, all rules should be forwarded to
+         */
+        CheckpointRecorder(IModelBuilder& modelBuilder)
+            : modelBuilder_(modelBuilder), numRules_(0) {
+
+        }
+
+        void setDefaultRule(const AbstractPrediction& prediction) override {
+            modelBuilder_.setDefaultRule(prediction);
+        }
+
+        void addRule(const ConditionList& conditions, const AbstractPrediction& prediction) override {
+            writer_.write<uint32>((uint32) conditions.getNumConditions());
+
+            for (auto it = conditions.cbegin(); it != conditions.cend(); it++) {
+                const Condition& condition = *it;
+                writer_.write<uint32>(condition.featureIndex);
+                writer_.write<uint32>((uint32) condition.comparator);
+                writer_.write<float32>(condition.threshold);
+            }
+
+            std::unique_ptr<IHead> headPtr = prediction.toHead();
+            auto fullHeadVisitor = [this](const FullHead& head) {
+                uint32 numElements = head.getNumElements();
+                writer_.write<uint8>(0);
+                writer_.write<uint32>(numElements);
+                writer_.writeArray<float64>(head.scores_cbegin(), numElements);
+            };
+            auto partialHeadVisitor = [this](const PartialHead& head) {
+                uint32 numElements = head.getNumElements();
+                writer_.write<uint8>(1);
+                writer_.write<uint32>(numElements);
+                writer_.writeArray<float64>(head.scores_cbegin(), numElements);
+                writer_.writeArray<uint32>(head.indices_cbegin(), numElements);
+            };
+            headPtr->visit(fullHeadVisitor, partialHeadVisitor);
+            numRules_++;
+            modelBuilder_.addRule(conditions, prediction);
+        }
+
+        /**
+         * Serializes the predictions of the model after the most recently added rule.
+         *
+         * @param predictions A reference to a vector that stores the predictions
+         */
+        void recordPredictions(const std::vector<uint32>& predictions) {
+            uint32 numPredictions = (uint32) predictions.size();
+            writer_.write<uint32>(numPredictions);
+            writer_.writeArray<uint32>(predictions.data(), numPredictions);
+        }
+
+        /**
+         * Returns the number of rules that have been added so far.
+         *
+         * @return The number of rules
+         */
+        uint32 getNumRules() const {
+            return numRules_;
+        }
+
+        /**
+         * Returns the writer that stores the serialized rules and predictions.
+         *
+         * @return A reference to an object of type `CheckpointWriter` that stores the serialized rules and predictions
+         */
+        const CheckpointWriter& getWriter() const {
+            return writer_;
+        }
+
+        std::unique_ptr<RuleModel> build(uint32 numUsedRules) override {
+            return modelBuilder_.build(numUsedRules);
+        }
+
+};
+
+/**
+ * Reads a rule that has been serialized by a `CheckpointRecorder` and adds it to a model.
+ *
+ * @param reader        A reference to an object of type `CheckpointReader`, the rule should be read from
+ * @param modelBuilder  A reference to an object of type `IModelBuilder`, the rule should be added to
+ */
+static inline void restoreRule(CheckpointReader& reader, IModelBuilder& modelBuilder) {
+    ConditionList conditions;
+    uint32 numConditions = reader.read<uint32>();
+
+    for (uint32 i = 0; i < numConditions; i++) {
+        Condition condition;
+        condition.featureIndex = reader.read<uint32>();
+        condition.comparator = (Comparator) reader.read<uint32>();
+        condition.threshold = reader.read<float32>();
+        condition.start = 0;
+        condition.end = 0;
+        condition.covered = true;
+        condition.numCovered = 0;
+        conditions.addCondition(condition);
+    }
+
+    bool partial = reader.read<uint8>();
+    uint32 numElements = reader.read<uint32>();
+
+    if (partial) {
+        PartialPrediction prediction(numElements);
+        reader.readArray<float64>(prediction.scores_begin(), numElements);
+        reader.readArray<uint32>(prediction.indices_begin(), numElements);
+        modelBuilder.addRule(conditions, prediction);
+    } else {
+        FullPrediction prediction(numElements);
+        reader.readArray<float64>(prediction.scores_begin(), numElements);
+        modelBuilder.addRule(conditions, prediction);
+    }
+}
+
+/**
+ * Updates a fingerprint with the bytes of an array by using the FNV-1a hash function.
+ *
+ * @tparam T            The type of the values in the array
+ * @param fingerprint   The fingerprint to be updated
+ * @param array         A pointer to an array of template type `T`, shape `(numElements)`, that stores the values
+ * @param numElements   The number of elements in the array
+ * @return              The updated fingerprint
+ */
+template<class T>
+static inline uint64 updateFingerprint(uint64 fingerprint, const T* array, uint32 numElements) {
+    const uint8* bytes = reinterpret_cast<const uint8*>(array);
+    uint64 numBytes = ((uint64) numElements) * sizeof(T);
+
+    for (uint64 i = 0; i < numBytes; i++) {
+        fingerprint = (fingerprint ^ bytes[i]) * FINGERPRINT_PRIME;
+    }
+
+    return fingerprint;
+}
+
+/**
+ * Computes a fingerprint of the training data that allows to check whether a checkpoint has been written for the same
+ * data. It takes into account the ground truth, as well as the indices and values of all features.
+ *
+ * @param featureMatrix A reference to an object of type `IFeatureMatrix` that provides column-wise access to the
+ *                      feature values of the training examples
+ * @param statistics    A reference to an object of type `IStatistics` that provides access to the ground truth
+ * @return              The fingerprint
+ */
+static inline uint64 computeFingerprint(const IFeatureMatrix& featureMatrix, const IStatistics& statistics) {
+    std::unique_ptr<std::vector<uint32>> groundTruthPtr = statistics.getGroundTruth();
+    uint64 fingerprint = updateFingerprint<uint32>(FINGERPRINT_OFFSET, groundTruthPtr->data(),
+                                                   (uint32) groundTruthPtr->size());
+    uint32 numFeatures = featureMatrix.getNumCols();
+    std::unique_ptr<FeatureVector> featureVectorPtr;
+    std::vector<uint32> missingIndices;
+
+    for (uint32 i = 0; i < numFeatures; i++) {
+        featureMatrix.fetchFeatureVector(i, featureVectorPtr);
+        uint32 numElements = featureVectorPtr->getNumElements();
+        FeatureVector::const_iterator iterator = featureVectorPtr->cbegin();
+
+        for (uint32 j = 0; j < numElements; j++) {
+            fingerprint = updateFingerprint<uint32>(fingerprint, &iterator[j].index, 1);
+            fingerprint = updateFingerprint<float32>(fingerprint, &iterator[j].value, 1);
+        }
+
+        // The order of the missing indices is not guaranteed to be the same...
+        missingIndices.assign(featureVectorPtr->missing_indices_cbegin(), featureVectorPtr->missing_indices_cend());
+        std::sort(missingIndices.begin(), missingIndices.end());
+        fingerprint = updateFingerprint<uint32>(fingerprint, missingIndices.data(), (uint32) missingIndices.size());
+    }
+
+    return fingerprint;
+}
+
+/**
+ * Writes the current state of the induction of rules to a checkpoint file.
+ *
+ * @param path                  The path of the checkpoint file
+ * @param statistics            A reference to an object of type `IStatistics` that stores the current statistics
+ * @param numFeatures           The total number of available features
+ * @param numLabels             The total number of available labels
+ * @param fingerprint           A fingerprint of the training data
+ * @param rng                   A reference to an object of type `RNG` that implements the random number generator that
+ *                              is used
+ * @param numRules              The number of rules induced so far
+ * @param numUsedRules          The number of used rules that has been stored by a stopping criterion or 0, if no such
+ *                              number has been stored yet
+ * @param currentQuality        The quality of the current model
+ * @param stoppingCriteria      A reference to a list that contains the stopping criteria
+ * @param instanceSubSampling   A reference to an object of type `IInstanceSubSampling` that is used for sampling the
+ *                              examples
+ * @param featureSubSampling    A reference to an object of type `IFeatureSubSampling` that is used for sampling the
+ *                              features
+ * @param ruleInduction         A reference to an object of type `IRuleInduction` that is used to induce rules
+ * @param recorder              A reference to an object of type `CheckpointRecorder` that stores the serialized rules
+ * @return                      True, if the checkpoint has been written successfully, false otherwise
+ */
+static inline bool saveCheckpoint(const std::string& path, const IStatistics& statistics, uint32 numFeatures,
+                                  uint32 numLabels, uint64 fingerprint, const RNG& rng, uint32 numRules,
+                                  uint32 numUsedRules,
+                                  float64 currentQuality,
+                                  const std::forward_list<std::shared_ptr<IStoppingCriterion>>& stoppingCriteria,
+                                  const IInstanceSubSampling& instanceSubSampling,
+                                  const IFeatureSubSampling& featureSubSampling, const IRuleInduction& ruleInduction,
+                                  const CheckpointRecorder& recorder) {
+    uint32 numStatistics = statistics.getNumStatistics();
+    CheckpointWriter stateWriter;
+    stateWriter.write<uint32>(rng.getState());
+    stateWriter.write<uint32>(numRules);
+    stateWriter.write<uint32>(numUsedRules);
+    stateWriter.write<float64>(currentQuality);
+
+    for (uint32 i = 0; i < numStatistics; i++) {
+        stateWriter.write<uint32>(statistics.getCoverageCount(i));
+    }
+
+    for (auto it = stoppingCriteria.cbegin(); it != stoppingCriteria.cend(); it++) {
+        (*it)->writeState(stateWriter);
+    }
+
+    instanceSubSampling.writeState(stateWriter);
+    featureSubSampling.writeState(stateWriter);
+    ruleInduction.writeState(stateWriter);
+    stateWriter.write<uint32>(recorder.getNumRules());
+
+    // The header allows to check whether a checkpoint belongs to the same data and whether it is complete...
+    const CheckpointWriter& ruleWriter = recorder.getWriter();
+    CheckpointWriter writer;
+    writer.write<uint32>(CHECKPOINT_MAGIC);
+    writer.write<uint32>(CHECKPOINT_VERSION);
+    writer.write<uint32>(numStatistics);
+    writer.write<uint32>(numFeatures);
+    writer.write<uint32>(numLabels);
+    writer.write<uint64>(fingerprint);
+    writer.write<uint32>(stateWriter.getNumBytes() + ruleWriter.getNumBytes());
+    writer.append(stateWriter);
+    writer.append(ruleWriter);
+    return writer.save(path);
+}
+
+/**
+ * Reads a checkpoint file and checks whether it has been written for the same data.
+ *
+ * @param path          The path of the checkpoint file
+ * @param statistics    A reference to an object of type `IStatistics` that stores the current statistics
+ * @param numFeatures   The total number of available features
+ * @param numLabels     The total number of available labels
+ * @param fingerprint   A fingerprint of the training data
+ * @param reader        A reference to an object of type `CheckpointReader`, the checkpoint should be read into
+ * @return              True, if the checkpoint file exists and can be used to resume the induction of rules, false
+ *                      otherwise
+ */
+static inline bool loadCheckpoint(const std::string& path, const IStatistics& statistics, uint32 numFeatures,
+                                  uint32 numLabels, uint64 fingerprint, CheckpointReader& reader) {
+    if (!reader.load(path)) {
+        return false;
+    }
+
+    uint32 magic = reader.read<uint32>();
+    uint32 version = reader.read<uint32>();
+    uint32 numStatistics = reader.read<uint32>();
+    uint32 numCheckpointFeatures = reader.read<uint32>();
+    uint32 numCheckpointLabels = reader.read<uint32>();
+    uint64 checkpointFingerprint = reader.read<uint64>();
+    uint32 numBytes = reader.read<uint32>();
+    return reader.isValid() && magic == CHECKPOINT_MAGIC && version == CHECKPOINT_VERSION
+           && numStatistics == statistics.getNumStatistics() && numCheckpointFeatures == numFeatures
+           && numCheckpointLabels == numLabels && checkpointFingerprint == fingerprint
+           && numBytes == reader.getNumRemainingBytes();
+}
+
+/**
+ * Restores the state of the induction of rules from a checkpoint that has been loaded via the function
+ * `loadCheckpoint`.
+ *
+ * @param reader                A reference to an object of type `CheckpointReader`, the state should be read from
+ * @param statistics            A reference to an object of type `IStatistics` that should be updated
+ * @param rng                   A reference to an object of type `RNG`, whose state should be restored
+ * @param numRules              A reference to the number of rules induced so far, which should be updated
+ * @param numUsedRules          A reference to the number of used rules, which should be updated
+ * @param currentQuality        A reference to the quality of the current model, which should be updated
+ * @param stoppingCriteria      A reference to a list that contains the stopping criteria, whose state should be
+ *                              restored
+ * @param instanceSubSampling   A reference to an object of type `IInstanceSubSampling`, whose state should be restored
+ * @param featureSubSampling    A reference to an object of type `IFeatureSubSampling`, whose state should be restored
+ * @param ruleInduction         A reference to an object of type `IRuleInduction`, whose state should be restored
+ * @param modelBuilder          A reference to an object of type `IModelBuilder`, the restored rules should be added to
+ * @param predictionVisitor     The visitor function that should be invoked for each restored rule
+ */
+static inline void restoreCheckpoint(CheckpointReader& reader, IStatistics& statistics, RNG& rng, uint32& numRules,
+                                     uint32& numUsedRules, float64& currentQuality,
+                                     std::forward_list<std::shared_ptr<IStoppingCriterion>>& stoppingCriteria,
+                                     IInstanceSubSampling& instanceSubSampling,
+                                     IFeatureSubSampling& featureSubSampling, IRuleInduction& ruleInduction,
+                                     IModelBuilder& modelBuilder,
+                                     IRuleModelInduction::PredictionVisitor predictionVisitor) {
+    uint32 numStatistics = statistics.getNumStatistics();
+    rng.setState(reader.read<uint32>());
+    numRules = reader.read<uint32>();
+    numUsedRules = reader.read<uint32>();
+    currentQuality = reader.read<float64>();
+
+    // As the predictions only depend on the number of rules that cover each example, the statistics can be restored
+    // without applying the rules again...
+    for (uint32 i = 0; i < numStatistics; i++) {
+        uint32 coverageCount = reader.read<uint32>();
+
+        for (uint32 j = 0; j < coverageCount; j++) {
+            statistics.increaseCoverageCount(i);
+        }
+    }
+
+    statistics.updatePredictions();
+
+    for (auto it = stoppingCriteria.begin(); it != stoppingCriteria.end(); it++) {
+        (*it)->readState(reader);
+    }
+
+    instanceSubSampling.readState(reader);
+    featureSubSampling.readState(reader);
+    ruleInduction.readState(reader);
+    uint32 numRecordedRules = reader.read<uint32>();
+    std::vector<uint32> predictions;
+
+    for (uint32 i = 0; i < numRecordedRules; i++) {
+        restoreRule(reader, modelBuilder);
+        predictions.resize(reader.read<uint32>());
+        reader.readArray<uint32>(predictions.data(), (uint32) predictions.size());
+        predictionVisitor(predictions);
+    }
+}
+
+/**
+ * Applies the rules of an existing model to the training examples, such that the induction of rules can be continued
+ * from the resulting state, and adds them to a new model.
+ *
+ * @param initialModel          A reference to an object of type `RuleModel` that stores the rules to be inherited
+ * @param maxInheritedRules     The maximum number of rules to be inherited or 0, if all (used) rules should be
+ *                              inherited
+ * @param verifyInheritedRules  True, if rules should only be inherited if they improve the quality of the model, false
+ *                              otherwise
+ * @param numThreads            The number of CPU threads to be used to identify the examples that are covered by the
+ *                              rules in parallel
+ * @param featureMatrix         A reference to an object of type `IFeatureMatrix` that provides access to the feature
+ *                              values of the training examples
+ * @param statistics            A reference to an object of type `IStatistics` that should be updated
+ * @param headRefinementFactory A reference to an object of type `IHeadRefinementFactory` that should be used to assess
+ *                              the quality of rules
+ * @param labelIndices          A reference to an object of type `FullIndexVector` that provides access to the indices
+ *                              of all labels
+ * @param modelBuilder          A reference to an object of type `IModelBuilder`, the inherited rules should be added to
+ * @param predictionVisitor     The visitor function that should be invoked after each inherited rule
+ * @param currentQuality        A reference to the quality of the current model, which should be updated
+ * @return                      The number of rules that have been inherited
+ */
+static inline uint32 inheritRules(const RuleModel& initialModel, uint32 maxInheritedRules, bool verifyInheritedRules,
+                                  uint32 numThreads, const IFeatureMatrix& featureMatrix, IStatistics& statistics,
+                                  const IHeadRefinementFactory& headRefinementFactory,
+                                  const FullIndexVector& labelIndices, IModelBuilder& modelBuilder,
+                                  IRuleModelInduction::PredictionVisitor predictionVisitor, float64& currentQuality) {
+    // Collect the rules to be inherited. Rules with an empty body are ignored, as the default rule is induced anew...
+    std::vector<InheritedRule> rules;
+    FeatureVectorMap featureVectors;
+    std::vector<uint32> featureIndices;
+
+    for (auto it = initialModel.used_cbegin(); it != initialModel.used_cend(); it++) {
+        if (maxInheritedRules > 0 && rules.size() >= maxInheritedRules) {
+            break;
+        }
+
+        const Rule& rule = *it;
+        auto emptyBodyVisitor = [](const EmptyBody& body) {
+            return;
+        };
+        auto conjunctiveBodyVisitor = [&](const ConjunctiveBody& body) {
+            rules.push_back(std::make_pair(&body, &rule.getHead()));
+            auto addFeatureIndices = [&](ConjunctiveBody::index_const_iterator indexIterator, uint32 numConditions) {
+                for (uint32 i = 0; i < numConditions; i++) {
+                    uint32 featureIndex = indexIterator[i];
+
+                    if (featureVectors.emplace(featureIndex, std::unique_ptr<FeatureVector>()).second) {
+                        featureIndices.push_back(featureIndex);
+                    }
+                }
+            };
+            addFeatureIndices(body.leq_indices_cbegin(), body.getNumLeq());
+            addFeatureIndices(body.gr_indices_cbegin(), body.getNumGr());
+            addFeatureIndices(body.eq_indices_cbegin(), body.getNumEq());
+            addFeatureIndices(body.neq_indices_cbegin(), body.getNumNeq());
+        };
+        rule.getBody().visit(emptyBodyVisitor, conjunctiveBodyVisitor);
+    }
+
+    uint32 numRules = (uint32) rules.size();
+
+    if (numRules == 0) {
+        return 0;
+    }
+
+    // Fetch the feature vectors that are used by the rules in parallel...
+    uint32 numFeatures = (uint32) featureIndices.size();
+    const IFeatureMatrix* featureMatrixPtr = &featureMatrix;
+    FeatureVectorMap* featureVectorsPtr = &featureVectors;
+    std::vector<uint32>* featureIndicesPtr = &featureIndices;
+
+    #pragma omp parallel for firstprivate(numFeatures) firstprivate(featureMatrixPtr) firstprivate(featureVectorsPtr) \
+    firstprivate(featureIndicesPtr) schedule(dynamic) num_threads(numThreads)
+    for (intp i = 0; i < numFeatures; i++) {
+        uint32 featureIndex = (*featureIndicesPtr)[i];
+        featureMatrixPtr->fetchFeatureVector(featureIndex, featureVectorsPtr->find(featureIndex)->second);
+    }
+
+    // Identify the examples that are covered by several rules in parallel, before the rules are applied one after
+    // another...
+    uint32 numExamples = statistics.getNumStatistics();
+    uint32 batchSize = std::min(numThreads, numRules);
+    DenseMatrix<uint8> coverageMatrix(batchSize, numExamples);
+    DenseMatrix<uint8> tmpMatrix(batchSize, numExamples);
+    DenseMatrix<uint8>* coverageMatrixPtr = &coverageMatrix;
+    DenseMatrix<uint8>* tmpMatrixPtr = &tmpMatrix;
+    const std::vector<InheritedRule>* rulesPtr = &rules;
+    uint32 numInheritedRules = 0;
+
+    for (uint32 batchStart = 0; batchStart < numRules; batchStart += batchSize) {
+        uint32 numBatchRules = std::min(batchSize, numRules - batchStart);
+
+        #pragma omp parallel for firstprivate(numBatchRules) firstprivate(batchStart) firstprivate(numExamples) \
+        firstprivate(rulesPtr) firstprivate(featureVectorsPtr) firstprivate(coverageMatrixPtr) \
+        firstprivate(tmpMatrixPtr) schedule(dynamic) num_threads(numThreads)
+        for (intp i = 0; i < numBatchRules; i++) {
+            const ConjunctiveBody& body = *(*rulesPtr)[batchStart + i].first;
+            calculateCoverage(body, *featureVectorsPtr, coverageMatrixPtr->row_begin(i), tmpMatrixPtr->row_begin(i),
+                              numExamples);
+        }
+
+        for (uint32 i = 0; i < numBatchRules; i++) {
+            const InheritedRule& rule = rules[batchStart + i];
+            const uint8* coverageArray = coverageMatrix.row_cbegin(i);
+
+            if (verifyInheritedRules
+                && !(evaluateCoverage(statistics, headRefinementFactory, labelIndices, coverageArray, numExamples)
+                     < currentQuality)) {
+                continue;
+            }
+
+            // Update the statistics by applying the predictions of the inherited rule...
+            for (uint32 j = 0; j < numExamples; j++) {
+                if (coverageArray[j]) {
+                    statistics.increaseCoverageCount(j);
+                }
+            }
+
+            statistics.updatePredictions();
+            addRule(modelBuilder, *rule.first, *rule.second);
+            numInheritedRules++;
+            currentQuality = statistics.evaluatePredictions();
+
+            std::unique_ptr<std::vector<uint32>> predictionPtr = statistics.getPredictions();
+            predictionVisitor(*predictionPtr);
+        }
+    }
+
+    return numInheritedRules;
+}
+
 SequentialRuleModelInduction::SequentialRuleModelInduction(
         std::shared_ptr<IStatisticsProviderFactory> statisticsProviderFactoryPtr,
         std::shared_ptr<IThresholdsFactory> thresholdsFactoryPtr, std::shared_ptr<IRuleInduction> ruleInductionPtr,
@@ -41,28 +750,47 @@ SequentialRuleModelInduction::SequentialRuleModelInduction(
         std::shared_ptr<IInstanceSubSamplingFactory> instanceSubSamplingFactoryPtr,
         std::shared_ptr<IFeatureSubSamplingFactory> featureSubSamplingFactoryPtr,
         std::shared_ptr<IPartitionSamplingFactory> partitionSamplingFactoryPtr,
-        std::unique_ptr<std::forward_list<std::shared_ptr<IStoppingCriterion>>> stoppingCriteriaPtr)
+        std::unique_ptr<std::forward_list<std::shared_ptr<IStoppingCriterion>>> stoppingCriteriaPtr,
+        std::shared_ptr<CancellationToken> cancellationTokenPtr, uint32 maxInheritedRules, bool verifyInheritedRules,
+        uint32 numThreads, const std::string& checkpointPath, uint32 checkpointInterval)
     : statisticsProviderFactoryPtr_(statisticsProviderFactoryPtr), thresholdsFactoryPtr_(thresholdsFactoryPtr),
       ruleInductionPtr_(ruleInductionPtr), defaultRuleHeadRefinementFactoryPtr_(defaultRuleHeadRefinementFactoryPtr),
       headRefinementFactoryPtr_(headRefinementFactoryPtr),
       instanceSubSamplingFactoryPtr_(instanceSubSamplingFactoryPtr),
       featureSubSamplingFactoryPtr_(featureSubSamplingFactoryPtr),
       partitionSamplingFactoryPtr_(partitionSamplingFactoryPtr),
-      stoppingCriteriaPtr_(std::move(stoppingCriteriaPtr)) {
+      stoppingCriteriaPtr_(std::move(stoppingCriteriaPtr)), cancellationTokenPtr_(cancellationTokenPtr),
+      maxInheritedRules_(maxInheritedRules), verifyInheritedRules_(verifyInheritedRules), numThreads_(numThreads),
+      checkpointPath_(checkpointPath), checkpointInterval_(checkpointInterval) {
 
 }
 
 std::unique_ptr<RuleModel> SequentialRuleModelInduction::induceRules(
         std::shared_ptr<INominalFeatureMask> nominalFeatureMaskPtr, std::shared_ptr<IFeatureMatrix> featureMatrixPtr,
         std::shared_ptr<ILabelMatrix> labelMatrixPtr, RNG& rng, IModelBuilder& modelBuilder,
-        PredictionVisitor groundTruthVisitor, PredictionVisitor predictionVisitor) {
+        const RuleModel* initialModel, PredictionVisitor groundTruthVisitor, PredictionVisitor predictionVisitor) {
+    cancellationTokenPtr_->start();
+
+    // If checkpoints should be written, all rules and predictions are recorded...
+    bool checkpointing = !checkpointPath_.empty();
+    CheckpointRecorder recorder(modelBuilder);
+    IModelBuilder& builder = checkpointing ? static_cast<IModelBuilder&>(recorder) : modelBuilder;
+    PredictionVisitor visitor = predictionVisitor;
+
+    if (checkpointing) {
+        visitor = [&](const std::vector<uint32>& predictions) {
+            recorder.recordPredictions(predictions);
+            predictionVisitor(predictions);
+        };
+    }
+
     // Induce default rule...
     const IHeadRefinementFactory* defaultRuleHeadRefinementFactory = defaultRuleHeadRefinementFactoryPtr_.get();
     uint32 numRules = defaultRuleHeadRefinementFactory != nullptr ? 1 : 0;
     uint32 numUsedRules = 0;
     std::shared_ptr<IStatisticsProvider> statisticsProviderPtr =
         labelMatrixPtr->createStatisticsProvider(*statisticsProviderFactoryPtr_);
-    ruleInductionPtr_->induceDefaultRule(*statisticsProviderPtr, defaultRuleHeadRefinementFactory, modelBuilder);
+    ruleInductionPtr_->induceDefaultRule(*statisticsProviderPtr, defaultRuleHeadRefinementFactory, builder);
 
     // Induce the remaining rules...
     std::unique_ptr<IThresholds> thresholdsPtr = thresholdsFactoryPtr_->create(featureMatrixPtr, nominalFeatureMaskPtr,
@@ -73,39 +801,79 @@ std::unique_ptr<RuleModel> SequentialRuleModelInduction::induceRules(
     std::unique_ptr<IPartitionSampling> partitionSamplingPtr = labelMatrixPtr->createPartitionSampling(
         *partitionSamplingFactoryPtr_);
     IPartition& partition = partitionSamplingPtr->partition(rng);
+    partition.markHoldoutStatistics(statisticsProviderPtr->get());
     std::unique_ptr<IInstanceSubSampling> instanceSubSamplingPtr = partition.createInstanceSubSampling(
-        *instanceSubSamplingFactoryPtr_);
+        *instanceSubSamplingFactoryPtr_, *labelMatrixPtr);
     std::unique_ptr<IFeatureSubSampling> featureSubSamplingPtr = featureSubSamplingFactoryPtr_->create(numFeatures);
     const FullIndexVector labelIndices(numLabels);
     IStoppingCriterion::Result stoppingCriterionResult;
     float64 currentQuality = 0;
+    CheckpointReader checkpointReader;
+    uint64 fingerprint = checkpointing ? computeFingerprint(*featureMatrixPtr, statisticsProviderPtr->get()) : 0;
+
+    if (checkpointing && loadCheckpoint(checkpointPath_, statisticsProviderPtr->get(), numFeatures, numLabels,
+                                        fingerprint, checkpointReader)) {
+        // Resume from a checkpoint. It includes the rules that have been inherited from an existing model, if any...
+        restoreCheckpoint(checkpointReader, statisticsProviderPtr->get(), rng, numRules, numUsedRules,
+                          currentQuality, *stoppingCriteriaPtr_, *instanceSubSamplingPtr, *featureSubSamplingPtr,
+                          *ruleInductionPtr_, builder, visitor);
+    } else if (initialModel != nullptr) {
+        // Continue the rules of an existing model...
+        numRules += inheritRules(*initialModel, maxInheritedRules_, verifyInheritedRules_, numThreads_,
+                                 *featureMatrixPtr, statisticsProviderPtr->get(), *headRefinementFactoryPtr_,
+                                 labelIndices, builder, visitor, currentQuality);
+    }
 
     while (stoppingCriterionResult = testStoppingCriteria(*stoppingCriteriaPtr_, partition,
-                                                          statisticsProviderPtr->get(), numRules),
+                                                          statisticsProviderPtr->get(), numRules, numUsedRules),
            stoppingCriterionResult.action != IStoppingCriterion::Action::FORCE_STOP) {
-        if (stoppingCriterionResult.action == IStoppingCriterion::Action::STORE_STOP && numUsedRules == 0) {
-            numUsedRules = stoppingCriterionResult.numRules;
-        }
-
         const IWeightVector& weights = instanceSubSamplingPtr->subSample(rng);
         std::pair<bool, float64> result = ruleInductionPtr_->induceRule(*thresholdsPtr, labelIndices, weights, partition,
-                                                     *featureSubSamplingPtr, rng, modelBuilder, currentQuality);
+                                                     *featureSubSamplingPtr, rng, builder, currentQuality,
+                                                     *cancellationTokenPtr_);
         bool success = result.first;
         currentQuality = result.second;
 
         if (success) {
             numRules++;
 
+            // As the rule may have been learned on a sub-sample of the training examples, the quality of the model is
+            // calculated with respect to all training examples...
+            currentQuality = statisticsProviderPtr->get().evaluatePredictions();
+
             std::unique_ptr<std::vector<uint32>> predictionPtr = statisticsProviderPtr->get().getPredictions();
-            predictionVisitor(*predictionPtr);
+            visitor(*predictionPtr);
+
+            // Checkpoints are only written after a rule has been induced successfully, as the state is inconsistent
+            // while a rule is being induced...
+            if (checkpointing && numRules % checkpointInterval_ == 0
+                && !saveCheckpoint(checkpointPath_, statisticsProviderPtr->get(), numFeatures, numLabels, fingerprint,
+                                   rng, numRules, numUsedRules, currentQuality, *stoppingCriteriaPtr_,
+                                   *instanceSubSamplingPtr, *featureSubSamplingPtr, *ruleInductionPtr_, recorder)) {
+                throw std::runtime_error("Failed to write checkpoint to file \"" + checkpointPath_ + "\"");
+            }
         } else {
             break;
         }
     }
 
+    // A stopping criterion that forces the induction of rules to be stopped may ask for using fewer rules than have
+    // been induced (e.g., if the quality on a holdout set has not improved for some time). If a potential point for
+    // stopping has been stored before, the smaller number of rules is used...
+    if (stoppingCriterionResult.action == IStoppingCriterion::Action::FORCE_STOP
+        && (numUsedRules == 0 || stoppingCriterionResult.numRules < numUsedRules)) {
+        numUsedRules = stoppingCriterionResult.numRules;
+    }
+
+    // Once the induction of rules has been completed, the checkpoint is not needed anymore. If it has been canceled,
+    // the most recent checkpoint is retained...
+    if (checkpointing && !cancellationTokenPtr_->isCancelled()) {
+        std::remove(checkpointPath_.c_str());
+    }
+
     std::unique_ptr<std::vector<uint32>> groundTruthPtr = statisticsProviderPtr->get().getGroundTruth();
     groundTruthVisitor(*groundTruthPtr);
 
     // Build and return the final model...
-    return modelBuilder.build(numUsedRules);
+    return builder.build(numUsedRules);
 }
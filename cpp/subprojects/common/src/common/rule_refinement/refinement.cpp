@@ -1,4 +1,7 @@
 #include "common/rule_refinement/refinement.hpp"
+#include "common/head_refinement/prediction_full.hpp"
+#include "common/head_refinement/prediction_partial.hpp"
+#include "common/rule_induction/checkpoint.hpp"
 
 
 bool Refinement::isBetterThan(const Refinement& another) const {
@@ -11,3 +14,51 @@ bool Refinement::isBetterThan(const Refinement& another) const {
 
     return false;
 }
+
+void Refinement::serialize(CheckpointWriter& writer) const {
+    Condition::serialize(writer);
+    writer.write<intp>(previous);
+    const AbstractEvaluatedPrediction* head = headPtr.get();
+
+    if (head == nullptr) {
+        writer.write<uint8>(0);
+    } else {
+        uint32 numElements = head->getNumElements();
+        bool partial = head->isPartial();
+        writer.write<uint8>(partial ? 2 : 1);
+        writer.write<uint32>(numElements);
+        writer.writeArray<float64>(head->scores_cbegin(), numElements);
+
+        if (partial) {
+            for (uint32 i = 0; i < numElements; i++) {
+                writer.write<uint32>(head->getIndex(i));
+            }
+        }
+
+        writer.write<float64>(head->overallQualityScore);
+    }
+}
+
+void Refinement::deserialize(CheckpointReader& reader) {
+    Condition::deserialize(reader);
+    previous = reader.read<intp>();
+    uint8 type = reader.read<uint8>();
+
+    if (type == 0) {
+        headPtr.reset();
+    } else {
+        uint32 numElements = reader.read<uint32>();
+
+        if (type == 2) {
+            std::unique_ptr<PartialPrediction> predictionPtr = std::make_unique<PartialPrediction>(numElements);
+            reader.readArray<float64>(predictionPtr->scores_begin(), numElements);
+            reader.readArray<uint32>(predictionPtr->indices_begin(), numElements);
+            headPtr = std::move(predictionPtr);
+        } else {
+            headPtr = std::make_unique<FullPrediction>(numElements);
+            reader.readArray<float64>(headPtr->scores_begin(), numElements);
+        }
+
+        headPtr->overallQualityScore = reader.read<float64>();
+    }
+}
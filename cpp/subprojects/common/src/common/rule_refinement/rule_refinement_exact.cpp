@@ -1,34 +1,57 @@
 #include "common/rule_refinement/rule_refinement_exact.hpp"
 #include "common/math/math.hpp"
+#include <limits>
+#include <vector>
 
 #define USE_NEQ false
 
 #define USE_LEQ true
 
+#define CANCELLATION_INTERVAL 1024
+
+
+/**
+ * Returns whether a feature value satisfies a condition or not.
+ *
+ * @param comparator    The type of the operator that is used by the condition
+ * @param threshold     The threshold of the condition
+ * @param value         The feature value
+ * @return              True, if the feature value satisfies the condition, false otherwise
+ */
+static inline bool satisfiesCondition(Comparator comparator, float32 threshold, float32 value) {
+    switch (comparator) {
+        case LEQ:
+            return value <= threshold;
+        case GR:
+            return value > threshold;
+        case EQ:
+            return value == threshold;
+        default:
+            return value != threshold;
+    }
+}
 
 template<class T>
 ExactRuleRefinement<T>::ExactRuleRefinement(
         std::unique_ptr<IHeadRefinement> headRefinementPtr, const T& labelIndices, uint32 numExamples,
         uint32 featureIndex, bool nominal,
-        std::unique_ptr<IRuleRefinementCallback<FeatureVector, IWeightVector>> callbackPtr)
+        std::unique_ptr<IExactRuleRefinementCallback> callbackPtr)
     : headRefinementPtr_(std::move(headRefinementPtr)), labelIndices_(labelIndices), numExamples_(numExamples),
       featureIndex_(featureIndex), nominal_(nominal), callbackPtr_(std::move(callbackPtr)) {
 
 }
 
 template<class T>
-void ExactRuleRefinement<T>::findRefinement(const AbstractEvaluatedPrediction* currentHead, uint32 minCoverage) {
+template<class Vector>
+void ExactRuleRefinement<T>::findRefinementInternally(const Vector& featureVector,
+                                                      const IImmutableStatistics& statistics,
+                                                      const IWeightVector& weights,
+                                                      const AbstractEvaluatedPrediction* currentHead,
+                                                      uint32 minCoverage, const CancellationToken& cancellationToken) {
     std::unique_ptr<Refinement> refinementPtr = std::make_unique<Refinement>();
     refinementPtr->featureIndex = featureIndex_;
     const AbstractEvaluatedPrediction* bestHead = currentHead;
-
-    // Invoke the callback...
-    std::unique_ptr<IRuleRefinementCallback<FeatureVector, IWeightVector>::Result> callbackResultPtr =
-        callbackPtr_->get();
-    const IImmutableStatistics& statistics = callbackResultPtr->statistics_;
-    const IWeightVector& weights = callbackResultPtr->weights_;
-    const FeatureVector& featureVector = callbackResultPtr->vector_;
-    FeatureVector::const_iterator iterator = featureVector.cbegin();
+    typename Vector::const_iterator iterator = featureVector.cbegin();
     uint32 numElements = featureVector.getNumElements();
 
     // Create a new, empty subset of the statistics...
@@ -82,6 +105,13 @@ void ExactRuleRefinement<T>::findRefinement(const AbstractEvaluatedPrediction* c
                 break;
             }
 
+            // Check whether the induction of rules has been canceled every `CANCELLATION_INTERVAL` examples...
+            if (r % CANCELLATION_INTERVAL == 0 && cancellationToken.isCancelled()) {
+                refinementPtr->headPtr = headRefinementPtr_->pollHead();
+                refinementPtr_ = std::move(refinementPtr);
+                return;
+            }
+
             lastNegativeR = r;
             uint32 i = iterator[r].index;
             float64 weight = weights.getWeight(i);
@@ -249,6 +279,13 @@ void ExactRuleRefinement<T>::findRefinement(const AbstractEvaluatedPrediction* c
             uint32 i = iterator[r].index;
             float64 weight = weights.getWeight(i);
 
+            // Check whether the induction of rules has been canceled every `CANCELLATION_INTERVAL` examples...
+            if (r % CANCELLATION_INTERVAL == 0 && cancellationToken.isCancelled()) {
+                refinementPtr->headPtr = headRefinementPtr_->pollHead();
+                refinementPtr_ = std::move(refinementPtr);
+                return;
+            }
+
             // Do only consider examples that are included in the current sub-sample...
             if (weight > 0) {
                 float32 currentThreshold = iterator[r].value;
@@ -522,6 +559,258 @@ void ExactRuleRefinement<T>::findRefinement(const AbstractEvaluatedPrediction* c
     refinementPtr_ = std::move(refinementPtr);
 }
 
+template<class T>
+template<class Vector>
+void ExactRuleRefinement<T>::evaluateConditionInternally(const Vector& featureVector,
+                                                         const IImmutableStatistics& statistics,
+                                                         const IWeightVector& weights, const Condition& condition,
+                                                         uint32 minCoverage) {
+    std::unique_ptr<Refinement> refinementPtr = std::make_unique<Refinement>();
+    refinementPtr->featureIndex = featureIndex_;
+    refinementPtr->comparator = condition.comparator;
+    refinementPtr->threshold = condition.threshold;
+    typename Vector::const_iterator iterator = featureVector.cbegin();
+    uint32 numElements = featureVector.getNumElements();
+
+    // Create a new, empty subset of the statistics...
+    std::unique_ptr<IStatisticsSubset> statisticsSubsetPtr = labelIndices_.createSubset(statistics);
+
+    for (auto it = featureVector.missing_indices_cbegin(); it != featureVector.missing_indices_cend(); it++) {
+        uint32 i = *it;
+        float64 weight = weights.getWeight(i);
+        statisticsSubsetPtr->addToMissing(i, weight);
+    }
+
+    // If the condition is satisfied by (sparse) examples with feature value 0, which are not contained by the feature
+    // vector, the rule covers all examples that do not belong to the range of elements that do not satisfy the
+    // condition. Otherwise, it covers the examples that belong to the range of elements that satisfy the condition. As
+    // the elements are sorted by their feature values, the range is contiguous...
+    bool covered = !satisfiesCondition(condition.comparator, condition.threshold, 0);
+    intp start = 0;
+
+    while (start < numElements
+           && satisfiesCondition(condition.comparator, condition.threshold, iterator[start].value) != covered) {
+        start++;
+    }
+
+    intp end = start;
+    uint32 numExamples = 0;
+
+    while (end < numElements
+           && satisfiesCondition(condition.comparator, condition.threshold, iterator[end].value) == covered) {
+        uint32 i = iterator[end].index;
+        float64 weight = weights.getWeight(i);
+
+        if (weight > 0) {
+            statisticsSubsetPtr->addToSubset(i, weight);
+            numExamples++;
+        }
+
+        end++;
+    }
+
+    uint32 numCovered = covered ? numExamples : numExamples_ - numExamples;
+    refinementPtr->covered = covered;
+    refinementPtr->numCovered = numCovered;
+
+    // If the examples that are not covered belong to the end of the feature vector, the range must be specified in
+    // descending order, as expected by the function `IThresholdsSubset::filterThresholds`...
+    if (!covered && start > 0 && end == numElements && condition.comparator != NEQ) {
+        refinementPtr->start = end - 1;
+        refinementPtr->end = start - 1;
+    } else {
+        refinementPtr->start = start;
+        refinementPtr->end = end;
+    }
+
+    refinementPtr->previous = refinementPtr->end;
+
+    if (numCovered > 0 && numCovered >= minCoverage) {
+        headRefinementPtr_->findHead(nullptr, *statisticsSubsetPtr, !covered, false);
+        refinementPtr->headPtr = headRefinementPtr_->pollHead();
+    }
+
+    refinementPtr_ = std::move(refinementPtr);
+}
+
+template<class T>
+template<class Vector>
+float64 ExactRuleRefinement<T>::estimateQualityInternally(const Vector& featureVector,
+                                                          const IImmutableStatistics& statistics,
+                                                          const IWeightVector& weights, float32 sampleSize,
+                                                          uint32 minCoverage) {
+    float64 bestQualityScore = std::numeric_limits<float64>::infinity();
+    typename Vector::const_iterator iterator = featureVector.cbegin();
+    uint32 numElements = featureVector.getNumElements();
+
+    // Only every `stepSize`-th covered element is taken into account, starting at the first one when traversing the
+    // elements in ascending order and at the last one when traversing them in descending order. As the elements are
+    // sorted by their feature values, this results in samples that are spread evenly across the range of the feature.
+    // The elements that are not covered are skipped, instead of filtering the feature vector...
+    uint32 stepSize = sampleSize < 1 ? (uint32) (1 / sampleSize) : 1;
+    std::vector<IndexedValue<float32>> samples[2];
+    uint32 numCoveredElements = 0;
+
+    for (uint32 d = 0; d < (nominal_ ? 1 : 2); d++) {
+        bool descending = d > 0;
+        std::vector<IndexedValue<float32>>& sample = samples[d];
+        sample.reserve(numElements / stepSize + 1);
+        uint32 offset = descending ? (numCoveredElements + stepSize - 1) % stepSize : 0;
+        uint32 n = 0;
+
+        for (uint32 r = 0; r < numElements; r++) {
+            uint32 i = iterator[r].index;
+
+            if (weights.getWeight(i) > 0 && callbackPtr_->isCovered(i)) {
+                if (n % stepSize == offset) {
+                    sample.push_back(iterator[r]);
+                }
+
+                n++;
+            }
+        }
+
+        numCoveredElements = n;
+    }
+
+    // Create a new, empty subset of the statistics...
+    std::unique_ptr<IStatisticsSubset> statisticsSubsetPtr = labelIndices_.createSubset(statistics);
+    uint32 numMissing = 0;
+
+    for (auto it = featureVector.missing_indices_cbegin(); it != featureVector.missing_indices_cend(); it++) {
+        uint32 i = *it;
+        float64 weight = weights.getWeight(i);
+
+        if (weight > 0 && callbackPtr_->isCovered(i)) {
+            statisticsSubsetPtr->addToMissing(i, weight);
+        }
+
+        numMissing++;
+    }
+
+    // The examples that are not contained by the feature vector have sparse, i.e. zero, feature values. If there are
+    // such examples, conditions that use the <= operator with thresholds >= 0, or the > operator with thresholds < 0,
+    // may cover them. As their statistics are not known, such conditions are only evaluated if all elements are taken
+    // into account...
+    bool sparse = numElements + numMissing < callbackPtr_->getNumExamples();
+
+    // Traverse the sampled elements in ascending order to evaluate conditions that use the <= operator (or the ==
+    // operator in case of a nominal feature) and in descending order to evaluate conditions that use the > operator.
+    // Only the examples that are covered by a condition are taken into account to evaluate it...
+    for (uint32 d = 0; d < (nominal_ ? 1 : 2); d++) {
+        bool descending = d > 0;
+        uint32 numCovered = 0;
+        float32 previousThreshold = 0;
+        const std::vector<IndexedValue<float32>>& sample = samples[d];
+        uint32 numSampled = (uint32) sample.size();
+
+        for (uint32 k = 0; k < numSampled; k++) {
+            const IndexedValue<float32>& entry = sample[descending ? (numSampled - k - 1) : k];
+            float32 currentThreshold = entry.value;
+
+            // In case of a numerical feature, conditions must not separate the sparse elements from each other...
+            if (sparse && !nominal_ && (descending ? currentThreshold < 0 : currentThreshold >= 0)) {
+                break;
+            }
+
+            if (numCovered > 0 && previousThreshold != currentThreshold) {
+                if (numCovered >= minCoverage) {
+                    const IScoreVector& scoreVector =
+                        headRefinementPtr_->calculatePrediction(*statisticsSubsetPtr, false, false);
+                    float64 qualityScore = scoreVector.overallQualityScore;
+
+                    if (qualityScore < bestQualityScore) {
+                        bestQualityScore = qualityScore;
+                    }
+                }
+
+                // The complementary condition, which also covers the sparse elements, can only be evaluated if all
+                // elements are taken into account...
+                if (sparse && stepSize == 1 && !nominal_ && numExamples_ - numCovered >= minCoverage) {
+                    const IScoreVector& scoreVector =
+                        headRefinementPtr_->calculatePrediction(*statisticsSubsetPtr, true, false);
+                    float64 qualityScore = scoreVector.overallQualityScore;
+
+                    if (qualityScore < bestQualityScore) {
+                        bestQualityScore = qualityScore;
+                    }
+                }
+
+                if (nominal_) {
+                    statisticsSubsetPtr->resetSubset();
+                    numCovered = 0;
+                }
+            }
+
+            // Each sampled element represents `stepSize` covered elements. Its statistics are added accordingly,
+            // because otherwise the estimates would be biased towards conditions that cover fewer examples...
+            uint32 i = entry.index;
+            float64 weight = weights.getWeight(i);
+
+            for (uint32 j = 0; j < stepSize; j++) {
+                statisticsSubsetPtr->addToSubset(i, weight);
+            }
+
+            numCovered += stepSize;
+            previousThreshold = currentThreshold;
+        }
+
+        statisticsSubsetPtr->resetSubset();
+    }
+
+    return bestQualityScore;
+}
+
+template<class T>
+void ExactRuleRefinement<T>::findRefinement(const AbstractEvaluatedPrediction* currentHead, uint32 minCoverage,
+                                            const CancellationToken& cancellationToken) {
+    // Invoke the callback. If available, the compressed feature vector is searched without decompressing it...
+    std::unique_ptr<IExactRuleRefinementCallback::CompressedResult> compressedResultPtr =
+        callbackPtr_->getCompressed();
+
+    if (compressedResultPtr) {
+        findRefinementInternally(compressedResultPtr->vector_, compressedResultPtr->statistics_,
+                                 compressedResultPtr->weights_, currentHead, minCoverage, cancellationToken);
+    } else {
+        std::unique_ptr<IExactRuleRefinementCallback::Result> callbackResultPtr = callbackPtr_->get();
+        findRefinementInternally(callbackResultPtr->vector_, callbackResultPtr->statistics_,
+                                 callbackResultPtr->weights_, currentHead, minCoverage, cancellationToken);
+    }
+}
+
+template<class T>
+void ExactRuleRefinement<T>::evaluateCondition(const Condition& condition, uint32 minCoverage) {
+    // Invoke the callback. If available, the compressed feature vector is used without decompressing it...
+    std::unique_ptr<IExactRuleRefinementCallback::CompressedResult> compressedResultPtr =
+        callbackPtr_->getCompressed();
+
+    if (compressedResultPtr) {
+        evaluateConditionInternally(compressedResultPtr->vector_, compressedResultPtr->statistics_,
+                                    compressedResultPtr->weights_, condition, minCoverage);
+    } else {
+        std::unique_ptr<IExactRuleRefinementCallback::Result> callbackResultPtr = callbackPtr_->get();
+        evaluateConditionInternally(callbackResultPtr->vector_, callbackResultPtr->statistics_,
+                                    callbackResultPtr->weights_, condition, minCoverage);
+    }
+}
+
+template<class T>
+float64 ExactRuleRefinement<T>::estimateQuality(float32 sampleSize, uint32 minCoverage) {
+    // Invoke the callback. The feature vector is not filtered, as only a sample of its elements is needed. If
+    // available, the compressed feature vector is used without decompressing it...
+    std::unique_ptr<IExactRuleRefinementCallback::CompressedResult> compressedResultPtr =
+        callbackPtr_->getCompressedUnfiltered();
+
+    if (compressedResultPtr) {
+        return estimateQualityInternally(compressedResultPtr->vector_, compressedResultPtr->statistics_,
+                                         compressedResultPtr->weights_, sampleSize, minCoverage);
+    }
+
+    std::unique_ptr<IExactRuleRefinementCallback::Result> callbackResultPtr = callbackPtr_->getUnfiltered();
+    return estimateQualityInternally(callbackResultPtr->vector_, callbackResultPtr->statistics_,
+                                     callbackResultPtr->weights_, sampleSize, minCoverage);
+}
+
 template<class T>
 std::unique_ptr<Refinement> ExactRuleRefinement<T>::pollRefinement() {
     return std::move(refinementPtr_);
@@ -0,0 +1,15 @@
+#include "common/sampling/feature_sampling.hpp"
+#include "common/rule_refinement/refinement.hpp"
+
+
+void recordGain(IFeatureSubSampling& featureSubSampling, uint32 featureIndex, bool found, float64 qualityScore,
+                float64 baselineQuality) {
+    float64 gain = found ? baselineQuality - qualityScore : 0;
+    featureSubSampling.recordGain(featureIndex, gain > 0 ? gain : 0);
+}
+
+void recordGain(IFeatureSubSampling& featureSubSampling, const Refinement& refinement, float64 baselineQuality) {
+    const AbstractEvaluatedPrediction* head = refinement.headPtr.get();
+    recordGain(featureSubSampling, refinement.featureIndex, head != nullptr,
+               head != nullptr ? head->overallQualityScore : 0, baselineQuality);
+}
@@ -0,0 +1,132 @@
+#include "common/sampling/feature_sampling_adaptive.hpp"
+#include "common/rule_induction/checkpoint.hpp"
+#include "common/sampling/sampling_buffer.hpp"
+#include "common/indices/index_vector_partial.hpp"
+#include "common/data/vector_dense.hpp"
+#include <algorithm>
+#include <cmath>
+
+
+const uint32 MAX_UNIFORM = 0x7FFFFFFF;
+
+/**
+ * Generates and returns a random number in (0, 1).
+ *
+ * @param rng   A reference to an object of type `RNG`, implementing the random number generator to be used
+ * @return      The random number that has been generated
+ */
+static inline float64 uniform(RNG& rng) {
+    return (rng.random(0, MAX_UNIFORM) + 1.0) / (MAX_UNIFORM + 1.0);
+}
+
+/**
+ * Allows to select a subset of the available features without replacement, where the probability of a feature to be
+ * selected depends on the gains it has achieved in the past.
+ */
+class AdaptiveFeatureSubsetSelection final : public IFeatureSubSampling {
+
+    private:
+
+        uint32 numFeatures_;
+
+        float32 decay_;
+
+        float32 explorationRate_;
+
+        PartialIndexVector indexVector_;
+
+        SamplingBuffer buffer_;
+
+        DenseVector<float64> gains_;
+
+        DenseVector<float64> keys_;
+
+        float64 sumOfGains_;
+
+    public:
+
+        /**
+         * @param numFeatures       The total number of available features
+         * @param sampleSize        The fraction of features to be included in the sample (e.g. a value of 0.6
+         *                          corresponds to 60 % of the available features). Must be in (0, 1) or 0, if the
+         *                          default sample size `floor(log2(num_features - 1) + 1)` should be used
+         * @param decay             The factor, the gain that is recorded for a feature is multiplied by each time the
+         *                          feature is used, before it is replaced by a greater gain. Must be in [0, 1]
+         * @param explorationRate   The fraction of the probability mass to be distributed uniformly among all
+         *                          features. Must be in (0, 1]
+         */
+        AdaptiveFeatureSubsetSelection(uint32 numFeatures, float32 sampleSize, float32 decay, float32 explorationRate)
+            : numFeatures_(numFeatures), decay_(decay), explorationRate_(explorationRate),
+              indexVector_(PartialIndexVector((uint32) (sampleSize > 0 ? sampleSize * numFeatures
+                                                                       : log2(numFeatures - 1) + 1))),
+              buffer_(numFeatures), gains_(DenseVector<float64>(numFeatures, true)),
+              keys_(DenseVector<float64>(numFeatures)), sumOfGains_(0) {
+
+        }
+
+        const IIndexVector& subSample(RNG& rng) override {
+            uint32 numSamples = indexVector_.getNumElements();
+            DenseVector<float64>::const_iterator gainIterator = gains_.cbegin();
+            DenseVector<float64>::iterator keyIterator = keys_.begin();
+            float64 uniformProbability = 1.0 / numFeatures_;
+            float64 sumOfGains = sumOfGains_;
+
+            // Assign a random key to each feature, such that selecting the features with the largest keys corresponds
+            // to sampling without replacement according to the probabilities of the features (Efraimidis and
+            // Spirakis, 2006)...
+            for (uint32 i = 0; i < numFeatures_; i++) {
+                float64 probability = uniformProbability;
+
+                if (sumOfGains > 0) {
+                    probability = ((1 - explorationRate_) * (gainIterator[i] / sumOfGains))
+                                  + (explorationRate_ * uniformProbability);
+                }
+
+                keyIterator[i] = std::log(uniform(rng)) / probability;
+            }
+
+            // Select the features with the largest keys...
+            uint32* permutation = buffer_.getPermutation();
+            std::nth_element(permutation, permutation + numSamples, permutation + numFeatures_,
+                             [keyIterator](uint32 a, uint32 b) {
+                return keyIterator[a] > keyIterator[b];
+            });
+            std::copy(permutation, permutation + numSamples, indexVector_.begin());
+            return indexVector_;
+        }
+
+        void recordGain(uint32 featureIndex, float64 gain) override {
+            float64 previousGain = gains_[featureIndex];
+            float64 newGain = previousGain * decay_;
+
+            if (gain > newGain) {
+                newGain = gain;
+            }
+
+            gains_[featureIndex] = newGain;
+            sumOfGains_ += (newGain - previousGain);
+        }
+
+        void writeState(CheckpointWriter& writer) const override {
+            buffer_.writeState(writer);
+            writer.writeArray<float64>(gains_.cbegin(), numFeatures_);
+            writer.write<float64>(sumOfGains_);
+        }
+
+        void readState(CheckpointReader& reader) override {
+            buffer_.readState(reader);
+            reader.readArray<float64>(gains_.begin(), numFeatures_);
+            sumOfGains_ = reader.read<float64>();
+        }
+
+};
+
+AdaptiveFeatureSubsetSelectionFactory::AdaptiveFeatureSubsetSelectionFactory(float32 sampleSize, float32 decay,
+                                                                             float32 explorationRate)
+    : sampleSize_(sampleSize), decay_(decay), explorationRate_(explorationRate) {
+
+}
+
+std::unique_ptr<IFeatureSubSampling> AdaptiveFeatureSubsetSelectionFactory::create(uint32 numFeatures) const {
+    return std::make_unique<AdaptiveFeatureSubsetSelection>(numFeatures, sampleSize_, decay_, explorationRate_);
+}
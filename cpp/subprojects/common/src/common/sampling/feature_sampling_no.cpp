@@ -1,4 +1,5 @@
 #include "common/sampling/feature_sampling_no.hpp"
+#include "common/rule_induction/checkpoint.hpp"
 #include "common/indices/index_vector_full.hpp"
 
 
@@ -25,6 +26,18 @@ class NoFeatureSubSampling final : public IFeatureSubSampling {
             return indexVector_;
         }
 
+        void recordGain(uint32 featureIndex, float64 gain) override {
+
+        }
+
+        void writeState(CheckpointWriter& writer) const override {
+
+        }
+
+        void readState(CheckpointReader& reader) override {
+
+        }
+
 };
 
 std::unique_ptr<IFeatureSubSampling> NoFeatureSubSamplingFactory::create(uint32 numFeatures) const {
@@ -1,4 +1,5 @@
 #include "common/sampling/feature_sampling_random.hpp"
+#include "common/rule_induction/checkpoint.hpp"
 #include "common/indices/index_vector_partial.hpp"
 #include "common/indices/index_iterator.hpp"
 #include "index_sampling.hpp"
@@ -16,6 +17,8 @@ class RandomFeatureSubsetSelection final : public IFeatureSubSampling {
 
         PartialIndexVector indexVector_;
 
+        SamplingBuffer buffer_;
+
     public:
 
         /**
@@ -27,16 +30,29 @@ class RandomFeatureSubsetSelection final : public IFeatureSubSampling {
         RandomFeatureSubsetSelection(uint32 numFeatures, float32 sampleSize)
             : numFeatures_(numFeatures),
               indexVector_(PartialIndexVector((uint32) (sampleSize > 0 ? sampleSize * numFeatures
-                                                                       : log2(numFeatures - 1) + 1))) {
+                                                                       : log2(numFeatures - 1) + 1))),
+              buffer_(numFeatures) {
 
         }
 
         const IIndexVector& subSample(RNG& rng) override {
             sampleIndicesWithoutReplacement<IndexIterator>(indexVector_, IndexIterator(numFeatures_), numFeatures_,
-                                                           rng);
+                                                           buffer_, rng);
             return indexVector_;
         }
 
+        void recordGain(uint32 featureIndex, float64 gain) override {
+
+        }
+
+        void writeState(CheckpointWriter& writer) const override {
+            buffer_.writeState(writer);
+        }
+
+        void readState(CheckpointReader& reader) override {
+            buffer_.readState(reader);
+        }
+
 };
 
 RandomFeatureSubsetSelectionFactory::RandomFeatureSubsetSelectionFactory(float32 sampleSize)
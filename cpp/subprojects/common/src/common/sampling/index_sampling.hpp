@@ -4,69 +4,10 @@
 #pragma once
 
 #include "common/indices/index_vector_partial.hpp"
-#include <unordered_set>
+#include "common/sampling/sampling_buffer.hpp"
+#include "common/sampling/random.hpp"
 
 
-/**
- * Randomly selects `numSamples` out of `numTotal` indices without replacement by using a set to keep track of the
- * indices that have already been selected. This method is suitable if `numSamples` is much smaller than `numTotal`
- *
- * @tparam Iterator     The type of the iterator that provides random access to the available indices to sample from
- * @param indexVector   A reference to an object of type `PartialIndexVector`, the sampled indices should be written to
- * @param iterator      An iterator that provides random access to the available indices to sample from
- * @param numTotal      The total number of available indices to sample from
- * @param rng           A reference to an object of type `RNG`, implementing the random number generator to be used
- */
-template<class Iterator>
-static inline void sampleIndicesWithoutReplacementViaTrackingSelection(PartialIndexVector& indexVector,
-                                                                       Iterator iterator, uint32 numTotal, RNG& rng) {
-    uint32 numSamples = indexVector.getNumElements();
-    PartialIndexVector::iterator sampleIterator = indexVector.begin();
-    std::unordered_set<uint32> selectedIndices;
-
-    for (uint32 i = 0; i < numSamples; i++) {
-        bool shouldContinue = true;
-        uint32 sampledIndex;
-
-        while (shouldContinue) {
-            uint32 randomIndex = rng.random(0, numTotal);
-            sampledIndex = iterator[randomIndex];
-            shouldContinue = !selectedIndices.insert(sampledIndex).second;
-        }
-
-        sampleIterator[i] = sampledIndex;
-    }
-}
-
-/**
- * Randomly selects `numSamples` out of `numTotal` indices without replacement using a reservoir sampling algorithm.
- * This method is suitable if `numSamples` is almost as large as `numTotal`.
- *
- * @tparam Iterator     The type of the iterator that provides random access to the available indices to sample from
- * @param indexVector   A reference to an object of type `PartialIndexVector`, the sampled indices should be written to
- * @param iterator      An iterator that provides random access to the available indices to sample from
- * @param numTotal      The total number of available indices to sample from
- * @param rng           A reference to an object of type `RNG`, implementing the random number generator to be used
- */
-template<class Iterator>
-static inline void sampleIndicesWithoutReplacementViaReservoirSampling(PartialIndexVector& indexVector,
-                                                                       Iterator iterator, uint32 numTotal, RNG& rng) {
-    uint32 numSamples = indexVector.getNumElements();
-    PartialIndexVector::iterator sampleIterator = indexVector.begin();
-
-    for (uint32 i = 0; i < numSamples; i++) {
-        sampleIterator[i] = iterator[i];
-    }
-
-    for (uint32 i = numSamples; i < numTotal; i++) {
-        uint32 randomIndex = rng.random(0, i + 1);
-
-        if (randomIndex < numSamples) {
-            sampleIterator[randomIndex] = iterator[i];
-        }
-    }
-}
-
 /**
  * Computes a random permutation of the indices that are contained by two mutually exclusive sets using the Fisher-Yates
  * shuffle.
@@ -108,58 +49,100 @@ static inline void randomPermutation(FirstIterator firstIterator, SecondIterator
 }
 
 /**
- * Randomly selects `numSamples` out of `numTotal` indices without replacement by first generating a random permutation
- * of the available indices and then returning the first `numSamples` indices.
+ * Randomly selects `numSamples` out of `numTotal` indices without replacement using Robert Floyd's algorithm. A bitmap,
+ * which is provided by a `SamplingBuffer`, is used to keep track of the indices that have already been selected. The
+ * algorithm requires exactly `numSamples` random numbers and does not allocate any memory. It is suitable if
+ * `numSamples` is much smaller than `numTotal`.
  *
  * @tparam Iterator     The type of the iterator that provides random access to the available indices to sample from
  * @param indexVector   A reference to an object of type `PartialIndexVector`, the sampled indices should be written to
  * @param iterator      An iterator that provides random access to the available indices to sample from
  * @param numTotal      The total number of available indices to sample from
+ * @param buffer        A reference to an object of type `SamplingBuffer` that provides space for `numTotal` elements
  * @param rng           A reference to an object of type `RNG`, implementing the random number generator to be used
  */
 template<class Iterator>
-static inline void sampleIndicesWithoutReplacementViaRandomPermutation(PartialIndexVector& indexVector,
-                                                                       Iterator iterator, uint32 numTotal, RNG& rng) {
+static inline void sampleIndicesWithoutReplacementViaFloydSelection(PartialIndexVector& indexVector,
+                                                                    Iterator iterator, uint32 numTotal,
+                                                                    SamplingBuffer& buffer, RNG& rng) {
     uint32 numSamples = indexVector.getNumElements();
     PartialIndexVector::iterator sampleIterator = indexVector.begin();
-    uint32 unusedIndices[numTotal - numSamples];
+    uint32 offset = numTotal - numSamples;
 
     for (uint32 i = 0; i < numSamples; i++) {
-        sampleIterator[i] = iterator[i];
+        uint32 maxPosition = offset + i;
+        uint32 position = rng.random(0, maxPosition + 1);
+
+        if (!buffer.mark(position)) {
+            // The randomly selected position has already been selected before, so `maxPosition` is used instead...
+            position = maxPosition;
+            buffer.mark(position);
+        }
+
+        sampleIterator[i] = position;
     }
 
-    for (uint32 i = numSamples; i < numTotal; i++) {
-        unusedIndices[i - numSamples] = iterator[i];
+    // Reset the bitmap and replace the selected positions with the corresponding indices...
+    for (uint32 i = 0; i < numSamples; i++) {
+        uint32 position = sampleIterator[i];
+        buffer.unmark(position);
+        sampleIterator[i] = iterator[position];
     }
+}
 
-    randomPermutation<PartialIndexVector::iterator, uint32*>(sampleIterator, &unusedIndices[0], numSamples, numTotal,
-                                                             numSamples, rng);
+/**
+ * Randomly selects `numSamples` out of `numTotal` indices without replacement by performing a partial Fisher-Yates
+ * shuffle on the persistent permutation that is provided by a `SamplingBuffer` and returning the first `numSamples`
+ * indices. As the permutation is not reset between subsequent invocations, only `numSamples` swaps are necessary.
+ *
+ * @tparam Iterator     The type of the iterator that provides random access to the available indices to sample from
+ * @param indexVector   A reference to an object of type `PartialIndexVector`, the sampled indices should be written to
+ * @param iterator      An iterator that provides random access to the available indices to sample from
+ * @param numTotal      The total number of available indices to sample from
+ * @param buffer        A reference to an object of type `SamplingBuffer` that provides space for `numTotal` elements
+ * @param rng           A reference to an object of type `RNG`, implementing the random number generator to be used
+ */
+template<class Iterator>
+static inline void sampleIndicesWithoutReplacementViaRandomPermutation(PartialIndexVector& indexVector,
+                                                                       Iterator iterator, uint32 numTotal,
+                                                                       SamplingBuffer& buffer, RNG& rng) {
+    uint32 numSamples = indexVector.getNumElements();
+    PartialIndexVector::iterator sampleIterator = indexVector.begin();
+    uint32* permutation = buffer.getPermutation();
+
+    for (uint32 i = 0; i < numSamples; i++) {
+        // Swap elements at index i and at a randomly selected index...
+        uint32 randomIndex = rng.random(i, numTotal);
+        uint32 position = permutation[randomIndex];
+        permutation[randomIndex] = permutation[i];
+        permutation[i] = position;
+        sampleIterator[i] = iterator[position];
+    }
 }
 
 /**
  * Randomly selects `numSamples` out of `numTotal` indices without replacement. The method that is used internally is
- * chosen automatically, depending on the ratio `numSamples / numTotal`.
+ * chosen automatically, depending on the ratio `numSamples / numTotal`. Regardless of the method, the number of
+ * operations is linear in `numSamples` and no memory is allocated, except for the memory that is allocated by the given
+ * `SamplingBuffer` when it is used for the first time.
  *
  * @tparam Iterator     The type of the iterator that provides random access to the available indices to sample from
  * @param indexVector   A reference to an object of type `PartialIndexVector`, the sampled indices should be written to
  * @param iterator      An iterator that provides random access to the available indices to sample from
  * @param numTotal      The total number of available indices to sample from
+ * @param buffer        A reference to an object of type `SamplingBuffer` that provides space for `numTotal` elements
  * @param rng           A reference to an object of type `RNG`, implementing the random number generator to be used
  */
 template<class Iterator>
 static inline void sampleIndicesWithoutReplacement(PartialIndexVector& indexVector, Iterator iterator, uint32 numTotal,
-                                                   RNG& rng) {
+                                                   SamplingBuffer& buffer, RNG& rng) {
     float64 ratio = numTotal > 0 ? ((float64) indexVector.getNumElements()) / ((float64) numTotal) : 1;
 
-    // The thresholds for choosing a suitable method are based on empirical experiments
     if (ratio < 0.06) {
-        // For very small ratios use tracking selection
-        sampleIndicesWithoutReplacementViaTrackingSelection(indexVector, iterator, numTotal, rng);
-    } else if (ratio > 0.5) {
-        // For large ratios use reservoir sampling
-        sampleIndicesWithoutReplacementViaReservoirSampling(indexVector, iterator, numTotal, rng);
+        // For very small ratios use Floyd's algorithm, which only requires a bitmap of size `numTotal / 8` bytes
+        sampleIndicesWithoutReplacementViaFloydSelection(indexVector, iterator, numTotal, buffer, rng);
     } else {
-        // Otherwise, use random permutation as the default method
-        sampleIndicesWithoutReplacementViaRandomPermutation(indexVector, iterator, numTotal, rng);
+        // Otherwise, use a partial random permutation as the default method
+        sampleIndicesWithoutReplacementViaRandomPermutation(indexVector, iterator, numTotal, buffer, rng);
     }
 }
@@ -1,7 +1,9 @@
 #include "common/sampling/instance_sampling_bagging.hpp"
+#include "common/rule_induction/checkpoint.hpp"
 #include "common/sampling/weight_vector_dense.hpp"
 #include "common/sampling/partition_bi.hpp"
 #include "common/sampling/partition_single.hpp"
+#include "common/input/label_matrix_c_contiguous.hpp"
 #include "common/data/arrays.hpp"
 
 
@@ -31,7 +33,7 @@ static inline void subSampleInternally(const SinglePartition& partition, float32
 
 static inline void subSampleInternally(BiPartition& partition, float32 sampleSize,
                                        DenseWeightVector<uint32>& weightVector, RNG& rng) {
-    uint32 numExamples = partition.getNumElements();
+    uint32 numExamples = weightVector.getNumElements();
     uint32 numTrainingExamples = partition.getNumFirst();
     uint32 numSamples = (uint32) (sampleSize * numTrainingExamples);
     BiPartition::const_iterator indexIterator = partition.first_cbegin();
@@ -79,12 +81,13 @@ class Bagging final : public IInstanceSubSampling {
         /**
          * @param partition  A reference to an object of template type `Partition` that provides access to the indices
          *                   of the examples that are included in the training set
-         * @param sampleSize The fraction of examples to be included in the sample (e.g. a value of 0.6 corresponds to
-         *                   60 % of the available examples). Must be in (0, 1]
+         * @param sampleSize  The fraction of examples to be included in the sample (e.g. a value of 0.6 corresponds to
+         *                    60 % of the available examples). Must be in (0, 1]
+         * @param numExamples The total number of examples
          */
-        Bagging(Partition& partition, float32 sampleSize)
+        Bagging(Partition& partition, float32 sampleSize, uint32 numExamples)
             : partition_(partition), sampleSize_(sampleSize),
-              weightVector_(DenseWeightVector<uint32>(partition.getNumElements())) {
+              weightVector_(DenseWeightVector<uint32>(numExamples)) {
 
         }
 
@@ -93,6 +96,14 @@ class Bagging final : public IInstanceSubSampling {
             return weightVector_;
         }
 
+        void writeState(CheckpointWriter& writer) const override {
+
+        }
+
+        void readState(CheckpointReader& reader) override {
+
+        }
+
 };
 
 BaggingFactory::BaggingFactory(float32 sampleSize)
@@ -100,10 +111,12 @@ BaggingFactory::BaggingFactory(float32 sampleSize)
 
 }
 
-std::unique_ptr<IInstanceSubSampling> BaggingFactory::create(const SinglePartition& partition) const {
-    return std::make_unique<Bagging<const SinglePartition>>(partition, sampleSize_);
+std::unique_ptr<IInstanceSubSampling> BaggingFactory::create(const CContiguousLabelMatrix& labelMatrix,
+                                                             const SinglePartition& partition) const {
+    return std::make_unique<Bagging<const SinglePartition>>(partition, sampleSize_, labelMatrix.getNumRows());
 }
 
-std::unique_ptr<IInstanceSubSampling> BaggingFactory::create(BiPartition& partition) const {
-    return std::make_unique<Bagging<BiPartition>>(partition, sampleSize_);
+std::unique_ptr<IInstanceSubSampling> BaggingFactory::create(const CContiguousLabelMatrix& labelMatrix,
+                                                             BiPartition& partition) const {
+    return std::make_unique<Bagging<BiPartition>>(partition, sampleSize_, labelMatrix.getNumRows());
 }
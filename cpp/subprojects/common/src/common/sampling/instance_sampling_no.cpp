@@ -1,8 +1,10 @@
 #include "common/sampling/instance_sampling_no.hpp"
+#include "common/rule_induction/checkpoint.hpp"
 #include "common/sampling/weight_vector_equal.hpp"
 #include "common/sampling/weight_vector_dense.hpp"
 #include "common/sampling/partition_bi.hpp"
 #include "common/sampling/partition_single.hpp"
+#include "common/input/label_matrix_c_contiguous.hpp"
 #include "common/data/arrays.hpp"
 
 
@@ -11,7 +13,7 @@ static inline void subSampleInternally(const SinglePartition& partition, EqualWe
 }
 
 static inline void subSampleInternally(BiPartition& partition, DenseWeightVector<uint8>& weightVector, RNG& rng) {
-    uint32 numExamples = partition.getNumElements();
+    uint32 numExamples = weightVector.getNumElements();
     uint32 numTrainingExamples = partition.getNumFirst();
     BiPartition::const_iterator indexIterator = partition.first_cbegin();
     typename DenseWeightVector<uint8>::iterator weightIterator = weightVector.begin();
@@ -45,11 +47,12 @@ class NoInstanceSubSampling final : public IInstanceSubSampling {
     public:
 
         /**
-         * @param partition A reference to an object of template type `Partition` that provides access to the indices of
-         *                  the examples that are included in the training set
+         * @param partition     A reference to an object of template type `Partition` that provides access to the
+         *                      indices of the examples that are included in the training set
+         * @param numExamples   The total number of examples
          */
-        NoInstanceSubSampling(Partition& partition)
-            : partition_(partition), weightVector_(WeightVector(partition.getNumElements())) {
+        NoInstanceSubSampling(Partition& partition, uint32 numExamples)
+            : partition_(partition), weightVector_(WeightVector(numExamples)) {
 
         }
 
@@ -58,12 +61,24 @@ class NoInstanceSubSampling final : public IInstanceSubSampling {
             return weightVector_;
         }
 
+        void writeState(CheckpointWriter& writer) const override {
+
+        }
+
+        void readState(CheckpointReader& reader) override {
+
+        }
+
 };
 
-std::unique_ptr<IInstanceSubSampling> NoInstanceSubSamplingFactory::create(const SinglePartition& partition) const {
-    return std::make_unique<NoInstanceSubSampling<const SinglePartition, EqualWeightVector>>(partition);
+std::unique_ptr<IInstanceSubSampling> NoInstanceSubSamplingFactory::create(const CContiguousLabelMatrix& labelMatrix,
+                                                                           const SinglePartition& partition) const {
+    return std::make_unique<NoInstanceSubSampling<const SinglePartition, EqualWeightVector>>(
+        partition, labelMatrix.getNumRows());
 }
 
-std::unique_ptr<IInstanceSubSampling> NoInstanceSubSamplingFactory::create(BiPartition& partition) const {
-    return std::make_unique<NoInstanceSubSampling<BiPartition, DenseWeightVector<uint8>>>(partition);
+std::unique_ptr<IInstanceSubSampling> NoInstanceSubSamplingFactory::create(const CContiguousLabelMatrix& labelMatrix,
+                                                                           BiPartition& partition) const {
+    return std::make_unique<NoInstanceSubSampling<BiPartition, DenseWeightVector<uint8>>>(partition,
+                                                                                  labelMatrix.getNumRows());
 }
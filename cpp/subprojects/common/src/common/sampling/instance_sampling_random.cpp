@@ -1,8 +1,10 @@
 #include "common/sampling/instance_sampling_random.hpp"
+#include "common/rule_induction/checkpoint.hpp"
 #include "common/indices/index_iterator.hpp"
 #include "weight_sampling.hpp"
 #include "common/sampling/partition_bi.hpp"
 #include "common/sampling/partition_single.hpp"
+#include "common/input/label_matrix_c_contiguous.hpp"
 
 
 static inline void subSampleInternally(const SinglePartition& partition, float32 sampleSize,
@@ -43,12 +45,13 @@ class RandomInstanceSubsetSelection final : public IInstanceSubSampling {
         /**
          * @param partition  A reference to an object of template type `Partition` that provides access to the indices
          *                   of the examples that are included in the training set
-         * @param sampleSize The fraction of examples to be included in the sample (e.g. a value of 0.6 corresponds to
-         *                   60 % of the available examples). Must be in (0, 1)
+         * @param sampleSize  The fraction of examples to be included in the sample (e.g. a value of 0.6 corresponds to
+         *                    60 % of the available examples). Must be in (0, 1)
+         * @param numExamples The total number of examples
          */
-        RandomInstanceSubsetSelection(Partition& partition, float32 sampleSize)
+        RandomInstanceSubsetSelection(Partition& partition, float32 sampleSize, uint32 numExamples)
             : partition_(partition), sampleSize_(sampleSize),
-              weightVector_(DenseWeightVector<uint8>(partition.getNumElements())) {
+              weightVector_(DenseWeightVector<uint8>(numExamples)) {
 
         }
 
@@ -57,6 +60,14 @@ class RandomInstanceSubsetSelection final : public IInstanceSubSampling {
             return weightVector_;
         }
 
+        void writeState(CheckpointWriter& writer) const override {
+
+        }
+
+        void readState(CheckpointReader& reader) override {
+
+        }
+
 };
 
 RandomInstanceSubsetSelectionFactory::RandomInstanceSubsetSelectionFactory(float32 sampleSize)
@@ -64,10 +75,14 @@ RandomInstanceSubsetSelectionFactory::RandomInstanceSubsetSelectionFactory(float
 
 }
 
-std::unique_ptr<IInstanceSubSampling> RandomInstanceSubsetSelectionFactory::create(const SinglePartition& partition) const {
-    return std::make_unique<RandomInstanceSubsetSelection<const SinglePartition>>(partition, sampleSize_);
+std::unique_ptr<IInstanceSubSampling> RandomInstanceSubsetSelectionFactory::create(const CContiguousLabelMatrix& labelMatrix,
+                                                                                   const SinglePartition& partition) const {
+    return std::make_unique<RandomInstanceSubsetSelection<const SinglePartition>>(partition, sampleSize_,
+                                                                                  labelMatrix.getNumRows());
 }
 
-std::unique_ptr<IInstanceSubSampling> RandomInstanceSubsetSelectionFactory::create(BiPartition& partition) const {
-    return std::make_unique<RandomInstanceSubsetSelection<BiPartition>>(partition, sampleSize_);
+std::unique_ptr<IInstanceSubSampling> RandomInstanceSubsetSelectionFactory::create(const CContiguousLabelMatrix& labelMatrix,
+                                                                                   BiPartition& partition) const {
+    return std::make_unique<RandomInstanceSubsetSelection<BiPartition>>(partition, sampleSize_,
+                                                                        labelMatrix.getNumRows());
 }
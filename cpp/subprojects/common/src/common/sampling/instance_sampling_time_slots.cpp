@@ -0,0 +1,128 @@
+#include "common/sampling/instance_sampling_time_slots.hpp"
+#include "common/rule_induction/checkpoint.hpp"
+#include "common/sampling/weight_vector_dense.hpp"
+#include "common/sampling/partition_bi.hpp"
+#include "common/sampling/partition_single.hpp"
+#include "common/sampling/sampling_buffer.hpp"
+#include "common/input/label_matrix_c_contiguous.hpp"
+#include "common/indices/index_iterator.hpp"
+#include "common/data/arrays.hpp"
+#include "index_sampling.hpp"
+#include <algorithm>
+
+
+static inline bool isTrainingExample(const SinglePartition& partition, uint32 exampleIndex) {
+    return true;
+}
+
+static inline bool isTrainingExample(BiPartition& partition, uint32 exampleIndex) {
+    // If the label matrix only includes a subset of the examples, the remaining ones are neither contained by the
+    // training set, nor by the holdout set...
+    return partition.getFirstSet()[exampleIndex];
+}
+
+/**
+ * Allows to select a subset of the available time slots without replacement, where consecutive time slots are grouped
+ * into blocks of a fixed size.
+ *
+ * @tparam Partition The type of the object that provides access to the indices of the examples that are included in the
+ *                   training set
+ */
+template<class Partition>
+class TimeSlotSubsetSelection final : public IInstanceSubSampling {
+
+    private:
+
+        const CContiguousLabelMatrix& labelMatrix_;
+
+        Partition& partition_;
+
+        uint32 blockSize_;
+
+        uint32 numBlocks_;
+
+        PartialIndexVector blockIndices_;
+
+        SamplingBuffer buffer_;
+
+        DenseWeightVector<uint8> weightVector_;
+
+    public:
+
+        /**
+         * @param labelMatrix   A reference to an object of type `CContiguousLabelMatrix` that provides access to the
+         *                      time slots of the training examples
+         * @param partition     A reference to an object of template type `Partition` that provides access to the
+         *                      indices of the examples that are included in the training set
+         * @param sampleSize    The fraction of blocks to be included in the sample (e.g. a value of 0.6 corresponds to
+         *                      60 % of the available blocks). Must be in (0, 1)
+         * @param blockSize     The number of consecutive time slots that belong to a single block. Must be at least 1
+         */
+        TimeSlotSubsetSelection(const CContiguousLabelMatrix& labelMatrix, Partition& partition, float32 sampleSize,
+                                uint32 blockSize)
+            : labelMatrix_(labelMatrix), partition_(partition), blockSize_(blockSize),
+              numBlocks_((labelMatrix.getNumTimeSlots() + blockSize - 1) / blockSize),
+              blockIndices_(PartialIndexVector(std::max<uint32>((uint32) (sampleSize * numBlocks_), 1))),
+              buffer_(numBlocks_),
+              weightVector_(DenseWeightVector<uint8>(labelMatrix.getNumRows())) {
+
+        }
+
+        const IWeightVector& subSample(RNG& rng) override {
+            uint32 numTimeSlots = labelMatrix_.getNumTimeSlots();
+            uint32 numExamples = weightVector_.getNumElements();
+            CContiguousLabelMatrix::index_const_iterator indexIterator = labelMatrix_.indices_cbegin();
+            typename DenseWeightVector<uint8>::iterator weightIterator = weightVector_.begin();
+            setArrayToZeros(weightIterator, numExamples);
+            uint32 numNonZeroWeights = 0;
+
+            // Select blocks of time slots...
+            sampleIndicesWithoutReplacement<IndexIterator>(blockIndices_, IndexIterator(numBlocks_), numBlocks_,
+                                                           buffer_, rng);
+            PartialIndexVector::const_iterator blockIterator = blockIndices_.cbegin();
+            uint32 numSampledBlocks = blockIndices_.getNumElements();
+
+            // Include all training examples that belong to the selected time slots...
+            for (uint32 i = 0; i < numSampledBlocks; i++) {
+                uint32 firstTimeSlot = blockIterator[i] * blockSize_;
+                uint32 lastTimeSlot = std::min(firstTimeSlot + blockSize_, numTimeSlots);
+                uint32 start = indexIterator[firstTimeSlot];
+                uint32 end = indexIterator[lastTimeSlot];
+
+                for (uint32 j = start; j < end; j++) {
+                    if (isTrainingExample(partition_, j)) {
+                        weightIterator[j] = 1;
+                        numNonZeroWeights++;
+                    }
+                }
+            }
+
+            weightVector_.setNumNonZeroWeights(numNonZeroWeights);
+            return weightVector_;
+        }
+
+        void writeState(CheckpointWriter& writer) const override {
+            buffer_.writeState(writer);
+        }
+
+        void readState(CheckpointReader& reader) override {
+            buffer_.readState(reader);
+        }
+
+};
+
+TimeSlotSubsetSelectionFactory::TimeSlotSubsetSelectionFactory(float32 sampleSize, uint32 blockSize)
+    : sampleSize_(sampleSize), blockSize_(blockSize) {
+
+}
+
+std::unique_ptr<IInstanceSubSampling> TimeSlotSubsetSelectionFactory::create(const CContiguousLabelMatrix& labelMatrix,
+                                                                             const SinglePartition& partition) const {
+    return std::make_unique<TimeSlotSubsetSelection<const SinglePartition>>(labelMatrix, partition, sampleSize_,
+                                                                            blockSize_);
+}
+
+std::unique_ptr<IInstanceSubSampling> TimeSlotSubsetSelectionFactory::create(const CContiguousLabelMatrix& labelMatrix,
+                                                                             BiPartition& partition) const {
+    return std::make_unique<TimeSlotSubsetSelection<BiPartition>>(labelMatrix, partition, sampleSize_, blockSize_);
+}
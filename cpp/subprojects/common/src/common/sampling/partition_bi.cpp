@@ -1,8 +1,10 @@
 #include "common/sampling/partition_bi.hpp"
 #include "common/sampling/instance_sampling.hpp"
+#include "common/input/label_matrix.hpp"
 #include "common/thresholds/thresholds_subset.hpp"
 #include "common/rule_refinement/refinement.hpp"
 #include "common/head_refinement/prediction.hpp"
+#include "common/statistics/statistics.hpp"
 
 
 static inline BinaryDokVector* createDokVector(BiPartition::const_iterator iterator, uint32 numElements) {
@@ -87,8 +89,8 @@ const BinaryDokVector& BiPartition::getSecondSet() {
 }
 
 std::unique_ptr<IInstanceSubSampling> BiPartition::createInstanceSubSampling(
-        const IInstanceSubSamplingFactory& factory) {
-    return factory.create(*this);
+        const IInstanceSubSamplingFactory& factory, const ILabelMatrix& labelMatrix) {
+    return labelMatrix.createInstanceSubSampling(factory, *this);
 }
 
 float64 BiPartition::evaluateOutOfSample(const IThresholdsSubset& thresholdsSubset, const ICoverageState& coverageState,
@@ -100,3 +102,18 @@ void BiPartition::recalculatePrediction(const IThresholdsSubset& thresholdsSubse
                                         Refinement& refinement) {
     coverageState.recalculatePrediction(thresholdsSubset, *this, refinement);
 }
+
+void BiPartition::markHoldoutStatistics(IStatistics& statistics) const {
+    uint32 numHoldout = this->getNumSecond();
+    const_iterator holdoutIterator = this->second_cbegin();
+
+    for (uint32 i = 0; i < numHoldout; i++) {
+        statistics.addHoldoutStatistic(holdoutIterator[i]);
+    }
+}
+
+std::unique_ptr<std::vector<uint32>> BiPartition::getHoldoutIndices() const {
+    uint32 numHoldout = this->getNumSecond();
+    const_iterator holdoutIterator = this->second_cbegin();
+    return std::make_unique<std::vector<uint32>>(holdoutIterator, holdoutIterator + numHoldout);
+}
@@ -1,26 +1,34 @@
 #include "common/sampling/partition_sampling_bi_random.hpp"
 #include "common/sampling/partition_bi.hpp"
+#include "common/indices/index_iterator.hpp"
 #include "index_sampling.hpp"
 
 
 /**
  * Allows to randomly split the training examples into two mutually exclusive sets that may be used as a training set
  * and a holdout set.
+ *
+ * @tparam IndexIterator The type of the iterator that provides access to the indices of the examples to be split
  */
+template<class IndexIterator>
 class RandomBiPartitionSampling final : public IPartitionSampling {
 
     private:
 
+        IndexIterator indexIterator_;
+
         BiPartition partition_;
 
     public:
 
         /**
+         * @param indexIterator An iterator of template type `IndexIterator` that provides access to the indices of the
+         *                      examples to be split
          * @param numTraining   The number of examples to be included in the training set
          * @param numHoldout    The number of examples to be included in the holdout set
          */
-        RandomBiPartitionSampling(uint32 numTraining, uint32 numHoldout)
-            : partition_(BiPartition(numTraining, numHoldout)) {
+        RandomBiPartitionSampling(IndexIterator indexIterator, uint32 numTraining, uint32 numHoldout)
+            : indexIterator_(indexIterator), partition_(BiPartition(numTraining, numHoldout)) {
 
         }
 
@@ -31,11 +39,11 @@ class RandomBiPartitionSampling final : public IPartitionSampling {
             BiPartition::iterator holdoutIterator = partition_.second_begin();
 
             for (uint32 i = 0; i < numTraining; i++) {
-                trainingIterator[i] = i;
+                trainingIterator[i] = indexIterator_[i];
             }
 
             for (uint32 i = 0; i < numHoldout; i++) {
-                holdoutIterator[i] = numTraining + i;
+                holdoutIterator[i] = indexIterator_[numTraining + i];
             }
 
             uint32 numTotal = partition_.getNumElements();
@@ -53,8 +61,14 @@ RandomBiPartitionSamplingFactory::RandomBiPartitionSamplingFactory(float32 holdo
 
 std::unique_ptr<IPartitionSampling> RandomBiPartitionSamplingFactory::create(
         const CContiguousLabelMatrix& labelMatrix) const {
-    uint32 numExamples = labelMatrix.getNumRows();
+    uint32 numExamples = labelMatrix.getNumSubsetRows();
     uint32 numHoldout = (uint32) (holdoutSetSize_ * numExamples);
     uint32 numTraining = numExamples - numHoldout;
-    return std::make_unique<RandomBiPartitionSampling>(numTraining, numHoldout);
+
+    if (labelMatrix.isSubset()) {
+        return std::make_unique<RandomBiPartitionSampling<CContiguousLabelMatrix::index_const_iterator>>(
+            labelMatrix.subset_indices_cbegin(), numTraining, numHoldout);
+    }
+
+    return std::make_unique<RandomBiPartitionSampling<IndexIterator>>(IndexIterator(), numTraining, numHoldout);
 }
@@ -0,0 +1,166 @@
+#include "common/sampling/partition_sampling_bi_time_slots.hpp"
+#include "common/sampling/partition_bi.hpp"
+#include "common/indices/index_iterator.hpp"
+#include <algorithm>
+
+
+/**
+ * Returns whether a specific block of time slots belongs to the holdout set or not.
+ *
+ * @param blockIndex        The index of the block
+ * @param numBlocks         The total number of blocks
+ * @param numHoldoutBlocks  The number of blocks to be included in the holdout set
+ * @param interleaved       True, if the blocks in the holdout set should be evenly spread across all blocks, false, if
+ *                          the last blocks should be used as the holdout set
+ * @return                  True, if the block belongs to the holdout set, false otherwise
+ */
+static inline bool isHoldoutBlock(uint32 blockIndex, uint32 numBlocks, uint32 numHoldoutBlocks, bool interleaved) {
+    if (interleaved) {
+        // The holdout set includes a block whenever the number of blocks that should have been held out so far is
+        // increased by the block (e.g. every fourth block, if 25 % of the blocks should be held out)...
+        intp previous = ((intp) blockIndex * numHoldoutBlocks) / numBlocks;
+        intp current = ((intp) (blockIndex + 1) * numHoldoutBlocks) / numBlocks;
+        return current > previous;
+    } else {
+        return blockIndex >= numBlocks - numHoldoutBlocks;
+    }
+}
+
+/**
+ * Splits the examples into a training set and a holdout set, based on the time slots they belong to.
+ *
+ * @tparam ExampleIterator  The type of the iterator that provides access to the indices of the examples to be split
+ * @param labelMatrix       A reference to an object of type `CContiguousLabelMatrix` that provides access to the time
+ *                          slots of the training examples
+ * @param exampleIterator   An iterator of template type `ExampleIterator` that provides access to the indices of the
+ *                          examples to be split in increasing order
+ * @param numExamples       The number of examples to be split
+ * @param blockSize         The number of consecutive time slots that belong to a single block
+ * @param numHoldoutBlocks  The number of blocks to be included in the holdout set
+ * @param interleaved       True, if the blocks in the holdout set should be evenly spread across all blocks, false, if
+ *                          the last blocks should be used as the holdout set
+ * @param trainingIterator  An iterator, the indices of the examples in the training set should be written to. May be
+ *                          a null pointer, if the indices should only be counted
+ * @param holdoutIterator   An iterator, the indices of the examples in the holdout set should be written to. May be a
+ *                          null pointer, if the indices should only be counted
+ * @return                  The number of examples that belong to the holdout set
+ */
+template<class ExampleIterator>
+static inline uint32 splitExamples(const CContiguousLabelMatrix& labelMatrix, ExampleIterator exampleIterator,
+                                   uint32 numExamples, uint32 blockSize, uint32 numHoldoutBlocks, bool interleaved,
+                                   BiPartition::iterator trainingIterator, BiPartition::iterator holdoutIterator) {
+    uint32 numTimeSlots = labelMatrix.getNumTimeSlots();
+    uint32 numBlocks = (numTimeSlots + blockSize - 1) / blockSize;
+    CContiguousLabelMatrix::index_const_iterator indexIterator = labelMatrix.indices_cbegin();
+    uint32 n = 0;
+    uint32 m = 0;
+    uint32 k = 0;
+
+    for (uint32 i = 0; i < numTimeSlots; i++) {
+        bool holdout = isHoldoutBlock(i / blockSize, numBlocks, numHoldoutBlocks, interleaved);
+        uint32 end = indexIterator[i + 1];
+
+        // The examples that belong to a time slot are consecutive. If the label matrix only includes a subset of the
+        // examples, the remaining ones are skipped...
+        for (; k < numExamples && exampleIterator[k] < end; k++) {
+            uint32 exampleIndex = exampleIterator[k];
+
+            if (holdout) {
+                if (holdoutIterator != nullptr) {
+                    holdoutIterator[m] = exampleIndex;
+                }
+
+                m++;
+            } else {
+                if (trainingIterator != nullptr) {
+                    trainingIterator[n] = exampleIndex;
+                }
+
+                n++;
+            }
+        }
+    }
+
+    return m;
+}
+
+/**
+ * Splits the examples that are included by a label matrix into a training set and a holdout set, based on the time
+ * slots they belong to.
+ *
+ * @param labelMatrix       A reference to an object of type `CContiguousLabelMatrix` that provides access to the time
+ *                          slots of the training examples
+ * @param blockSize         The number of consecutive time slots that belong to a single block
+ * @param numHoldoutBlocks  The number of blocks to be included in the holdout set
+ * @param interleaved       True, if the blocks in the holdout set should be evenly spread across all blocks, false, if
+ *                          the last blocks should be used as the holdout set
+ * @param trainingIterator  An iterator, the indices of the examples in the training set should be written to. May be
+ *                          a null pointer, if the indices should only be counted
+ * @param holdoutIterator   An iterator, the indices of the examples in the holdout set should be written to. May be a
+ *                          null pointer, if the indices should only be counted
+ * @return                  The number of examples that belong to the holdout set
+ */
+static inline uint32 splitExamples(const CContiguousLabelMatrix& labelMatrix, uint32 blockSize,
+                                   uint32 numHoldoutBlocks, bool interleaved, BiPartition::iterator trainingIterator,
+                                   BiPartition::iterator holdoutIterator) {
+    uint32 numExamples = labelMatrix.getNumSubsetRows();
+
+    if (labelMatrix.isSubset()) {
+        return splitExamples(labelMatrix, labelMatrix.subset_indices_cbegin(), numExamples, blockSize,
+                             numHoldoutBlocks, interleaved, trainingIterator, holdoutIterator);
+    }
+
+    return splitExamples(labelMatrix, IndexIterator(), numExamples, blockSize, numHoldoutBlocks, interleaved,
+                         trainingIterator, holdoutIterator);
+}
+
+/**
+ * Allows to split the training examples into a training set and a holdout set, based on the time slots they belong to.
+ * As the resulting partition does not depend on random numbers, it is only computed once.
+ */
+class TimeSlotBiPartitionSampling final : public IPartitionSampling {
+
+    private:
+
+        BiPartition partition_;
+
+    public:
+
+        /**
+         * @param labelMatrix       A reference to an object of type `CContiguousLabelMatrix` that provides access to
+         *                          the time slots of the training examples
+         * @param numHoldout        The number of examples to be included in the holdout set
+         * @param blockSize         The number of consecutive time slots that belong to a single block
+         * @param numHoldoutBlocks  The number of blocks to be included in the holdout set
+         * @param interleaved       True, if the blocks in the holdout set should be evenly spread across all blocks,
+         *                          false, if the last blocks should be used as the holdout set
+         */
+        TimeSlotBiPartitionSampling(const CContiguousLabelMatrix& labelMatrix, uint32 numHoldout, uint32 blockSize,
+                                    uint32 numHoldoutBlocks, bool interleaved)
+            : partition_(labelMatrix.getNumSubsetRows() - numHoldout, numHoldout) {
+            splitExamples(labelMatrix, blockSize, numHoldoutBlocks, interleaved, partition_.first_begin(),
+                          partition_.second_begin());
+        }
+
+        IPartition& partition(RNG& rng) override {
+            return partition_;
+        }
+
+};
+
+TimeSlotBiPartitionSamplingFactory::TimeSlotBiPartitionSamplingFactory(float32 holdoutSetSize, uint32 blockSize,
+                                                                       bool interleaved)
+    : holdoutSetSize_(holdoutSetSize), blockSize_(blockSize), interleaved_(interleaved) {
+
+}
+
+std::unique_ptr<IPartitionSampling> TimeSlotBiPartitionSamplingFactory::create(
+        const CContiguousLabelMatrix& labelMatrix) const {
+    uint32 numTimeSlots = labelMatrix.getNumTimeSlots();
+    uint32 numBlocks = (numTimeSlots + blockSize_ - 1) / blockSize_;
+    uint32 numHoldoutBlocks = std::min<uint32>(std::max<uint32>((uint32) (holdoutSetSize_ * numBlocks), 1),
+                                               numBlocks - 1);
+    uint32 numHoldout = splitExamples(labelMatrix, blockSize_, numHoldoutBlocks, interleaved_, nullptr, nullptr);
+    return std::make_unique<TimeSlotBiPartitionSampling>(labelMatrix, numHoldout, blockSize_, numHoldoutBlocks,
+                                                         interleaved_);
+}
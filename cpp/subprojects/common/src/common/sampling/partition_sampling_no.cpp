@@ -1,5 +1,7 @@
 #include "common/sampling/partition_sampling_no.hpp"
 #include "common/sampling/partition_single.hpp"
+#include "common/sampling/partition_bi.hpp"
+#include "common/data/arrays.hpp"
 
 
 /**
@@ -27,7 +29,39 @@ class NoPartitionSampling final : public IPartitionSampling {
 
 };
 
+/**
+ * An implementation of the class `IPartitionSampling` that does not split the training examples, but includes all
+ * examples that belong to a subset, e.g., the training examples of a single cross validation fold, in the training set.
+ * The remaining examples are neither included in the training set, nor in the holdout set.
+ */
+class NoSubsetPartitionSampling final : public IPartitionSampling {
+
+    private:
+
+        BiPartition partition_;
+
+    public:
+
+        /**
+         * @param labelMatrix A reference to an object of type `CContiguousLabelMatrix` that provides access to the
+         *                    indices of the examples in the subset
+         */
+        NoSubsetPartitionSampling(const CContiguousLabelMatrix& labelMatrix)
+            : partition_(BiPartition(labelMatrix.getNumSubsetRows(), 0)) {
+            copyArray(labelMatrix.subset_indices_cbegin(), partition_.first_begin(), partition_.getNumFirst());
+        }
+
+        IPartition& partition(RNG& rng) override {
+            return partition_;
+        }
+
+};
+
 std::unique_ptr<IPartitionSampling> NoPartitionSamplingFactory::create(
         const CContiguousLabelMatrix& labelMatrix) const {
+    if (labelMatrix.isSubset()) {
+        return std::make_unique<NoSubsetPartitionSampling>(labelMatrix);
+    }
+
     return std::make_unique<NoPartitionSampling>(labelMatrix.getNumRows());
 }
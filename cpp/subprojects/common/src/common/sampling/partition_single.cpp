@@ -1,8 +1,10 @@
 #include "common/sampling/partition_single.hpp"
 #include "common/sampling/instance_sampling.hpp"
+#include "common/input/label_matrix.hpp"
 #include "common/thresholds/thresholds_subset.hpp"
 #include "common/rule_refinement/refinement.hpp"
 #include "common/head_refinement/prediction.hpp"
+#include "common/statistics/statistics.hpp"
 
 
 SinglePartition::SinglePartition(uint32 numElements)
@@ -23,8 +25,8 @@ uint32 SinglePartition::getNumElements() const {
 }
 
 std::unique_ptr<IInstanceSubSampling> SinglePartition::createInstanceSubSampling(
-        const IInstanceSubSamplingFactory& factory) {
-    return factory.create(*this);
+        const IInstanceSubSamplingFactory& factory, const ILabelMatrix& labelMatrix) {
+    return labelMatrix.createInstanceSubSampling(factory, *this);
 }
 
 float64 SinglePartition::evaluateOutOfSample(const IThresholdsSubset& thresholdsSubset,
@@ -36,3 +38,11 @@ void SinglePartition::recalculatePrediction(const IThresholdsSubset& thresholdsS
                                             const ICoverageState& coverageState, Refinement& refinement) {
     coverageState.recalculatePrediction(thresholdsSubset, *this, refinement);
 }
+
+void SinglePartition::markHoldoutStatistics(IStatistics& statistics) const {
+    return;
+}
+
+std::unique_ptr<std::vector<uint32>> SinglePartition::getHoldoutIndices() const {
+    return std::make_unique<std::vector<uint32>>();
+}
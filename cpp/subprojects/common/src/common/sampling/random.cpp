@@ -22,3 +22,11 @@ uint32 RNG::random(uint32 min, uint32 max) {
     uint32 randomNumber = randomState[0] % (MAX_RANDOM + 1);
     return min + (randomNumber % (max - min));
 }
+
+uint32 RNG::getState() const {
+    return randomState_;
+}
+
+void RNG::setState(uint32 randomState) {
+    randomState_ = randomState;
+}
@@ -0,0 +1,65 @@
+#include "common/sampling/sampling_buffer.hpp"
+#include "common/rule_induction/checkpoint.hpp"
+#include <cstdlib>
+
+
+SamplingBuffer::SamplingBuffer(uint32 numTotal)
+    : numTotal_(numTotal), permutation_(nullptr), bitmap_(nullptr) {
+
+}
+
+SamplingBuffer::~SamplingBuffer() {
+    free(permutation_);
+    free(bitmap_);
+}
+
+uint32 SamplingBuffer::getNumTotal() const {
+    return numTotal_;
+}
+
+uint32* SamplingBuffer::getPermutation() {
+    if (permutation_ == nullptr) {
+        permutation_ = (uint32*) malloc(numTotal_ * sizeof(uint32));
+
+        for (uint32 i = 0; i < numTotal_; i++) {
+            permutation_[i] = i;
+        }
+    }
+
+    return permutation_;
+}
+
+bool SamplingBuffer::mark(uint32 position) {
+    if (bitmap_ == nullptr) {
+        bitmap_ = (uint32*) calloc((numTotal_ / 32) + 1, sizeof(uint32));
+    }
+
+    uint32& word = bitmap_[position / 32];
+    uint32 mask = ((uint32) 1) << (position % 32);
+
+    if (word & mask) {
+        return false;
+    }
+
+    word |= mask;
+    return true;
+}
+
+void SamplingBuffer::unmark(uint32 position) {
+    bitmap_[position / 32] &= ~(((uint32) 1) << (position % 32));
+}
+
+void SamplingBuffer::writeState(CheckpointWriter& writer) const {
+    // If the permutation has not been initialized yet, it corresponds to the identity...
+    writer.write<uint8>(permutation_ != nullptr);
+
+    if (permutation_ != nullptr) {
+        writer.writeArray<uint32>(permutation_, numTotal_);
+    }
+}
+
+void SamplingBuffer::readState(CheckpointReader& reader) {
+    if (reader.read<uint8>()) {
+        reader.readArray<uint32>(this->getPermutation(), numTotal_);
+    }
+}
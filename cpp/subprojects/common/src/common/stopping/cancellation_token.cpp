@@ -0,0 +1,24 @@
+#include "common/stopping/cancellation_token.hpp"
+
+
+CancellationToken::CancellationToken(uint32 timeLimit)
+    : cancelled_(false), timeLimit_(std::chrono::duration_cast<timer_unit>(std::chrono::seconds(timeLimit))),
+      deadline_(timer::now() + timeLimit_) {
+
+}
+
+void CancellationToken::start() {
+    deadline_ = timer::now() + timeLimit_;
+}
+
+void CancellationToken::cancel() {
+    cancelled_.store(true);
+}
+
+bool CancellationToken::isCancelled() const {
+    if (cancelled_.load(std::memory_order_relaxed)) {
+        return true;
+    }
+
+    return timeLimit_.count() > 0 && timer::now() >= deadline_;
+}
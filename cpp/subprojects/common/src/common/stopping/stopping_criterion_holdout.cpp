@@ -0,0 +1,51 @@
+#include "common/stopping/stopping_criterion_holdout.hpp"
+#include "common/rule_induction/checkpoint.hpp"
+#include <cmath>
+
+
+HoldoutStoppingCriterion::HoldoutStoppingCriterion(uint32 patience, bool forceStop)
+    : patience_(patience), forceStop_(forceStop), bestQuality_(0), bestNumRules_(0), stored_(false) {
+
+}
+
+IStoppingCriterion::Result HoldoutStoppingCriterion::test(const IPartition& partition, const IStatistics& statistics,
+                                                          uint32 numRules) {
+    Result result;
+    result.action = CONTINUE;
+
+    // The quality on the holdout set is kept up-to-date by the statistics whenever a rule is added. It is undefined as
+    // long as no holdout set is used or the model does not contain any rules that cover holdout examples...
+    float64 quality = statistics.evaluateHoldoutPredictions();
+
+    if (!std::isnan(quality)) {
+        if (bestNumRules_ == 0 || quality < bestQuality_) {
+            bestQuality_ = quality;
+            bestNumRules_ = numRules;
+        }
+
+        if (numRules - bestNumRules_ >= patience_) {
+            result.action = forceStop_ ? FORCE_STOP : STORE_STOP;
+            result.numRules = bestNumRules_;
+            stored_ = !forceStop_;
+        } else if (stored_) {
+            // If a potential point for stopping has been stored before, it must be replaced, because the quality has
+            // improved since then...
+            result.action = STORE_STOP;
+            result.numRules = bestNumRules_;
+        }
+    }
+
+    return result;
+}
+
+void HoldoutStoppingCriterion::writeState(CheckpointWriter& writer) const {
+    writer.write<float64>(bestQuality_);
+    writer.write<uint32>(bestNumRules_);
+    writer.write<uint8>(stored_ ? 1 : 0);
+}
+
+void HoldoutStoppingCriterion::readState(CheckpointReader& reader) {
+    bestQuality_ = reader.read<float64>();
+    bestNumRules_ = reader.read<uint32>();
+    stored_ = reader.read<uint8>() != 0;
+}
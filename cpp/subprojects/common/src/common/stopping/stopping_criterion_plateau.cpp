@@ -0,0 +1,73 @@
+#include "common/stopping/stopping_criterion_plateau.hpp"
+#include "common/rule_induction/checkpoint.hpp"
+#include <cmath>
+
+
+PlateauStoppingCriterion::PlateauStoppingCriterion(uint32 windowSize, float64 minImprovement, bool forceStop)
+    : buffer_(windowSize), minImprovement_(minImprovement), forceStop_(forceStop),
+      storedNumRules_(0) {
+
+}
+
+IStoppingCriterion::Result PlateauStoppingCriterion::test(const IPartition& partition, const IStatistics& statistics,
+                                                          uint32 numRules) {
+    Result result;
+    result.action = CONTINUE;
+    float64 quality = statistics.evaluatePredictions();
+
+    // The quality is undefined as long as the model does not contain any rules that cover examples...
+    if (!std::isnan(quality)) {
+        std::pair<bool, float64> pair = buffer_.push(quality);
+
+        // Once the buffer is full, the overwritten value corresponds to the quality before the last `windowSize`
+        // rules have been added...
+        if (pair.first) {
+            float64 improvement = pair.second - quality;
+
+            if (improvement < minImprovement_) {
+                if (forceStop_) {
+                    result.action = FORCE_STOP;
+                    result.numRules = numRules;
+                } else if (storedNumRules_ == 0) {
+                    // The number of rules at the beginning of the window, where the first plateau has been reached, is
+                    // retained. It must be at least 1, because 0 would result in all rules being used...
+                    uint32 capacity = buffer_.getCapacity();
+                    storedNumRules_ = numRules > capacity ? numRules - capacity : 1;
+                }
+            }
+        }
+    }
+
+    // Once a potential point for stopping has been stored, it is reported whenever the criterion is tested, even if the
+    // quality has improved in the meantime...
+    if (result.action == CONTINUE && storedNumRules_ > 0) {
+        result.action = STORE_STOP;
+        result.numRules = storedNumRules_;
+    }
+
+    return result;
+}
+
+void PlateauStoppingCriterion::writeState(CheckpointWriter& writer) const {
+    // The values in the buffer are written in the order they have been added...
+    uint32 numElements = buffer_.getNumElements();
+    uint32 start = buffer_.isFull() ? buffer_.getPosition() : 0;
+    RingBuffer<float64>::const_iterator iterator = buffer_.cbegin();
+    writer.write<uint32>(numElements);
+
+    for (uint32 i = 0; i < numElements; i++) {
+        writer.write<float64>(iterator[(start + i) % numElements]);
+    }
+
+    writer.write<uint32>(storedNumRules_);
+}
+
+void PlateauStoppingCriterion::readState(CheckpointReader& reader) {
+    uint32 numElements = reader.read<uint32>();
+
+    for (uint32 i = 0; i < numElements; i++) {
+        buffer_.push(reader.read<float64>());
+    }
+
+    storedNumRules_ = reader.read<uint32>();
+}
@@ -1,4 +1,5 @@
 #include "common/stopping/stopping_criterion_size.hpp"
+#include "common/rule_induction/checkpoint.hpp"
 
 
 SizeStoppingCriterion::SizeStoppingCriterion(uint32 maxRules)
@@ -19,3 +20,11 @@ IStoppingCriterion::Result SizeStoppingCriterion::test(const IPartition& partiti
 
     return result;
 }
+
+void SizeStoppingCriterion::writeState(CheckpointWriter& writer) const {
+
+}
+
+void SizeStoppingCriterion::readState(CheckpointReader& reader) {
+
+}
@@ -1,4 +1,5 @@
 #include "common/stopping/stopping_criterion_time.hpp"
+#include "common/rule_induction/checkpoint.hpp"
 
 
 TimeStoppingCriterion::TimeStoppingCriterion(uint32 timeLimit)
@@ -29,3 +30,21 @@ IStoppingCriterion::Result TimeStoppingCriterion::test(const IPartition& partiti
 
     return result;
 }
+
+void TimeStoppingCriterion::writeState(CheckpointWriter& writer) const {
+    // The time that has already elapsed is stored, such that it counts towards the time limit when resuming...
+    uint32 elapsedTime = 0;
+
+    if (timerStarted_) {
+        elapsedTime = (uint32) std::chrono::duration_cast<timer_unit>(timer::now() - startTime_).count();
+    }
+
+    writer.write<uint8>(timerStarted_);
+    writer.write<uint32>(elapsedTime);
+}
+
+void TimeStoppingCriterion::readState(CheckpointReader& reader) {
+    timerStarted_ = reader.read<uint8>();
+    uint32 elapsedTime = reader.read<uint32>();
+    startTime_ = timer::now() - timer_unit(elapsedTime);
+}
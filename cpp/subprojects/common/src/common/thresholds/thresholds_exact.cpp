@@ -1,23 +1,29 @@
 #include "common/thresholds/thresholds_exact.hpp"
+#include "common/input/feature_vector_compressed.hpp"
+#include "common/input/feature_vector_prefetcher.hpp"
 #include "common/rule_refinement/rule_refinement_exact.hpp"
 #include "thresholds_common.hpp"
 #include <unordered_map>
 #include <cmath>
+#include <mutex>
 
 
 /**
- * An entry that is stored in a cache and contains an unique pointer to a feature vector. The field `numConditions`
+ * An entry that is stored in a cache and contains a shared pointer to a feature vector. The field `numConditions`
  * specifies how many conditions the rule contained when the vector was updated for the last time. It may be used to
  * check if the vector is still valid or must be updated.
+ *
+ * If a subset of the thresholds is copied, the feature vectors are shared by the copies. A shared vector must not be
+ * modified, but must be replaced by a new one instead (copy-on-write).
  */
 struct FilteredCacheEntry {
 
     FilteredCacheEntry(): numConditions(0) { };
 
     /**
-     * An unique pointer to an object of type `FeatureVector` that stores feature values.
+     * A shared pointer to an object of type `FeatureVector` that stores feature values.
      */
-    std::unique_ptr<FeatureVector> vectorPtr;
+    std::shared_ptr<FeatureVector> vectorPtr;
 
     /**
      * The number of conditions that were contained by the rule when the cache was updated for the last time.
@@ -33,8 +39,9 @@ struct FilteredCacheEntry {
  * descending order, depending on whether `conditionEnd` is smaller than `conditionPrevious` or vice versa, until the
  * next example that is contained in the current sub-sampling is encountered.
  *
- * @param featureVector     A reference to an object of type `FeatureVector` that stores the indices and feature values
- *                          of the training examples
+ * @tparam Vector           The type of the feature vector
+ * @param featureVector     A reference to an object of template type `Vector` that stores the indices and feature
+ *                          values of the training examples
  * @param conditionEnd      The position that separates the covered from the uncovered examples when only taking into
  *                          account the examples that are contained in the current sub-sample
  * @param conditionPrevious The position to stop at (exclusive)
@@ -42,9 +49,10 @@ struct FilteredCacheEntry {
  * @return                  The adjusted position that separates the covered from the uncovered examples with respect to
  *                          the examples that are not contained in the current sub-sample
  */
-static inline intp adjustSplit(FeatureVector& featureVector, intp conditionEnd, intp conditionPrevious,
+template<class Vector>
+static inline intp adjustSplit(const Vector& featureVector, intp conditionEnd, intp conditionPrevious,
                                float32 threshold) {
-    FeatureVector::const_iterator iterator = featureVector.cbegin();
+    typename Vector::const_iterator iterator = featureVector.cbegin();
     intp adjustedPosition = conditionEnd;
     bool ascending = conditionEnd < conditionPrevious;
     intp direction = ascending ? 1 : -1;
@@ -80,7 +88,8 @@ static inline intp adjustSplit(FeatureVector& featureVector, intp conditionEnd,
  * contain the elements that are covered by the new rule. The filtered vector is stored in a given struct of type
  * `FilteredCacheEntry` and the given statistics are updated accordingly.
  *
- * @param vector                A reference to an object of type `FeatureVector` that should be filtered
+ * @tparam Vector               The type of the feature vector
+ * @param vector                A reference to an object of template type `Vector` that should be filtered
  * @param cacheEntry            A reference to a struct of type `FilteredCacheEntry` that should be used to store the
  *                              filtered feature vector
  * @param conditionStart        The element in `vector` that corresponds to the first statistic (inclusive) included in
@@ -98,11 +107,14 @@ static inline intp adjustSplit(FeatureVector& featureVector, intp conditionEnd,
  *                              covered by the new rule
  * @param weights               A reference to an an object of type `IWeightVector` that provides access to the weights
  *                              of the individual training examples
+ * @param updatedIndices        A pointer to an object of type `std::vector`, the indices of the statistics that are
+ *                              updated should be added to, or a null pointer, if the indices should not be recorded
  */
-static inline void filterCurrentVector(const FeatureVector& vector, FilteredCacheEntry& cacheEntry, intp conditionStart,
+template<class Vector>
+static inline void filterCurrentVector(const Vector& vector, FilteredCacheEntry& cacheEntry, intp conditionStart,
                                        intp conditionEnd, Comparator conditionComparator, bool covered,
                                        uint32 numConditions, CoverageMask& coverageMask, IStatistics& statistics,
-                                       const IWeightVector& weights) {
+                                       const IWeightVector& weights, std::vector<uint32>* updatedIndices) {
     // Determine the number of elements in the filtered vector...
     uint32 numTotalElements = vector.getNumElements();
     uint32 distance = std::abs(conditionStart - conditionEnd);
@@ -111,12 +123,12 @@ static inline void filterCurrentVector(const FeatureVector& vector, FilteredCach
     // Create a new vector that will contain the filtered elements, if necessary...
     FeatureVector* filteredVector = cacheEntry.vectorPtr.get();
 
-    if (filteredVector == nullptr) {
-        cacheEntry.vectorPtr = std::make_unique<FeatureVector>(numElements);
+    if (filteredVector == nullptr || cacheEntry.vectorPtr.use_count() > 1) {
+        cacheEntry.vectorPtr = std::make_shared<FeatureVector>(numElements);
         filteredVector = cacheEntry.vectorPtr.get();
     }
 
-    typename FeatureVector::const_iterator iterator = vector.cbegin();
+    typename Vector::const_iterator iterator = vector.cbegin();
     FeatureVector::iterator filteredIterator = filteredVector->begin();
     CoverageMask::iterator coverageMaskIterator = coverageMask.begin();
 
@@ -146,6 +158,10 @@ static inline void filterCurrentVector(const FeatureVector& vector, FilteredCach
             float64 weight = weights.getWeight(index);
             statistics.updateCoveredStatistic(index, weight, false);
             i++;
+
+            if (updatedIndices != nullptr) {
+                updatedIndices->push_back(index);
+            }
         }
     } else {
         // Discard the indices at positions [start, end) and set the corresponding values in `coverageMask` to
@@ -155,6 +171,10 @@ static inline void filterCurrentVector(const FeatureVector& vector, FilteredCach
             coverageMaskIterator[index] = numConditions;
             float64 weight = weights.getWeight(index);
             statistics.updateCoveredStatistic(index, weight, true);
+
+            if (updatedIndices != nullptr) {
+                updatedIndices->push_back(index);
+            }
         }
 
         if (conditionComparator == NEQ) {
@@ -210,6 +230,10 @@ static inline void filterCurrentVector(const FeatureVector& vector, FilteredCach
             coverageMaskIterator[index] = numConditions;
             float64 weight = weights.getWeight(index);
             statistics.updateCoveredStatistic(index, weight, true);
+
+            if (updatedIndices != nullptr) {
+                updatedIndices->push_back(index);
+            }
         }
     }
 
@@ -221,20 +245,26 @@ static inline void filterCurrentVector(const FeatureVector& vector, FilteredCach
  * Filters a given feature vector, such that the filtered vector does only contain the elements that are covered by the
  * current rule. The filtered vector is stored in a given struct of type `FilteredCacheEntry`.
  *
- * @param vector        A reference to an object of type `FeatureVector` that should be filtered
+ * @tparam Vector       The type of the feature vector
+ * @param vector        A reference to an object of template type `Vector` that should be filtered
  * @param cacheEntry    A reference to a struct of type `FilteredCacheEntry` that should be used to store the filtered
  *                      vector
  * @param numConditions The total number of conditions in the current rule's body
  * @param coverageMask  A reference to an object of type `CoverageMask` that is used to keep track of the elements that
  *                      are covered by the current rule
  */
-static inline void filterAnyVector(const FeatureVector& vector, FilteredCacheEntry& cacheEntry, uint32 numConditions,
+template<class Vector>
+static inline void filterAnyVector(const Vector& vector, FilteredCacheEntry& cacheEntry, uint32 numConditions,
                                    const CoverageMask& coverageMask) {
     uint32 maxElements = vector.getNumElements();
-    FeatureVector* filteredVector = cacheEntry.vectorPtr.get();
 
-    if (filteredVector == nullptr) {
-        cacheEntry.vectorPtr = std::make_unique<FeatureVector>(maxElements);
+    // The vector is kept alive until it has been filtered. This prevents other subsets that share the vector from
+    // modifying it in the meantime, if they are filtered concurrently...
+    std::shared_ptr<FeatureVector> vectorPtr = cacheEntry.vectorPtr;
+    FeatureVector* filteredVector = vectorPtr.get();
+
+    if (filteredVector == nullptr || vectorPtr.use_count() > 2) {
+        cacheEntry.vectorPtr = std::make_shared<FeatureVector>(maxElements);
         filteredVector = cacheEntry.vectorPtr.get();
     } else {
         filteredVector->clearMissingIndices();
@@ -250,7 +280,7 @@ static inline void filterAnyVector(const FeatureVector& vector, FilteredCacheEnt
     }
 
     // Filter the feature values...
-    typename FeatureVector::const_iterator iterator = vector.cbegin();
+    typename Vector::const_iterator iterator = vector.cbegin();
     typename FeatureVector::iterator filteredIterator = filteredVector->begin();
     uint32 i = 0;
 
@@ -284,9 +314,11 @@ class ExactThresholds final : public AbstractThresholds {
 
             /**
              * A callback that allows to retrieve feature vectors. If available, the feature vectors are retrieved from
-             * the cache. Otherwise, they are fetched from the feature matrix.
+             * the cache. Otherwise, they are fetched from the feature matrix. If the cache is compressed, the feature
+             * vectors are provided in compressed form, unless they must be filtered. If the feature vectors are not
+             * cached at all, they are owned by the result of the callback.
              */
-            class Callback final : public IRuleRefinementCallback<FeatureVector, IWeightVector> {
+            class Callback final : public IExactRuleRefinementCallback {
 
                 private:
 
@@ -310,30 +342,56 @@ class ExactThresholds final : public AbstractThresholds {
                     std::unique_ptr<Result> get() override {
                         auto cacheFilteredIterator = thresholdsSubset_.cacheFiltered_.find(featureIndex_);
                         FilteredCacheEntry& cacheEntry = cacheFilteredIterator->second;
-                        FeatureVector* featureVector = cacheEntry.vectorPtr.get();
+
+                        // Filter feature vector, if only a subset of its elements are covered by the current rule...
+                        thresholdsSubset_.updateFilteredVector(featureIndex_, cacheEntry);
+                        const FeatureVector* featureVector = cacheEntry.vectorPtr.get();
+                        const IImmutableStatistics& statistics = thresholdsSubset_.getStatistics();
 
                         if (featureVector == nullptr) {
-                            auto cacheIterator = thresholdsSubset_.thresholds_.cache_.find(featureIndex_);
-                            featureVector = cacheIterator->second.get();
-
-                            if (featureVector == nullptr) {
-                                thresholdsSubset_.thresholds_.featureMatrixPtr_->fetchFeatureVector(
-                                    featureIndex_, cacheIterator->second);
-                                cacheIterator->second->sortByValues();
-                                featureVector = cacheIterator->second.get();
-                            }
+                            std::shared_ptr<const FeatureVector> featureVectorPtr =
+                                thresholdsSubset_.thresholds_.getFeatureVector(featureIndex_);
+                            return std::make_unique<Result>(statistics, thresholdsSubset_.weights_, featureVectorPtr);
                         }
 
-                        // Filter feature vector, if only a subset of its elements are covered by the current rule...
-                        uint32 numConditions = thresholdsSubset_.numModifications_;
+                        return std::make_unique<Result>(statistics, thresholdsSubset_.weights_, *featureVector);
+                    }
 
-                        if (numConditions > cacheEntry.numConditions) {
-                            filterAnyVector(*featureVector, cacheEntry, numConditions, thresholdsSubset_.coverageMask_);
-                            featureVector = cacheEntry.vectorPtr.get();
+                    std::unique_ptr<Result> getUnfiltered() override {
+                        return std::make_unique<Result>(thresholdsSubset_.getStatistics(), thresholdsSubset_.weights_,
+                                                        thresholdsSubset_.thresholds_.getFeatureVector(featureIndex_));
+                    }
+
+                    std::unique_ptr<CompressedResult> getCompressed() override {
+                        const FilteredCacheEntry& cacheEntry =
+                            thresholdsSubset_.cacheFiltered_.find(featureIndex_)->second;
+
+                        // The compressed feature vector can only be used, if it must not be filtered...
+                        if (cacheEntry.vectorPtr || thresholdsSubset_.numModifications_ > cacheEntry.numConditions) {
+                            return nullptr;
                         }
 
-                        return std::make_unique<Result>(thresholdsSubset_.thresholds_.statisticsProviderPtr_->get(),
-                                                        thresholdsSubset_.weights_, *featureVector);
+                        return getCompressedUnfiltered();
+                    }
+
+                    std::unique_ptr<CompressedResult> getCompressedUnfiltered() override {
+                        const CompressedFeatureVector* compressedVector =
+                            thresholdsSubset_.thresholds_.getCompressedFeatureVector(featureIndex_);
+
+                        if (compressedVector == nullptr) {
+                            return nullptr;
+                        }
+
+                        return std::make_unique<CompressedResult>(thresholdsSubset_.getStatistics(),
+                                                                  thresholdsSubset_.weights_, *compressedVector);
+                    }
+
+                    uint32 getNumExamples() const override {
+                        return thresholdsSubset_.thresholds_.getNumExamples();
+                    }
+
+                    bool isCovered(uint32 index) const override {
+                        return thresholdsSubset_.coverageMask_.isCovered(index);
                     }
 
             };
@@ -350,16 +408,23 @@ class ExactThresholds final : public AbstractThresholds {
 
             std::unordered_map<uint32, FilteredCacheEntry> cacheFiltered_;
 
+            std::unique_ptr<IStatistics> isolatedStatisticsPtr_;
+
+            IStatistics& getStatistics() const {
+                IStatistics* isolatedStatistics = isolatedStatisticsPtr_.get();
+                return isolatedStatistics != nullptr ? *isolatedStatistics : thresholds_.statisticsProviderPtr_->get();
+            }
+
             template<class T>
             std::unique_ptr<IRuleRefinement> createExactRuleRefinement(const T& labelIndices, uint32 featureIndex) {
                 // Retrieve the `FilteredCacheEntry` from the cache, or insert a new one if it does not already exist...
                 auto cacheFilteredIterator = cacheFiltered_.emplace(featureIndex, FilteredCacheEntry()).first;
-                FeatureVector* featureVector = cacheFilteredIterator->second.vectorPtr.get();
+                const FeatureVector* featureVector = cacheFilteredIterator->second.vectorPtr.get();
 
-                // If the `FilteredCacheEntry` in the cache does not refer to a `FeatureVector`, add an empty
-                // `unique_ptr` to the cache...
+                // If the `FilteredCacheEntry` in the cache does not refer to a `FeatureVector`, add an empty entry to
+                // the cache...
                 if (featureVector == nullptr) {
-                    thresholds_.cache_.emplace(featureIndex, std::unique_ptr<FeatureVector>());
+                    thresholds_.addCacheEntry(featureIndex);
                 }
 
                 bool nominal = thresholds_.nominalFeatureMaskPtr_->isNominal(featureIndex);
@@ -371,6 +436,84 @@ class ExactThresholds final : public AbstractThresholds {
                                                                 std::move(callbackPtr));
             }
 
+            /**
+             * Invokes a visitor with the feature vector that corresponds to a specific feature. If the given
+             * `FilteredCacheEntry` stores a filtered feature vector, it is passed to the visitor. Otherwise, the
+             * unfiltered feature vector is passed to the visitor. If the cache is compressed, the unfiltered feature
+             * vector is passed in compressed form, i.e., it is never decompressed as a whole.
+             *
+             * @tparam Visitor      The type of the visitor. It must accept references to objects of type
+             *                      `FeatureVector` and `CompressedFeatureVector`
+             * @param featureIndex  The index of the feature
+             * @param cacheEntry    A reference to a struct of type `FilteredCacheEntry` that corresponds to the feature
+             * @param visitor       The visitor to be invoked
+             */
+            template<class Visitor>
+            void visitFeatureVector(uint32 featureIndex, const FilteredCacheEntry& cacheEntry, Visitor visitor) {
+                const FeatureVector* featureVector = cacheEntry.vectorPtr.get();
+
+                if (featureVector != nullptr) {
+                    visitor(*featureVector);
+                    return;
+                }
+
+                const CompressedFeatureVector* compressedVector = thresholds_.getCompressedFeatureVector(featureIndex);
+
+                if (compressedVector != nullptr) {
+                    visitor(*compressedVector);
+                } else {
+                    // The feature vector is kept alive until the visitor returns...
+                    std::shared_ptr<const FeatureVector> featureVectorPtr = thresholds_.getFeatureVector(featureIndex);
+                    visitor(*featureVectorPtr);
+                }
+            }
+
+            /**
+             * Filters the feature vector that corresponds to a specific feature, such that it does only contain the
+             * elements that are covered by the current rule, unless it has already been filtered. The filtered vector
+             * is stored in the given `FilteredCacheEntry`.
+             *
+             * @param featureIndex  The index of the feature
+             * @param cacheEntry    A reference to a struct of type `FilteredCacheEntry` that corresponds to the feature
+             */
+            void updateFilteredVector(uint32 featureIndex, FilteredCacheEntry& cacheEntry) {
+                if (numModifications_ > cacheEntry.numConditions) {
+                    auto filterVisitor = [&](const auto& featureVector) {
+                        filterAnyVector(featureVector, cacheEntry, numModifications_, coverageMask_);
+                    };
+                    visitFeatureVector(featureIndex, cacheEntry, filterVisitor);
+                }
+            }
+
+            void filterThresholdsInternally(Refinement& refinement, std::vector<uint32>* updatedIndices) {
+                numModifications_++;
+                numCoveredExamples_ = refinement.numCovered;
+
+                uint32 featureIndex = refinement.featureIndex;
+                auto cacheFilteredIterator = cacheFiltered_.find(featureIndex);
+                FilteredCacheEntry& cacheEntry = cacheFilteredIterator->second;
+
+                auto filterVisitor = [&](const auto& featureVector) {
+                    // If there are examples with zero weights, those examples have not been considered considered when
+                    // searching for the refinement. In the next step, we need to identify the examples that are
+                    // covered by the refined rule, including those that have previously been ignored, via the function
+                    // `filterCurrentVector`. Said function calculates the number of covered examples based on the
+                    // variable `refinement.end`, which represents the position that separates the covered from the
+                    // uncovered examples. However, when taking into account the examples with zero weights, this
+                    // position may differ from the current value of `refinement.end` and therefore must be adjusted...
+                    if (weights_.hasZeroWeights() && std::abs(refinement.previous - refinement.end) > 1) {
+                        refinement.end = adjustSplit(featureVector, refinement.end, refinement.previous,
+                                                     refinement.threshold);
+                    }
+
+                    // Identify the examples that are covered by the refined rule...
+                    filterCurrentVector(featureVector, cacheEntry, refinement.start, refinement.end,
+                                        refinement.comparator, refinement.covered, numModifications_, coverageMask_,
+                                        getStatistics(), weights_, updatedIndices);
+                };
+                visitFeatureVector(featureIndex, cacheEntry, filterVisitor);
+            }
+
             public:
 
                 /**
@@ -384,6 +527,20 @@ class ExactThresholds final : public AbstractThresholds {
 
                 }
 
+                /**
+                 * @param thresholdsSubset A reference to an object of type `ThresholdsSubset` to be copied
+                 */
+                ThresholdsSubset(const ThresholdsSubset& thresholdsSubset)
+                    : thresholds_(thresholdsSubset.thresholds_), weights_(thresholdsSubset.weights_),
+                      numCoveredExamples_(thresholdsSubset.numCoveredExamples_),
+                      coverageMask_(thresholdsSubset.coverageMask_),
+                      numModifications_(thresholdsSubset.numModifications_),
+                      cacheFiltered_(thresholdsSubset.cacheFiltered_),
+                      isolatedStatisticsPtr_(thresholdsSubset.isolatedStatisticsPtr_
+                          ? thresholdsSubset.isolatedStatisticsPtr_->isolateCoveredStatistics() : nullptr) {
+
+                }
+
                 std::unique_ptr<IRuleRefinement> createRuleRefinement(const FullIndexVector& labelIndices,
                                                                       uint32 featureIndex) override {
                     return createExactRuleRefinement(labelIndices, featureIndex);
@@ -395,35 +552,53 @@ class ExactThresholds final : public AbstractThresholds {
                 }
 
                 void filterThresholds(Refinement& refinement) override {
-                    numModifications_++;
-                    numCoveredExamples_ = refinement.numCovered;
+                    filterThresholdsInternally(refinement, nullptr);
+                }
+
+                void filterThresholds(Refinement& refinement, std::vector<uint32>& indices) override {
+                    filterThresholdsInternally(refinement, &indices);
+                }
 
+                void getUpdatedIndices(const Refinement& refinement, std::vector<uint32>& indices) override {
                     uint32 featureIndex = refinement.featureIndex;
-                    auto cacheFilteredIterator = cacheFiltered_.find(featureIndex);
-                    FilteredCacheEntry& cacheEntry = cacheFilteredIterator->second;
-                    FeatureVector* featureVector = cacheEntry.vectorPtr.get();
+                    FilteredCacheEntry& cacheEntry = cacheFiltered_.find(featureIndex)->second;
+                    updateFilteredVector(featureIndex, cacheEntry);
+
+                    auto indexVisitor = [&](const auto& featureVector) {
+                        // Adjust the position that separates the covered from the uncovered examples in the same way
+                        // as the function `filterThresholdsInternally`...
+                        intp conditionStart = refinement.start;
+                        intp conditionEnd = refinement.end;
+
+                        if (weights_.hasZeroWeights() && std::abs(refinement.previous - conditionEnd) > 1) {
+                            conditionEnd = adjustSplit(featureVector, conditionEnd, refinement.previous,
+                                                       refinement.threshold);
+                        }
 
-                    if (featureVector == nullptr) {
-                        auto cacheIterator = thresholds_.cache_.find(featureIndex);
-                        featureVector = cacheIterator->second.get();
-                    }
+                        // Identify the examples in the same order as the function `filterCurrentVector`...
+                        auto iterator = featureVector.cbegin();
+                        intp start, end;
 
-                    // If there are examples with zero weights, those examples have not been considered considered when
-                    // searching for the refinement. In the next step, we need to identify the examples that are covered
-                    // by the refined rule, including those that have previously been ignored, via the function
-                    // `filterCurrentVector`. Said function calculates the number of covered examples based on the
-                    // variable `refinement.end`, which represents the position that separates the covered from the
-                    // uncovered examples. However, when taking into account the examples with zero weights, this
-                    // position may differ from the current value of `refinement.end` and therefore must be adjusted...
-                    if (weights_.hasZeroWeights() && std::abs(refinement.previous - refinement.end) > 1) {
-                        refinement.end = adjustSplit(*featureVector, refinement.end, refinement.previous,
-                                                     refinement.threshold);
-                    }
+                        if (conditionEnd < conditionStart) {
+                            start = conditionEnd + 1;
+                            end = conditionStart + 1;
+                        } else {
+                            start = conditionStart;
+                            end = conditionEnd;
+                        }
 
-                    // Identify the examples that are covered by the refined rule...
-                    filterCurrentVector(*featureVector, cacheEntry, refinement.start, refinement.end,
-                                        refinement.comparator, refinement.covered, numModifications_, coverageMask_,
-                                        thresholds_.statisticsProviderPtr_->get(), weights_);
+                        for (intp r = start; r < end; r++) {
+                            indices.push_back(iterator[r].index);
+                        }
+
+                        if (!refinement.covered) {
+                            for (auto it = featureVector.missing_indices_cbegin();
+                                 it != featureVector.missing_indices_cend(); it++) {
+                                indices.push_back(*it);
+                            }
+                        }
+                    };
+                    visitFeatureVector(featureIndex, cacheEntry, indexVisitor);
                 }
 
                 void filterThresholds(const Condition& condition) override {
@@ -433,32 +608,66 @@ class ExactThresholds final : public AbstractThresholds {
                     uint32 featureIndex = condition.featureIndex;
                     auto cacheFilteredIterator = cacheFiltered_.emplace(featureIndex, FilteredCacheEntry()).first;
                     FilteredCacheEntry& cacheEntry = cacheFilteredIterator->second;
-                    FeatureVector* featureVector = cacheEntry.vectorPtr.get();
 
-                    if (featureVector == nullptr) {
-                        auto cacheIterator = thresholds_.cache_.emplace(featureIndex,
-                                                                        std::unique_ptr<FeatureVector>()).first;
-                        featureVector = cacheIterator->second.get();
+                    if (!cacheEntry.vectorPtr) {
+                        thresholds_.addCacheEntry(featureIndex);
                     }
 
                     // Identify the examples that are covered by the condition...
-                    if (numModifications_ > cacheEntry.numConditions) {
-                        filterAnyVector(*featureVector, cacheEntry, numModifications_, coverageMask_);
-                        featureVector = cacheEntry.vectorPtr.get();
+                    updateFilteredVector(featureIndex, cacheEntry);
+
+                    auto filterVisitor = [&](const auto& featureVector) {
+                        filterCurrentVector(featureVector, cacheEntry, condition.start, condition.end,
+                                            condition.comparator, condition.covered, numModifications_, coverageMask_,
+                                            getStatistics(), weights_, nullptr);
+                    };
+                    visitFeatureVector(featureIndex, cacheEntry, filterVisitor);
+                }
+
+                void filterThresholds(const Condition& condition, const uint32* indices, uint32 numIndices) override {
+                    numModifications_++;
+                    numCoveredExamples_ = condition.numCovered;
+                    IStatistics& statistics = getStatistics();
+                    CoverageMask::iterator coverageMaskIterator = coverageMask_.begin();
+                    bool covered = condition.covered;
+
+                    // Update the coverage mask and the statistics in the same way as the function
+                    // `filterCurrentVector`...
+                    if (covered) {
+                        coverageMask_.setTarget(numModifications_);
+                        statistics.resetCoveredStatistics();
                     }
 
-                    filterCurrentVector(*featureVector, cacheEntry, condition.start, condition.end,
-                                        condition.comparator, condition.covered, numModifications_, coverageMask_,
-                                        thresholds_.statisticsProviderPtr_->get(), weights_);
+                    for (uint32 i = 0; i < numIndices; i++) {
+                        uint32 index = indices[i];
+                        coverageMaskIterator[index] = numModifications_;
+                        float64 weight = weights_.getWeight(index);
+                        statistics.updateCoveredStatistic(index, weight, !covered);
+                    }
                 }
 
                 void resetThresholds() override {
+                    isolatedStatisticsPtr_.reset();
                     numModifications_ = 0;
                     numCoveredExamples_ = weights_.getNumNonZeroWeights();
                     cacheFiltered_.clear();
                     coverageMask_.reset();
                 }
 
+                std::unique_ptr<IThresholdsSubset> copy() const override {
+                    return std::make_unique<ThresholdsSubset>(*this);
+                }
+
+                void isolateStatistics() override {
+                    if (!isolatedStatisticsPtr_) {
+                        isolatedStatisticsPtr_ = thresholds_.statisticsProviderPtr_->get().isolateCoveredStatistics();
+                    }
+                }
+
+                bool isCovered(uint32 exampleIndex) const override {
+                    return coverageMask_.isCovered(exampleIndex);
+                }
+
                 const ICoverageState& getCoverageState() const {
                     return coverageMask_;
                 }
@@ -467,28 +676,28 @@ class ExactThresholds final : public AbstractThresholds {
                                             const AbstractPrediction& head) const override {
                     return evaluateOutOfSampleInternally<SinglePartition::const_iterator>(
                         partition.cbegin(), partition.getNumElements(), weights_, coverageState,
-                        thresholds_.statisticsProviderPtr_->get(), *thresholds_.headRefinementFactoryPtr_, head);
+                        getStatistics(), *thresholds_.headRefinementFactoryPtr_, head);
                 }
 
                 float64 evaluateOutOfSample(const BiPartition& partition, const CoverageMask& coverageState,
                                             const AbstractPrediction& head) const override {
                     return evaluateOutOfSampleInternally<BiPartition::const_iterator>(
                         partition.first_cbegin(), partition.getNumFirst(), weights_, coverageState,
-                        thresholds_.statisticsProviderPtr_->get(), *thresholds_.headRefinementFactoryPtr_, head);
+                        getStatistics(), *thresholds_.headRefinementFactoryPtr_, head);
                 }
 
                 void recalculatePrediction(const SinglePartition& partition, const CoverageMask& coverageState,
                                            Refinement& refinement) const override {
                     recalculatePredictionInternally<SinglePartition::const_iterator>(
                         partition.cbegin(), partition.getNumElements(), coverageState,
-                        thresholds_.statisticsProviderPtr_->get(), *thresholds_.headRefinementFactoryPtr_, refinement);
+                        getStatistics(), *thresholds_.headRefinementFactoryPtr_, refinement);
                 }
 
                 void recalculatePrediction(const BiPartition& partition, const CoverageMask& coverageState,
                                            Refinement& refinement) const override {
                     recalculatePredictionInternally<BiPartition::const_iterator>(
                         partition.first_cbegin(), partition.getNumFirst(), coverageState,
-                        thresholds_.statisticsProviderPtr_->get(), *thresholds_.headRefinementFactoryPtr_, refinement);
+                        getStatistics(), *thresholds_.headRefinementFactoryPtr_, refinement);
                 }
 
                 void applyPrediction(const AbstractPrediction& prediction) override {
@@ -506,7 +715,116 @@ class ExactThresholds final : public AbstractThresholds {
 
         };
 
-        std::unordered_map<uint32, std::unique_ptr<FeatureVector>> cache_;
+        bool compressCache_;
+
+        std::unordered_map<uint32, std::shared_ptr<const FeatureVector>> cache_;
+
+        std::unordered_map<uint32, std::unique_ptr<CompressedFeatureVector>> cacheCompressed_;
+
+        std::unique_ptr<FeatureVectorPrefetcher> prefetcherPtr_;
+
+        std::mutex mutex_;
+
+        /**
+         * Adds an empty entry for a specific feature to the cache, if it does not already contain an entry for the
+         * feature. If the feature vectors are not cached, the feature vector is requested to be fetched in the
+         * background instead. This function must not be called concurrently.
+         *
+         * @param featureIndex The index of the feature
+         */
+        void addCacheEntry(uint32 featureIndex) {
+            if (prefetcherPtr_) {
+                prefetcherPtr_->prefetch(featureIndex);
+            } else if (compressCache_) {
+                cacheCompressed_.emplace(featureIndex, std::unique_ptr<CompressedFeatureVector>());
+            } else {
+                cache_.emplace(featureIndex, std::shared_ptr<const FeatureVector>());
+            }
+        }
+
+        /**
+         * Retrieves the compressed feature vector that corresponds to a specific feature from the cache, if the cache
+         * is compressed. If the cache does not store the feature vector yet, it is fetched from the feature matrix,
+         * compressed and added to the cache. The cache must already contain an entry for the given feature, which
+         * allows to call this function concurrently.
+         *
+         * @param featureIndex  The index of the feature
+         * @return              A pointer to an object of type `CompressedFeatureVector` that stores the compressed
+         *                      feature vector or a null pointer, if the cache is not compressed
+         */
+        const CompressedFeatureVector* getCompressedFeatureVector(uint32 featureIndex) {
+            if (prefetcherPtr_ || !compressCache_) {
+                return nullptr;
+            }
+
+            std::unique_ptr<CompressedFeatureVector>& compressedVectorPtr = cacheCompressed_.find(featureIndex)->second;
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+
+                if (compressedVectorPtr) {
+                    return compressedVectorPtr.get();
+                }
+            }
+
+            // The feature vector is fetched and compressed without holding the lock. If the same feature vector is
+            // compressed by another thread in the meantime, only one of them is added to the cache...
+            std::shared_ptr<const FeatureVector> featureVectorPtr =
+                featureMatrixPtr_->fetchSortedFeatureVector(featureIndex);
+            std::unique_ptr<CompressedFeatureVector> newCompressedVectorPtr =
+                std::make_unique<CompressedFeatureVector>(*featureVectorPtr);
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            if (!compressedVectorPtr) {
+                compressedVectorPtr = std::move(newCompressedVectorPtr);
+            }
+
+            return compressedVectorPtr.get();
+        }
+
+        /**
+         * Retrieves the feature vector that corresponds to a specific feature from the cache. If the cache does not
+         * store the feature vector yet, it is fetched from the feature matrix and added to the cache. The cache must
+         * already contain an entry for the given feature, which allows to call this function concurrently. If the cache
+         * is compressed, the feature vector is decompressed and owned by the returned pointer. The search for
+         * refinements avoids this by using the function `getCompressedFeatureVector` instead. If the feature vectors
+         * are not cached, the feature vector is retrieved from the prefetcher.
+         *
+         * @param featureIndex  The index of the feature
+         * @return              A shared pointer to an object of type `FeatureVector` that stores the feature vector
+         */
+        std::shared_ptr<const FeatureVector> getFeatureVector(uint32 featureIndex) {
+            if (prefetcherPtr_) {
+                return prefetcherPtr_->get(featureIndex);
+            }
+
+            const CompressedFeatureVector* compressedVector = getCompressedFeatureVector(featureIndex);
+
+            if (compressedVector != nullptr) {
+                return compressedVector->decompress();
+            }
+
+            std::shared_ptr<const FeatureVector>& cachedVectorPtr = cache_.find(featureIndex)->second;
+            std::shared_ptr<const FeatureVector> featureVectorPtr;
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                featureVectorPtr = cachedVectorPtr;
+            }
+
+            if (!featureVectorPtr) {
+                featureVectorPtr = featureMatrixPtr_->fetchSortedFeatureVector(featureIndex);
+                std::lock_guard<std::mutex> lock(mutex_);
+
+                if (cachedVectorPtr) {
+                    featureVectorPtr = cachedVectorPtr;
+                } else {
+                    cachedVectorPtr = featureVectorPtr;
+                }
+            }
+
+            return featureVectorPtr;
+        }
 
     public:
 
@@ -520,27 +838,50 @@ class ExactThresholds final : public AbstractThresholds {
          * @param headRefinementFactoryPtr  A shared pointer to an object of type `IHeadRefinementFactory` that allows
          *                                  to create instances of the class that should be used to find the heads of
          *                                  rules
+         * @param compressCache             True, if the feature vectors should be stored in the cache in a compressed
+         *                                  form, false otherwise
+         * @param prefetchWindow            The maximum number of feature vectors to be prefetched in the background, if
+         *                                  the feature vectors should not be cached, or 0, if they should be cached
          */
         ExactThresholds(std::shared_ptr<IFeatureMatrix> featureMatrixPtr,
                         std::shared_ptr<INominalFeatureMask> nominalFeatureMaskPtr,
                         std::shared_ptr<IStatisticsProvider> statisticsProviderPtr,
-                        std::shared_ptr<IHeadRefinementFactory> headRefinementFactoryPtr)
+                        std::shared_ptr<IHeadRefinementFactory> headRefinementFactoryPtr, bool compressCache,
+                        uint32 prefetchWindow)
             : AbstractThresholds(featureMatrixPtr, nominalFeatureMaskPtr, statisticsProviderPtr,
-                                 headRefinementFactoryPtr) {
+                                 headRefinementFactoryPtr),
+              compressCache_(compressCache),
+              prefetcherPtr_(prefetchWindow > 0
+                             ? std::make_unique<FeatureVectorPrefetcher>(featureMatrixPtr, prefetchWindow) : nullptr) {
 
         }
 
         std::unique_ptr<IThresholdsSubset> createSubset(const IWeightVector& weights) override {
+            // Feature vectors that have been prefetched or retrieved for the previous rule are discarded...
+            if (prefetcherPtr_) {
+                prefetcherPtr_->clear();
+            }
+
             updateSampledStatisticsInternally(statisticsProviderPtr_->get(), weights);
             return std::make_unique<ExactThresholds::ThresholdsSubset>(*this, weights);
         }
 
 };
 
+ExactThresholdsFactory::ExactThresholdsFactory()
+    : ExactThresholdsFactory(false, 0) {
+
+}
+
+ExactThresholdsFactory::ExactThresholdsFactory(bool compressCache, uint32 prefetchWindow)
+    : compressCache_(compressCache), prefetchWindow_(prefetchWindow) {
+
+}
+
 std::unique_ptr<IThresholds> ExactThresholdsFactory::create(
         std::shared_ptr<IFeatureMatrix> featureMatrixPtr, std::shared_ptr<INominalFeatureMask> nominalFeatureMaskPtr,
         std::shared_ptr<IStatisticsProvider> statisticsProviderPtr,
         std::shared_ptr<IHeadRefinementFactory> headRefinementFactoryPtr) const {
     return std::make_unique<ExactThresholds>(featureMatrixPtr, nominalFeatureMaskPtr, statisticsProviderPtr,
-                                             headRefinementFactoryPtr);
+                                             headRefinementFactoryPtr, compressCache_, prefetchWindow_);
 }
@@ -0,0 +1,160 @@
+/*
+ * @author Michael Rapp (mrapp@ke.tu-darmstadt.de)
+ */
+#pragma once
+
+#include "common/data/types.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace tsa {
+
+    /**
+     * Stores the instances of all weeks of a time series in chronological order, as well as the number of cases in each
+     * week, in the formats that are expected by the classes `FortranContiguousFeatureMatrix` and
+     * `CContiguousLabelMatrix`.
+     */
+    class TimeSeries final {
+
+        private:
+
+            uint32 numRows_;
+
+            uint32 numCols_;
+
+            std::vector<float32> featureValues_;
+
+            std::vector<uint32> labels_;
+
+            std::vector<uint32> years_;
+
+            std::vector<uint32> weeks_;
+
+            std::vector<std::vector<std::string>> nominalValues_;
+
+            std::vector<bool> nominal_;
+
+        public:
+
+            /**
+             * @param numRows   The number of instances
+             * @param numCols   The number of features
+             */
+            TimeSeries(uint32 numRows, uint32 numCols);
+
+            /**
+             * Returns the number of instances.
+             *
+             * @return The number of instances
+             */
+            uint32 getNumRows() const;
+
+            /**
+             * Returns the number of features.
+             *
+             * @return The number of features
+             */
+            uint32 getNumCols() const;
+
+            /**
+             * Returns a pointer to a Fortran-contiguous array of type `float32`, shape `(numRows, numCols)`, that
+             * stores the feature values of the instances. Missing feature values are represented by NaN, whereas the
+             * values of nominal features are represented by the indices of the values in the order of their first
+             * occurrence.
+             *
+             * @return A pointer to the array
+             */
+            float32* getFeatureValues();
+
+            /**
+             * Returns a pointer to a C-contiguous array of type `uint32`, shape `(numRows, 2)`, that stores the time
+             * slot, starting at 1, and the number of cases that correspond to the individual instances.
+             *
+             * @return A pointer to the array
+             */
+            uint32* getLabels();
+
+            /**
+             * Returns a pointer to an array of type `uint32`, shape `(numRows)`, that stores the year of each instance.
+             *
+             * @return A pointer to the array
+             */
+            uint32* getYears();
+
+            /**
+             * Returns a pointer to an array of type `uint32`, shape `(numRows)`, that stores the week of each instance.
+             *
+             * @return A pointer to the array
+             */
+            uint32* getWeeks();
+
+            /**
+             * Returns whether a specific feature is nominal or not.
+             *
+             * @param featureIndex  The index of the feature
+             * @return              True, if the feature is nominal, false otherwise
+             */
+            bool isNominal(uint32 featureIndex) const;
+
+            /**
+             * Marks a specific feature as nominal.
+             *
+             * @param featureIndex  The index of the feature
+             * @param values        The values of the feature in the order of their indices
+             */
+            void setNominal(uint32 featureIndex, std::vector<std::string>&& values);
+
+            /**
+             * Returns the values of a specific nominal feature in the order of their indices.
+             *
+             * @param featureIndex  The index of the feature
+             * @return              A reference to an object of type `std::vector` that stores the values
+             */
+            const std::vector<std::string>& getNominalValues(uint32 featureIndex) const;
+
+    };
+
+    /**
+     * Allows to read a time series from CSV files. The file that stores the instances must contain a column `week`,
+     * whose values specify the year and week an instance belongs to in the format `<year>-<week>`, as well as a column
+     * for each feature to be used. The file that stores the number of cases must contain the columns `year`, `week` and
+     * `cases`. Instances of weeks with an unknown number of cases are ignored. Values may be enclosed in double quotes,
+     * in which case they may also contain line breaks.
+     *
+     * The files are mapped into memory and the file that stores the instances is split into chunks of complete records
+     * that are parsed in parallel. Features, whose values cannot be parsed as numbers, are considered to be nominal and
+     * their values are encoded by indices.
+     */
+    class CsvTimeSeriesReader final {
+
+        private:
+
+            uint32 numThreads_;
+
+        public:
+
+            /**
+             * @param numThreads The number of CPU threads to be used to parse the file in parallel. Must be at least 1
+             */
+            CsvTimeSeriesReader(uint32 numThreads);
+
+            /**
+             * Reads a time series from CSV files.
+             *
+             * @param instanceFile  The path of the CSV file that stores the instances
+             * @param countFile     The path of the CSV file that stores the number of cases in each week
+             * @param featureNames  A reference to an object of type `std::vector` that stores the names of the columns
+             *                      that correspond to the features to be used
+             * @param error         A reference to an object of type `std::string`, a description of the error should be
+             *                      written to, if the files cannot be read
+             * @return              An unique pointer to an object of type `TimeSeries` that stores the time series that
+             *                      has been read or a null pointer, if the files cannot be read
+             */
+            std::unique_ptr<TimeSeries> read(const std::string& instanceFile, const std::string& countFile,
+                                             const std::vector<std::string>& featureNames, std::string& error) const;
+
+    };
+
+}
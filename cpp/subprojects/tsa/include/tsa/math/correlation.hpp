@@ -0,0 +1,160 @@
+/*
+ * @author Michael Rapp (mrapp@ke.tu-darmstadt.de)
+ */
+#pragma once
+
+#include "common/data/types.hpp"
+#include <cmath>
+
+
+namespace tsa {
+
+    /**
+     * Stores the sums that are needed to calculate the Pearson correlation coefficient between the ground truth `x` and
+     * the predictions `y` for individual time slots. When the prediction for a single time slot changes, the sums can
+     * be updated in constant time, instead of iterating all time slots again.
+     *
+     * As the ground truth and the predictions are integers, all sums are exact and do not depend on the order in which
+     * the updates are applied.
+     */
+    struct CorrelationMoments {
+
+        CorrelationMoments() : numElements(0), xSum(0), xSquaredSum(0), ySum(0), ySquaredSum(0), productSum(0) { };
+
+        /**
+         * The number of time slots.
+         */
+        float64 numElements;
+
+        /**
+         * The sum of the ground truth.
+         */
+        float64 xSum;
+
+        /**
+         * The sum of the squared ground truth.
+         */
+        float64 xSquaredSum;
+
+        /**
+         * The sum of the predictions.
+         */
+        float64 ySum;
+
+        /**
+         * The sum of the squared predictions.
+         */
+        float64 ySquaredSum;
+
+        /**
+         * The sum of the products of the ground truth and the predictions.
+         */
+        float64 productSum;
+
+    };
+
+    /**
+     * Adds a single time slot to the sums that are needed to calculate the Pearson correlation coefficient.
+     *
+     * @param moments       A reference to a struct of type `CorrelationMoments` that should be updated
+     * @param groundTruth   The ground truth for the time slot
+     * @param prediction    The prediction for the time slot
+     */
+    static inline void addToCorrelationMoments(CorrelationMoments& moments, uint32 groundTruth, uint32 prediction) {
+        float64 x = (float64) groundTruth;
+        float64 y = (float64) prediction;
+        moments.numElements += 1;
+        moments.xSum += x;
+        moments.xSquaredSum += (x * x);
+        moments.ySum += y;
+        moments.ySquaredSum += (y * y);
+        moments.productSum += (x * y);
+    }
+
+    /**
+     * Removes a single time slot from the sums that are needed to calculate the Pearson correlation coefficient.
+     *
+     * @param moments       A reference to a struct of type `CorrelationMoments` that should be updated
+     * @param groundTruth   The ground truth for the time slot
+     * @param prediction    The prediction for the time slot
+     */
+    static inline void removeFromCorrelationMoments(CorrelationMoments& moments, uint32 groundTruth,
+                                                    uint32 prediction) {
+        float64 x = (float64) groundTruth;
+        float64 y = (float64) prediction;
+        moments.numElements -= 1;
+        moments.xSum -= x;
+        moments.xSquaredSum -= (x * x);
+        moments.ySum -= y;
+        moments.ySquaredSum -= (y * y);
+        moments.productSum -= (x * y);
+    }
+
+    /**
+     * Calculates and returns the sums that are needed to calculate the Pearson correlation coefficient between the
+     * ground truth and the predictions for several time slots.
+     *
+     * @tparam GroundTruthIterator  The type of the iterator that provides access to the ground truth
+     * @tparam PredictionIterator   The type of the iterator that provides access to the predictions
+     * @param groundTruthIterator   An iterator of template type `GroundTruthIterator` that provides random access to
+     *                              the ground truth
+     * @param predictionIterator    An iterator of template type `PredictionIterator` that provides random access to the
+     *                              predictions
+     * @param numTimeSlots          The number of time slots
+     * @return                      A struct of type `CorrelationMoments` that stores the sums
+     */
+    template<class GroundTruthIterator, class PredictionIterator>
+    static inline CorrelationMoments calculateCorrelationMoments(GroundTruthIterator groundTruthIterator,
+                                                                 PredictionIterator predictionIterator,
+                                                                 uint32 numTimeSlots) {
+        CorrelationMoments moments;
+
+        for (uint32 i = 0; i < numTimeSlots; i++) {
+            addToCorrelationMoments(moments, groundTruthIterator[i], predictionIterator[i]);
+        }
+
+        return moments;
+    }
+
+    /**
+     * Updates the sums that are needed to calculate the Pearson correlation coefficient when the prediction for a
+     * single time slot is increased or decreased by one.
+     *
+     * @param moments       A reference to a struct of type `CorrelationMoments` that should be updated
+     * @param groundTruth   The ground truth for the time slot
+     * @param prediction    The prediction for the time slot before it is updated
+     * @param remove        True, if the prediction is decreased, false, if it is increased
+     */
+    static inline void updateCorrelationMoments(CorrelationMoments& moments, uint32 groundTruth, uint32 prediction,
+                                                bool remove) {
+        float64 x = (float64) groundTruth;
+        float64 y = (float64) prediction;
+
+        if (remove) {
+            moments.ySum -= 1;
+            moments.ySquaredSum -= ((2 * y) - 1);
+            moments.productSum -= x;
+        } else {
+            moments.ySum += 1;
+            moments.ySquaredSum += ((2 * y) + 1);
+            moments.productSum += x;
+        }
+    }
+
+    /**
+     * Calculates and returns the Pearson correlation coefficient, given the sums that are stored by a struct of type
+     * `CorrelationMoments`.
+     *
+     * @param moments   A reference to a struct of type `CorrelationMoments` that stores the sums
+     * @return          The Pearson correlation coefficient
+     */
+    static inline float64 pearsonCorrelation(const CorrelationMoments& moments) {
+        float64 n = moments.numElements;
+        float64 numerator = (n * moments.productSum) - (moments.xSum * moments.ySum);
+        float64 sqrt1 = std::sqrt((n * moments.xSquaredSum) - std::pow(moments.xSum, 2));
+        float64 sqrt2 = std::sqrt((n * moments.ySquaredSum) - std::pow(moments.ySum, 2));
+        float64 denominator = sqrt1 * sqrt2;
+        return numerator / denominator;
+    }
+
+}
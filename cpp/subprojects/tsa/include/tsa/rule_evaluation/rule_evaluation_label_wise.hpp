@@ -4,10 +4,9 @@
 #pragma once
 
 #include "common/rule_evaluation/score_vector_label_wise.hpp"
-#include "common/data/vector_dense.hpp"
-#include "common/input/label_matrix_c_contiguous.hpp"
 #include "common/indices/index_vector_full.hpp"
 #include "common/indices/index_vector_partial.hpp"
+#include "tsa/math/correlation.hpp"
 #include <memory>
 
 
@@ -26,15 +25,14 @@ namespace tsa {
 
             /**
              * Calculates the scores to be predicted by a rule, as well as corresponding quality scores, based on the
-             * label-wise sums of gradients and Hessians that are covered by the rule.
+             * sums that are needed to calculate the correlation between the ground truth and the predictions.
              *
-             * @param statisticVector   A reference to an object of type `DenseLabelWiseStatisticVector` that stores the
-             *                          gradients and Hessians
-             * @return                  A reference to an object of type `ILabelWiseScoreVector` that stores the
-             *                          predicted scores and quality scores
+             * @param moments   A reference to a struct of type `CorrelationMoments` that stores the sums that
+             *                  correspond to the predictions for the individual time slots
+             * @return          A reference to an object of type `ILabelWiseScoreVector` that stores the predicted
+             *                  scores and quality scores. It may be modified by the caller
              */
-            virtual const ILabelWiseScoreVector& calculateLabelWisePrediction(
-                const DenseVector<uint32>& predictions, const CContiguousLabelMatrix& groundTruth) = 0;
+            virtual ILabelWiseScoreVector& calculateLabelWisePrediction(const CorrelationMoments& moments) = 0;
 
     };
 
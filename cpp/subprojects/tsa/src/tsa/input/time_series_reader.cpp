@@ -0,0 +1,865 @@
+#include "tsa/input/time_series_reader.hpp"
+#include "omp.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+namespace tsa {
+
+    const std::string COLUMN_YEAR = "year";
+
+    const std::string COLUMN_WEEK = "week";
+
+    const std::string COLUMN_CASES = "cases";
+
+    /**
+     * The tokens that are interpreted as missing values. They correspond to the default values that are used by pandas.
+     */
+    const char* NA_VALUES[] = {
+        "", "#N/A", "#N/A N/A", "#NA", "-1.#IND", "-1.#QNAN", "-NaN", "-nan", "1.#IND", "1.#QNAN", "<NA>", "N/A", "NA",
+        "NULL", "NaN", "None", "n/a", "nan", "null"
+    };
+
+    /**
+     * The number of chunks per thread the file that stores the instances is split into.
+     */
+    const uint32 CHUNKS_PER_THREAD = 4;
+
+    /**
+     * Stores the instances that have been parsed from a contiguous range of lines in a CSV file.
+     */
+    struct Chunk {
+
+        /**
+         * A pointer to the first character of the range.
+         */
+        const char* begin;
+
+        /**
+         * A pointer to the character past the last character of the range.
+         */
+        const char* end;
+
+        /**
+         * The number of instances in the range.
+         */
+        uint32 numRows;
+
+        /**
+         * The years of the instances.
+         */
+        std::vector<uint32> years;
+
+        /**
+         * The weeks of the instances.
+         */
+        std::vector<uint32> weeks;
+
+        /**
+         * Whether the year and week of the individual instances could be parsed or not.
+         */
+        std::vector<uint8> valid;
+
+        /**
+         * The feature values of the instances in row-major order. The values of nominal features are represented by
+         * the indices of the values in `dictionaries`.
+         */
+        std::vector<float32> values;
+
+        /**
+         * Whether the individual features contain values that cannot be parsed as numbers or not.
+         */
+        std::vector<uint8> nonNumeric;
+
+        /**
+         * The values of each nominal feature in the order of their first occurrence within the range.
+         */
+        std::vector<std::vector<std::string>> dictionaries;
+
+    };
+
+    /**
+     * Provides read-only access to the content of a file that is mapped into memory, rather than copying it.
+     */
+    class MappedFile final {
+
+        private:
+
+            void* data_;
+
+            size_t size_;
+
+            const char* begin_;
+
+            const char* end_;
+
+        public:
+
+            MappedFile()
+                : data_(nullptr), size_(0), begin_(nullptr), end_(nullptr) {
+
+            }
+
+            ~MappedFile() {
+                if (data_ != nullptr) {
+                    munmap(data_, size_);
+                }
+            }
+
+            MappedFile(const MappedFile&) = delete;
+
+            MappedFile& operator=(const MappedFile&) = delete;
+
+            /**
+             * Maps a file into memory.
+             *
+             * @param path  The path of the file
+             * @return      True, if the file has been mapped successfully, false otherwise
+             */
+            bool open(const std::string& path) {
+                int fileDescriptor = ::open(path.c_str(), O_RDONLY);
+
+                if (fileDescriptor < 0) {
+                    return false;
+                }
+
+                struct stat fileStatus;
+                bool success = fstat(fileDescriptor, &fileStatus) == 0;
+
+                // Empty files cannot be mapped into memory...
+                if (success && fileStatus.st_size > 0) {
+                    size_t size = (size_t) fileStatus.st_size;
+                    void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+                    if (data != MAP_FAILED) {
+                        madvise(data, size, MADV_SEQUENTIAL);
+                        data_ = data;
+                        size_ = size;
+                        begin_ = static_cast<const char*>(data);
+                        end_ = begin_ + size;
+
+                        // A byte order mark at the beginning of the file is ignored...
+                        if (size >= 3 && std::memcmp(begin_, "\xEF\xBB\xBF", 3) == 0) {
+                            begin_ += 3;
+                        }
+                    } else {
+                        success = false;
+                    }
+                }
+
+                close(fileDescriptor);
+                return success;
+            }
+
+            /**
+             * Returns a pointer to the first character of the file.
+             *
+             * @return A pointer to the first character
+             */
+            const char* begin() const {
+                return begin_;
+            }
+
+            /**
+             * Returns a pointer to the end of the file.
+             *
+             * @return A pointer to the end
+             */
+            const char* end() const {
+                return end_;
+            }
+
+    };
+
+    /**
+     * Returns a pointer to the beginning of the record that follows the record at a specific position. Unlike line
+     * breaks that are enclosed in double quotes, which are part of a field, line breaks outside of double quotes
+     * terminate a record.
+     *
+     * @param position  A pointer to a position within the record
+     * @param end       A pointer to the end of the text
+     * @param quoted    True, if the given position is enclosed in double quotes, false otherwise
+     * @return          A pointer to the beginning of the next record or `end`, if there is no such record
+     */
+    static inline const char* findNextRecord(const char* position, const char* end, bool quoted) {
+        while (position < end) {
+            if (quoted) {
+                const char* quote = static_cast<const char*>(std::memchr(position, '"', end - position));
+
+                if (quote == nullptr) {
+                    return end;
+                }
+
+                position = quote + 1;
+                quoted = false;
+            } else {
+                const char* lineEnd = static_cast<const char*>(std::memchr(position, '\n', end - position));
+                const char* searchEnd = lineEnd != nullptr ? lineEnd : end;
+                const char* quote = static_cast<const char*>(std::memchr(position, '"', searchEnd - position));
+
+                if (quote == nullptr) {
+                    return lineEnd != nullptr ? lineEnd + 1 : end;
+                }
+
+                position = quote + 1;
+                quoted = true;
+            }
+        }
+
+        return end;
+    }
+
+    /**
+     * Returns a pointer to the end of the record that starts at a specific position, excluding the trailing line break.
+     * A record may span several lines, if line breaks are enclosed in double quotes.
+     *
+     * @param begin     A pointer to the first character of the record
+     * @param end       A pointer to the end of the text
+     * @param next      A reference to a pointer, the position of the next record should be written to
+     * @return          A pointer to the end of the record
+     */
+    static inline const char* findLineEnd(const char* begin, const char* end, const char*& next) {
+        next = findNextRecord(begin, end, false);
+        const char* lineEnd = next;
+
+        if (lineEnd > begin && *(lineEnd - 1) == '\n') {
+            lineEnd--;
+        }
+
+        if (lineEnd > begin && *(lineEnd - 1) == '\r') {
+            lineEnd--;
+        }
+
+        return lineEnd;
+    }
+
+    /**
+     * Splits a line of a CSV file into its fields. Fields may be enclosed in double quotes, in which case two
+     * consecutive double quotes are interpreted as a single one.
+     *
+     * @param begin     A pointer to the first character of the line
+     * @param end       A pointer to the end of the line
+     * @param fields    A reference to an object of type `std::vector`, the fields should be written to
+     * @return          The number of fields
+     */
+    static inline uint32 splitLine(const char* begin, const char* end, std::vector<std::string>& fields) {
+        uint32 numFields = 0;
+        const char* position = begin;
+
+        while (true) {
+            if (numFields >= fields.size()) {
+                fields.emplace_back();
+            }
+
+            std::string& field = fields[numFields];
+            field.clear();
+            numFields++;
+            bool quoted = false;
+
+            while (position < end) {
+                char c = *position;
+
+                if (quoted) {
+                    if (c == '"') {
+                        if (position + 1 < end && position[1] == '"') {
+                            field.push_back('"');
+                            position++;
+                        } else {
+                            quoted = false;
+                        }
+                    } else {
+                        field.push_back(c);
+                    }
+                } else if (c == '"') {
+                    quoted = true;
+                } else if (c == ',') {
+                    break;
+                } else {
+                    field.push_back(c);
+                }
+
+                position++;
+            }
+
+            if (position >= end) {
+                return numFields;
+            }
+
+            position++;
+        }
+    }
+
+    /**
+     * Returns whether a field represents a missing value or not.
+     *
+     * @param field A reference to an object of type `std::string` that stores the field
+     * @return      True, if the field represents a missing value, false otherwise
+     */
+    static inline bool isMissing(const std::string& field) {
+        for (const char* naValue : NA_VALUES) {
+            if (field == naValue) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * Parses a number from a field.
+     *
+     * @param field A reference to an object of type `std::string` that stores the field
+     * @param value A reference to a value of type `float64`, the number should be written to
+     * @return      True, if the field has been parsed successfully, false otherwise
+     */
+    static inline bool parseNumber(const std::string& field, float64& value) {
+        const char* begin = field.c_str();
+        char* end;
+        value = std::strtod(begin, &end);
+        return end != begin && *end == '\0';
+    }
+
+    /**
+     * Parses a non-negative integer from a part of a field.
+     *
+     * @param begin A pointer to the first character of the integer
+     * @param end   A pointer to the end of the integer
+     * @param value A reference to a value of type `uint32`, the integer should be written to
+     * @return      True, if the integer has been parsed successfully, false otherwise
+     */
+    static inline bool parseInteger(const char* begin, const char* end, uint32& value) {
+        uint64 result = 0;
+
+        if (begin >= end) {
+            return false;
+        }
+
+        for (const char* position = begin; position < end; position++) {
+            char c = *position;
+
+            if (c < '0' || c > '9') {
+                return false;
+            }
+
+            result = (result * 10) + (c - '0');
+
+            if (result > std::numeric_limits<uint32>::max()) {
+                return false;
+            }
+        }
+
+        value = (uint32) result;
+        return true;
+    }
+
+    /**
+     * Parses the year and week from a field in the format `<year>-<week>`.
+     *
+     * @param field A reference to an object of type `std::string` that stores the field
+     * @param year  A reference to a value of type `uint32`, the year should be written to
+     * @param week  A reference to a value of type `uint32`, the week should be written to
+     * @return      True, if the field has been parsed successfully, false otherwise
+     */
+    static inline bool parseYearAndWeek(const std::string& field, uint32& year, uint32& week) {
+        const char* begin = field.c_str();
+        const char* end = begin + field.size();
+        const char* separator = static_cast<const char*>(std::memchr(begin, '-', field.size()));
+        return separator != nullptr && parseInteger(begin, separator, year) && parseInteger(separator + 1, end, week);
+    }
+
+    /**
+     * Returns a key that uniquely identifies a combination of a year and week.
+     *
+     * @param year  The year
+     * @param week  The week
+     * @return      The key
+     */
+    static inline uint64 getKey(uint32 year, uint32 week) {
+        return (((uint64) year) << 32) | week;
+    }
+
+    /**
+     * Returns the index of the column with a specific name.
+     *
+     * @param header    A reference to an object of type `std::vector` that stores the names of all columns
+     * @param numCols   The number of columns
+     * @param name      The name of the column
+     * @return          The index of the column or -1, if no such column is available
+     */
+    static inline intp findColumn(const std::vector<std::string>& header, uint32 numCols, const std::string& name) {
+        for (uint32 i = 0; i < numCols; i++) {
+            if (header[i] == name) {
+                return i;
+            }
+        }
+
+        return -1;
+    }
+
+    /**
+     * Parses the header of a CSV file and determines the indices of specific columns.
+     *
+     * @param file          A reference to an object of type `MappedFile` that provides access to the content of the file
+     * @param path          The path of the file
+     * @param names         A reference to an object of type `std::vector` that stores the names of the columns
+     * @param columnIndices A reference to an object of type `std::vector`, the indices of the columns should be written
+     *                      to
+     * @param bodyBegin     A reference to a pointer, the position of the first line after the header should be written
+     *                      to
+     * @param error         A reference to an object of type `std::string`, a description of the error should be written
+     *                      to, if a column is not available
+     * @return              True, if all columns are available, false otherwise
+     */
+    static inline bool parseHeader(const MappedFile& file, const std::string& path,
+                                   const std::vector<std::string>& names, std::vector<uint32>& columnIndices,
+                                   const char*& bodyBegin, std::string& error) {
+        const char* begin = file.begin();
+        const char* end = file.end();
+        const char* lineEnd = findLineEnd(begin, end, bodyBegin);
+        std::vector<std::string> header;
+        uint32 numCols = splitLine(begin, lineEnd, header);
+
+        for (auto it = names.cbegin(); it != names.cend(); it++) {
+            const std::string& name = *it;
+            intp columnIndex = findColumn(header, numCols, name);
+
+            if (columnIndex < 0) {
+                error = "Column '" + name + "' missing from file '" + path + "'";
+                return false;
+            }
+
+            columnIndices.push_back((uint32) columnIndex);
+        }
+
+        return true;
+    }
+
+    /**
+     * Reads the number of cases in each week from a CSV file.
+     *
+     * @param path      The path of the file
+     * @param counts    A reference to an object of type `std::unordered_map`, the number of cases in each week should
+     *                  be written to
+     * @param error     A reference to an object of type `std::string`, a description of the error should be written
+     *                  to, if the file cannot be read
+     * @return          True, if the file has been read successfully, false otherwise
+     */
+    static inline bool readCounts(const std::string& path, std::unordered_map<uint64, uint32>& counts,
+                                  std::string& error) {
+        MappedFile file;
+
+        if (!file.open(path)) {
+            error = "Unable to read file '" + path + "'";
+            return false;
+        }
+
+        std::vector<std::string> names = { COLUMN_YEAR, COLUMN_WEEK, COLUMN_CASES };
+        std::vector<uint32> columnIndices;
+        const char* position;
+
+        if (!parseHeader(file, path, names, columnIndices, position, error)) {
+            return false;
+        }
+
+        const char* end = file.end();
+        std::vector<std::string> fields;
+        uint32 numFields = 0;
+
+        while (position < end) {
+            const char* lineBegin = position;
+            const char* lineEnd = findLineEnd(lineBegin, end, position);
+
+            if (lineEnd > lineBegin) {
+                numFields = splitLine(lineBegin, lineEnd, fields);
+                uint32 values[3];
+
+                for (uint32 i = 0; i < 3; i++) {
+                    uint32 columnIndex = columnIndices[i];
+                    float64 value;
+
+                    if (columnIndex >= numFields || !parseNumber(fields[columnIndex], value) || !(value >= 0)
+                        || value > std::numeric_limits<uint32>::max()) {
+                        error = "Invalid value in column '" + names[i] + "' of file '" + path + "'";
+                        return false;
+                    }
+
+                    values[i] = (uint32) value;
+                }
+
+                counts[getKey(values[0], values[1])] = values[2];
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * Splits the body of a CSV file into chunks that consist of complete records. To make sure that records that span
+     * several lines are not split, the double quotes in front of each chunk boundary are taken into account.
+     *
+     * @param begin     A pointer to the first line of the body
+     * @param end       A pointer to the end of the body
+     * @param numChunks The maximum number of chunks
+     * @param chunks    A reference to an object of type `std::vector`, the chunks should be written to
+     */
+    static inline void splitIntoChunks(const char* begin, const char* end, uint32 numChunks,
+                                       std::vector<Chunk>& chunks) {
+        uint64 chunkSize = ((end - begin) / numChunks) + 1;
+        const char* position = begin;
+
+        while (position < end) {
+            const char* chunkEnd = position + std::min<uint64>(chunkSize, end - position);
+
+            if (chunkEnd < end) {
+                // As the chunk starts at the beginning of a record, an odd number of double quotes indicates that the
+                // tentative end of the chunk is enclosed in double quotes...
+                bool quoted = false;
+                const char* quote = position;
+
+                while ((quote = static_cast<const char*>(std::memchr(quote, '"', chunkEnd - quote))) != nullptr) {
+                    quoted = !quoted;
+                    quote++;
+                }
+
+                chunkEnd = findNextRecord(chunkEnd, end, quoted);
+            }
+
+            Chunk chunk;
+            chunk.begin = position;
+            chunk.end = chunkEnd;
+            chunk.numRows = 0;
+            chunks.push_back(std::move(chunk));
+            position = chunkEnd;
+        }
+    }
+
+    /**
+     * Parses the instances in a chunk. Feature values that cannot be parsed as numbers are represented by NaN and the
+     * corresponding features are marked as non-numeric.
+     *
+     * @param chunk         A reference to an object of type `Chunk` that stores the chunk
+     * @param columnIndices A reference to an object of type `std::vector` that stores the indices of the columns that
+     *                      correspond to the features, followed by the index of the column that stores the week
+     */
+    static inline void parseChunk(Chunk& chunk, const std::vector<uint32>& columnIndices) {
+        uint32 numFeatures = columnIndices.size() - 1;
+        uint32 weekColumnIndex = columnIndices[numFeatures];
+        chunk.nonNumeric.resize(numFeatures, 0);
+        std::vector<std::string> fields;
+        const char* position = chunk.begin;
+
+        while (position < chunk.end) {
+            const char* lineBegin = position;
+            const char* lineEnd = findLineEnd(lineBegin, chunk.end, position);
+
+            // Empty lines are ignored...
+            if (lineEnd > lineBegin) {
+                uint32 numFields = splitLine(lineBegin, lineEnd, fields);
+                uint32 year = 0;
+                uint32 week = 0;
+                bool valid = weekColumnIndex < numFields && parseYearAndWeek(fields[weekColumnIndex], year, week);
+                chunk.years.push_back(year);
+                chunk.weeks.push_back(week);
+                chunk.valid.push_back(valid ? 1 : 0);
+
+                for (uint32 i = 0; i < numFeatures; i++) {
+                    uint32 columnIndex = columnIndices[i];
+                    float32 value = NAN;
+
+                    if (columnIndex < numFields && !isMissing(fields[columnIndex])) {
+                        float64 number;
+
+                        if (parseNumber(fields[columnIndex], number)) {
+                            value = (float32) number;
+                        } else {
+                            chunk.nonNumeric[i] = 1;
+                        }
+                    }
+
+                    chunk.values.push_back(value);
+                }
+
+                chunk.numRows++;
+            }
+        }
+    }
+
+    /**
+     * Encodes the values of nominal features in a chunk by the indices of the values in the order of their first
+     * occurrence within the chunk.
+     *
+     * @param chunk         A reference to an object of type `Chunk` that stores the chunk
+     * @param columnIndices A reference to an object of type `std::vector` that stores the indices of the columns that
+     *                      correspond to the features, followed by the index of the column that stores the week
+     * @param nominal       A reference to an object of type `std::vector` that specifies whether the individual
+     *                      features are nominal or not
+     */
+    static inline void encodeChunk(Chunk& chunk, const std::vector<uint32>& columnIndices,
+                                   const std::vector<uint8>& nominal) {
+        uint32 numFeatures = columnIndices.size() - 1;
+        std::vector<std::unordered_map<std::string, uint32>> codes(numFeatures);
+        chunk.dictionaries.resize(numFeatures);
+        std::vector<std::string> fields;
+        const char* position = chunk.begin;
+        uint32 r = 0;
+
+        while (position < chunk.end) {
+            const char* lineBegin = position;
+            const char* lineEnd = findLineEnd(lineBegin, chunk.end, position);
+
+            if (lineEnd > lineBegin) {
+                uint32 numFields = splitLine(lineBegin, lineEnd, fields);
+                float32* values = &chunk.values[(uint64) r * numFeatures];
+
+                for (uint32 i = 0; i < numFeatures; i++) {
+                    uint32 columnIndex = columnIndices[i];
+
+                    if (nominal[i] && columnIndex < numFields && !isMissing(fields[columnIndex])) {
+                        std::string& field = fields[columnIndex];
+                        auto result = codes[i].emplace(field, (uint32) codes[i].size());
+
+                        if (result.second) {
+                            chunk.dictionaries[i].push_back(field);
+                        }
+
+                        values[i] = (float32) result.first->second;
+                    }
+                }
+
+                r++;
+            }
+        }
+    }
+
+    TimeSeries::TimeSeries(uint32 numRows, uint32 numCols)
+        : numRows_(numRows), numCols_(numCols), featureValues_((uint64) numRows * numCols), labels_((uint64) numRows * 2),
+          years_(numRows), weeks_(numRows), nominalValues_(numCols), nominal_(numCols, false) {
+
+    }
+
+    uint32 TimeSeries::getNumRows() const {
+        return numRows_;
+    }
+
+    uint32 TimeSeries::getNumCols() const {
+        return numCols_;
+    }
+
+    float32* TimeSeries::getFeatureValues() {
+        return featureValues_.data();
+    }
+
+    uint32* TimeSeries::getLabels() {
+        return labels_.data();
+    }
+
+    uint32* TimeSeries::getYears() {
+        return years_.data();
+    }
+
+    uint32* TimeSeries::getWeeks() {
+        return weeks_.data();
+    }
+
+    bool TimeSeries::isNominal(uint32 featureIndex) const {
+        return nominal_[featureIndex];
+    }
+
+    void TimeSeries::setNominal(uint32 featureIndex, std::vector<std::string>&& values) {
+        nominal_[featureIndex] = true;
+        nominalValues_[featureIndex] = std::move(values);
+    }
+
+    const std::vector<std::string>& TimeSeries::getNominalValues(uint32 featureIndex) const {
+        return nominalValues_[featureIndex];
+    }
+
+    CsvTimeSeriesReader::CsvTimeSeriesReader(uint32 numThreads)
+        : numThreads_(numThreads) {
+
+    }
+
+    std::unique_ptr<TimeSeries> CsvTimeSeriesReader::read(const std::string& instanceFile,
+                                                          const std::string& countFile,
+                                                          const std::vector<std::string>& featureNames,
+                                                          std::string& error) const {
+        std::unordered_map<uint64, uint32> counts;
+
+        if (!readCounts(countFile, counts, error)) {
+            return nullptr;
+        }
+
+        MappedFile file;
+
+        if (!file.open(instanceFile)) {
+            error = "Unable to read file '" + instanceFile + "'";
+            return nullptr;
+        }
+
+        std::vector<std::string> names = featureNames;
+        names.push_back(COLUMN_WEEK);
+        std::vector<uint32> columnIndices;
+        const char* bodyBegin;
+
+        if (!parseHeader(file, instanceFile, names, columnIndices, bodyBegin, error)) {
+            return nullptr;
+        }
+
+        uint32 numThreads = numThreads_;
+        std::vector<Chunk> chunks;
+        splitIntoChunks(bodyBegin, file.end(), numThreads * CHUNKS_PER_THREAD, chunks);
+        uint32 numChunks = chunks.size();
+        uint32 numFeatures = featureNames.size();
+        std::vector<Chunk>* chunksPtr = &chunks;
+        const std::vector<uint32>* columnIndicesPtr = &columnIndices;
+
+        #pragma omp parallel for firstprivate(numChunks) firstprivate(chunksPtr) firstprivate(columnIndicesPtr) \
+        schedule(dynamic) num_threads(numThreads)
+        for (intp i = 0; i < numChunks; i++) {
+            parseChunk((*chunksPtr)[i], *columnIndicesPtr);
+        }
+
+        // Features that contain values that cannot be parsed as numbers are considered to be nominal...
+        std::vector<uint8> nominal(numFeatures, 0);
+        bool anyNominal = false;
+
+        for (uint32 i = 0; i < numChunks; i++) {
+            for (uint32 j = 0; j < numFeatures; j++) {
+                if (chunks[i].nonNumeric[j]) {
+                    nominal[j] = 1;
+                    anyNominal = true;
+                }
+            }
+        }
+
+        if (anyNominal) {
+            const std::vector<uint8>* nominalPtr = &nominal;
+
+            #pragma omp parallel for firstprivate(numChunks) firstprivate(chunksPtr) firstprivate(columnIndicesPtr) \
+            firstprivate(nominalPtr) schedule(dynamic) num_threads(numThreads)
+            for (intp i = 0; i < numChunks; i++) {
+                encodeChunk((*chunksPtr)[i], *columnIndicesPtr, *nominalPtr);
+            }
+        }
+
+        // Instances of weeks with an unknown number of cases are ignored...
+        std::vector<std::pair<uint32, uint32>> rows;
+        std::vector<uint32> cases;
+
+        for (uint32 i = 0; i < numChunks; i++) {
+            const Chunk& chunk = chunks[i];
+
+            for (uint32 r = 0; r < chunk.numRows; r++) {
+                if (chunk.valid[r]) {
+                    auto it = counts.find(getKey(chunk.years[r], chunk.weeks[r]));
+
+                    if (it != counts.end()) {
+                        rows.emplace_back(i, r);
+                        cases.push_back(it->second);
+                    }
+                }
+            }
+        }
+
+        if (rows.size() > std::numeric_limits<uint32>::max()
+            || (uint64) rows.size() * numFeatures > std::numeric_limits<uint32>::max()) {
+            error = "Data set is too large";
+            return nullptr;
+        }
+
+        // Sort chronologically...
+        uint32 numRows = (uint32) rows.size();
+        std::vector<uint32> order(numRows);
+
+        for (uint32 i = 0; i < numRows; i++) {
+            order[i] = i;
+        }
+
+        std::stable_sort(order.begin(), order.end(), [&](uint32 a, uint32 b) {
+            const Chunk& chunkA = chunks[rows[a].first];
+            const Chunk& chunkB = chunks[rows[b].first];
+            uint32 rowA = rows[a].second;
+            uint32 rowB = rows[b].second;
+            return getKey(chunkA.years[rowA], chunkA.weeks[rowA]) < getKey(chunkB.years[rowB], chunkB.weeks[rowB]);
+        });
+
+        std::unique_ptr<TimeSeries> timeSeriesPtr = std::make_unique<TimeSeries>(numRows, numFeatures);
+        float32* featureValues = timeSeriesPtr->getFeatureValues();
+        uint32* labels = timeSeriesPtr->getLabels();
+        uint32* years = timeSeriesPtr->getYears();
+        uint32* weeks = timeSeriesPtr->getWeeks();
+        uint32 timeSlot = 0;
+
+        for (uint32 i = 0; i < numRows; i++) {
+            uint32 index = order[i];
+            const Chunk& chunk = chunks[rows[index].first];
+            uint32 r = rows[index].second;
+            uint32 year = chunk.years[r];
+            uint32 week = chunk.weeks[r];
+
+            // Each distinct combination of year and week is assigned an unique number...
+            if (i == 0 || year != years[i - 1] || week != weeks[i - 1]) {
+                timeSlot++;
+            }
+
+            years[i] = year;
+            weeks[i] = week;
+            labels[(uint64) i * 2] = timeSlot;
+            labels[((uint64) i * 2) + 1] = cases[index];
+            const float32* values = &chunk.values[(uint64) r * numFeatures];
+
+            for (uint32 j = 0; j < numFeatures; j++) {
+                featureValues[((uint64) j * numRows) + i] = values[j];
+            }
+        }
+
+        // The values of nominal features are re-encoded in the order of their first occurrence after sorting...
+        for (uint32 j = 0; j < numFeatures; j++) {
+            if (nominal[j]) {
+                std::vector<std::vector<intp>> mappings(numChunks);
+                std::unordered_map<std::string, uint32> codes;
+                std::vector<std::string> values;
+
+                for (uint32 i = 0; i < numChunks; i++) {
+                    mappings[i].resize(chunks[i].dictionaries[j].size(), -1);
+                }
+
+                for (uint32 i = 0; i < numRows; i++) {
+                    float32& value = featureValues[((uint64) j * numRows) + i];
+
+                    if (!std::isnan(value)) {
+                        uint32 chunkIndex = rows[order[i]].first;
+                        uint32 localCode = (uint32) value;
+                        intp& code = mappings[chunkIndex][localCode];
+
+                        if (code < 0) {
+                            const std::string& nominalValue = chunks[chunkIndex].dictionaries[j][localCode];
+                            auto result = codes.emplace(nominalValue, (uint32) values.size());
+
+                            if (result.second) {
+                                values.push_back(nominalValue);
+                            }
+
+                            code = result.first->second;
+                        }
+
+                        value = (float32) code;
+                    }
+                }
+
+                timeSeriesPtr->setNominal(j, std::move(values));
+            }
+        }
+
+        return timeSeriesPtr;
+    }
+
+}
@@ -34,36 +34,8 @@ namespace tsa {
                 }
             }
 
-            const ILabelWiseScoreVector& calculateLabelWisePrediction(
-                    const DenseVector<uint32>& predictions, const CContiguousLabelMatrix& groundTruth) override {
-                uint32 numTimeSlots = predictions.getNumElements();
-                CContiguousLabelMatrix::value_const_iterator groundTruthIterator = groundTruth.values_cbegin();
-                DenseVector<uint32>::const_iterator predictionIterator = predictions.cbegin();
-                float64 xSum = 0;
-                float64 xSquaredSum = 0;
-                float64 ySum = 0;
-                float64 ySquaredSum = 0;
-                float64 productSum = 0;
-
-                for (uint32 i = 0; i < numTimeSlots; i++) {
-                    float64 x = (float64) groundTruthIterator[i];
-                    float64 y = (float64) predictionIterator[i];
-                    xSum += x;
-                    xSquaredSum += std::pow(x, 2);
-                    ySum += y;
-                    ySquaredSum += std::pow(y, 2);
-                    float64 product = x * y;
-                    productSum += product;
-                }
-
-                float64 n = (float64) numTimeSlots;
-                float64 numerator = (n * productSum) - (xSum * ySum);
-                float64 sqrt1 = std::sqrt((n * xSquaredSum) - std::pow(xSum, 2));
-                float64 sqrt2 = std::sqrt((n * ySquaredSum) - std::pow(ySum, 2));
-                float64 denominator = sqrt1 * sqrt2;
-
-                scoreVector_.overallQualityScore = -std::abs(numerator / denominator);
-
+            ILabelWiseScoreVector& calculateLabelWisePrediction(const CorrelationMoments& moments) override {
+                scoreVector_.overallQualityScore = -std::abs(pearsonCorrelation(moments));
                 return scoreVector_;
             }
 
@@ -1,6 +1,7 @@
 #include "tsa/statistics/statistics_label_wise.hpp"
 #include "common/statistics/statistics_subset_decomposable.hpp"
 #include "common/data/arrays.hpp"
+#include "tsa/math/correlation.hpp"
 
 
 namespace tsa {
@@ -10,8 +11,9 @@ namespace tsa {
      * applied label-wise and allows to update the gradients and Hessians after a new rule has been learned.
      *
      * @tparam LabelMatrix      The type of the matrix that provides access to the labels of the training examples
+     * @tparam TimeSlot         The type of the indices of the time slots the training examples belong to
      */
-    template<class LabelMatrix>
+    template<class LabelMatrix, typename TimeSlot>
     class LabelWiseStatistics final : virtual public ILabelWiseStatistics {
 
         private:
@@ -30,6 +32,10 @@ namespace tsa {
 
                     const LabelWiseStatistics& statistics_;
 
+                    const DenseVector<uint32>& totalPredictionVector_;
+
+                    const CorrelationMoments& totalPredictionMoments_;
+
                     std::unique_ptr<ILabelWiseRuleEvaluation> ruleEvaluationPtr_;
 
                     const T& labelIndices_;
@@ -42,25 +48,77 @@ namespace tsa {
 
                     DenseVector<uint32>* accumulatedUncoveredPredictionVector_;
 
+                    CorrelationMoments coveredMoments_;
+
+                    CorrelationMoments uncoveredMoments_;
+
+                    CorrelationMoments accumulatedCoveredMoments_;
+
+                    CorrelationMoments accumulatedUncoveredMoments_;
+
+                    float64 qualityOffset_;
+
+                    void updatePrediction(DenseVector<uint32>& predictionVector, CorrelationMoments& moments,
+                                          uint32 timeSlot, bool remove) {
+                        if (statistics_.sampledTimeSlotVector_[timeSlot]) {
+                            uint32 groundTruth = statistics_.labelMatrix_.values_cbegin()[timeSlot];
+                            updateCorrelationMoments(moments, groundTruth, predictionVector[timeSlot], remove);
+                        }
+
+                        if (remove) {
+                            predictionVector[timeSlot] -= 1;
+                        } else {
+                            predictionVector[timeSlot] += 1;
+                        }
+                    }
+
                 public:
 
                     /**
-                     * @param statistics        A reference to an object of type `LabelWiseStatistics` that
-                     *                          stores the gradients and Hessians
-                     * @param ruleEvaluationPtr An unique pointer to an object of type `ILabelWiseRuleEvaluation` that
-                     *                          should be used to calculate the predictions, as well as corresponding
-                     *                          quality scores, of rules
-                     * @param labelIndices      A reference to an object of template type `T` that provides access to
-                     *                          the indices of the labels that are included in the subset
+                     * @param statistics                A reference to an object of type `LabelWiseStatistics` that
+                     *                                  stores the gradients and Hessians
+                     * @param totalPredictionVector     A reference to an object of type `DenseVector` that stores the
+                     *                                  predictions for each time slot, if the examples that are
+                     *                                  currently covered were covered by the current model
+                     * @param totalPredictionMoments    A reference to an object of type `CorrelationMoments` that
+                     *                                  stores the sums that are needed to calculate the correlation of
+                     *                                  the predictions in `totalPredictionVector`
+                     * @param ruleEvaluationPtr         An unique pointer to an object of type
+                     *                                  `ILabelWiseRuleEvaluation` that should be used to calculate the
+                     *                                  predictions, as well as corresponding quality scores, of rules
+                     * @param labelIndices              A reference to an object of template type `T` that provides
+                     *                                  access to the indices of the labels that are included in the
+                     *                                  subset
                      */
                     StatisticsSubset(const LabelWiseStatistics& statistics,
+                                     const DenseVector<uint32>& totalPredictionVector,
+                                     const CorrelationMoments& totalPredictionMoments,
                                      std::unique_ptr<ILabelWiseRuleEvaluation> ruleEvaluationPtr, const T& labelIndices)
-                        : statistics_(statistics), ruleEvaluationPtr_(std::move(ruleEvaluationPtr)),
-                          labelIndices_(labelIndices),
+                        : statistics_(statistics), totalPredictionVector_(totalPredictionVector),
+                          totalPredictionMoments_(totalPredictionMoments),
+                          ruleEvaluationPtr_(std::move(ruleEvaluationPtr)), labelIndices_(labelIndices),
                           coveredPredictionVector_(DenseVector<uint32>(statistics.predictionVector_)),
-                          uncoveredPredictionVector_(DenseVector<uint32>(statistics.totalPredictionVector_)),
-                          accumulatedCoveredPredictionVector_(nullptr), accumulatedUncoveredPredictionVector_(nullptr) {
-
+                          uncoveredPredictionVector_(DenseVector<uint32>(totalPredictionVector)),
+                          accumulatedCoveredPredictionVector_(nullptr), accumulatedUncoveredPredictionVector_(nullptr),
+                          coveredMoments_(statistics.predictionMoments_), uncoveredMoments_(totalPredictionMoments),
+                          qualityOffset_(0) {
+                        // If only a subset of the time slots has been sampled, the quality scores are calculated with
+                        // respect to the sampled time slots. To be able to compare them to the quality of the current
+                        // model, they are shifted by the difference between the quality of the current model on all
+                        // training time slots and on the sampled ones. As long as the model's predictions are
+                        // constant, the correlation is undefined and no shift is applied...
+                        if (statistics.predictionMoments_.numElements
+                                < statistics.trainingPredictionMoments_.numElements) {
+                            float64 trainingQuality = ruleEvaluationPtr_->calculateLabelWisePrediction(
+                                statistics.trainingPredictionMoments_).overallQualityScore;
+                            float64 sampledQuality = ruleEvaluationPtr_->calculateLabelWisePrediction(
+                                statistics.predictionMoments_).overallQualityScore;
+                            float64 qualityOffset = trainingQuality - sampledQuality;
+
+                            if (!std::isnan(qualityOffset)) {
+                                qualityOffset_ = qualityOffset;
+                            }
+                        }
                     }
 
                     ~StatisticsSubset() {
@@ -70,20 +128,22 @@ namespace tsa {
 
                     void addToMissing(uint32 statisticIndex, float64 weight) override {
                         if (statistics_.coverageCountVector_[statisticIndex] == 0) {
-                            uint32 timeSlot = statistics_.labelMatrix_.time_slots_cbegin()[statisticIndex];
-                            uncoveredPredictionVector_[timeSlot] -= 1;
+                            uint32 timeSlot = statistics_.timeSlots_[statisticIndex];
+                            updatePrediction(uncoveredPredictionVector_, uncoveredMoments_, timeSlot, true);
                         }
                     }
 
                     void addToSubset(uint32 statisticIndex, float64 weight) override {
                         if (statistics_.coverageCountVector_[statisticIndex] == 0) {
-                            uint32 timeSlot = statistics_.labelMatrix_.time_slots_cbegin()[statisticIndex];
-                            coveredPredictionVector_[timeSlot] += 1;
-                            uncoveredPredictionVector_[timeSlot] -= 1;
+                            uint32 timeSlot = statistics_.timeSlots_[statisticIndex];
+                            updatePrediction(coveredPredictionVector_, coveredMoments_, timeSlot, false);
+                            updatePrediction(uncoveredPredictionVector_, uncoveredMoments_, timeSlot, true);
 
                             if (accumulatedCoveredPredictionVector_ != nullptr) {
-                                (*accumulatedCoveredPredictionVector_)[timeSlot] += 1;
-                                (*accumulatedUncoveredPredictionVector_)[timeSlot] -= 1;
+                                updatePrediction(*accumulatedCoveredPredictionVector_, accumulatedCoveredMoments_,
+                                                 timeSlot, false);
+                                updatePrediction(*accumulatedUncoveredPredictionVector_, accumulatedUncoveredMoments_,
+                                                 timeSlot, true);
                             }
                         }
                     }
@@ -92,20 +152,26 @@ namespace tsa {
                         if (accumulatedCoveredPredictionVector_ == nullptr) {
                             accumulatedCoveredPredictionVector_ = new DenseVector<uint32>(coveredPredictionVector_);
                             accumulatedUncoveredPredictionVector_ = new DenseVector<uint32>(uncoveredPredictionVector_);
+                            accumulatedCoveredMoments_ = coveredMoments_;
+                            accumulatedUncoveredMoments_ = uncoveredMoments_;
                         }
 
                         copyArray(statistics_.predictionVector_.cbegin(), coveredPredictionVector_.begin(),
                                   coveredPredictionVector_.getNumElements());
-                        copyArray(statistics_.totalPredictionVector_.cbegin(), uncoveredPredictionVector_.begin(),
+                        copyArray(totalPredictionVector_.cbegin(), uncoveredPredictionVector_.begin(),
                                   uncoveredPredictionVector_.getNumElements());
+                        coveredMoments_ = statistics_.predictionMoments_;
+                        uncoveredMoments_ = totalPredictionMoments_;
                     }
 
                     const ILabelWiseScoreVector& calculateLabelWisePrediction(bool uncovered,
                                                                               bool accumulated) override {
-                        const DenseVector<uint32>& predictions =
-                            uncovered ? (accumulated ? *accumulatedUncoveredPredictionVector_ : uncoveredPredictionVector_)
-                                      : (accumulated ? *accumulatedCoveredPredictionVector_ : coveredPredictionVector_);
-                        return ruleEvaluationPtr_->calculateLabelWisePrediction(predictions, statistics_.labelMatrix_);
+                        const CorrelationMoments& moments =
+                            uncovered ? (accumulated ? accumulatedUncoveredMoments_ : uncoveredMoments_)
+                                      : (accumulated ? accumulatedCoveredMoments_ : coveredMoments_);
+                        ILabelWiseScoreVector& scoreVector = ruleEvaluationPtr_->calculateLabelWisePrediction(moments);
+                        scoreVector.overallQualityScore += qualityOffset_;
+                        return scoreVector;
                     }
 
             };
@@ -114,6 +180,119 @@ namespace tsa {
 
             typedef StatisticsSubset<PartialIndexVector> PartialSubset;
 
+            /**
+             * Keeps track of the statistics that are covered by a rule independently of an instance of the class
+             * `LabelWiseStatistics`, whose remaining statistics are shared. Only the predictions for each time slot
+             * that take the covered examples into account, as well as the sums that are needed to calculate their
+             * correlation, are copied.
+             */
+            class IsolatedStatistics final : virtual public IStatistics {
+
+                private:
+
+                    LabelWiseStatistics& statistics_;
+
+                    DenseVector<uint32> totalPredictionVector_;
+
+                    CorrelationMoments totalPredictionMoments_;
+
+                public:
+
+                    /**
+                     * @param statistics                A reference to an object of type `LabelWiseStatistics` that
+                     *                                  stores the shared statistics
+                     * @param totalPredictionVector     A reference to an object of type `DenseVector` that stores the
+                     *                                  predictions for each time slot, if the examples that are
+                     *                                  currently covered were covered by the current model, to be
+                     *                                  copied
+                     * @param totalPredictionMoments    A reference to an object of type `CorrelationMoments` that
+                     *                                  stores the sums that are needed to calculate the correlation of
+                     *                                  the predictions in `totalPredictionVector`
+                     */
+                    IsolatedStatistics(LabelWiseStatistics& statistics,
+                                       const DenseVector<uint32>& totalPredictionVector,
+                                       const CorrelationMoments& totalPredictionMoments)
+                        : statistics_(statistics), totalPredictionVector_(DenseVector<uint32>(totalPredictionVector)),
+                          totalPredictionMoments_(totalPredictionMoments) {
+
+                    }
+
+                    uint32 getNumStatistics() const override {
+                        return statistics_.getNumStatistics();
+                    }
+
+                    uint32 getNumLabels() const override {
+                        return statistics_.getNumLabels();
+                    }
+
+                    void resetSampledStatistics() override {
+                        statistics_.resetSampledStatistics();
+                    }
+
+                    void addSampledStatistic(uint32 statisticIndex, float64 weight) override {
+                        statistics_.addSampledStatistic(statisticIndex, weight);
+                    }
+
+                    void resetCoveredStatistics() override {
+                        statistics_.resetCoveredStatisticsInternally(totalPredictionVector_, totalPredictionMoments_);
+                    }
+
+                    void updateCoveredStatistic(uint32 statisticIndex, float64 weight, bool remove) override {
+                        statistics_.updateCoveredStatisticInternally(totalPredictionVector_, totalPredictionMoments_,
+                                                                     statisticIndex, remove);
+                    }
+
+                    void increaseCoverageCount(uint32 statisticIndex) override {
+                        statistics_.increaseCoverageCount(statisticIndex);
+                    }
+
+                    uint32 getCoverageCount(uint32 statisticIndex) const override {
+                        return statistics_.getCoverageCount(statisticIndex);
+                    }
+
+                    void updatePredictions() override {
+                        statistics_.updatePredictions();
+                    }
+
+                    float64 evaluatePredictions() const override {
+                        return statistics_.evaluatePredictions();
+                    }
+
+                    void addHoldoutStatistic(uint32 statisticIndex) override {
+                        statistics_.addHoldoutStatistic(statisticIndex);
+                    }
+
+                    float64 evaluateHoldoutPredictions() const override {
+                        return statistics_.evaluateHoldoutPredictions();
+                    }
+
+                    std::unique_ptr<std::vector<uint32>> getGroundTruth() const override {
+                        return statistics_.getGroundTruth();
+                    }
+
+                    std::unique_ptr<std::vector<uint32>> getPredictions() const override {
+                        return statistics_.getPredictions();
+                    }
+
+                    std::unique_ptr<IStatistics> isolateCoveredStatistics() override {
+                        return std::make_unique<IsolatedStatistics>(statistics_, totalPredictionVector_,
+                                                                    totalPredictionMoments_);
+                    }
+
+                    std::unique_ptr<IStatisticsSubset> createSubset(
+                            const FullIndexVector& labelIndices) const override {
+                        return statistics_.createSubsetInternally(labelIndices, totalPredictionVector_,
+                                                                  totalPredictionMoments_);
+                    }
+
+                    std::unique_ptr<IStatisticsSubset> createSubset(
+                            const PartialIndexVector& labelIndices) const override {
+                        return statistics_.createSubsetInternally(labelIndices, totalPredictionVector_,
+                                                                  totalPredictionMoments_);
+                    }
+
+            };
+
             uint32 numStatistics_;
 
             uint32 numLabels_;
@@ -124,10 +303,61 @@ namespace tsa {
 
             DenseVector<uint32> totalPredictionVector_;
 
+            DenseVector<uint8> sampledTimeSlotVector_;
+
+            DenseVector<uint8> holdoutTimeSlotVector_;
+
+            CorrelationMoments trainingPredictionMoments_;
+
+            CorrelationMoments holdoutPredictionMoments_;
+
+            CorrelationMoments predictionMoments_;
+
+            CorrelationMoments totalPredictionMoments_;
+
             std::shared_ptr<ILabelWiseRuleEvaluationFactory> ruleEvaluationFactoryPtr_;
 
             const LabelMatrix& labelMatrix_;
 
+            const TimeSlot* timeSlots_;
+
+            void resetCoveredStatisticsInternally(DenseVector<uint32>& totalPredictionVector,
+                                                  CorrelationMoments& totalPredictionMoments) const {
+                copyArray(predictionVector_.cbegin(), totalPredictionVector.begin(),
+                          totalPredictionVector.getNumElements());
+                totalPredictionMoments = predictionMoments_;
+            }
+
+            void updateCoveredStatisticInternally(DenseVector<uint32>& totalPredictionVector,
+                                                  CorrelationMoments& totalPredictionMoments, uint32 statisticIndex,
+                                                  bool remove) const {
+                if (coverageCountVector_[statisticIndex] == 0) {
+                    uint32 timeSlot = timeSlots_[statisticIndex];
+
+                    if (sampledTimeSlotVector_[timeSlot]) {
+                        uint32 groundTruth = labelMatrix_.values_cbegin()[timeSlot];
+                        updateCorrelationMoments(totalPredictionMoments, groundTruth, totalPredictionVector[timeSlot],
+                                                 remove);
+                    }
+
+                    if (remove) {
+                        totalPredictionVector[timeSlot] -= 1;
+                    } else {
+                        totalPredictionVector[timeSlot] += 1;
+                    }
+                }
+            }
+
+            template<class T>
+            std::unique_ptr<IStatisticsSubset> createSubsetInternally(
+                    const T& labelIndices, const DenseVector<uint32>& totalPredictionVector,
+                    const CorrelationMoments& totalPredictionMoments) const {
+                std::unique_ptr<ILabelWiseRuleEvaluation> ruleEvaluationPtr =
+                    ruleEvaluationFactoryPtr_->create(labelIndices);
+                return std::make_unique<StatisticsSubset<T>>(*this, totalPredictionVector, totalPredictionMoments,
+                                                             std::move(ruleEvaluationPtr), labelIndices);
+            }
+
         public:
 
             /**
@@ -137,14 +367,38 @@ namespace tsa {
              *                                  rules
              * @param labelMatrix               A reference to an object of template type `LabelMatrix` that provides
              *                                  access to the labels of the training examples
+             * @param timeSlots                 A pointer to an array of template type `TimeSlot`, shape
+             *                                  `(numStatistics)`, that stores the index of the time slot each training
+             *                                  example belongs to
              */
             LabelWiseStatistics(std::shared_ptr<ILabelWiseRuleEvaluationFactory> ruleEvaluationFactoryPtr,
-                                const LabelMatrix& labelMatrix)
+                                const LabelMatrix& labelMatrix, const TimeSlot* timeSlots)
                 : numStatistics_(labelMatrix.getNumRows()), numLabels_(labelMatrix.getNumCols()),
                   coverageCountVector_(DenseVector<uint32>(numStatistics_, true)),
                   predictionVector_(DenseVector<uint32>(labelMatrix.getNumTimeSlots(), true)),
                   totalPredictionVector_(DenseVector<uint32>(labelMatrix.getNumTimeSlots())),
-                  ruleEvaluationFactoryPtr_(ruleEvaluationFactoryPtr), labelMatrix_(labelMatrix) {
+                  sampledTimeSlotVector_(DenseVector<uint8>(labelMatrix.getNumTimeSlots())),
+                  holdoutTimeSlotVector_(DenseVector<uint8>(labelMatrix.getNumTimeSlots(), true)),
+                  ruleEvaluationFactoryPtr_(ruleEvaluationFactoryPtr), labelMatrix_(labelMatrix),
+                  timeSlots_(timeSlots) {
+                setArrayToValue(sampledTimeSlotVector_.begin(), sampledTimeSlotVector_.getNumElements(), (uint8) 1);
+
+                // If the label matrix only includes a subset of the examples, the remaining ones are treated as if they
+                // were already covered. As a result, the predictions of the time slots never account for them...
+                if (labelMatrix.isSubset()) {
+                    typename DenseVector<uint32>::iterator coverageCountIterator = coverageCountVector_.begin();
+                    setArrayToValue<uint32>(coverageCountIterator, numStatistics_, 1);
+
+                    for (auto it = labelMatrix.subset_indices_cbegin(); it != labelMatrix.subset_indices_cend(); it++) {
+                        coverageCountIterator[*it] = 0;
+                    }
+                }
+
+                trainingPredictionMoments_ = calculateCorrelationMoments(labelMatrix.values_cbegin(),
+                                                                         predictionVector_.cbegin(),
+                                                                         predictionVector_.getNumElements());
+                predictionMoments_ = trainingPredictionMoments_;
+                totalPredictionMoments_ = predictionMoments_;
 
             }
 
@@ -162,57 +416,108 @@ namespace tsa {
             }
 
             void resetSampledStatistics() override {
-                // This function is equivalent to the function `resetCoveredStatistics`...
+                // The correlation is only calculated with respect to the time slots that contain at least one sampled
+                // statistic. They are added one after another by the function `addSampledStatistic`...
+                setArrayToZeros(sampledTimeSlotVector_.begin(), sampledTimeSlotVector_.getNumElements());
+                predictionMoments_ = CorrelationMoments();
                 this->resetCoveredStatistics();
             }
 
             void addSampledStatistic(uint32 statisticIndex, float64 weight) override {
-                // This function is equivalent to the function `updateCoveredStatistic`...
+                if (weight > 0) {
+                    uint32 timeSlot = timeSlots_[statisticIndex];
+
+                    if (!sampledTimeSlotVector_[timeSlot] && !holdoutTimeSlotVector_[timeSlot]) {
+                        uint32 groundTruth = labelMatrix_.values_cbegin()[timeSlot];
+                        sampledTimeSlotVector_[timeSlot] = 1;
+                        addToCorrelationMoments(predictionMoments_, groundTruth, predictionVector_[timeSlot]);
+                        addToCorrelationMoments(totalPredictionMoments_, groundTruth, totalPredictionVector_[timeSlot]);
+                    }
+                }
+
+                // Apart from that, this function is equivalent to the function `updateCoveredStatistic`...
                 this->updateCoveredStatistic(statisticIndex, weight, false);
             }
 
             void resetCoveredStatistics() override {
-                copyArray(predictionVector_.cbegin(), totalPredictionVector_.begin(),
-                          totalPredictionVector_.getNumElements());
+                resetCoveredStatisticsInternally(totalPredictionVector_, totalPredictionMoments_);
             }
 
             void updateCoveredStatistic(uint32 statisticIndex, float64 weight, bool remove) override {
-                if (coverageCountVector_[statisticIndex] == 0) {
-                    uint32 timeSlot = labelMatrix_.time_slots_cbegin()[statisticIndex];
+                updateCoveredStatisticInternally(totalPredictionVector_, totalPredictionMoments_, statisticIndex,
+                                                 remove);
+            }
 
-                    if (remove) {
-                        totalPredictionVector_[timeSlot] -= 1;
+            void increaseCoverageCount(uint32 statisticIndex) override {
+                uint32 coverageCount = coverageCountVector_[statisticIndex];
+                coverageCountVector_[statisticIndex] = coverageCount + 1;
+
+                // The prediction for a time slot corresponds to the number of covered examples it contains. Hence, it
+                // does only change if an example is covered for the first time. In such case, the sums that are needed
+                // to calculate the correlation are updated for the affected time slot only...
+                if (coverageCount == 0) {
+                    uint32 timeSlot = timeSlots_[statisticIndex];
+                    uint32 groundTruth = labelMatrix_.values_cbegin()[timeSlot];
+                    uint32 prediction = predictionVector_[timeSlot];
+
+                    if (holdoutTimeSlotVector_[timeSlot]) {
+                        updateCorrelationMoments(holdoutPredictionMoments_, groundTruth, prediction, false);
                     } else {
-                        totalPredictionVector_[timeSlot] += 1;
+                        updateCorrelationMoments(trainingPredictionMoments_, groundTruth, prediction, false);
+
+                        if (sampledTimeSlotVector_[timeSlot]) {
+                            updateCorrelationMoments(predictionMoments_, groundTruth, prediction, false);
+                        }
                     }
+
+                    predictionVector_[timeSlot] = prediction + 1;
                 }
             }
 
-            void increaseCoverageCount(uint32 statisticIndex) override {
-                coverageCountVector_[statisticIndex] += 1;
+            uint32 getCoverageCount(uint32 statisticIndex) const override {
+                return coverageCountVector_[statisticIndex];
             }
 
             void updatePredictions() override {
-                DenseVector<uint32>::iterator predictionIterator = predictionVector_.begin();
-                DenseVector<uint32>::const_iterator countIterator = coverageCountVector_.cbegin();
-                typename LabelMatrix::index_const_iterator indices = labelMatrix_.indices_cbegin();
-                uint32 numTimeSlots = labelMatrix_.getNumTimeSlots();
-
-                for (uint32 i = 0; i < numTimeSlots; i++) {
-                    uint32 start = indices[i];
-                    uint32 end = indices[i + 1];
-                    uint32 prediction = 0;
-
-                    for (uint32 j = start; j < end; j++) {
-                        if (countIterator[j] > 0) {
-                            prediction++;
-                        }
-                    }
+                // The predictions are already updated by the function `increaseCoverageCount`...
+                return;
+            }
 
-                    predictionIterator[i] = prediction;
+            void addHoldoutStatistic(uint32 statisticIndex) override {
+                uint32 timeSlot = timeSlots_[statisticIndex];
+
+                // A time slot belongs to the holdout set as a whole, i.e., its contribution to the correlation on the
+                // training data is moved to the correlation on the holdout set...
+                if (!holdoutTimeSlotVector_[timeSlot]) {
+                    uint32 groundTruth = labelMatrix_.values_cbegin()[timeSlot];
+                    uint32 prediction = predictionVector_[timeSlot];
+                    holdoutTimeSlotVector_[timeSlot] = 1;
+                    removeFromCorrelationMoments(trainingPredictionMoments_, groundTruth, prediction);
+                    addToCorrelationMoments(holdoutPredictionMoments_, groundTruth, prediction);
+
+                    if (sampledTimeSlotVector_[timeSlot]) {
+                        sampledTimeSlotVector_[timeSlot] = 0;
+                        removeFromCorrelationMoments(predictionMoments_, groundTruth, prediction);
+                        removeFromCorrelationMoments(totalPredictionMoments_, groundTruth,
+                                                     totalPredictionVector_[timeSlot]);
+                    }
                 }
             }
 
+            float64 evaluatePredictions() const override {
+                FullIndexVector labelIndices(numLabels_);
+                std::unique_ptr<ILabelWiseRuleEvaluation> ruleEvaluationPtr =
+                    ruleEvaluationFactoryPtr_->create(labelIndices);
+                return ruleEvaluationPtr->calculateLabelWisePrediction(trainingPredictionMoments_).overallQualityScore;
+            }
+
+            float64 evaluateHoldoutPredictions() const override {
+                FullIndexVector labelIndices(numLabels_);
+                std::unique_ptr<ILabelWiseRuleEvaluation> ruleEvaluationPtr =
+                    ruleEvaluationFactoryPtr_->create(labelIndices);
+                return ruleEvaluationPtr->calculateLabelWisePrediction(holdoutPredictionMoments_).overallQualityScore;
+            }
+
             std::unique_ptr<std::vector<uint32>> getGroundTruth() const override {
                 std::unique_ptr<std::vector<uint32>> ptr = std::make_unique<std::vector<uint32>>();
                 typename LabelMatrix::value_const_iterator groundTruthIterator = labelMatrix_.values_cbegin();
@@ -239,19 +544,16 @@ namespace tsa {
                 return ptr;
             }
 
+            std::unique_ptr<IStatistics> isolateCoveredStatistics() override {
+                return std::make_unique<IsolatedStatistics>(*this, totalPredictionVector_, totalPredictionMoments_);
+            }
+
             std::unique_ptr<IStatisticsSubset> createSubset(const FullIndexVector& labelIndices) const override {
-                std::unique_ptr<ILabelWiseRuleEvaluation> ruleEvaluationPtr =
-                    this->ruleEvaluationFactoryPtr_->create(labelIndices);
-                return std::make_unique<typename LabelWiseStatistics::FullSubset>(*this, std::move(ruleEvaluationPtr),
-                                                                                  labelIndices);
+                return createSubsetInternally(labelIndices, totalPredictionVector_, totalPredictionMoments_);
             }
 
             std::unique_ptr<IStatisticsSubset> createSubset(const PartialIndexVector& labelIndices) const override {
-                std::unique_ptr<ILabelWiseRuleEvaluation> ruleEvaluationPtr =
-                    this->ruleEvaluationFactoryPtr_->create(labelIndices);
-                return std::make_unique<typename LabelWiseStatistics::PartialSubset>(*this,
-                                                                                     std::move(ruleEvaluationPtr),
-                                                                                     labelIndices);
+                return createSubsetInternally(labelIndices, totalPredictionVector_, totalPredictionMoments_);
             }
 
     };
@@ -6,10 +6,12 @@
 
 namespace tsa {
 
-    template<class LabelMatrix>
+    template<class LabelMatrix, typename TimeSlot>
     static inline std::unique_ptr<ILabelWiseStatistics> createInternally(
-            std::shared_ptr<ILabelWiseRuleEvaluationFactory> ruleEvaluationFactoryPtr, const LabelMatrix& labelMatrix) {
-        return std::make_unique<LabelWiseStatistics<LabelMatrix>>(ruleEvaluationFactoryPtr, labelMatrix);
+            std::shared_ptr<ILabelWiseRuleEvaluationFactory> ruleEvaluationFactoryPtr, const LabelMatrix& labelMatrix,
+            const TimeSlot* timeSlots) {
+        return std::make_unique<LabelWiseStatistics<LabelMatrix, TimeSlot>>(ruleEvaluationFactoryPtr, labelMatrix,
+                                                                            timeSlots);
     }
 
     DenseLabelWiseStatisticsFactory::DenseLabelWiseStatisticsFactory(
@@ -20,7 +22,14 @@ namespace tsa {
 
     std::unique_ptr<ILabelWiseStatistics> DenseLabelWiseStatisticsFactory::create(
             const CContiguousLabelMatrix& labelMatrix) const {
-        return createInternally<CContiguousLabelMatrix>(ruleEvaluationFactoryPtr_, labelMatrix);
+        // The type of the indices of the time slots is chosen depending on the number of time slots...
+        if (labelMatrix.hasCompactTimeSlots()) {
+            return createInternally<CContiguousLabelMatrix, uint16>(ruleEvaluationFactoryPtr_, labelMatrix,
+                                                                    labelMatrix.compact_time_slots_cbegin());
+        }
+
+        return createInternally<CContiguousLabelMatrix, uint32>(ruleEvaluationFactoryPtr_, labelMatrix,
+                                                                labelMatrix.time_slots_cbegin());
     }
 
 }
@@ -46,6 +46,36 @@ def optional_dict(s):
     return {} if string is None else literal_eval(string)
 
 
+def __year_and_week(s):
+    parts = s.split('-')
+
+    if len(parts) > 2:
+        raise ValueError('Invalid year or week given: ' + str(s))
+
+    return int(parts[0]), (int(parts[1]) if len(parts) > 1 else -1)
+
+
+def optional_time_windows(s):
+    string = optional_string(s)
+
+    if string is None:
+        return None
+
+    windows = []
+
+    for window in string.split(','):
+        parts = window.strip().split(':')
+
+        if len(parts) != 2:
+            raise ValueError('Invalid time window given: ' + str(window))
+
+        from_year, from_week = __year_and_week(parts[0])
+        to_year, to_week = __year_and_week(parts[1])
+        windows.append((from_year, from_week, to_year, to_week))
+
+    return windows
+
+
 class ArgumentParserBuilder:
     """
     A builder that allows to configure an `ArgumentParser` that accepts commonly used command-line arguments.
@@ -75,6 +105,17 @@ class ArgumentParserBuilder:
                             default=ArgumentParserBuilder.__get_or_default('model_dir', None, **kwargs),
                             help='The path of the directory where models should be saved')
         parser.add_argument('--dataset', type=str, required=True, help='The name of the data set to be used')
+        parser.add_argument('--folds', type=int,
+                            default=ArgumentParserBuilder.__get_or_default('folds', 1, **kwargs),
+                            help='Total number of folds to be used by cross validation or 1, if separate training and '
+                                 + 'test sets should be used')
+        parser.add_argument('--current-fold', type=int,
+                            default=ArgumentParserBuilder.__get_or_default('current_fold', -1, **kwargs),
+                            help='The cross validation fold to be performed or -1, if all folds should be performed')
+        parser.add_argument('--num-parallel-folds', type=int,
+                            default=ArgumentParserBuilder.__get_or_default('num_parallel_folds', 1, **kwargs),
+                            help='The number of cross validation folds to be performed concurrently. The threads to be '
+                                 + 'used for searching refinements are split among them')
         parser.add_argument('--one-hot-encoding', type=boolean_string,
                             default=ArgumentParserBuilder.__get_or_default('one_hot_encoding', False, **kwargs),
                             help='True, if one-hot-encoding should be used, False otherwise')
@@ -95,6 +136,15 @@ class ArgumentParserBuilder:
         parser.add_argument('--time-limit', type=int,
                             default=ArgumentParserBuilder.__get_or_default('time_limit', -1, **kwargs),
                             help='The duration in seconds after which the induction of rules should be canceled or -1')
+        parser.add_argument('--early-stopping', type=optional_string,
+                            default=ArgumentParserBuilder.__get_or_default('early_stopping', None, **kwargs),
+                            help='The name of the strategy to be used for early stopping or None')
+        parser.add_argument('--holdout', type=optional_string,
+                            default=ArgumentParserBuilder.__get_or_default('holdout', None, **kwargs),
+                            help='The name of the strategy to be used for creating a holdout set or None')
+        parser.add_argument('--instance-sub-sampling', type=optional_string,
+                            default=ArgumentParserBuilder.__get_or_default('instance_sub_sampling', None, **kwargs),
+                            help='The name of the strategy to be used for instance sub-sampling or None')
         parser.add_argument('--feature-sub-sampling', type=optional_string,
                             default=ArgumentParserBuilder.__get_or_default('feature_sub_sampling', None, **kwargs),
                             help='The name of the strategy to be used for feature sub-sampling or None')
@@ -103,6 +153,30 @@ class ArgumentParserBuilder:
         parser.add_argument('--max-conditions', type=int,
                             default=ArgumentParserBuilder.__get_or_default('max_conditions', -1, **kwargs),
                             help='The maximum number of conditions to be included in a rule\'s body or -1')
+        parser.add_argument('--beam-width', type=int,
+                            default=ArgumentParserBuilder.__get_or_default('beam_width', 1, **kwargs),
+                            help='The number of rules to be retained at each iteration of the search for a new rule')
+        parser.add_argument('--batch-size', type=int,
+                            default=ArgumentParserBuilder.__get_or_default('batch_size', 1, **kwargs),
+                            help='The maximum number of rules to be induced based on a single scan of the features')
+        parser.add_argument('--max-overlap', type=float,
+                            default=ArgumentParserBuilder.__get_or_default('max_overlap', 0.0, **kwargs),
+                            help='The maximum fraction of overlapping examples among the rules in the same batch')
+        parser.add_argument('--screening-sample-size', type=float,
+                            default=ArgumentParserBuilder.__get_or_default('screening_sample_size', 1.0, **kwargs),
+                            help='The fraction of the examples to be used for screening the features or 1')
+        parser.add_argument('--num-screened-features', type=int,
+                            default=ArgumentParserBuilder.__get_or_default('num_screened_features', 10, **kwargs),
+                            help='The number of features to be retained by the screening')
+        parser.add_argument('--compress-cache', type=boolean_string,
+                            default=ArgumentParserBuilder.__get_or_default('compress_cache', False, **kwargs),
+                            help='True, if the cached feature vectors should be compressed, False otherwise')
+        parser.add_argument('--prefetch-window', type=int,
+                            default=ArgumentParserBuilder.__get_or_default('prefetch_window', 0, **kwargs),
+                            help='The number of feature vectors to be prefetched instead of caching them or 0')
+        parser.add_argument('--shard-sockets', type=optional_string,
+                            default=ArgumentParserBuilder.__get_or_default('shard_sockets', None, **kwargs),
+                            help='A comma-separated list of sockets of workers to distribute the features among')
         parser.add_argument('--print-rules', type=boolean_string,
                             default=ArgumentParserBuilder.__get_or_default('print_rules', True, **kwargs),
                             help='True, if the induced rules should be printed on the console, False otherwise')
@@ -137,6 +211,15 @@ class ArgumentParserBuilder:
         parser.add_argument('--count-file-name', type=str,
                             default=ArgumentParserBuilder.__get_or_default('count_file_name', None, **kwargs),
                             help='The name of the file that stores the number of cases for individual weeks')
+        parser.add_argument('--windows', type=optional_time_windows,
+                            default=ArgumentParserBuilder.__get_or_default('windows', None, **kwargs),
+                            help='A comma-separated list of time windows in the format '
+                                 + '<from_year>[-<from_week>]:<to_year>[-<to_week>], a separate model should be fit to, '
+                                 + 'or None. If given, the prepared time series is cached in the temporary directory')
+        parser.add_argument('--num-threads', type=int,
+                            default=ArgumentParserBuilder.__get_or_default('num_threads', 1, **kwargs),
+                            help='The total number of threads to be used for fitting models to several time windows '
+                                 + 'concurrently or -1')
         return self
 
     def build(self) -> ArgumentParser:
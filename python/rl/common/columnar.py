@@ -0,0 +1,87 @@
+#!/usr/bin/python
+
+"""
+@author: Michael Rapp (mrapp@ke.tu-darmstadt.de)
+"""
+import numpy as np
+from scipy.sparse import issparse
+
+from rl.common.types import DTYPE_FLOAT32
+
+MAGIC_NUMBER = 0x4D464C52
+
+VERSION = 1
+
+DTYPE_HEADER = np.dtype([('magic_number', '<u4'), ('version', '<u4'), ('num_rows', '<u4'), ('num_cols', '<u4')])
+
+DTYPE_ENTRY = np.dtype([('offset', '<u8'), ('num_elements', '<u4'), ('flags', '<u4')])
+
+FLAG_SPARSE = 1
+
+FLAG_SORTED = 2
+
+
+def write_feature_matrix(file_path: str, x, presort: bool = False):
+    """
+    Writes a feature matrix to a file in the columnar format that is expected by the C++ class
+    `MemoryMappedFeatureMatrix`. Features are stored in a sparse format, if the given matrix is sparse or if the feature
+    values should be sorted, or in a dense format otherwise.
+
+    :param file_path:   The path of the file
+    :param x:           A `numpy.ndarray` or `scipy.sparse` matrix, shape `(num_examples, num_features)`, that stores
+                        the feature values of the examples
+    :param presort:     True, if the feature values should be sorted, such that they must not be sorted when the file is
+                        used for training, False otherwise
+    """
+    sparse = issparse(x)
+
+    if sparse:
+        x = x.tocsc()
+        x.sort_indices()
+    else:
+        x = np.asarray(x, dtype=DTYPE_FLOAT32)
+
+    num_rows, num_cols = x.shape
+    header = np.array([(MAGIC_NUMBER, VERSION, num_rows, num_cols)], dtype=DTYPE_HEADER)
+    entries = np.zeros(num_cols, dtype=DTYPE_ENTRY)
+    offset = DTYPE_HEADER.itemsize + num_cols * DTYPE_ENTRY.itemsize
+
+    with open(file_path, 'wb') as f:
+        f.seek(offset)
+
+        for i in range(num_cols):
+            if sparse:
+                start = x.indptr[i]
+                end = x.indptr[i + 1]
+                indices = np.ascontiguousarray(x.indices[start:end], dtype='<u4')
+                values = np.ascontiguousarray(x.data[start:end], dtype='<f4')
+            else:
+                indices = np.arange(num_rows, dtype='<u4') if presort else None
+                values = np.ascontiguousarray(x[:, i], dtype='<f4')
+
+            if presort:
+                # The elements are sorted by their feature values, followed by the elements with missing values...
+                missing = np.isnan(values)
+                order = np.concatenate((np.flatnonzero(~missing)[np.argsort(values[~missing], kind='stable')],
+                                        np.flatnonzero(missing)))
+                indices = indices[order]
+                values = values[order]
+
+            # The data of each feature must start at a multiple of 4...
+            offset += (-offset) % 4
+            f.seek(offset)
+            num_elements = values.shape[0]
+            entries[i] = (offset, num_elements, (FLAG_SPARSE if indices is not None else 0)
+                          | (FLAG_SORTED if presort else 0))
+
+            if indices is not None:
+                f.write(indices.tobytes())
+
+            f.write(values.tobytes())
+            f.write(np.packbits(np.isnan(values), bitorder='little').tobytes())
+            offset = f.tell()
+
+        f.seek(0)
+        f.write(header.tobytes())
+        f.write(entries.tobytes())
+
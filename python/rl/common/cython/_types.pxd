@@ -5,6 +5,7 @@ cimport numpy as npc
 
 ctypedef Py_ssize_t intp
 ctypedef npc.uint8_t uint8
+ctypedef npc.uint16_t uint16
 ctypedef npc.uint32_t uint32
 ctypedef npc.float32_t float32
 ctypedef npc.float64_t float64
@@ -1,7 +1,9 @@
-from rl.common.cython._types cimport uint32, float32
+from rl.common.cython._types cimport uint16, uint32, float32
 
 from libcpp cimport bool
-from libcpp.memory cimport shared_ptr
+from libcpp.memory cimport shared_ptr, unique_ptr
+from libcpp.string cimport string
+from libcpp.vector cimport vector
 
 
 cdef extern from "common/input/label_matrix.hpp" nogil:
@@ -17,17 +19,36 @@ cdef extern from "common/input/label_matrix.hpp" nogil:
 
 cdef extern from "common/input/label_matrix_c_contiguous.hpp" nogil:
 
+    const uint32 MAX_NUM_COMPACT_TIME_SLOTS
+
     cdef cppclass CContiguousLabelMatrixImpl"CContiguousLabelMatrix"(ILabelMatrix):
 
         # Constructors:
 
         CContiguousLabelMatrixImpl(uint32 numRows, uint32 numCols, const uint32* array) except +
 
+        CContiguousLabelMatrixImpl(uint32 numRows, uint32 numTimeSlots, const uint32* timeSlots,
+                                   const uint32* values) except +
+
+        CContiguousLabelMatrixImpl(uint32 numRows, uint32 numTimeSlots, const uint16* timeSlots,
+                                   const uint32* values) except +
+
+        CContiguousLabelMatrixImpl(uint32 numRows, uint32 numTimeSlots, const uint32* timeSlots, const uint32* values,
+                                   uint32 numSubsetRows, const uint32* subsetIndices) except +
+
+        CContiguousLabelMatrixImpl(uint32 numRows, uint32 numTimeSlots, const uint16* timeSlots, const uint32* values,
+                                   uint32 numSubsetRows, const uint32* subsetIndices) except +
+
 
 cdef extern from "common/input/feature_matrix.hpp" nogil:
 
     cdef cppclass IFeatureMatrix:
-        pass
+
+        # Functions:
+
+        uint32 getNumRows()
+
+        uint32 getNumCols()
 
 
 cdef extern from "common/input/feature_matrix_c_contiguous.hpp" nogil:
@@ -62,6 +83,28 @@ cdef extern from "common/input/feature_matrix_csc.hpp" nogil:
                              uint32* colIndices) except +
 
 
+cdef extern from "common/input/feature_matrix_memory_mapped.hpp" nogil:
+
+    cdef cppclass MemoryMappedFeatureMatrixImpl"MemoryMappedFeatureMatrix"(IFeatureMatrix):
+
+        # Constructors:
+
+        MemoryMappedFeatureMatrixImpl(string path) except +
+
+        # Functions:
+
+        bool isOpen()
+
+
+cdef extern from "common/input/feature_matrix_presorted.hpp" nogil:
+
+    cdef cppclass PresortedFeatureMatrixImpl"PresortedFeatureMatrix"(IFeatureMatrix):
+
+        # Constructors:
+
+        PresortedFeatureMatrixImpl(shared_ptr[IFeatureMatrix] featureMatrixPtr, uint32 numThreads) except +
+
+
 cdef extern from "common/input/feature_matrix_csr.hpp" nogil:
 
     cdef cppclass CsrFeatureMatrixImpl"CsrFeatureMatrix":
@@ -76,6 +119,54 @@ cdef extern from "common/input/feature_matrix_csr.hpp" nogil:
         uint32 getNumRows()
 
 
+cdef extern from "common/input/arrow.hpp" nogil:
+
+    cdef struct ArrowSchema:
+        void (*release)(ArrowSchema*)
+
+
+    cdef struct ArrowArray:
+        void (*release)(ArrowArray*)
+
+
+cdef extern from "common/input/arrow_table.hpp" nogil:
+
+    cdef struct ArrowColumn:
+        string name
+        bool nominal
+        vector[string] nominalValues
+
+
+    cdef cppclass ArrowTableImpl"ArrowTable":
+
+        # Constructors:
+
+        ArrowTableImpl(ArrowSchema* schema, ArrowArray* array) except +
+
+        # Functions:
+
+        bool isValid()
+
+        const string& getError()
+
+        uint32 getNumRows()
+
+        uint32 getNumCols()
+
+        const ArrowColumn& getColumn(uint32 columnIndex)
+
+        bool fetchColumn(uint32 columnIndex, uint32* array, uint32 stride)
+
+
+cdef extern from "common/input/feature_matrix_arrow.hpp" nogil:
+
+    cdef cppclass ArrowFeatureMatrixImpl"ArrowFeatureMatrix"(IFeatureMatrix):
+
+        # Constructors:
+
+        ArrowFeatureMatrixImpl(shared_ptr[const ArrowTableImpl] tablePtr) except +
+
+
 cdef extern from "common/input/nominal_feature_mask.hpp" nogil:
 
     cdef cppclass INominalFeatureMask:
@@ -100,6 +191,44 @@ cdef extern from "common/input/nominal_feature_mask_equal.hpp" nogil:
         EqualNominalFeatureMaskImpl(bool nominal) except +
 
 
+cdef extern from "common/input/arff_reader.hpp" nogil:
+
+    cdef cppclass ArffDataImpl"ArffData":
+
+        # Functions:
+
+        uint32 getNumRows()
+
+        uint32 getNumCols()
+
+        bool isSparse()
+
+        uint32 getNumValues()
+
+        float32* getValues()
+
+        uint32* getRowIndices()
+
+        uint32* getColIndices()
+
+        const string& getAttributeName(uint32 attributeIndex)
+
+        bool isNominal(uint32 attributeIndex)
+
+        const vector[string]& getNominalValues(uint32 attributeIndex)
+
+
+    cdef cppclass ArffReaderImpl"ArffReader":
+
+        # Constructors:
+
+        ArffReaderImpl(uint32 numThreads) except +
+
+        # Functions:
+
+        unique_ptr[ArffDataImpl] read(const string& path, string& error)
+
+
 cdef class LabelMatrix:
 
     # Attributes:
@@ -111,6 +240,17 @@ cdef class CContiguousLabelMatrix(LabelMatrix):
     pass
 
 
+cdef class TimeSlotLabelMatrix(LabelMatrix):
+
+    # Attributes:
+
+    cdef object time_slots
+
+    cdef const uint32[::1] values
+
+    cdef object subset_indices
+
+
 cdef class DokLabelMatrix(LabelMatrix):
     pass
 
@@ -123,13 +263,41 @@ cdef class FeatureMatrix:
 
 
 cdef class FortranContiguousFeatureMatrix(FeatureMatrix):
-    pass
+
+    # Attributes:
+
+    cdef const float32[::1, :] array
 
 
 cdef class CscFeatureMatrix(FeatureMatrix):
+
+    # Attributes:
+
+    cdef const float32[::1] data
+
+    cdef uint32[::1] row_indices
+
+    cdef uint32[::1] col_indices
+
+
+cdef class MemoryMappedFeatureMatrix(FeatureMatrix):
     pass
 
 
+cdef class PresortedFeatureMatrix(FeatureMatrix):
+
+    # Attributes:
+
+    cdef FeatureMatrix feature_matrix
+
+
+cdef class ArrowFeatureMatrix(FeatureMatrix):
+
+    # Attributes:
+
+    cdef ArrowTable table
+
+
 cdef class CContiguousFeatureMatrix:
 
     # Attributes:
@@ -157,3 +325,17 @@ cdef class DokNominalFeatureMask(NominalFeatureMask):
 
 cdef class EqualNominalFeatureMask(NominalFeatureMask):
     pass
+
+
+cdef class ArrowTable:
+
+    # Attributes:
+
+    cdef shared_ptr[ArrowTableImpl] table_ptr
+
+
+cdef class ArffReader:
+
+    # Attributes:
+
+    cdef unique_ptr[ArffReaderImpl] reader_ptr
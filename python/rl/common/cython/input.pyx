@@ -3,6 +3,11 @@
 """
 from libcpp.memory cimport unique_ptr, make_unique, make_shared
 from libcpp.utility cimport move
+from libc.stdint cimport uintptr_t
+from cpython.pycapsule cimport PyCapsule_GetPointer
+
+import numpy as np
+from scipy.sparse import csc_matrix
 
 
 cdef class LabelMatrix:
@@ -29,16 +34,95 @@ cdef class CContiguousLabelMatrix(LabelMatrix):
                                                                                                   &array[0, 0])
 
 
+cdef class TimeSlotLabelMatrix(LabelMatrix):
+    """
+    A wrapper for the C++ class `CContiguousLabelMatrix` that provides access to the time slots of the training examples
+    and the ground truth of the individual time slots, which are stored in arrays that are not copied.
+    """
+
+    def __cinit__(self, time_slots, const uint32[::1] values, subset_indices = None):
+        """
+        :param time_slots:      An array of type `uint16` or `uint32`, shape `(num_examples)`, that stores the index of
+                                the time slot each example belongs to in increasing order. The type `uint16` may only be
+                                used if there are at most `MAX_NUM_COMPACT_TIME_SLOTS` time slots
+        :param values:          An array of type `uint32`, shape `(num_time_slots)`, that stores the ground truth of each
+                                time slot
+        :param subset_indices:  An array of type `uint32`, shape `(num_subset_examples)`, that stores the indices of the
+                                examples that are included in the training data in increasing order, or None, if all
+                                examples are included
+        """
+        cdef const uint16[::1] compact_time_slot_array
+        cdef const uint32[::1] time_slot_array
+        cdef const uint32[::1] subset_index_array
+        cdef uint32 num_examples = time_slots.shape[0]
+        cdef uint32 num_time_slots = values.shape[0]
+        cdef uint32 num_subset_examples
+        cdef bint compact = time_slots.dtype == np.uint16
+        cdef const uint16* compact_time_slot_ptr = NULL
+        cdef const uint32* time_slot_ptr = NULL
+        cdef const uint32* values_ptr = &values[0] if num_time_slots > 0 else NULL
+        self.time_slots = time_slots
+        self.values = values
+        self.subset_indices = subset_indices
+
+        if compact:
+            if num_time_slots > MAX_NUM_COMPACT_TIME_SLOTS:
+                raise ValueError('Indices of type uint16 are not supported for more than '
+                                 + str(MAX_NUM_COMPACT_TIME_SLOTS) + ' time slots')
+
+            compact_time_slot_array = time_slots
+            compact_time_slot_ptr = &compact_time_slot_array[0] if num_examples > 0 else NULL
+        else:
+            time_slot_array = time_slots
+            time_slot_ptr = &time_slot_array[0] if num_examples > 0 else NULL
+
+        if subset_indices is None:
+            if compact:
+                self.label_matrix_ptr = <shared_ptr[ILabelMatrix]>make_shared[CContiguousLabelMatrixImpl](
+                    num_examples, num_time_slots, compact_time_slot_ptr, values_ptr)
+            else:
+                self.label_matrix_ptr = <shared_ptr[ILabelMatrix]>make_shared[CContiguousLabelMatrixImpl](
+                    num_examples, num_time_slots, time_slot_ptr, values_ptr)
+        else:
+            subset_index_array = subset_indices
+            num_subset_examples = subset_index_array.shape[0]
+
+            if compact:
+                self.label_matrix_ptr = <shared_ptr[ILabelMatrix]>make_shared[CContiguousLabelMatrixImpl](
+                    num_examples, num_time_slots, compact_time_slot_ptr, values_ptr, num_subset_examples,
+                    &subset_index_array[0] if num_subset_examples > 0 else NULL)
+            else:
+                self.label_matrix_ptr = <shared_ptr[ILabelMatrix]>make_shared[CContiguousLabelMatrixImpl](
+                    num_examples, num_time_slots, time_slot_ptr, values_ptr, num_subset_examples,
+                    &subset_index_array[0] if num_subset_examples > 0 else NULL)
+
+
 cdef class FeatureMatrix:
     """
     A wrapper for the pure virtual C++ class `IFeatureMatrix`.
     """
-    pass
+
+    def get_num_rows(self) -> int:
+        """
+        Returns the number of examples.
+
+        :return: The number of examples
+        """
+        return self.feature_matrix_ptr.get().getNumRows()
+
+    def get_num_cols(self) -> int:
+        """
+        Returns the number of features.
+
+        :return: The number of features
+        """
+        return self.feature_matrix_ptr.get().getNumCols()
 
 
 cdef class FortranContiguousFeatureMatrix(FeatureMatrix):
     """
-    A wrapper for the C++ class `FortranContiguousFeatureMatrix`.
+    A wrapper for the C++ class `FortranContiguousFeatureMatrix`. The given array is not copied, but kept alive as long
+    as the wrapper exists.
     """
 
     def __cinit__(self, const float32[::1, :] array):
@@ -48,13 +132,15 @@ cdef class FortranContiguousFeatureMatrix(FeatureMatrix):
         """
         cdef uint32 num_examples = array.shape[0]
         cdef uint32 num_features = array.shape[1]
+        self.array = array
         self.feature_matrix_ptr = <shared_ptr[IFeatureMatrix]>make_shared[FortranContiguousFeatureMatrixImpl](
             num_examples, num_features, &array[0, 0])
 
 
 cdef class CscFeatureMatrix(FeatureMatrix):
     """
-    A wrapper for the C++ class `CscFeatureMatrix`.
+    A wrapper for the C++ class `CscFeatureMatrix`. The given arrays are not copied, but kept alive as long as the
+    wrapper exists.
     """
 
     def __cinit__(self, uint32 num_examples, uint32 num_features, const float32[::1] data, uint32[::1] row_indices,
@@ -70,12 +156,66 @@ cdef class CscFeatureMatrix(FeatureMatrix):
                                 first element in `data` and `row_indices` that corresponds to a certain feature. The
                                 index at the last position is equal to `num_non_zero_values`
         """
+        self.data = data
+        self.row_indices = row_indices
+        self.col_indices = col_indices
         self.feature_matrix_ptr = <shared_ptr[IFeatureMatrix]>make_shared[CscFeatureMatrixImpl](num_examples,
                                                                                                 num_features, &data[0],
                                                                                                 &row_indices[0],
                                                                                                 &col_indices[0])
 
 
+cdef class MemoryMappedFeatureMatrix(FeatureMatrix):
+    """
+    A wrapper for the C++ class `MemoryMappedFeatureMatrix`.
+    """
+
+    def __cinit__(self, str file_path):
+        """
+        :param file_path: The path of the file that stores the feature values in the format that is written by the
+                          function `rl.common.columnar.write_feature_matrix`
+        """
+        cdef shared_ptr[MemoryMappedFeatureMatrixImpl] feature_matrix_ptr = make_shared[MemoryMappedFeatureMatrixImpl](
+            file_path.encode('utf-8'))
+
+        if not feature_matrix_ptr.get().isOpen():
+            raise IOError('Unable to open feature matrix from file \'' + file_path + '\'')
+
+        self.feature_matrix_ptr = <shared_ptr[IFeatureMatrix]>feature_matrix_ptr
+
+
+cdef class PresortedFeatureMatrix(FeatureMatrix):
+    """
+    A wrapper for the C++ class `PresortedFeatureMatrix`.
+    """
+
+    def __cinit__(self, FeatureMatrix feature_matrix, uint32 num_threads):
+        """
+        :param feature_matrix:  The feature matrix, whose feature values should be sorted in advance. The feature
+                                values are sorted once and may afterwards be shared by several learners that are fit
+                                concurrently
+        :param num_threads:     The number of CPU threads to be used to sort the feature values in parallel. Must be at
+                                least 1
+        """
+        self.feature_matrix = feature_matrix
+        self.feature_matrix_ptr = <shared_ptr[IFeatureMatrix]>make_shared[PresortedFeatureMatrixImpl](
+            feature_matrix.feature_matrix_ptr, num_threads)
+
+
+cdef class ArrowFeatureMatrix(FeatureMatrix):
+    """
+    A wrapper for the C++ class `ArrowFeatureMatrix`.
+    """
+
+    def __cinit__(self, ArrowTable table):
+        """
+        :param table: The table that stores the feature values of the training examples in its columns
+        """
+        self.table = table
+        self.feature_matrix_ptr = <shared_ptr[IFeatureMatrix]>make_shared[ArrowFeatureMatrixImpl](
+            <shared_ptr[const ArrowTableImpl]>table.table_ptr)
+
+
 cdef class CContiguousFeatureMatrix:
     """
     A wrapper for the C++ class `CContiguousFeatureMatrix`.
@@ -152,3 +292,182 @@ cdef class EqualNominalFeatureMask(NominalFeatureMask):
         """
         self.nominal_feature_mask_ptr = <shared_ptr[INominalFeatureMask]>make_shared[EqualNominalFeatureMaskImpl](
             nominal)
+
+
+cdef class ArrowTable:
+    """
+    A wrapper for the C++ class `ArrowTable`.
+    """
+
+    def __cinit__(self, data):
+        """
+        :param data: A record batch, e.g., a `pyarrow.RecordBatch`, that implements the Arrow PyCapsule interface via
+                     the method `__arrow_c_array__` or that can be exported via the method `_export_to_c`. The buffers
+                     of the record batch are accessed in place
+        """
+        cdef ArrowSchema schema
+        cdef ArrowArray array
+        cdef ArrowSchema* schema_ptr
+        cdef ArrowArray* array_ptr
+        cdef str error
+
+        if hasattr(data, '__arrow_c_array__'):
+            schema_capsule, array_capsule = data.__arrow_c_array__()
+            schema_ptr = <ArrowSchema*>PyCapsule_GetPointer(schema_capsule, 'arrow_schema')
+            array_ptr = <ArrowArray*>PyCapsule_GetPointer(array_capsule, 'arrow_array')
+        elif hasattr(data, '_export_to_c'):
+            schema.release = NULL
+            array.release = NULL
+            data._export_to_c(<uintptr_t>&array, <uintptr_t>&schema)
+            schema_ptr = &schema
+            array_ptr = &array
+        else:
+            raise ValueError('Data of type ' + type(data).__name__ + ' cannot be exported via the Arrow C data '
+                             + 'interface')
+
+        self.table_ptr = make_shared[ArrowTableImpl](schema_ptr, array_ptr)
+
+        if not self.table_ptr.get().isValid():
+            # The record batch must be released before the error is raised, because its release callback might be
+            # implemented in Python...
+            error = self.table_ptr.get().getError().decode('utf-8')
+            self.table_ptr.reset()
+            raise ValueError(error)
+
+    def get_num_rows(self) -> int:
+        """
+        Returns the number of rows in the table.
+
+        :return: The number of rows
+        """
+        return self.table_ptr.get().getNumRows()
+
+    def get_num_cols(self) -> int:
+        """
+        Returns the number of columns in the table.
+
+        :return: The number of columns
+        """
+        return self.table_ptr.get().getNumCols()
+
+    def get_column_names(self):
+        """
+        Returns the names of all columns in the table.
+
+        :return: A list that contains the names of the columns
+        """
+        cdef ArrowTableImpl* table = self.table_ptr.get()
+        cdef uint32 i
+        return [table.getColumn(i).name.decode('utf-8') for i in range(table.getNumCols())]
+
+    def get_nominal_values(self):
+        """
+        Returns the values of all dictionary-encoded columns in the table, whose indices are used as the values of
+        nominal features.
+
+        :return: A dictionary that contains the indices of the dictionary-encoded columns as keys and lists that
+                 contain the values of the dictionaries as values
+        """
+        cdef ArrowTableImpl* table = self.table_ptr.get()
+        cdef const ArrowColumn* column
+        cdef uint32 i, j
+        nominal_values = {}
+
+        for i in range(table.getNumCols()):
+            column = &table.getColumn(i)
+
+            if column.nominal:
+                nominal_values[i] = [column.nominalValues.at(j).decode('utf-8')
+                                     for j in range(column.nominalValues.size())]
+
+        return nominal_values
+
+    def to_label_array(self):
+        """
+        Copies the values in the table, which must be non-negative integers without any missing values, into a
+        C-contiguous array, as expected by the class `CContiguousLabelMatrix`.
+
+        :return: A C-contiguous `numpy.ndarray` of type `uint32`, shape `(num_rows, num_cols)`, that stores the values
+        """
+        cdef ArrowTableImpl* table = self.table_ptr.get()
+        cdef uint32 num_rows = table.getNumRows()
+        cdef uint32 num_cols = table.getNumCols()
+        cdef uint32[:, ::1] array = np.empty((num_rows, num_cols), dtype=np.uint32)
+        cdef uint32 i
+
+        if num_rows > 0:
+            for i in range(num_cols):
+                if not table.fetchColumn(i, &array[0, i], num_cols):
+                    raise ValueError('Column \'' + table.getColumn(i).name.decode('utf-8')
+                                     + '\' must store non-negative integers without any missing values')
+
+        return np.asarray(array)
+
+
+cdef class ArffReader:
+    """
+    A wrapper for the C++ class `ArffReader`.
+    """
+
+    def __cinit__(self, uint32 num_threads):
+        """
+        :param num_threads: The number of CPU threads to be used to parse the file in parallel. Must be at least 1
+        """
+        self.reader_ptr = make_unique[ArffReaderImpl](num_threads)
+
+    def read(self, str file_path):
+        """
+        Reads a data set from an ARFF file.
+
+        :param file_path:   The path of the ARFF file
+        :return:            A Fortran-contiguous `numpy.ndarray`, if the file is given in the dense format, or a
+                            `scipy.sparse.csc_matrix`, if it is given in the sparse format, of type `float32`, shape
+                            `(num_instances, num_attributes)`, that stores the values in the file, as well as a list
+                            that contains a tuple for each attribute, consisting of its name and either the string
+                            'NUMERIC' or a list that contains the values of a nominal attribute
+        """
+        cdef string error
+        cdef unique_ptr[ArffDataImpl] data_ptr = move(self.reader_ptr.get().read(file_path.encode('utf-8'), error))
+
+        if not data_ptr:
+            message = error.decode('utf-8')
+
+            if message.startswith('Unable to read'):
+                raise IOError(message)
+
+            raise ValueError(message)
+
+        cdef ArffDataImpl* data = data_ptr.get()
+        cdef uint32 num_rows = data.getNumRows()
+        cdef uint32 num_cols = data.getNumCols()
+        cdef uint32 num_values = data.getNumValues()
+        cdef const vector[string]* nominal_values
+        cdef uint32 i, j
+        values = np.empty(num_values, dtype=np.float32)
+
+        if num_values > 0:
+            values[:] = np.asarray(<float32[:num_values]>data.getValues())
+
+        if data.isSparse():
+            row_indices = np.empty(num_values, dtype=np.uint32)
+            col_indices = np.asarray(<uint32[:(num_cols + 1)]>data.getColIndices()).copy()
+
+            if num_values > 0:
+                row_indices[:] = np.asarray(<uint32[:num_values]>data.getRowIndices())
+
+            matrix = csc_matrix((values, row_indices, col_indices), shape=(num_rows, num_cols))
+        else:
+            matrix = np.reshape(values, (num_rows, num_cols), order='F')
+
+        attributes = []
+
+        for i in range(num_cols):
+            name = data.getAttributeName(i).decode('utf-8')
+
+            if data.isNominal(i):
+                nominal_values = &data.getNominalValues(i)
+                attributes.append((name, [nominal_values.at(j).decode('utf-8') for j in range(nominal_values.size())]))
+            else:
+                attributes.append((name, 'NUMERIC'))
+
+        return matrix, attributes
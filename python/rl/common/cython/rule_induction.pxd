@@ -1,4 +1,4 @@
-from rl.common.cython._types cimport uint32, intp
+from rl.common.cython._types cimport uint32, intp, float32
 from rl.common.cython.input cimport NominalFeatureMask, INominalFeatureMask
 from rl.common.cython.input cimport FeatureMatrix, IFeatureMatrix
 from rl.common.cython.input cimport LabelMatrix, ILabelMatrix
@@ -6,12 +6,14 @@ from rl.common.cython.model cimport ModelBuilder, RuleModel, IModelBuilder, Rule
 from rl.common.cython.sampling cimport IInstanceSubSamplingFactory, IFeatureSubSamplingFactory, \
     IPartitionSamplingFactory, RNG
 from rl.common.cython.statistics cimport IStatisticsProviderFactory
-from rl.common.cython.stopping cimport IStoppingCriterion
+from rl.common.cython.stopping cimport IStoppingCriterion, CancellationTokenImpl
 from rl.common.cython.thresholds cimport IThresholdsFactory
 from rl.common.cython.head_refinement cimport IHeadRefinementFactory
 from libcpp.memory cimport unique_ptr, shared_ptr
 from libcpp.forward_list cimport forward_list
 from libcpp.vector cimport vector
+from libcpp cimport bool
+from libcpp.string cimport string
 
 
 cdef extern from "common/rule_induction/rule_induction.hpp" nogil:
@@ -32,8 +34,9 @@ cdef extern from "common/rule_induction/rule_model_induction.hpp" nogil:
         unique_ptr[RuleModelImpl] induceRules(shared_ptr[INominalFeatureMask] nominalFeatureMaskPtr,
                                               shared_ptr[IFeatureMatrix] featureMatrixPtr,
                                               shared_ptr[ILabelMatrix] labelMatrixPtr, RNG& rng,
-                                              IModelBuilder& modelBuilder, PredictionVisitor groundTruthVisitor,
-                                              PredictionVisitor predictionVisitor)
+                                              IModelBuilder& modelBuilder, const RuleModelImpl* initialModel,
+                                              PredictionVisitor groundTruthVisitor,
+                                              PredictionVisitor predictionVisitor) except +
 
 
 cdef extern from "common/rule_induction/rule_induction_top_down.hpp" nogil:
@@ -42,7 +45,75 @@ cdef extern from "common/rule_induction/rule_induction_top_down.hpp" nogil:
 
         # Constructors:
 
-        TopDownRuleInductionImpl(uint32 minCoverage, intp maxConditions, uint32 numThreads) except +
+        TopDownRuleInductionImpl(float32 minSupport, intp maxConditions, float32 screeningSampleSize,
+                                 uint32 numScreenedFeatures, uint32 numThreads) except +
+
+
+cdef extern from "common/rule_induction/rule_induction_batch.hpp" nogil:
+
+    cdef cppclass BatchRuleInductionImpl"BatchRuleInduction"(IRuleInduction):
+
+        # Constructors:
+
+        BatchRuleInductionImpl(uint32 batchSize, float32 maxOverlap, float32 minSupport, intp maxConditions,
+                               uint32 numThreads) except +
+
+
+cdef extern from "common/rule_induction/rule_induction_beam_search.hpp" nogil:
+
+    cdef cppclass BeamSearchRuleInductionImpl"BeamSearchRuleInduction"(IRuleInduction):
+
+        # Constructors:
+
+        BeamSearchRuleInductionImpl(uint32 beamWidth, float32 minSupport, intp maxConditions,
+                                    uint32 numThreads) except +
+
+
+cdef extern from "common/distributed/channel.hpp" nogil:
+
+    cdef cppclass IChannel:
+        pass
+
+
+cdef extern from "common/distributed/channel_socket.hpp" nogil:
+
+    cdef cppclass SocketChannelImpl"SocketChannel"(IChannel):
+
+        # Functions:
+
+        @staticmethod
+        unique_ptr[SocketChannelImpl] listen(const string& path, uint32 timeout) except +
+
+        @staticmethod
+        unique_ptr[SocketChannelImpl] connect(const string& path, uint32 timeout)
+
+
+cdef extern from "common/distributed/shard_worker.hpp" nogil:
+
+    cdef cppclass ShardWorkerImpl"ShardWorker":
+
+        # Constructors:
+
+        ShardWorkerImpl(shared_ptr[IStatisticsProviderFactory] statisticsProviderFactoryPtr,
+                        shared_ptr[IThresholdsFactory] thresholdsFactoryPtr,
+                        shared_ptr[IHeadRefinementFactory] headRefinementFactoryPtr,
+                        shared_ptr[INominalFeatureMask] nominalFeatureMaskPtr,
+                        shared_ptr[IFeatureMatrix] featureMatrixPtr, shared_ptr[ILabelMatrix] labelMatrixPtr,
+                        uint32 numThreads) except +
+
+        # Functions:
+
+        bool serve(IChannel& channel)
+
+
+cdef extern from "common/rule_induction/rule_induction_sharded.hpp" nogil:
+
+    cdef cppclass ShardedRuleInductionImpl"ShardedRuleInduction"(IRuleInduction):
+
+        # Constructors:
+
+        ShardedRuleInductionImpl(unique_ptr[vector[shared_ptr[IChannel]]] channelsPtr, float32 minSupport,
+                                 intp maxConditions) except +
 
 
 cdef extern from "common/rule_induction/rule_model_induction_sequential.hpp" nogil:
@@ -59,10 +130,13 @@ cdef extern from "common/rule_induction/rule_model_induction_sequential.hpp" nog
                 shared_ptr[IInstanceSubSamplingFactory] instanceSubSamplingFactoryPtr,
                 shared_ptr[IFeatureSubSamplingFactory] featureSubSamplingFactoryPtr,
                 shared_ptr[IPartitionSamplingFactory] partitionSamplingFactoryPtr,
-                unique_ptr[forward_list[shared_ptr[IStoppingCriterion]]] stoppingCriteriaPtr) except +
+                unique_ptr[forward_list[shared_ptr[IStoppingCriterion]]] stoppingCriteriaPtr,
+                shared_ptr[CancellationTokenImpl] cancellationTokenPtr, uint32 maxInheritedRules,
+                bool verifyInheritedRules, uint32 numThreads, string checkpointPath,
+                uint32 checkpointInterval) except +
 
 
-cdef extern from *:
+cdef extern from * nogil:
     """
     #include "common/rule_induction/rule_model_induction.hpp"
 
@@ -92,6 +166,29 @@ cdef class TopDownRuleInduction(RuleInduction):
     pass
 
 
+cdef class BatchRuleInduction(RuleInduction):
+    pass
+
+
+cdef class BeamSearchRuleInduction(RuleInduction):
+    pass
+
+
+cdef class ShardedRuleInduction(RuleInduction):
+    pass
+
+
+cdef class ShardWorker:
+
+    # Attributes:
+
+    cdef unique_ptr[ShardWorkerImpl] shard_worker_ptr
+
+    # Functions:
+
+    cpdef bint serve(self, str socket_path, uint32 timeout)
+
+
 cdef class Predictions:
 
     # Attributes:
@@ -111,12 +208,13 @@ cdef class RuleModelInduction:
 
     # Functions:
 
-    cdef __visit_ground_truth(self, const vector[uint32]& vec)
+    cdef void __visit_ground_truth(self, const vector[uint32]& vec) with gil
 
-    cdef __visit_prediction(self, const vector[uint32]& vec)
+    cdef void __visit_prediction(self, const vector[uint32]& vec) with gil
 
     cpdef RuleModel induce_rules(self, NominalFeatureMask nominal_feature_mask, FeatureMatrix feature_matrix,
-                                 LabelMatrix label_matrix, uint32 random_state, ModelBuilder model_builder)
+                                 LabelMatrix label_matrix, uint32 random_state, ModelBuilder model_builder,
+                                 RuleModel initial_model)
 
 
 cdef class SequentialRuleModelInduction(RuleModelInduction):
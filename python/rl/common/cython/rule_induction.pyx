@@ -5,7 +5,7 @@ from rl.common.cython._types cimport float32
 from rl.common.cython.head_refinement cimport HeadRefinementFactory
 from rl.common.cython.sampling cimport InstanceSubSamplingFactory, FeatureSubSamplingFactory, PartitionSamplingFactory
 from rl.common.cython.statistics cimport StatisticsProviderFactory
-from rl.common.cython.stopping cimport StoppingCriterion
+from rl.common.cython.stopping cimport StoppingCriterion, CancellationToken
 from rl.common.cython.thresholds cimport ThresholdsFactory
 
 from cython.operator cimport dereference, postincrement
@@ -26,17 +26,153 @@ cdef class TopDownRuleInduction(RuleInduction):
     A wrapper for the C++ class `TopDownRuleInduction`.
     """
 
-    def __cinit__(self, float32 min_support, intp max_conditions, uint32 num_threads):
+    def __cinit__(self, float32 min_support, intp max_conditions, float32 screening_sample_size,
+                  uint32 num_screened_features, uint32 num_threads):
         """
         :param min_support:             The minimum fraction of the training examples that must be covered by a rule.
                                         Must be at least 1
         :param max_conditions:          The maximum number of conditions to be included in a rule's body. Must be at
                                         least 1 or -1, if the number of conditions should not be restricted
+        :param screening_sample_size:   The fraction of the examples to be used for screening the features. Must be in
+                                        (0, 1]. If 1, the features are not screened
+        :param num_screened_features:   The number of features with the best estimates to be retained by the screening.
+                                        Must be at least 1
         :param num_threads:             The number of CPU threads to be used to search for potential refinements of a
                                         rule in parallel. Must be at least 1
         """
         self.rule_induction_ptr = <shared_ptr[IRuleInduction]>make_shared[TopDownRuleInductionImpl](
-            min_support, max_conditions, num_threads)
+            min_support, max_conditions, screening_sample_size, num_screened_features, num_threads)
+
+
+cdef class BatchRuleInduction(RuleInduction):
+    """
+    A wrapper for the C++ class `BatchRuleInduction`.
+    """
+
+    def __cinit__(self, uint32 batch_size, float32 max_overlap, float32 min_support, intp max_conditions,
+                  uint32 num_threads):
+        """
+        :param batch_size:              The maximum number of rules to be induced based on a single scan of the sampled
+                                        features. Must be at least 1
+        :param max_overlap:             The maximum fraction of the examples covered by the first condition of a rule
+                                        that may also be covered by the first conditions of the preceding rules in the
+                                        same batch. Must be in [0, 1]
+        :param min_support:             The minimum fraction of the training examples that must be covered by a rule.
+                                        Must be in [0, 1)
+        :param max_conditions:          The maximum number of conditions to be included in a rule's body. Must be at
+                                        least 1 or -1, if the number of conditions should not be restricted
+        :param num_threads:             The number of CPU threads to be used to search for potential refinements of a
+                                        rule in parallel. Must be at least 1
+        """
+        self.rule_induction_ptr = <shared_ptr[IRuleInduction]>make_shared[BatchRuleInductionImpl](
+            batch_size, max_overlap, min_support, max_conditions, num_threads)
+
+
+cdef class BeamSearchRuleInduction(RuleInduction):
+    """
+    A wrapper for the C++ class `BeamSearchRuleInduction`.
+    """
+
+    def __cinit__(self, uint32 beam_width, float32 min_support, intp max_conditions, uint32 num_threads):
+        """
+        :param beam_width:              The maximum number of rules to be retained at each iteration of the search.
+                                        Must be at least 1
+        :param min_support:             The minimum fraction of the training examples that must be covered by a rule.
+                                        Must be in [0, 1)
+        :param max_conditions:          The maximum number of conditions to be included in a rule's body. Must be at
+                                        least 1 or -1, if the number of conditions should not be restricted
+        :param num_threads:             The number of CPU threads to be used to search for potential refinements of a
+                                        rule in parallel. Must be at least 1
+        """
+        self.rule_induction_ptr = <shared_ptr[IRuleInduction]>make_shared[BeamSearchRuleInductionImpl](
+            beam_width, min_support, max_conditions, num_threads)
+
+
+cdef class ShardedRuleInduction(RuleInduction):
+    """
+    A wrapper for the C++ class `ShardedRuleInduction`.
+    """
+
+    def __cinit__(self, list socket_paths, float32 min_support, intp max_conditions, uint32 timeout):
+        """
+        :param socket_paths:            A list that contains the paths of the Unix domain sockets, the workers that are
+                                        responsible for the individual shards of the features listen at
+        :param min_support:             The minimum fraction of the training examples that must be covered by a rule.
+                                        Must be in [0, 1)
+        :param max_conditions:          The maximum number of conditions to be included in a rule's body. Must be at
+                                        least 1 or -1, if the number of conditions should not be restricted
+        :param timeout:                 The maximum number of seconds to wait for each worker to become available
+        """
+        cdef unique_ptr[vector[shared_ptr[IChannel]]] channels_ptr = make_unique[vector[shared_ptr[IChannel]]]()
+        cdef unique_ptr[SocketChannelImpl] channel_ptr
+        cdef string path
+
+        for socket_path in socket_paths:
+            path = socket_path.encode('utf-8')
+
+            with nogil:
+                channel_ptr = SocketChannelImpl.connect(path, timeout)
+
+            if not channel_ptr:
+                raise RuntimeError('Failed to connect to worker at \'' + socket_path + '\'')
+
+            channels_ptr.get().push_back(<shared_ptr[IChannel]>shared_ptr[SocketChannelImpl](channel_ptr.release()))
+
+        self.rule_induction_ptr = <shared_ptr[IRuleInduction]>make_shared[ShardedRuleInductionImpl](
+            move(channels_ptr), min_support, max_conditions)
+
+
+cdef class ShardWorker:
+    """
+    A wrapper for the C++ class `ShardWorker`.
+    """
+
+    def __cinit__(self, StatisticsProviderFactory statistics_provider_factory, ThresholdsFactory thresholds_factory,
+                  HeadRefinementFactory head_refinement_factory, NominalFeatureMask nominal_feature_mask,
+                  FeatureMatrix feature_matrix, LabelMatrix label_matrix, uint32 num_threads):
+        """
+        :param statistics_provider_factory: A factory that allows to create a provider that provides access to the
+                                            statistics which serve as the basis for learning rules
+        :param thresholds_factory:          A factory that allows to create objects that provide access to the
+                                            thresholds that may be used by the conditions of rules
+        :param head_refinement_factory:     The factory that allows to create instances of the class that implements
+                                            the strategy that should be used to find the heads of rules
+        :param nominal_feature_mask:        A mask that provides access to the information whether individual features
+                                            are nominal or not
+        :param feature_matrix:              A matrix that provides access to the feature values of the training
+                                            examples
+        :param label_matrix:                A matrix that provides access to the labels of the training examples
+        :param num_threads:                 The number of CPU threads to be used to search for potential refinements of
+                                            a rule in parallel. Must be at least 1
+        """
+        self.shard_worker_ptr = make_unique[ShardWorkerImpl](
+            statistics_provider_factory.statistics_provider_factory_ptr, thresholds_factory.thresholds_factory_ptr,
+            head_refinement_factory.head_refinement_factory_ptr, nominal_feature_mask.nominal_feature_mask_ptr,
+            feature_matrix.feature_matrix_ptr, label_matrix.label_matrix_ptr, num_threads)
+
+    cpdef bint serve(self, str socket_path, uint32 timeout):
+        """
+        Creates a Unix domain socket at a specific path, waits until the coordinator connects to it and processes its
+        requests until it stops the worker. If the socket cannot be created, or if the coordinator does not connect
+        before the timeout is reached, a `RuntimeError` is raised.
+
+        :param socket_path: The path of the socket
+        :param timeout:     The maximum number of seconds to wait for the coordinator to connect
+        :return:            True, if the worker has been stopped by the coordinator, False, if the connection has been
+                            closed unexpectedly
+        """
+        cdef ShardWorkerImpl* shard_worker_ptr = self.shard_worker_ptr.get()
+        cdef string path = socket_path.encode('utf-8')
+        cdef unique_ptr[SocketChannelImpl] channel_ptr
+        cdef bool result
+
+        with nogil:
+            channel_ptr = SocketChannelImpl.listen(path, timeout)
+
+        with nogil:
+            result = shard_worker_ptr.serve(dereference(channel_ptr.get()))
+
+        return result
 
 
 cdef class Predictions:
@@ -62,20 +198,48 @@ cdef class RuleModelInduction:
         self.predictions = Predictions.__new__(Predictions)
 
     cpdef RuleModel induce_rules(self, NominalFeatureMask nominal_feature_mask, FeatureMatrix feature_matrix,
-                                 LabelMatrix label_matrix, uint32 random_state, ModelBuilder model_builder):
+                                 LabelMatrix label_matrix, uint32 random_state, ModelBuilder model_builder,
+                                 RuleModel initial_model):
+        """
+        Induces rules and returns a model that consists of the induced rules.
+
+        :param nominal_feature_mask:    A mask that provides access to the information whether individual features are
+                                        nominal or not
+        :param feature_matrix:          A matrix that provides access to the feature values of the training examples
+        :param label_matrix:            A matrix that provides access to the labels of the training examples
+        :param random_state:            The seed to be used by RNGs
+        :param model_builder:           The builder, the induced rules should be added to
+        :param initial_model:           A model that contains rules that have been induced previously and should be
+                                        continued or None, if the rules should be induced from scratch
+        :return:                        A model that consists of the induced rules
+        """
         cdef shared_ptr[IRuleModelInduction] rule_model_induction_ptr = self.rule_model_induction_ptr
         cdef unique_ptr[RNG] rng_ptr = make_unique[RNG](random_state)
-        cdef unique_ptr[RuleModelImpl] rule_model_ptr = rule_model_induction_ptr.get().induceRules(
-            nominal_feature_mask.nominal_feature_mask_ptr, feature_matrix.feature_matrix_ptr,
-            label_matrix.label_matrix_ptr, dereference(rng_ptr.get()),
-            dereference(model_builder.model_builder_ptr.get()),
-            wrapPredictionVisitor(<void *> self, <PredictionCythonVisitor> self.__visit_ground_truth),
-            wrapPredictionVisitor(<void *> self, <PredictionCythonVisitor> self.__visit_prediction))
+        cdef shared_ptr[INominalFeatureMask] nominal_feature_mask_ptr = nominal_feature_mask.nominal_feature_mask_ptr
+        cdef shared_ptr[IFeatureMatrix] feature_matrix_ptr = feature_matrix.feature_matrix_ptr
+        cdef shared_ptr[ILabelMatrix] label_matrix_ptr = label_matrix.label_matrix_ptr
+        cdef IModelBuilder* model_builder_ptr = model_builder.model_builder_ptr.get()
+        cdef const RuleModelImpl* initial_model_ptr = NULL
+        cdef void* visitor_self = <void *> self
+        cdef unique_ptr[RuleModelImpl] rule_model_ptr
+
+        if initial_model is not None:
+            initial_model_ptr = initial_model.model_ptr.get()
+
+        # The GIL is released while the rules are induced, such that the induction can be canceled from a different
+        # thread. It is only re-acquired by the visitors...
+        with nogil:
+            rule_model_ptr = rule_model_induction_ptr.get().induceRules(
+                nominal_feature_mask_ptr, feature_matrix_ptr, label_matrix_ptr, dereference(rng_ptr.get()),
+                dereference(model_builder_ptr), initial_model_ptr,
+                wrapPredictionVisitor(visitor_self, <PredictionCythonVisitor> RuleModelInduction.__visit_ground_truth),
+                wrapPredictionVisitor(visitor_self, <PredictionCythonVisitor> RuleModelInduction.__visit_prediction))
+
         cdef RuleModel model = RuleModel()
         model.model_ptr = move(rule_model_ptr)
         return model
 
-    cdef __visit_ground_truth(self, const vector[uint32]& vec):
+    cdef void __visit_ground_truth(self, const vector[uint32]& vec) with gil:
         cdef list value_list = []
 
         cdef vector[uint32].const_iterator it = vec.const_begin()
@@ -90,7 +254,7 @@ cdef class RuleModelInduction:
         cdef Predictions predictions = self.predictions
         predictions.ground_truth = value_list
 
-    cdef __visit_prediction(self, const vector[uint32]& vec):
+    cdef void __visit_prediction(self, const vector[uint32]& vec) with gil:
         cdef list value_list = []
 
         cdef vector[uint32].const_iterator it = vec.const_begin()
@@ -117,7 +281,9 @@ cdef class SequentialRuleModelInduction(RuleModelInduction):
                   HeadRefinementFactory head_refinement_factory,
                   InstanceSubSamplingFactory instance_sub_sampling_factory,
                   FeatureSubSamplingFactory feature_sub_sampling_factory,
-                  PartitionSamplingFactory partition_sampling_factory, list stopping_criteria):
+                  PartitionSamplingFactory partition_sampling_factory, list stopping_criteria,
+                  CancellationToken cancellation_token, uint32 max_inherited_rules, bint verify_inherited_rules,
+                  uint32 num_threads, str checkpoint_path, uint32 checkpoint_interval):
         """
         :param statistics_provider_factory:             A factory that allows to create a provider that provides access
                                                         to the statistics which serve as the basis for learning rules
@@ -141,6 +307,20 @@ cdef class SequentialRuleModelInduction(RuleModelInduction):
                                                         training set and a holdout set
         :param stopping_criteria                        A list that contains the stopping criteria that should be used
                                                         to decide whether additional rules should be induced or not
+        :param cancellation_token:                      A token that allows to cancel the induction of rules, even while
+                                                        a rule is being induced
+        :param max_inherited_rules:                     The maximum number of rules to be inherited from an existing
+                                                        model or 0, if all (used) rules should be inherited
+        :param verify_inherited_rules:                  True, if rules that are inherited from an existing model should
+                                                        only be retained if they improve the quality of the model with
+                                                        respect to the current training examples, False otherwise
+        :param num_threads:                             The number of CPU threads to be used to apply the rules that are
+                                                        inherited from an existing model in parallel. Must be at least 1
+        :param checkpoint_path:                         The path of the file, checkpoints should be written to, or an
+                                                        empty string, if no checkpoints should be written. If the file
+                                                        exists, the induction of rules is resumed from the checkpoint
+        :param checkpoint_interval:                     The number of rules after which a checkpoint should be written.
+                                                        Must be at least 1
         """
 
         cdef unique_ptr[forward_list[shared_ptr[IStoppingCriterion]]] stopping_criteria_ptr = make_unique[forward_list[shared_ptr[IStoppingCriterion]]]()
@@ -158,4 +338,6 @@ cdef class SequentialRuleModelInduction(RuleModelInduction):
             head_refinement_factory.head_refinement_factory_ptr,
             instance_sub_sampling_factory.instance_sub_sampling_factory_ptr,
             feature_sub_sampling_factory.feature_sub_sampling_factory_ptr,
-            partition_sampling_factory.partition_sampling_factory_ptr, move(stopping_criteria_ptr))
+            partition_sampling_factory.partition_sampling_factory_ptr, move(stopping_criteria_ptr),
+            cancellation_token.cancellation_token_ptr, max_inherited_rules, verify_inherited_rules, num_threads,
+            checkpoint_path.encode('utf-8'), checkpoint_interval)
@@ -1,5 +1,7 @@
 from rl.common.cython._types cimport uint32, float32
 
+from libcpp cimport bool
+
 from libcpp.memory cimport shared_ptr
 
 
@@ -43,6 +45,15 @@ cdef extern from "common/sampling/instance_sampling_random.hpp" nogil:
         RandomInstanceSubsetSelectionFactoryImpl(float32 sampleSize) except +
 
 
+cdef extern from "common/sampling/instance_sampling_time_slots.hpp" nogil:
+
+    cdef cppclass TimeSlotSubsetSelectionFactoryImpl"TimeSlotSubsetSelectionFactory"(IInstanceSubSamplingFactory):
+
+        # Constructors:
+
+        TimeSlotSubsetSelectionFactoryImpl(float32 sampleSize, uint32 blockSize) except +
+
+
 cdef extern from "common/sampling/instance_sampling_no.hpp" nogil:
 
     cdef cppclass NoInstanceSubSamplingFactoryImpl"NoInstanceSubSamplingFactory"(IInstanceSubSamplingFactory):
@@ -65,6 +76,16 @@ cdef extern from "common/sampling/feature_sampling_random.hpp" nogil:
         RandomFeatureSubsetSelectionFactoryImpl(float32 sampleSize) except +
 
 
+cdef extern from "common/sampling/feature_sampling_adaptive.hpp" nogil:
+
+    cdef cppclass AdaptiveFeatureSubsetSelectionFactoryImpl"AdaptiveFeatureSubsetSelectionFactory"(
+            IFeatureSubSamplingFactory):
+
+        # Constructors
+
+        AdaptiveFeatureSubsetSelectionFactoryImpl(float32 sampleSize, float32 decay, float32 explorationRate) except +
+
+
 cdef extern from "common/sampling/feature_sampling_no.hpp" nogil:
 
     cdef cppclass NoFeatureSubSamplingFactoryImpl"NoFeatureSubSamplingFactory"(IFeatureSubSamplingFactory):
@@ -92,6 +113,16 @@ cdef extern from "common/sampling/partition_sampling_bi_random.hpp" nogil:
         RandomBiPartitionSamplingFactoryImpl(float32 holdout_set_size) except +
 
 
+cdef extern from "common/sampling/partition_sampling_bi_time_slots.hpp" nogil:
+
+    cdef cppclass TimeSlotBiPartitionSamplingFactoryImpl"TimeSlotBiPartitionSamplingFactory"(
+            IPartitionSamplingFactory):
+
+        # Constructors:
+
+        TimeSlotBiPartitionSamplingFactoryImpl(float32 holdoutSetSize, uint32 blockSize, bool interleaved) except +
+
+
 cdef class InstanceSubSamplingFactory:
 
     # Attributes:
@@ -107,6 +138,10 @@ cdef class RandomInstanceSubsetSelectionFactory(InstanceSubSamplingFactory):
     pass
 
 
+cdef class TimeSlotSubsetSelectionFactory(InstanceSubSamplingFactory):
+    pass
+
+
 cdef class NoInstanceSubSamplingFactory(InstanceSubSamplingFactory):
     pass
 
@@ -122,6 +157,10 @@ cdef class RandomFeatureSubsetSelectionFactory(FeatureSubSamplingFactory):
     pass
 
 
+cdef class AdaptiveFeatureSubsetSelectionFactory(FeatureSubSamplingFactory):
+    pass
+
+
 cdef class NoFeatureSubSamplingFactory(FeatureSubSamplingFactory):
     pass
 
@@ -139,3 +178,7 @@ cdef class NoPartitionSamplingFactory(PartitionSamplingFactory):
 
 cdef class RandomBiPartitionSamplingFactory(PartitionSamplingFactory):
     pass
+
+
+cdef class TimeSlotBiPartitionSamplingFactory(PartitionSamplingFactory):
+    pass
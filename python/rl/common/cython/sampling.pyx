@@ -39,6 +39,21 @@ cdef class RandomInstanceSubsetSelectionFactory(InstanceSubSamplingFactory):
             sample_size)
 
 
+cdef class TimeSlotSubsetSelectionFactory(InstanceSubSamplingFactory):
+    """
+    A wrapper for the C++ class `TimeSlotSubsetSelectionFactory`.
+    """
+
+    def __cinit__(self, float32 sample_size = 0.66, uint32 block_size = 1):
+        """
+        :param sample_size: The fraction of blocks of time slots to be included in the sample (e.g. a value of 0.6
+                            corresponds to 60 % of the available blocks). Must be in (0, 1)
+        :param block_size:  The number of consecutive time slots that belong to a single block. Must be at least 1
+        """
+        self.instance_sub_sampling_factory_ptr = <shared_ptr[IInstanceSubSamplingFactory]>make_shared[TimeSlotSubsetSelectionFactoryImpl](
+            sample_size, block_size)
+
+
 cdef class NoInstanceSubSamplingFactory(InstanceSubSamplingFactory):
     """
     A wrapper for the C++ class `NoInstanceSubSamplingFactory`.
@@ -70,6 +85,25 @@ cdef class RandomFeatureSubsetSelectionFactory(FeatureSubSamplingFactory):
             sample_size)
 
 
+cdef class AdaptiveFeatureSubsetSelectionFactory(FeatureSubSamplingFactory):
+    """
+    A wrapper for the C++ class `AdaptiveFeatureSubsetSelectionFactory`.
+    """
+
+    def __cinit__(self, float32 sample_size = 0.0, float32 decay = 0.9, float32 exploration_rate = 0.1):
+        """
+        :param sample_size:         The fraction of features to be included in the sample (e.g. a value of 0.6
+                                    corresponds to 60 % of the available features). Must be in (0, 1) or 0, if the
+                                    default sample size `floor(log2(num_features - 1) + 1)` should be used
+        :param decay:               The factor, the gain that is recorded for a feature is multiplied by each time the
+                                    feature is used, before it is replaced by a greater gain. Must be in [0, 1]
+        :param exploration_rate:    The fraction of the probability mass to be distributed uniformly among all
+                                    features. Must be in (0, 1]
+        """
+        self.feature_sub_sampling_factory_ptr = <shared_ptr[IFeatureSubSamplingFactory]>make_shared[AdaptiveFeatureSubsetSelectionFactoryImpl](
+            sample_size, decay, exploration_rate)
+
+
 cdef class NoFeatureSubSamplingFactory(FeatureSubSamplingFactory):
     """
     A wrapper for the C++ class `NoFeatureSubSamplingFactory`.
@@ -107,3 +141,21 @@ cdef class RandomBiPartitionSamplingFactory(PartitionSamplingFactory):
         """
         self.partition_sampling_factory_ptr = <shared_ptr[IPartitionSamplingFactory]>make_shared[RandomBiPartitionSamplingFactoryImpl](
             holdout_set_size)
+
+
+cdef class TimeSlotBiPartitionSamplingFactory(PartitionSamplingFactory):
+    """
+    A wrapper for the C++ class `TimeSlotBiPartitionSamplingFactory`.
+    """
+
+    def __cinit__(self, float32 holdout_set_size, uint32 block_size, bint interleaved):
+        """
+        :param holdout_set_size:    The fraction of blocks to be included in the holdout set (e.g. a value of 0.2
+                                    corresponds to 20 % of the available blocks). Must be in (0, 1)
+        :param block_size:          The number of consecutive time slots that belong to a single block. Must be at least
+                                    1
+        :param interleaved:         True, if the blocks in the holdout set should be evenly spread across the entire
+                                    period of time, False, if the last blocks should be used as the holdout set
+        """
+        self.partition_sampling_factory_ptr = <shared_ptr[IPartitionSamplingFactory]>make_shared[TimeSlotBiPartitionSamplingFactoryImpl](
+            holdout_set_size, block_size, interleaved)
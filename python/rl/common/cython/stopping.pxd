@@ -1,4 +1,6 @@
-from rl.common.cython._types cimport uint32
+from rl.common.cython._types cimport uint32, float64
+
+from libcpp cimport bool
 
 from libcpp.memory cimport shared_ptr
 
@@ -27,6 +29,37 @@ cdef extern from "common/stopping/stopping_criterion_time.hpp" nogil:
         TimeStoppingCriterionImpl(uint32 timeLimit) except +
 
 
+cdef extern from "common/stopping/stopping_criterion_plateau.hpp" nogil:
+
+    cdef cppclass PlateauStoppingCriterionImpl"PlateauStoppingCriterion"(IStoppingCriterion):
+
+        # Constructors:
+
+        PlateauStoppingCriterionImpl(uint32 windowSize, float64 minImprovement, bool forceStop) except +
+
+
+cdef extern from "common/stopping/stopping_criterion_holdout.hpp" nogil:
+
+    cdef cppclass HoldoutStoppingCriterionImpl"HoldoutStoppingCriterion"(IStoppingCriterion):
+
+        # Constructors:
+
+        HoldoutStoppingCriterionImpl(uint32 patience, bool forceStop) except +
+
+
+cdef extern from "common/stopping/cancellation_token.hpp" nogil:
+
+    cdef cppclass CancellationTokenImpl"CancellationToken":
+
+        # Constructors:
+
+        CancellationTokenImpl(uint32 timeLimit) except +
+
+        # Functions:
+
+        void cancel()
+
+
 cdef class StoppingCriterion:
 
     # Attributes:
@@ -40,3 +73,18 @@ cdef class SizeStoppingCriterion(StoppingCriterion):
 
 cdef class TimeStoppingCriterion(StoppingCriterion):
     pass
+
+
+cdef class PlateauStoppingCriterion(StoppingCriterion):
+    pass
+
+
+cdef class HoldoutStoppingCriterion(StoppingCriterion):
+    pass
+
+
+cdef class CancellationToken:
+
+    # Attributes:
+
+    cdef shared_ptr[CancellationTokenImpl] cancellation_token_ptr
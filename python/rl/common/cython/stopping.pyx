@@ -33,3 +33,59 @@ cdef class TimeStoppingCriterion(StoppingCriterion):
         :param time_limit: The time limit in seconds
         """
         self.stopping_criterion_ptr = <shared_ptr[IStoppingCriterion]>make_shared[TimeStoppingCriterionImpl](time_limit)
+
+
+cdef class PlateauStoppingCriterion(StoppingCriterion):
+    """
+    A wrapper for the C++ class `PlateauStoppingCriterion`.
+    """
+
+    def __cinit__(self, uint32 window_size, float64 min_improvement, bint force_stop):
+        """
+        :param window_size:     The number of rules, the improvement of the model's quality should be calculated over.
+                                Must be at least 1
+        :param min_improvement: The minimum improvement in terms of the model's quality over the given number of rules.
+                                Must be at least 0
+        :param force_stop:      True, if the induction of rules should be forced to be stopped, if the improvement falls
+                                below the threshold, False, if the number of rules at the beginning of the window should
+                                only be stored as a potential point for stopping
+        """
+        self.stopping_criterion_ptr = <shared_ptr[IStoppingCriterion]>make_shared[PlateauStoppingCriterionImpl](
+            window_size, min_improvement, force_stop)
+
+
+cdef class HoldoutStoppingCriterion(StoppingCriterion):
+    """
+    A wrapper for the C++ class `HoldoutStoppingCriterion`.
+    """
+
+    def __cinit__(self, uint32 patience, bint force_stop):
+        """
+        :param patience:    The number of consecutive rules that may not improve the quality of the model on the holdout
+                            set, before the induction of rules is stopped. Must be at least 1
+        :param force_stop:  True, if the induction of rules should be forced to be stopped, if the quality has not
+                            improved, False, if the number of rules that resulted in the best quality should only be
+                            stored as a potential point for stopping
+        """
+        self.stopping_criterion_ptr = <shared_ptr[IStoppingCriterion]>make_shared[HoldoutStoppingCriterionImpl](
+            patience, force_stop)
+
+
+cdef class CancellationToken:
+    """
+    A wrapper for the C++ class `CancellationToken`.
+    """
+
+    def __cinit__(self, uint32 time_limit):
+        """
+        :param time_limit: The time limit in seconds or 0, if no time limit should be used
+        """
+        self.cancellation_token_ptr = make_shared[CancellationTokenImpl](time_limit)
+
+    def cancel(self):
+        """
+        Cancels the induction of rules. The rule that is currently being induced is discarded. May be called from a
+        different thread than the one that induces the rules.
+        """
+        with nogil:
+            self.cancellation_token_ptr.get().cancel()
@@ -1,10 +1,14 @@
+from rl.common.cython._types cimport uint32
 from rl.common.cython.thresholds cimport ThresholdsFactory, IThresholdsFactory
 
 
 cdef extern from "common/thresholds/thresholds_exact.hpp" nogil:
 
     cdef cppclass ExactThresholdsFactoryImpl"ExactThresholdsFactory"(IThresholdsFactory):
-        pass
+
+        # Constructors:
+
+        ExactThresholdsFactoryImpl(bint compressCache, uint32 prefetchWindow) except +
 
 
 cdef class ExactThresholdsFactory(ThresholdsFactory):
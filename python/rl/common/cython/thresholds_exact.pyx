@@ -9,5 +9,16 @@ cdef class ExactThresholdsFactory(ThresholdsFactory):
     A wrapper for the C++ class `ExactThresholdsFactory`.
     """
 
-    def __cinit__(self):
-        self.thresholds_factory_ptr = <shared_ptr[IThresholdsFactory]>make_shared[ExactThresholdsFactoryImpl]()
+    def __cinit__(self, bint compress_cache = False, uint32 prefetch_window = 0):
+        """
+        :param compress_cache:  True, if the feature vectors that are cached by the thresholds should be stored in a
+                                compressed form, which reduces the memory footprint of the cache at the expense of
+                                decompressing the feature vectors whenever they are accessed, unless they have been
+                                accessed recently, False otherwise
+        :param prefetch_window: The maximum number of feature vectors to be prefetched in the background, if the
+                                feature vectors should not be cached, but fetched from the feature matrix whenever they
+                                are needed, or 0, if they should be cached. If the feature vectors are not cached, the
+                                argument `compress_cache` is ignored
+        """
+        self.thresholds_factory_ptr = <shared_ptr[IThresholdsFactory]>make_shared[ExactThresholdsFactoryImpl](
+            compress_cache, prefetch_window)
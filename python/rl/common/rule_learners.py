@@ -6,6 +6,7 @@
 import os
 from abc import abstractmethod
 from ast import literal_eval
+from copy import copy
 from enum import Enum
 from typing import List
 
@@ -14,21 +15,58 @@ from scipy.sparse import issparse, isspmatrix_lil, isspmatrix_coo, isspmatrix_do
 from sklearn.utils import check_array
 
 from rl.common.arrays import enforce_dense
-from rl.common.cython.input import CContiguousLabelMatrix
-from rl.common.cython.input import DokNominalFeatureMask, EqualNominalFeatureMask
-from rl.common.cython.input import FortranContiguousFeatureMatrix, CscFeatureMatrix
-from rl.common.cython.model import ModelBuilder
-from rl.common.cython.rule_induction import RuleModelInduction
+from rl.common.cython.input import ArrowFeatureMatrix, ArrowTable, TimeSlotLabelMatrix, FeatureMatrix, LabelMatrix
+from rl.common.cython.input import NominalFeatureMask, DokNominalFeatureMask, EqualNominalFeatureMask
+from rl.common.cython.input import FortranContiguousFeatureMatrix, CscFeatureMatrix, PresortedFeatureMatrix
+from rl.common.cython.model import ModelBuilder, RuleModel
+from rl.common.cython.rule_induction import RuleModelInduction, ShardWorker
 from rl.common.cython.sampling import FeatureSubSamplingFactory, RandomFeatureSubsetSelectionFactory, \
-    NoFeatureSubSamplingFactory
-from rl.common.cython.stopping import StoppingCriterion, SizeStoppingCriterion, TimeStoppingCriterion
+    AdaptiveFeatureSubsetSelectionFactory, NoFeatureSubSamplingFactory
+from rl.common.cython.sampling import InstanceSubSamplingFactory, TimeSlotSubsetSelectionFactory, \
+    NoInstanceSubSamplingFactory
+from rl.common.cython.sampling import PartitionSamplingFactory, TimeSlotBiPartitionSamplingFactory, \
+    NoPartitionSamplingFactory
+from rl.common.cython.stopping import StoppingCriterion, SizeStoppingCriterion, TimeStoppingCriterion, \
+    PlateauStoppingCriterion, HoldoutStoppingCriterion
 from rl.common.learners import Learner, NominalAttributeLearner
-from rl.common.types import DTYPE_UINT32, DTYPE_FLOAT32
+from rl.common.types import DTYPE_UINT16, DTYPE_UINT32, DTYPE_FLOAT32
+
+INSTANCE_SUB_SAMPLING_TIME_SLOTS = 'time-slot-selection'
 
 FEATURE_SUB_SAMPLING_RANDOM = 'random-feature-selection'
 
+FEATURE_SUB_SAMPLING_ADAPTIVE = 'adaptive-feature-selection'
+
+PARTITION_SAMPLING_TIME_SLOTS = 'time-slot-holdout'
+
+EARLY_STOPPING_PLATEAU = 'plateau'
+
+EARLY_STOPPING_HOLDOUT = 'holdout'
+
 ARGUMENT_SAMPLE_SIZE = 'sample_size'
 
+ARGUMENT_BLOCK_SIZE = 'block_size'
+
+ARGUMENT_DECAY = 'decay'
+
+ARGUMENT_EXPLORATION_RATE = 'exploration_rate'
+
+ARGUMENT_WINDOW_SIZE = 'window_size'
+
+ARGUMENT_MIN_IMPROVEMENT = 'min_improvement'
+
+ARGUMENT_FORCE_STOP = 'force_stop'
+
+ARGUMENT_HOLDOUT_SET_SIZE = 'holdout_set_size'
+
+ARGUMENT_INTERLEAVED = 'interleaved'
+
+ARGUMENT_PATIENCE = 'patience'
+
+MAX_NUM_COMPACT_TIME_SLOTS = np.iinfo(DTYPE_UINT16).max + 1
+
+MAX_NUM_EXAMPLES = np.iinfo(DTYPE_UINT32).max
+
 
 class SparsePolicy(Enum):
     AUTO = 'auto'
@@ -49,19 +87,52 @@ def create_sparse_policy(policy: str) -> SparsePolicy:
             [x.value for x in SparsePolicy]))
 
 
+def create_instance_sub_sampling_factory(instance_sub_sampling: str) -> InstanceSubSamplingFactory:
+    if instance_sub_sampling is None:
+        return NoInstanceSubSamplingFactory()
+    else:
+        prefix, args = parse_prefix_and_dict(instance_sub_sampling, [INSTANCE_SUB_SAMPLING_TIME_SLOTS])
+
+        if prefix == INSTANCE_SUB_SAMPLING_TIME_SLOTS:
+            sample_size = get_float_argument(args, ARGUMENT_SAMPLE_SIZE, 0.66, lambda x: 0 < x < 1)
+            block_size = get_int_argument(args, ARGUMENT_BLOCK_SIZE, 1, lambda x: x >= 1)
+            return TimeSlotSubsetSelectionFactory(sample_size, block_size)
+        raise ValueError('Invalid value given for parameter \'instance_sub_sampling\': ' + str(instance_sub_sampling))
+
+
 def create_feature_sub_sampling_factory(feature_sub_sampling: str) -> FeatureSubSamplingFactory:
     if feature_sub_sampling is None:
         return NoFeatureSubSamplingFactory()
     else:
-        prefix, args = parse_prefix_and_dict(feature_sub_sampling, [FEATURE_SUB_SAMPLING_RANDOM])
+        prefix, args = parse_prefix_and_dict(feature_sub_sampling,
+                                             [FEATURE_SUB_SAMPLING_RANDOM, FEATURE_SUB_SAMPLING_ADAPTIVE])
 
         if prefix == FEATURE_SUB_SAMPLING_RANDOM:
             sample_size = get_float_argument(args, ARGUMENT_SAMPLE_SIZE, 0.0, lambda x: 0 <= x < 1)
             return RandomFeatureSubsetSelectionFactory(sample_size)
+        elif prefix == FEATURE_SUB_SAMPLING_ADAPTIVE:
+            sample_size = get_float_argument(args, ARGUMENT_SAMPLE_SIZE, 0.0, lambda x: 0 <= x < 1)
+            decay = get_float_argument(args, ARGUMENT_DECAY, 0.9, lambda x: 0 <= x <= 1)
+            exploration_rate = get_float_argument(args, ARGUMENT_EXPLORATION_RATE, 0.1, lambda x: 0 < x <= 1)
+            return AdaptiveFeatureSubsetSelectionFactory(sample_size, decay, exploration_rate)
         raise ValueError('Invalid value given for parameter \'feature_sub_sampling\': ' + str(feature_sub_sampling))
 
 
-def create_stopping_criteria(max_rules: int, time_limit: int) -> List[StoppingCriterion]:
+def create_partition_sampling_factory(holdout: str) -> PartitionSamplingFactory:
+    if holdout is None:
+        return NoPartitionSamplingFactory()
+    else:
+        prefix, args = parse_prefix_and_dict(holdout, [PARTITION_SAMPLING_TIME_SLOTS])
+
+        if prefix == PARTITION_SAMPLING_TIME_SLOTS:
+            holdout_set_size = get_float_argument(args, ARGUMENT_HOLDOUT_SET_SIZE, 0.2, lambda x: 0 < x < 1)
+            block_size = get_int_argument(args, ARGUMENT_BLOCK_SIZE, 1, lambda x: x >= 1)
+            interleaved = get_bool_argument(args, ARGUMENT_INTERLEAVED, False)
+            return TimeSlotBiPartitionSamplingFactory(holdout_set_size, block_size, interleaved)
+        raise ValueError('Invalid value given for parameter \'holdout\': ' + str(holdout))
+
+
+def create_stopping_criteria(max_rules: int, time_limit: int, early_stopping: str = None) -> List[StoppingCriterion]:
     stopping_criteria: List[StoppingCriterion] = []
 
     if max_rules != -1:
@@ -76,6 +147,21 @@ def create_stopping_criteria(max_rules: int, time_limit: int) -> List[StoppingCr
         else:
             raise ValueError('Invalid value given for parameter \'time_limit\': ' + str(time_limit))
 
+    if early_stopping is not None:
+        prefix, args = parse_prefix_and_dict(early_stopping, [EARLY_STOPPING_PLATEAU, EARLY_STOPPING_HOLDOUT])
+
+        if prefix == EARLY_STOPPING_PLATEAU:
+            window_size = get_int_argument(args, ARGUMENT_WINDOW_SIZE, 20, lambda x: x >= 1)
+            min_improvement = get_float_argument(args, ARGUMENT_MIN_IMPROVEMENT, 0.001, lambda x: x >= 0)
+            force_stop = get_bool_argument(args, ARGUMENT_FORCE_STOP, True)
+            stopping_criteria.append(PlateauStoppingCriterion(window_size, min_improvement, force_stop))
+        elif prefix == EARLY_STOPPING_HOLDOUT:
+            patience = get_int_argument(args, ARGUMENT_PATIENCE, 10, lambda x: x >= 1)
+            force_stop = get_bool_argument(args, ARGUMENT_FORCE_STOP, True)
+            stopping_criteria.append(HoldoutStoppingCriterion(patience, force_stop))
+        else:
+            raise ValueError('Invalid value given for parameter \'early_stopping\': ' + str(early_stopping))
+
     return stopping_criteria
 
 
@@ -93,6 +179,43 @@ def create_max_conditions(max_conditions: int) -> int:
     return max_conditions
 
 
+def create_beam_width(beam_width: int) -> int:
+    if beam_width < 1:
+        raise ValueError('Invalid value given for parameter \'beam_width\': ' + str(beam_width))
+
+    return beam_width
+
+
+def create_screening_sample_size(screening_sample_size: float) -> float:
+    if screening_sample_size <= 0 or screening_sample_size > 1:
+        raise ValueError(
+            'Invalid value given for parameter \'screening_sample_size\': ' + str(screening_sample_size))
+
+    return screening_sample_size
+
+
+def create_num_screened_features(num_screened_features: int) -> int:
+    if num_screened_features < 1:
+        raise ValueError(
+            'Invalid value given for parameter \'num_screened_features\': ' + str(num_screened_features))
+
+    return num_screened_features
+
+
+def create_batch_size(batch_size: int) -> int:
+    if batch_size < 1:
+        raise ValueError('Invalid value given for parameter \'batch_size\': ' + str(batch_size))
+
+    return batch_size
+
+
+def create_max_overlap(max_overlap: float) -> float:
+    if max_overlap < 0 or max_overlap > 1:
+        raise ValueError('Invalid value given for parameter \'max_overlap\': ' + str(max_overlap))
+
+    return max_overlap
+
+
 def create_max_head_refinements(max_head_refinements: int) -> int:
     if max_head_refinements != -1 and max_head_refinements < 1:
         raise ValueError('Invalid value given for parameter \'max_head_refinements\': ' + str(max_head_refinements))
@@ -100,6 +223,48 @@ def create_max_head_refinements(max_head_refinements: int) -> int:
     return max_head_refinements
 
 
+def create_max_inherited_rules(max_inherited_rules: int) -> int:
+    if max_inherited_rules == -1:
+        return 0
+    elif max_inherited_rules < 1:
+        raise ValueError('Invalid value given for parameter \'max_inherited_rules\': ' + str(max_inherited_rules))
+
+    return max_inherited_rules
+
+
+def create_checkpoint_path(checkpoint_path: str) -> str:
+    if checkpoint_path is None:
+        return ''
+
+    return str(checkpoint_path)
+
+
+def create_checkpoint_interval(checkpoint_interval: int) -> int:
+    if checkpoint_interval < 1:
+        raise ValueError('Invalid value given for parameter \'checkpoint_interval\': ' + str(checkpoint_interval))
+
+    return checkpoint_interval
+
+
+def create_prefetch_window(prefetch_window: int) -> int:
+    if prefetch_window < 0:
+        raise ValueError('Invalid value given for parameter \'prefetch_window\': ' + str(prefetch_window))
+
+    return prefetch_window
+
+
+def create_shard_socket_paths(shard_sockets: str) -> List[str]:
+    if shard_sockets is None:
+        return []
+
+    socket_paths = [socket_path.strip() for socket_path in str(shard_sockets).split(',')]
+
+    if '' in socket_paths:
+        raise ValueError('Invalid value given for parameter \'shard_sockets\': ' + str(shard_sockets))
+
+    return socket_paths
+
+
 def get_preferred_num_threads(num_threads: int) -> int:
     if num_threads == -1:
         return os.cpu_count()
@@ -216,10 +381,186 @@ def should_enforce_sparse(m, sparse_format: SparseFormat, policy: SparsePolicy,
         'Matrix of type ' + type(m).__name__ + ' cannot be converted to format \'' + str(sparse_format) + '\'')
 
 
+def get_time_slot_dtype(num_time_slots: int):
+    """
+    Returns the most compact type that can be used to store the indices of a given number of time slots.
+
+    :param num_time_slots:  The number of time slots
+    :return:                The type `uint16`, if there are at most `MAX_NUM_COMPACT_TIME_SLOTS` time slots, the type
+                            `uint32` otherwise
+    """
+    return DTYPE_UINT16 if num_time_slots <= MAX_NUM_COMPACT_TIME_SLOTS else DTYPE_UINT32
+
+
+def get_time_slots(timestamps):
+    """
+    Assigns consecutive examples with the same timestamp to the same time slot.
+
+    :param timestamps:  An array, shape `(num_examples)`, that stores the timestamp of each example
+    :return:            An array, shape `(num_examples)`, that stores the index of the time slot each example belongs
+                        to using the type that is returned by the function `get_time_slot_dtype`, as well as an array,
+                        shape `(num_time_slots)`, that stores the index of the first example that belongs to each time
+                        slot
+    """
+    num_examples = timestamps.shape[0]
+    first_indices = np.flatnonzero(timestamps[1:] != timestamps[:-1]) + 1
+    time_slots = np.zeros(num_examples, dtype=get_time_slot_dtype(first_indices.shape[0] + 1))
+    time_slots[first_indices] = 1
+    np.cumsum(time_slots, out=time_slots)
+    return time_slots, (np.insert(first_indices, 0, 0) if num_examples > 0 else first_indices)
+
+
+class TrainingContext:
+    """
+    Validates a training data set and converts it into the format that is used by the C++ implementation once, such that
+    it can be reused for fitting several learners, e.g., with different hyper-parameters. If the feature values are
+    sorted in advance, the sorted feature values are shared by all learners that are fit using the context. As the
+    context is not modified by a learner, multiple learners may be fit concurrently in different threads.
+
+    Attributes
+        feature_matrix  The feature matrix
+        label_matrix    The label matrix
+        num_examples    The number of examples
+        num_features    The number of features
+        num_labels      The number of labels
+        time_slots      A `numpy.ndarray`, shape `(num_examples)`, that stores the index of the time slot each example
+                        belongs to
+        values          A `numpy.ndarray`, shape `(num_time_slots)`, that stores the ground truth of each time slot
+    """
+
+    def __init__(self, x, y, feature_format: str = 'auto', presort: bool = False, num_threads: int = 1):
+        """
+        :param x:               A `numpy.ndarray` or `scipy.sparse` matrix, shape `(num_examples, num_features)`, that
+                                stores the feature values of the training examples, a `FeatureMatrix`, e.g., a
+                                `MemoryMappedFeatureMatrix` that reads the feature values from a file, or an
+                                `ArrowTable`, whose buffers are accessed in place
+        :param y:               A `numpy.ndarray` or `scipy.sparse` matrix, shape `(num_examples, 2)`, that stores the
+                                time slot and the ground truth of the time slot each training example belongs to, an
+                                `ArrowTable` with two integer columns or a tuple that contains an array, shape
+                                `(num_examples)`, that stores the index of the time slot each example belongs to in
+                                increasing order, as well as an array, shape `(num_time_slots)`, that stores the ground
+                                truth of each time slot
+        :param feature_format:  The format to be used for the feature matrix. Must be 'sparse', 'dense' or 'auto'
+        :param presort:         True, if the feature values should be sorted in advance, False otherwise
+        :param num_threads:     The number of threads to be used for sorting the feature values in advance. Must be at
+                                least 1 or -1, if the number of cores available on the machine should be used
+        """
+        if isinstance(x, ArrowTable):
+            # The feature values are read from the buffers of a record batch, without copying them...
+            x = ArrowFeatureMatrix(x)
+
+        if isinstance(x, FeatureMatrix):
+            # The feature matrix has already been converted into the format used by the C++ implementation, e.g.,
+            # because it is read from a file...
+            feature_matrix = x
+            self.num_examples = feature_matrix.get_num_rows()
+            self.num_features = feature_matrix.get_num_cols()
+        else:
+            # Validate feature matrix and convert it to the preferred format...
+            x_sparse_format = SparseFormat.CSC
+            x_sparse_policy = create_sparse_policy(feature_format)
+            x_enforce_sparse = should_enforce_sparse(x, sparse_format=x_sparse_format, policy=x_sparse_policy,
+                                                     dtype=DTYPE_FLOAT32)
+            x = check_array((x if x_enforce_sparse else enforce_dense(x, order='F', dtype=DTYPE_FLOAT32)),
+                            accept_sparse=(x_sparse_format.value if x_enforce_sparse else False), dtype=DTYPE_FLOAT32,
+                            force_all_finite='allow-nan')
+            self.num_examples = x.shape[0]
+            self.num_features = x.shape[1]
+
+            # The C++ implementation uses indices of type `uint32` to identify examples and the non-zero feature values
+            # of sparse matrices...
+            if self.num_examples > MAX_NUM_EXAMPLES:
+                raise ValueError('The number of examples must not exceed ' + str(MAX_NUM_EXAMPLES) + ', but got '
+                                 + str(self.num_examples))
+
+            if issparse(x) and x.nnz > MAX_NUM_EXAMPLES:
+                raise ValueError('The number of non-zero feature values must not exceed ' + str(MAX_NUM_EXAMPLES)
+                                 + ', but got ' + str(x.nnz))
+
+            if issparse(x):
+                x_data = np.ascontiguousarray(x.data, dtype=DTYPE_FLOAT32)
+                x_row_indices = np.ascontiguousarray(x.indices, dtype=DTYPE_UINT32)
+                x_col_indices = np.ascontiguousarray(x.indptr, dtype=DTYPE_UINT32)
+                feature_matrix = CscFeatureMatrix(x.shape[0], x.shape[1], x_data, x_row_indices, x_col_indices)
+            else:
+                feature_matrix = FortranContiguousFeatureMatrix(x)
+
+        if presort:
+            feature_matrix = PresortedFeatureMatrix(feature_matrix, get_preferred_num_threads(num_threads))
+
+        self.feature_matrix = feature_matrix
+
+        # Validate label matrix and convert it to the preferred format...
+        if isinstance(y, ArrowTable):
+            y = y.to_label_array()
+
+        if isinstance(y, tuple):
+            # Time slots of type `uint32`, or `uint16` if possible, are used as they are, other types are converted...
+            values = np.ascontiguousarray(y[1], dtype=DTYPE_UINT32)
+            time_slots = np.asarray(y[0])
+            num_time_slots = values.shape[0]
+
+            if time_slots.ndim != 1 or time_slots.shape[0] != self.num_examples:
+                raise ValueError('Expected ' + str(self.num_examples) + ' time slots, but got ' + str(time_slots.shape))
+
+            if time_slots.shape[0] > 0:
+                if np.any(time_slots[1:] < time_slots[:-1]):
+                    raise ValueError('The time slots must be given in increasing order')
+
+                # As the time slots are sorted, the first and last one are the smallest and largest one, respectively...
+                if time_slots[0] < 0 or time_slots[-1] >= num_time_slots:
+                    raise ValueError('The time slots must be in [0, ' + str(num_time_slots) + '), but got ['
+                                     + str(time_slots[0]) + ', ' + str(time_slots[-1]) + ']')
+
+            time_slot_dtype = get_time_slot_dtype(values.shape[0])
+            time_slots = np.ascontiguousarray(time_slots, dtype=(DTYPE_UINT32 if time_slots.dtype == DTYPE_UINT32
+                                                                 else time_slot_dtype))
+        else:
+            # Only the ground truth of the first example that belongs to each time slot is retained...
+            y = check_array(y, accept_sparse='csc', ensure_2d=False, dtype=DTYPE_UINT32)
+            timestamps = y[:, 0]
+            time_slots, first_indices = get_time_slots(timestamps.toarray().ravel() if issparse(y) else timestamps)
+            values = y[first_indices, 1]
+            values = np.ascontiguousarray(values.toarray().ravel() if issparse(y) else values, dtype=DTYPE_UINT32)
+
+        self.num_labels = 1
+        self.label_matrix = TimeSlotLabelMatrix(time_slots, values)
+        self.time_slots = time_slots
+        self.values = values
+
+    def subset(self, indices) -> 'TrainingContext':
+        """
+        Creates and returns a context that only includes a subset of the examples, e.g., the training examples of a
+        single cross validation fold. The subset shares the feature matrix of this context, i.e., if the feature values
+        have been sorted in advance, they are neither sorted nor copied again. The remaining examples keep their
+        indices, but they are ignored when fitting a learner.
+
+        :param indices: An array, shape `(num_indices)`, that stores the indices of the examples that should be
+                        included in the subset in increasing order
+        :return:        The context that has been created
+        """
+        indices = np.ascontiguousarray(indices, dtype=DTYPE_UINT32)
+        subset_time_slots, first_indices = get_time_slots(self.time_slots[indices])
+        values = self.values[self.time_slots[indices[first_indices]]]
+        # The remaining examples are assigned to the time slot of the preceding example in the subset, such that the
+        # time slots remain in increasing order...
+        positions = np.maximum(np.searchsorted(indices, np.arange(self.num_examples), side='right') - 1, 0)
+        time_slots = np.ascontiguousarray(subset_time_slots[positions] if indices.shape[0] > 0
+                                          else np.zeros(self.num_examples, dtype=subset_time_slots.dtype))
+        subset = copy(self)
+        subset.label_matrix = TimeSlotLabelMatrix(time_slots, values, indices)
+        subset.time_slots = time_slots
+        subset.values = values
+        return subset
+
+
 class MLRuleLearner(Learner, NominalAttributeLearner):
     """
     A scikit-multilearn implementation of a rule learning algorithm for multi-label classification or ranking.
 
+    Instead of a feature matrix, an object of type `TrainingContext` may be passed to the function `fit`. In such case,
+    the given label matrix is ignored and the training data that is stored by the context is used instead.
+
     Attributes
         predictions_ The predictions for the training data
     """
@@ -234,48 +575,63 @@ class MLRuleLearner(Learner, NominalAttributeLearner):
         self.feature_format = feature_format
 
     def _fit(self, x, y):
-        # Validate feature matrix and convert it to the preferred format...
-        x_sparse_format = SparseFormat.CSC
-        x_sparse_policy = create_sparse_policy(self.feature_format)
-        x_enforce_sparse = should_enforce_sparse(x, sparse_format=x_sparse_format, policy=x_sparse_policy,
-                                                 dtype=DTYPE_FLOAT32)
-        x = self._validate_data((x if x_enforce_sparse else enforce_dense(x, order='F', dtype=DTYPE_FLOAT32)),
-                                accept_sparse=(x_sparse_format.value if x_enforce_sparse else False),
-                                dtype=DTYPE_FLOAT32, force_all_finite='allow-nan')
-        num_features = x.shape[1]
-
-        if issparse(x):
-            x_data = np.ascontiguousarray(x.data, dtype=DTYPE_FLOAT32)
-            x_row_indices = np.ascontiguousarray(x.indices, dtype=DTYPE_UINT32)
-            x_col_indices = np.ascontiguousarray(x.indptr, dtype=DTYPE_UINT32)
-            feature_matrix = CscFeatureMatrix(x.shape[0], x.shape[1], x_data, x_row_indices, x_col_indices)
+        if isinstance(x, TrainingContext):
+            training_context = x
         else:
-            feature_matrix = FortranContiguousFeatureMatrix(x)
+            training_context = TrainingContext(x, y, feature_format=self.feature_format)
 
-        # Validate label matrix and convert it to the preferred format...
-        y = check_array(y.toarray(order='C'), accept_sparse=False, ensure_2d=False, dtype=DTYPE_UINT32)
-        num_labels = y.shape[1]
-        label_matrix = CContiguousLabelMatrix(y)
-
-        # Create a mask that provides access to the information whether individual features are nominal or not...
-        if self.nominal_attribute_indices is None or len(self.nominal_attribute_indices) == 0:
-            nominal_feature_mask = EqualNominalFeatureMask(False)
-        elif len(self.nominal_attribute_indices) == num_features:
-            nominal_feature_mask = EqualNominalFeatureMask(True)
-        else:
-            nominal_feature_mask = DokNominalFeatureMask(self.nominal_attribute_indices)
+        self.n_features_in_ = training_context.num_features
+        feature_matrix = training_context.feature_matrix
+        label_matrix = training_context.label_matrix
+        num_labels = training_context.num_labels
+        nominal_feature_mask = self.__create_nominal_feature_mask(training_context.num_features)
 
         # Induce rules...
         rule_model_induction = self._create_rule_model_induction(num_labels)
         model_builder = self._create_model_builder()
+        initial_model = self._get_initial_model()
         model = rule_model_induction.induce_rules(nominal_feature_mask, feature_matrix, label_matrix, self.random_state,
-                                                  model_builder)
+                                                  model_builder, initial_model)
         self.predictions_ = rule_model_induction.predictions
         return model
 
     def _predict(self, x):
         raise NotImplementedError('Prediction for unseen data not supported!')
 
+    def serve_shard(self, x, y, socket_path: str, timeout: int = 600) -> bool:
+        """
+        Acts as a worker that is responsible for a shard of the features, while another learner that uses the same
+        training data and parameters, and whose parameter `shard_sockets` includes the given path, fits a model. The
+        function blocks until the other learner has finished.
+
+        :param x:           A `numpy.ndarray` or `scipy.sparse` matrix, shape `(num_examples, num_features)`, that
+                            stores the feature values of the training examples, or an object of type `TrainingContext`
+        :param y:           A `numpy.ndarray` or `scipy.sparse` matrix that stores the ground truth of the training
+                            examples. Ignored, if `x` is an object of type `TrainingContext`
+        :param socket_path: The path of the Unix domain socket, the other learner should connect to
+        :param timeout:     The maximum number of seconds to wait for the other learner to connect
+        :return:            True, if the other learner has finished successfully, False, if the connection has been
+                            closed unexpectedly
+        """
+        if isinstance(x, TrainingContext):
+            training_context = x
+        else:
+            training_context = TrainingContext(x, y, feature_format=self.feature_format)
+
+        nominal_feature_mask = self.__create_nominal_feature_mask(training_context.num_features)
+        shard_worker = self._create_shard_worker(nominal_feature_mask, training_context.feature_matrix,
+                                                 training_context.label_matrix)
+        return shard_worker.serve(str(socket_path), int(timeout))
+
+    def __create_nominal_feature_mask(self, num_features: int) -> NominalFeatureMask:
+        # Create a mask that provides access to the information whether individual features are nominal or not...
+        if self.nominal_attribute_indices is None or len(self.nominal_attribute_indices) == 0:
+            return EqualNominalFeatureMask(False)
+        elif len(self.nominal_attribute_indices) == num_features:
+            return EqualNominalFeatureMask(True)
+        else:
+            return DokNominalFeatureMask(self.nominal_attribute_indices)
+
     @abstractmethod
     def _create_rule_model_induction(self, num_labels: int) -> RuleModelInduction:
         """
@@ -287,6 +643,20 @@ class MLRuleLearner(Learner, NominalAttributeLearner):
         """
         pass
 
+    def _create_shard_worker(self, nominal_feature_mask: NominalFeatureMask, feature_matrix: FeatureMatrix,
+                             label_matrix: LabelMatrix) -> ShardWorker:
+        """
+        May be overridden by subclasses in order to create a worker that is responsible for a shard of the features,
+        if the induction of rules can be distributed among several processes.
+
+        :param nominal_feature_mask:    A mask that provides access to the information whether individual features are
+                                        nominal or not
+        :param feature_matrix:          A matrix that provides access to the feature values of the training examples
+        :param label_matrix:            A matrix that provides access to the labels of the training examples
+        :return:                        The worker that has been created
+        """
+        raise NotImplementedError('Distributing the induction of rules among several processes is not supported!')
+
     @abstractmethod
     def _create_model_builder(self) -> ModelBuilder:
         """
@@ -295,3 +665,12 @@ class MLRuleLearner(Learner, NominalAttributeLearner):
         :return: The builder that has been created
         """
         pass
+
+    def _get_initial_model(self) -> RuleModel:
+        """
+        May be overridden by subclasses in order to provide a model, whose rules should be continued when fitting the
+        learner.
+
+        :return: The model, whose rules should be continued, or None, if the rules should be induced from scratch
+        """
+        return None
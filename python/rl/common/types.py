@@ -9,6 +9,8 @@ DTYPE_INTP = np.intp
 
 DTYPE_UINT8 = np.uint8
 
+DTYPE_UINT16 = np.uint16
+
 DTYPE_UINT32 = np.uint32
 
 DTYPE_FLOAT32 = np.float32
@@ -12,10 +12,11 @@ from xml.dom import minidom
 
 import arff
 import numpy as np
-from scipy.sparse import coo_matrix, lil_matrix, csc_matrix, issparse, dok_matrix
+from scipy.sparse import issparse, dok_matrix
 from sklearn.compose import ColumnTransformer
 from sklearn.preprocessing import OneHotEncoder
 
+from rl.common.cython.input import ArffReader
 from rl.common.types import DTYPE_UINT32, DTYPE_FLOAT32
 from rl.testbed.io import write_xml_file
 
@@ -82,9 +83,8 @@ class MetaData:
                 attribute_type is None or attribute.attribute_type == attribute_type]
 
 
-def load_data_set_and_meta_data(data_dir: str, arff_file_name: str, xml_file_name: str,
-                                feature_dtype=DTYPE_FLOAT32,
-                                label_dtype=DTYPE_UINT32) -> (lil_matrix, lil_matrix, MetaData):
+def load_data_set_and_meta_data(data_dir: str, arff_file_name: str, xml_file_name: str, feature_dtype=DTYPE_FLOAT32,
+                                label_dtype=DTYPE_UINT32, num_threads: int = 1):
     """
     Loads a multi-label data set from an ARFF file and the corresponding Mulan XML file.
 
@@ -93,24 +93,26 @@ def load_data_set_and_meta_data(data_dir: str, arff_file_name: str, xml_file_nam
     :param xml_file_name:   The name of the XML file (including the suffix)
     :param feature_dtype:   The requested type of the feature matrix
     :param label_dtype:     The requested type of the label matrix
-    :return:                A `scipy.sparse.lil_matrix` of type `feature_dtype`, shape `(num_examples, num_features)`,
-                            representing the feature values of the examples, a `scipy.sparse.lil_matrix` of type
-                            `label_dtype`, shape `(num_examples, num_labels)`, representing the corresponding label
-                            vectors, as well as the data set's meta data
+    :param num_threads:     The number of CPU threads to be used to parse the ARFF file in parallel
+    :return:                A Fortran-contiguous `numpy.ndarray` or a `scipy.sparse.csc_matrix` of type
+                            `feature_dtype`, shape `(num_examples, num_features)`, representing the feature values of
+                            the examples, a C-contiguous `numpy.ndarray` of type `label_dtype`, shape
+                            `(num_examples, num_labels)`, representing the corresponding label vectors, as well as the
+                            data set's meta data
     """
     xml_file = path.join(data_dir, xml_file_name)
     log.debug('Parsing meta data from file \"%s\"...', xml_file)
     labels = __parse_labels(xml_file)
     arff_file = path.join(data_dir, arff_file_name)
     log.debug('Loading data set from file \"%s\"...', arff_file)
-    matrix, attributes = __load_arff(arff_file, feature_dtype=feature_dtype)
+    matrix, attributes = __load_arff(arff_file, num_threads=num_threads)
     meta_data = __create_meta_data(attributes, labels)
-    x, y = __create_feature_and_label_matrix(matrix, meta_data, label_dtype)
+    x, y = __create_feature_and_label_matrix(matrix, meta_data, feature_dtype, label_dtype)
     return x, y, meta_data
 
 
 def load_data_set(data_dir: str, arff_file_name: str, meta_data: MetaData, feature_dtype=DTYPE_FLOAT32,
-                  label_dtype=DTYPE_UINT32) -> (lil_matrix, lil_matrix):
+                  label_dtype=DTYPE_UINT32, num_threads: int = 1):
     """
     Loads a multi-label data set from an ARFF file given its meta data.
 
@@ -119,15 +121,16 @@ def load_data_set(data_dir: str, arff_file_name: str, meta_data: MetaData, featu
     :param meta_data:       The meta data
     :param feature_dtype:   The requested dtype of the feature matrix
     :param label_dtype:     The requested dtype of the label matrix
-    :return:                A `scipy.sparse.lil_matrix` of type `feature_dtype`, shape `(num_examples, num_features)`,
-                            representing the feature values of the examples, as well as a `scipy.sparse.lil_matrix` of
-                            type `label_dtype`, shape `(num_examples, num_labels)`, representing the corresponding
-                            label vectors
+    :param num_threads:     The number of CPU threads to be used to parse the ARFF file in parallel
+    :return:                A Fortran-contiguous `numpy.ndarray` or a `scipy.sparse.csc_matrix` of type
+                            `feature_dtype`, shape `(num_examples, num_features)`, representing the feature values of
+                            the examples, as well as a C-contiguous `numpy.ndarray` of type `label_dtype`, shape
+                            `(num_examples, num_labels)`, representing the corresponding label vectors
     """
     arff_file = path.join(data_dir, arff_file_name)
     log.debug('Loading data set from file \"%s\"...', arff_file)
-    matrix, _ = __load_arff(arff_file, feature_dtype=feature_dtype)
-    x, y = __create_feature_and_label_matrix(matrix, meta_data, label_dtype)
+    matrix, _ = __load_arff(arff_file, num_threads=num_threads)
+    x, y = __create_feature_and_label_matrix(matrix, meta_data, feature_dtype, label_dtype)
     return x, y
 
 
@@ -295,17 +298,19 @@ def one_hot_encode(x, y, meta_data: MetaData, encoder=None):
         return x, None, meta_data
 
 
-def __create_feature_and_label_matrix(matrix: csc_matrix, meta_data: MetaData, label_dtype) -> (lil_matrix, lil_matrix):
+def __create_feature_and_label_matrix(matrix, meta_data: MetaData, feature_dtype, label_dtype):
     """
     Creates and returns the feature and label matrix from a single matrix, representing the values in an ARFF file.
 
-    :param matrix:      A `scipy.sparse.csc_matrix` of type `feature_dtype`, shape
-                        `(num_examples, num_features + num_labels)`, representing the values in an ARFF file
-    :param meta_data:   The meta data of the data set
-    :param label_dtype: The requested type of the label matrix
-    :return:            A `scipy.sparse.lil_matrix` of type `feature_dtype`, shape `(num_examples, num_features)`,
-                        representing the feature matrix, as well as `scipy.sparse.lil_matrix` of type `label_dtype`,
-                        shape `(num_examples, num_labels)`, representing the label matrix
+    :param matrix:          A Fortran-contiguous `numpy.ndarray` or a `scipy.sparse.csc_matrix`, shape
+                            `(num_examples, num_features + num_labels)`, representing the values in an ARFF file
+    :param meta_data:       The meta data of the data set
+    :param feature_dtype:   The requested type of the feature matrix
+    :param label_dtype:     The requested type of the label matrix
+    :return:                A Fortran-contiguous `numpy.ndarray` or a `scipy.sparse.csc_matrix` of type
+                            `feature_dtype`, shape `(num_examples, num_features)`, representing the feature matrix, as
+                            well as a C-contiguous `numpy.ndarray` of type `label_dtype`, shape
+                            `(num_examples, num_labels)`, representing the label matrix
     """
     num_labels = len(meta_data.labels)
 
@@ -316,61 +321,23 @@ def __create_feature_and_label_matrix(matrix: csc_matrix, meta_data: MetaData, l
         x = matrix[:, :-num_labels]
         y = matrix[:, -num_labels:]
 
-    x = x.tolil()
-    y = y.astype(label_dtype).tolil()
+    x = x.astype(feature_dtype, copy=False)
+    y = np.ascontiguousarray(y.toarray() if issparse(y) else y, dtype=label_dtype)
     return x, y
 
 
-def __load_arff(arff_file: str, feature_dtype) -> (csc_matrix, list):
-    """
-    Loads the content of an ARFF file.
-
-    :param arff_file:       The path of the ARFF file (including the suffix)
-    :param feature_dtype:   The type, the data should be converted to
-    :return:                A `np.sparse.csc_matrix` of type `feature_dtype`, containing the values in the ARFF file, as
-                            well as a list that contains a description of each attribute in the ARFF file
-    """
-    try:
-        arff_dict = __load_arff_as_dict(arff_file, sparse=True)
-        data = arff_dict['data']
-        matrix_data = data[0]
-
-        for i in range(len(matrix_data)):
-            if matrix_data[i] is None:
-                matrix_data[i] = np.nan
-
-        matrix_row_indices = data[1]
-        matrix_col_indices = data[2]
-        shape = (max(matrix_row_indices) + 1, max(matrix_col_indices) + 1)
-        matrix = coo_matrix((matrix_data, (matrix_row_indices, matrix_col_indices)), shape=shape, dtype=feature_dtype)
-        matrix = matrix.tocsc()
-    except arff.BadLayout:
-        arff_dict = __load_arff_as_dict(arff_file, sparse=False)
-        data = arff_dict['data']
-        
-        for row in data:
-            for i in range(len(row)):
-                if row[i] is None:
-                    row[i] = np.nan
-
-        matrix = csc_matrix(data, dtype=feature_dtype)
-
-    attributes = arff_dict['attributes']
-    return matrix, attributes
-
-
-def __load_arff_as_dict(arff_file: str, sparse: bool) -> dict:
+def __load_arff(arff_file: str, num_threads: int):
     """
     Loads the content of an ARFF file.
 
     :param arff_file:   The path of the ARFF file (including the suffix)
-    :param sparse:      True, if the ARFF file is given in sparse format, False otherwise. If the given format is
-                        incorrect, a `arff.BadLayout` will be raised
-    :return:            A dictionary that stores the content of the ARFF file
+    :param num_threads: The number of CPU threads to be used to parse the file in parallel
+    :return:            A Fortran-contiguous `numpy.ndarray`, if the file is given in the dense format, or a
+                        `scipy.sparse.csc_matrix`, if it is given in the sparse format, of type `float32`, containing
+                        the values in the ARFF file, as well as a list that contains a description of each attribute in
+                        the ARFF file
     """
-    with open(arff_file, 'r') as file:
-        sparse_format = arff.COO if sparse else arff.DENSE
-        return arff.load(file, encode_nominal=True, return_type=sparse_format)
+    return ArffReader(num_threads).read(arff_file)
 
 
 def __parse_labels(xml_file) -> List[Attribute]:
@@ -5,7 +5,9 @@
 @author: Michael Rapp (mrapp@ke.tu-darmstadt.de)
 """
 import logging as log
+import os
 from abc import ABC
+from typing import Callable
 
 from sklearn.base import clone
 
@@ -24,27 +26,48 @@ class Experiment(CrossValidation, ABC):
 
     def __init__(self, base_learner: Learner, data_set: DataSet, num_folds: int = 1, current_fold: int = -1,
                  model_printer: ModelPrinter = None, prediction_printer: PredictionPrinter = None,
-                 persistence: ModelPersistence = None):
+                 persistence: ModelPersistence = None, num_parallel_folds: int = 1,
+                 training_context_factory: Callable = None):
         """
-        :param base_learner:    The classifier or ranker to be trained
-        :param model_printer:   The printer that should be used to print textual representations of models
-        :param persistence:     The `ModelPersistence` that should be used for loading and saving models
+        :param base_learner:                The classifier or ranker to be trained
+        :param model_printer:               The printer that should be used to print textual representations of models
+        :param persistence:                 The `ModelPersistence` that should be used for loading and saving models
+        :param num_parallel_folds:          The number of cross validation folds to be performed concurrently. Must be
+                                            at least 1. The threads to be used by the learner, according to its
+                                            parameter `num_threads_refinement`, are split among the folds that are
+                                            performed concurrently
+        :param training_context_factory:    A function that prepares the training data of all cross validation folds
+                                            at once, given the feature matrix and the label matrix of all examples,
+                                            and returns an object that provides a function `subset`, or None, if the
+                                            training data of each fold should be created by slicing the matrices
         """
-        super().__init__(data_set, num_folds, current_fold)
+        super().__init__(data_set, num_folds, current_fold, num_parallel_folds)
         self.base_learner = base_learner
         self.model_printer = model_printer
         self.prediction_printer = prediction_printer
         self.persistence = persistence
+        self.training_context_factory = training_context_factory
 
     def run(self):
         log.info('Starting experiment \"' + self.base_learner.get_name() + '\"...')
         super().run()
 
+    def _create_training_context(self, x, y):
+        training_context_factory = self.training_context_factory
+        return None if training_context_factory is None else training_context_factory(x, y)
+
     def _train_and_evaluate(self, meta_data: MetaData, train_indices, train_x, train_y, test_indices, test_x, test_y,
                             first_fold: int, current_fold: int, last_fold: int, num_folds: int):
         base_learner = self.base_learner
         current_learner = clone(base_learner)
         learner_name = current_learner.get_name()
+        num_parallel_folds = min(self.num_parallel_folds, last_fold - first_fold + 1)
+
+        # Split the threads among the folds that are performed concurrently, if supported...
+        if num_parallel_folds > 1 and 'num_threads_refinement' in current_learner.get_params():
+            num_threads = current_learner.num_threads_refinement
+            num_threads = os.cpu_count() if num_threads == -1 else num_threads
+            current_learner.set_params(num_threads_refinement=max(num_threads // num_parallel_folds, 1))
 
         # Set the indices of nominal attributes, if supported...
         if isinstance(current_learner, NominalAttributeLearner):
@@ -56,7 +79,7 @@ class Experiment(CrossValidation, ABC):
         if isinstance(loaded_learner, Learner):
             current_learner = loaded_learner
         else:
-            log.info('Fitting model to %s training examples...', train_x.shape[0])
+            log.info('Fitting model to %s training examples...', train_y.shape[0])
             current_learner.fit(train_x, train_y)
             log.info('Successfully fit model in %s seconds', current_learner.train_time_)
 
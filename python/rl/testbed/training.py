@@ -7,6 +7,7 @@
 import logging as log
 import os.path as path
 from abc import ABC, abstractmethod
+from concurrent.futures import ThreadPoolExecutor
 from timeit import default_timer as timer
 
 from sklearn.model_selection import KFold
@@ -32,6 +33,38 @@ class DataSet:
         self.data_set_name = data_set_name
         self.use_one_hot_encoding = use_one_hot_encoding
 
+    def exists(self, file_name: str) -> bool:
+        """
+        Returns whether a file of the data set exists or not. May be overridden by subclasses in order to load data sets
+        that are not stored in ARFF files.
+
+        :param file_name:   The name of the file (without suffix)
+        :return:            True, if the file exists, False otherwise
+        """
+        return path.isfile(path.join(self.data_dir, get_file_name(file_name, SUFFIX_ARFF)))
+
+    def load_data_set_and_meta_data(self, file_name: str):
+        """
+        Loads the examples that are contained in a file of the data set, as well as the meta data of the data set. May
+        be overridden by subclasses in order to load data sets that are not stored in ARFF files.
+
+        :param file_name:   The name of the file (without suffix)
+        :return:            The feature matrix and the label matrix of the examples, as well as the meta data
+        """
+        return load_data_set_and_meta_data(self.data_dir, get_file_name(file_name, SUFFIX_ARFF),
+                                           get_file_name(self.data_set_name, SUFFIX_XML))
+
+    def load_data_set(self, file_name: str, meta_data: MetaData):
+        """
+        Loads the examples that are contained in a file of the data set, given the meta data of the data set. May be
+        overridden by subclasses in order to load data sets that are not stored in ARFF files.
+
+        :param file_name:   The name of the file (without suffix)
+        :param meta_data:   The meta data
+        :return:            The feature matrix and the label matrix of the examples
+        """
+        return load_data_set(self.data_dir, get_file_name(file_name, SUFFIX_ARFF), meta_data)
+
 
 class CrossValidation(Randomized, ABC):
     """
@@ -39,16 +72,19 @@ class CrossValidation(Randomized, ABC):
     classifier or ranker.
     """
 
-    def __init__(self, data_set: DataSet, num_folds: int, current_fold: int):
+    def __init__(self, data_set: DataSet, num_folds: int, current_fold: int, num_parallel_folds: int = 1):
         """
-        :param data_set:        The properties of the data set to be used
-        :param num_folds:       The total number of folds to be used by cross validation or 1, if separate training and
-                                test sets should be used
-        :param current_fold:    The cross validation fold to be performed or -1, if all folds should be performed
+        :param data_set:            The properties of the data set to be used
+        :param num_folds:           The total number of folds to be used by cross validation or 1, if separate training
+                                    and test sets should be used
+        :param current_fold:        The cross validation fold to be performed or -1, if all folds should be performed
+        :param num_parallel_folds:  The number of cross validation folds to be performed concurrently. Must be at least
+                                    1
         """
         self.data_set = data_set
         self.num_folds = num_folds
         self.current_fold = current_fold
+        self.num_parallel_folds = num_parallel_folds
 
     def run(self):
         start_time = timer()
@@ -74,9 +110,7 @@ class CrossValidation(Randomized, ABC):
             'full' if current_fold < 0 else ('fold ' + str(current_fold + 1) + ' of')) + ' %s-fold cross validation...',
                  num_folds)
         data_set = self.data_set
-        data_set_name = data_set.data_set_name
-        x, y, meta_data = load_data_set_and_meta_data(data_set.data_dir, get_file_name(data_set_name, SUFFIX_ARFF),
-                                                      get_file_name(data_set_name, SUFFIX_XML))
+        x, y, meta_data = data_set.load_data_set_and_meta_data(data_set.data_set_name)
 
         if data_set.use_one_hot_encoding:
             x, _, meta_data = one_hot_encode(x, y, meta_data)
@@ -89,27 +123,59 @@ class CrossValidation(Randomized, ABC):
             first_fold = current_fold
             last_fold = current_fold
 
-        i = 0
+        # The training data of all folds is prepared once, if supported...
+        training_context = self._create_training_context(x, y)
         k_fold = KFold(n_splits=num_folds, random_state=self.random_state, shuffle=True)
+        folds = [(i, train_indices, test_indices) for i, (train_indices, test_indices) in enumerate(k_fold.split(x, y))
+                 if current_fold < 0 or i == current_fold]
+        num_parallel_folds = min(self.num_parallel_folds, len(folds))
+
+        if num_parallel_folds > 1:
+            with ThreadPoolExecutor(max_workers=num_parallel_folds) as executor:
+                futures = [executor.submit(self.__train_and_evaluate_fold, meta_data, training_context, x, y,
+                                           train_indices, test_indices, first_fold=first_fold, current_fold=i,
+                                           last_fold=last_fold, num_folds=num_folds)
+                           for i, train_indices, test_indices in folds]
+
+                for future in futures:
+                    future.result()
+        else:
+            for i, train_indices, test_indices in folds:
+                self.__train_and_evaluate_fold(meta_data, training_context, x, y, train_indices, test_indices,
+                                               first_fold=first_fold, current_fold=i, last_fold=last_fold,
+                                               num_folds=num_folds)
 
-        for train_indices, test_indices in k_fold.split(x, y):
-            if current_fold < 0 or i == current_fold:
-                log.info('Fold %s / %s:', (i + 1), num_folds)
-
-                # Create training set for current fold
-                train_x = x[train_indices]
-                train_y = y[train_indices]
+    def __train_and_evaluate_fold(self, meta_data: MetaData, training_context, x, y, train_indices, test_indices,
+                                  first_fold: int, current_fold: int, last_fold: int, num_folds: int):
+        """
+        Trains and evaluates a multi-label classifier or ranker on a single cross validation fold.
+
+        :param meta_data:           The meta data of the data set
+        :param training_context:    The training data that has been prepared for all folds or None, if the training
+                                    data of each fold should be passed to the classifier or ranker directly
+        :param x:                   The feature matrix of all examples
+        :param y:                   The label matrix of all examples
+        :param train_indices:       The indices of the training examples
+        :param test_indices:        The indices of the test examples
+        :param first_fold:          The first fold
+        :param current_fold:        The current fold starting at 0
+        :param last_fold:           The last fold
+        :param num_folds:           The total number of cross validation folds
+        """
+        log.info('Fold %s / %s:', (current_fold + 1), num_folds)
 
-                # Create test set for current fold
-                test_x = x[test_indices]
-                test_y = y[test_indices]
+        # Create training set for current fold
+        train_x = x[train_indices] if training_context is None else training_context.subset(train_indices)
+        train_y = y[train_indices]
 
-                # Train & evaluate classifier
-                self._train_and_evaluate(meta_data, train_indices, train_x, train_y, test_indices, test_x, test_y,
-                                         first_fold=first_fold, current_fold=i, last_fold=last_fold,
-                                         num_folds=num_folds)
+        # Create test set for current fold
+        test_x = x[test_indices]
+        test_y = y[test_indices]
 
-            i += 1
+        # Train & evaluate classifier
+        self._train_and_evaluate(meta_data, train_indices, train_x, train_y, test_indices, test_x, test_y,
+                                 first_fold=first_fold, current_fold=current_fold, last_fold=last_fold,
+                                 num_folds=num_folds)
 
     def __train_test_split(self):
         """
@@ -120,21 +186,18 @@ class CrossValidation(Randomized, ABC):
 
         # Load training data
         data_set = self.data_set
-        data_dir = data_set.data_dir
         data_set_name = data_set.data_set_name
         use_one_hot_encoding = data_set.use_one_hot_encoding
-        train_arff_file_name = get_file_name(data_set_name + '-train', SUFFIX_ARFF)
-        train_arff_file = path.join(data_dir, train_arff_file_name)
+        train_file_name = data_set_name + '-train'
         test_data_exists = True
 
-        if not path.isfile(train_arff_file):
-            train_arff_file_name = get_file_name(data_set_name, SUFFIX_ARFF)
-            log.warning('File \'' + train_arff_file + '\' does not exist. Using \'' +
-                        path.join(data_dir, train_arff_file_name) + '\' instead!')
+        if not data_set.exists(train_file_name):
+            log.warning('Data set \'' + train_file_name + '\' does not exist. Using \'' + data_set_name
+                        + '\' instead!')
+            train_file_name = data_set_name
             test_data_exists = False
 
-        train_x, train_y, meta_data = load_data_set_and_meta_data(data_dir, train_arff_file_name,
-                                                                  get_file_name(data_set_name, SUFFIX_XML))
+        train_x, train_y, meta_data = data_set.load_data_set_and_meta_data(train_file_name)
 
         if use_one_hot_encoding:
             train_x, encoder, meta_data = one_hot_encode(train_x, train_y, meta_data)
@@ -143,7 +206,7 @@ class CrossValidation(Randomized, ABC):
 
         # Load test data
         if test_data_exists:
-            test_x, test_y = load_data_set(data_dir, get_file_name(data_set_name + '-test', SUFFIX_ARFF), meta_data)
+            test_x, test_y = data_set.load_data_set(data_set_name + '-test', meta_data)
 
             if encoder is not None:
                 test_x, _ = one_hot_encode(test_x, test_y, meta_data, encoder=encoder)
@@ -156,6 +219,19 @@ class CrossValidation(Randomized, ABC):
         self._train_and_evaluate(meta_data, None, train_x, train_y, None, test_x, test_y, first_fold=0,
                                  current_fold=0, last_fold=0, num_folds=1)
 
+    def _create_training_context(self, x, y):
+        """
+        May be overridden by subclasses in order to prepare the training data of all cross validation folds at once,
+        e.g., by sorting the feature values in advance. The returned object must provide a function `subset` that
+        returns the training data of a single fold, given the indices of the training examples.
+
+        :param x:   The feature matrix of all examples
+        :param y:   The label matrix of all examples
+        :return:    The training data that has been prepared or None, if the training data of each fold should be
+                    created by slicing the given matrices
+        """
+        return None
+
     @abstractmethod
     def _train_and_evaluate(self, meta_data: MetaData, train_indices, train_x, train_y, test_indices, test_x, test_y,
                             first_fold: int, current_fold: int, last_fold: int, num_folds: int):
@@ -165,7 +241,8 @@ class CrossValidation(Randomized, ABC):
 
         :param meta_data:       The meta data of the training data set
         :param train_indices:   The indices of the training examples or None, if no cross validation is used
-        :param train_x:         The feature matrix of the training examples
+        :param train_x:         The feature matrix of the training examples or the training data that has been
+                                prepared by the function `_create_training_context`
         :param train_y:         The label matrix of the training examples
         :param test_indices:    The indices of the test examples or None, if no cross validation is used
         :param test_x:          The feature matrix of the test examples
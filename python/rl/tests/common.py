@@ -0,0 +1,193 @@
+#!/usr/bin/python
+
+"""
+@author: Michael Rapp (mrapp@ke.tu-darmstadt.de)
+
+Provides utility functions and classes that are used by the tests of the individual modules.
+"""
+import pickle
+import unittest
+from copy import deepcopy
+
+import numpy as np
+
+from rl.common.types import DTYPE_FLOAT32, DTYPE_UINT32
+from rl.tsa.syndrome_learner import SyndromeLearner
+
+
+def create_data(num_time_slots: int = 100, num_examples_per_time_slot: int = 10, num_features: int = 8,
+                random_state: int = 1):
+    """
+    Creates a synthetic time series, where the number of cases in each time slot corresponds to the number of examples
+    that satisfy a known combination of conditions.
+
+    :param num_time_slots:              The number of time slots
+    :param num_examples_per_time_slot:  The number of examples that belong to each time slot
+    :param num_features:                The number of features. Must be at least 3
+    :param random_state:                The seed to be used by the RNG
+    :return:                            A `numpy.ndarray` of type `float32`, shape `(num_examples, num_features)`, that
+                                        stores the feature values of the examples, a `numpy.ndarray` of type `uint32`,
+                                        shape `(num_examples)`, that stores the index of the time slot each example
+                                        belongs to, as well as a `numpy.ndarray` of type `uint32`, shape
+                                        `(num_time_slots)`, that stores the number of cases in each time slot
+    """
+    rng = np.random.RandomState(random_state)
+    num_examples = num_time_slots * num_examples_per_time_slot
+    x = rng.rand(num_examples, num_features).astype(DTYPE_FLOAT32)
+    time_slots = np.repeat(np.arange(num_time_slots), num_examples_per_time_slot).astype(DTYPE_UINT32)
+    cases = ((x[:, 0] > 0.5) & (x[:, 1] <= 0.6)) | (x[:, 2] > 0.9)
+    values = np.bincount(time_slots, weights=cases, minlength=num_time_slots).astype(DTYPE_UINT32)
+    return x, time_slots, values
+
+
+def create_label_matrix(time_slots, values):
+    """
+    Creates a label matrix, shape `(num_examples, 2)`, that stores the time slot and the number of cases in the time
+    slot each example belongs to, as expected by the function `fit` of a `SyndromeLearner`.
+
+    :param time_slots:  A `numpy.ndarray`, shape `(num_examples)`, that stores the index of the time slot each example
+                        belongs to
+    :param values:      A `numpy.ndarray`, shape `(num_time_slots)`, that stores the number of cases in each time slot
+    :return:            A `numpy.ndarray` of type `uint32`, shape `(num_examples, 2)`, that stores the label matrix
+    """
+    return np.column_stack((time_slots, values[time_slots])).astype(DTYPE_UINT32)
+
+
+def write_arff_file(file_path: str, x, y, sparse: bool = False):
+    """
+    Writes a data set to an ARFF file, where all attributes, including the labels, are numerical.
+
+    :param file_path:   The path of the ARFF file
+    :param x:           A `numpy.ndarray`, shape `(num_examples, num_features)`, that stores the feature values of the
+                        examples
+    :param y:           A `numpy.ndarray`, shape `(num_examples, num_labels)`, that stores the labels of the examples
+    :param sparse:      True, if the data should be written in the sparse format, False otherwise
+    """
+    matrix = np.column_stack((x.astype(np.float64), y))
+    num_features = x.shape[1]
+
+    with open(file_path, 'w') as f:
+        f.write('@RELATION \'data: -C -' + str(y.shape[1]) + '\'\n\n')
+
+        for i in range(matrix.shape[1]):
+            name = 'X' + str(i) if i < num_features else 'y' + str(i - num_features)
+            f.write('@ATTRIBUTE ' + name + ' NUMERIC\n')
+
+        f.write('\n@DATA\n')
+
+        for row in matrix:
+            values = [(i, repr(float(value)) if i < num_features else str(int(value))) for i, value in enumerate(row)]
+
+            if sparse:
+                f.write('{' + ','.join(str(i) + ' ' + value for i, value in values if float(value) != 0) + '}\n')
+            else:
+                f.write(','.join(value for _, value in values) + '\n')
+
+
+def create_learner(**kwargs) -> SyndromeLearner:
+    """
+    Creates a `SyndromeLearner` that induces a small number of rules, unless specified otherwise.
+
+    :param kwargs:  Parameters of the learner that should differ from the default ones
+    :return:        The learner that has been created
+    """
+    kwargs.setdefault('max_rules', 10)
+    return SyndromeLearner(2015, -1, 2016, -1, **kwargs)
+
+
+def get_model_state(learner: SyndromeLearner) -> bytes:
+    """
+    Returns a serialized representation of the rules of a fitted learner that allows to compare models.
+
+    :param learner: The fitted learner
+    :return:        The serialized rules
+    """
+    return pickle.dumps(learner.model_.__getstate__())
+
+
+def get_rules(learner: SyndromeLearner) -> list:
+    """
+    Returns copies of the rules of a fitted learner. The arrays that are returned by the function `__getstate__` of a
+    model are views of the model's memory and must therefore be copied, if the learner is fit again.
+
+    :param learner: The fitted learner
+    :return:        A list that contains a tuple, consisting of the body and head, for each rule
+    """
+    return deepcopy(learner.model_.__getstate__()[1][0])
+
+
+def get_covered(x, body) -> np.ndarray:
+    """
+    Determines the examples that are covered by the body of a rule.
+
+    :param x:       A `numpy.ndarray`, shape `(num_examples, num_features)`, that stores the feature values of the
+                    examples
+    :param body:    The body of the rule, as returned by the function `get_rules`
+    :return:        A `numpy.ndarray` of type `bool`, shape `(num_examples)`, that specifies whether individual examples
+                    are covered or not
+    """
+    leq_thresholds, leq_indices, gr_thresholds, gr_indices = body[:4]
+    covered = np.ones(x.shape[0], dtype=bool)
+
+    if leq_thresholds is not None:
+        covered &= np.all(x[:, leq_indices] <= leq_thresholds, axis=1)
+
+    if gr_thresholds is not None:
+        covered &= np.all(x[:, gr_indices] > gr_thresholds, axis=1)
+
+    return covered
+
+
+class LearnerTestCase(unittest.TestCase):
+    """
+    A base class for all tests that fit learners to the synthetic time series that is created by the function
+    `create_data`.
+    """
+
+    def setUp(self):
+        self.x, self.time_slots, self.values = create_data()
+        self.y = create_label_matrix(self.time_slots, self.values)
+
+    def fit(self, x=None, y=None, **kwargs) -> SyndromeLearner:
+        """
+        Fits a learner that is created via the function `create_learner` to the synthetic time series or to given data.
+
+        :param x:       The feature matrix or None, if the synthetic time series should be used
+        :param y:       The label matrix or None, if the synthetic time series should be used
+        :param kwargs:  Parameters of the learner that should differ from the default ones
+        :return:        The fitted learner
+        """
+        learner = create_learner(**kwargs)
+
+        if x is None:
+            x = self.x
+            y = self.y
+
+        return learner.fit(x, y)
+
+    def assertSameRules(self, first: list, second: list):
+        self.assertEqual(pickle.dumps(first), pickle.dumps(second))
+
+    def assertSameModel(self, first: SyndromeLearner, second: SyndromeLearner):
+        self.assertEqual(get_model_state(first), get_model_state(second))
+
+    def assertNotSameModel(self, first: SyndromeLearner, second: SyndromeLearner):
+        self.assertNotEqual(get_model_state(first), get_model_state(second))
+
+    def assertConsistentPredictions(self, learner: SyndromeLearner):
+        """
+        Asserts that the predictions for the training data, which are updated incrementally while the rules are
+        induced, are equal to the number of examples in each time slot that are covered by at least one of the rules
+        induced so far.
+
+        :param learner: The fitted learner
+        """
+        predictions = np.asarray(learner.predictions_.predictions)
+        rules = get_rules(learner)
+        self.assertEqual(predictions.shape[0], len(rules))
+        covered = np.zeros(self.x.shape[0], dtype=bool)
+
+        for i, (body, _) in enumerate(rules):
+            covered |= get_covered(self.x, body)
+            expected = np.bincount(self.time_slots, weights=covered, minlength=self.values.shape[0])
+            np.testing.assert_array_equal(predictions[i], expected)
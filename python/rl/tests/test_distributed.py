@@ -0,0 +1,101 @@
+#!/usr/bin/python
+
+"""
+@author: Michael Rapp (mrapp@ke.tu-darmstadt.de)
+
+Tests the distribution of the induction of rules among several processes, each of which is responsible for a shard of
+the features.
+"""
+import multiprocessing
+import os
+import unittest
+from tempfile import TemporaryDirectory
+from unittest import mock
+
+from rl.tests.common import LearnerTestCase, create_data, create_label_matrix, create_learner
+
+
+def serve_shard(socket_path: str, kwargs: dict):
+    """
+    Starts a worker that is responsible for a shard of the features of the synthetic time series.
+
+    :param socket_path: The path of the Unix domain socket, the worker should listen at
+    :param kwargs:      Parameters of the learner that should differ from the default ones
+    """
+    x, time_slots, values = create_data()
+    create_learner(**kwargs).serve_shard(x, create_label_matrix(time_slots, values), socket_path, timeout=60)
+
+
+class ShardedRuleInductionTest(LearnerTestCase):
+
+    def setUp(self):
+        super().setUp()
+        self.temp_dir = TemporaryDirectory()
+
+    def tearDown(self):
+        self.temp_dir.cleanup()
+
+    def fit_sharded(self, num_shards: int, **kwargs):
+        """
+        Fits a learner, whose features are distributed among several worker processes.
+
+        :param num_shards:  The number of worker processes
+        :param kwargs:      Parameters of the learner that should differ from the default ones
+        :return:            The fitted learner
+        """
+        context = multiprocessing.get_context('spawn')
+        socket_paths = [os.path.join(self.temp_dir.name, 'shard' + str(i)) for i in range(num_shards)]
+        workers = [context.Process(target=serve_shard, args=(socket_path, kwargs)) for socket_path in socket_paths]
+
+        for worker in workers:
+            worker.start()
+
+        try:
+            return self.fit(shard_sockets=','.join(socket_paths), **kwargs)
+        finally:
+            for worker in workers:
+                worker.join(timeout=60)
+                self.assertEqual(worker.exitcode, 0)
+
+    def test_same_model(self):
+        # The model must not depend on how the features are distributed among the workers...
+        for kwargs in [{'feature_sub_sampling': None}, {}, {'max_conditions': 1, 'min_support': 0.1}]:
+            with self.subTest(**kwargs):
+                self.assertSameModel(self.fit_sharded(num_shards=2, **kwargs), self.fit(**kwargs))
+
+        self.assertSameModel(self.fit_sharded(num_shards=3), self.fit())
+
+    def test_unreachable_shard(self):
+        with mock.patch('rl.tsa.syndrome_learner.SHARD_CONNECTION_TIMEOUT', 1):
+            with self.assertRaises(RuntimeError):
+                self.fit(shard_sockets=os.path.join(self.temp_dir.name, 'missing'))
+
+    def test_worker_timeout(self):
+        with self.assertRaises(RuntimeError):
+            create_learner().serve_shard(self.x, self.y, os.path.join(self.temp_dir.name, 'shard'), timeout=1)
+
+    def test_existing_file(self):
+        # Files other than sockets must not be replaced by a worker...
+        file_path = os.path.join(self.temp_dir.name, 'file')
+
+        with open(file_path, 'w') as f:
+            f.write('content')
+
+        with self.assertRaises(RuntimeError):
+            create_learner().serve_shard(self.x, self.y, file_path, timeout=1)
+
+        with open(file_path, 'r') as f:
+            self.assertEqual(f.read(), 'content')
+
+    def test_invalid_arguments(self):
+        shard_sockets = os.path.join(self.temp_dir.name, 'shard')
+
+        for kwargs in [{'beam_width': 3}, {'batch_size': 3}, {'screening_sample_size': 0.5},
+                       {'checkpoint_path': os.path.join(self.temp_dir.name, 'checkpoint')}]:
+            with self.subTest(**kwargs):
+                with self.assertRaises(ValueError):
+                    self.fit(shard_sockets=shard_sockets, **kwargs)
+
+
+if __name__ == '__main__':
+    unittest.main()
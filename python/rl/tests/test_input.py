@@ -0,0 +1,497 @@
+#!/usr/bin/python
+
+"""
+@author: Michael Rapp (mrapp@ke.tu-darmstadt.de)
+
+Tests the different formats, the training data can be given in, and the readers that load them from files.
+"""
+import ctypes
+import os
+import unittest
+from tempfile import TemporaryDirectory
+
+import numpy as np
+from scipy.sparse import csc_matrix, issparse
+
+from rl.common.columnar import write_feature_matrix
+from rl.common.cython.input import ArffReader, ArrowTable, MemoryMappedFeatureMatrix, TimeSlotLabelMatrix
+from rl.common.rule_learners import TrainingContext, MAX_NUM_COMPACT_TIME_SLOTS, MAX_NUM_EXAMPLES, \
+    get_time_slot_dtype
+from rl.common.types import DTYPE_FLOAT32, DTYPE_UINT16, DTYPE_UINT32
+from rl.tests.common import LearnerTestCase, create_data, create_label_matrix, create_learner, get_model_state, \
+    write_arff_file
+from rl.tsa.cython.input import CsvTimeSeriesReader
+from rl.tsa.windows import load_time_series
+
+
+class MemoryMappedFeatureMatrixTest(LearnerTestCase):
+
+    def setUp(self):
+        super().setUp()
+        self.temp_dir = TemporaryDirectory()
+        self.file_path = os.path.join(self.temp_dir.name, 'features.rlfm')
+
+    def tearDown(self):
+        self.temp_dir.cleanup()
+
+    def test_dense(self):
+        x = self.x.copy()
+        x[::7, 1] = np.nan
+
+        for presort in [False, True]:
+            with self.subTest(presort=presort):
+                write_feature_matrix(self.file_path, x, presort=presort)
+                feature_matrix = MemoryMappedFeatureMatrix(self.file_path)
+                self.assertEqual(feature_matrix.get_num_rows(), x.shape[0])
+                self.assertEqual(feature_matrix.get_num_cols(), x.shape[1])
+                self.assertSameModel(self.fit(TrainingContext(feature_matrix, self.y)), self.fit(x, self.y))
+
+    def test_sparse(self):
+        x = csc_matrix(np.where(self.x > 0.3, self.x, 0))
+
+        for presort in [False, True]:
+            with self.subTest(presort=presort):
+                write_feature_matrix(self.file_path, x, presort=presort)
+                self.assertSameModel(self.fit(TrainingContext(MemoryMappedFeatureMatrix(self.file_path), self.y)),
+                                     self.fit(x, self.y, feature_format='sparse'))
+
+    def test_missing_file(self):
+        with self.assertRaises(IOError):
+            MemoryMappedFeatureMatrix(self.file_path)
+
+
+def write_time_series(data_dir: str, random_state: int = 1):
+    """
+    Writes a time series to the CSV files that are expected by the class `CsvTimeSeriesReader`. The instances are
+    written in random order. They include a nominal feature, whose values must be quoted, and missing values. The
+    number of cases is unknown for the last week.
+
+    :param data_dir:        The path of the directory, the files should be written to
+    :param random_state:    The seed to be used by the RNG
+    :return:                A dictionary that contains the identifier of each instance that belongs to a week with a
+                            known number of cases as keys and tuples, consisting of the year, week, feature values and
+                            number of cases, as values
+    """
+    rng = np.random.RandomState(random_state)
+    nominal_values = ['north', 'south, east', 'north\nwest']
+    weeks = [(year, week) for year in [2015, 2016] for week in range(1, 11)]
+    cases = {week: rng.randint(0, 20) for week in weeks[:-1]}
+    rows = []
+
+    for i in range(len(weeks) * 5):
+        year, week = weeks[i // 5]
+        value = '' if i % 11 == 0 else repr(float(np.float32(rng.rand())))
+        rows.append((i, year, week, value, nominal_values[rng.randint(0, len(nominal_values))]))
+
+    with open(os.path.join(data_dir, 'instances.csv'), 'w') as f:
+        f.write('id,week,value,region,ignored\n')
+
+        for i in rng.permutation(len(rows)):
+            identifier, year, week, value, region = rows[i]
+            f.write(str(identifier) + ',' + str(year) + '-' + str(week) + ',' + value + ',"' + region + '",x\n')
+
+    with open(os.path.join(data_dir, 'instances_counts.csv'), 'w') as f:
+        f.write('year,week,cases\n')
+
+        for (year, week), num_cases in cases.items():
+            f.write(str(year) + ',' + str(week) + ',' + str(num_cases) + '\n')
+
+    with open(os.path.join(data_dir, 'features.txt'), 'w') as f:
+        f.write('id\nvalue\nregion\n')
+
+    return {identifier: (year, week, value, region, cases[(year, week)])
+            for identifier, year, week, value, region in rows if (year, week) in cases}
+
+
+class TimeSeriesCacheTest(unittest.TestCase):
+
+    def setUp(self):
+        self.temp_dir = TemporaryDirectory()
+        self.data_dir = os.path.join(self.temp_dir.name, 'data')
+        self.cache_dir = os.path.join(self.temp_dir.name, 'cache')
+        os.makedirs(self.data_dir)
+        write_time_series(self.data_dir)
+
+    def tearDown(self):
+        self.temp_dir.cleanup()
+
+    def load(self, cache: bool):
+        return load_time_series(self.data_dir, 'instances', 'features',
+                                cache_dir=(self.cache_dir if cache else None), num_threads=2)
+
+    def fit(self, time_series):
+        learner = create_learner(max_rules=3, feature_sub_sampling=None)
+        learner.nominal_attribute_indices = time_series.nominal_attribute_indices
+        return learner.fit(TrainingContext(time_series.x, time_series.y), None)
+
+    def assertSameTimeSeries(self, time_series, expected_time_series):
+        self.assertIsInstance(time_series.x, MemoryMappedFeatureMatrix)
+        np.testing.assert_array_equal(time_series.y, expected_time_series.y)
+        np.testing.assert_array_equal(time_series.years, expected_time_series.years)
+        np.testing.assert_array_equal(time_series.weeks, expected_time_series.weeks)
+        self.assertEqual(time_series.feature_names, expected_time_series.feature_names)
+        self.assertEqual(time_series.nominal_attribute_indices, expected_time_series.nominal_attribute_indices)
+        self.assertEqual(time_series.nominal_values, expected_time_series.nominal_values)
+        self.assertEqual(get_model_state(self.fit(time_series)), get_model_state(self.fit(expected_time_series)))
+
+    def test_cache(self):
+        expected_time_series = self.load(cache=False)
+        self.assertSameTimeSeries(self.load(cache=True), expected_time_series)
+        self.assertTrue(os.path.isfile(os.path.join(self.cache_dir, 'instances_features.json')))
+
+        # The cached time series must be used, if the files have not changed...
+        self.assertSameTimeSeries(self.load(cache=True), expected_time_series)
+
+    def test_outdated_cache(self):
+        self.load(cache=True)
+        write_time_series(self.data_dir, random_state=2)
+        expected_time_series = self.load(cache=False)
+        self.assertSameTimeSeries(self.load(cache=True), expected_time_series)
+
+
+class CsvTimeSeriesReaderTest(unittest.TestCase):
+
+    def setUp(self):
+        self.temp_dir = TemporaryDirectory()
+        self.instances = write_time_series(self.temp_dir.name)
+
+    def tearDown(self):
+        self.temp_dir.cleanup()
+
+    def read(self, num_threads: int):
+        instance_file = os.path.join(self.temp_dir.name, 'instances.csv')
+        count_file = os.path.join(self.temp_dir.name, 'instances_counts.csv')
+        return CsvTimeSeriesReader(num_threads).read(instance_file, count_file, ['id', 'value', 'region'])
+
+    def test_read(self):
+        x, y, years, weeks, nominal_attribute_indices, nominal_values = self.read(num_threads=1)
+        self.assertEqual(x.shape, (len(self.instances), 3))
+        self.assertTrue(x.flags.f_contiguous)
+        self.assertEqual(nominal_attribute_indices, [2])
+
+        # The arrays must not be copied...
+        for array in [x, y, years, weeks]:
+            self.assertFalse(array.flags.owndata)
+
+        # The instances must be sorted chronologically and the time slots must start at 1...
+        chronological_order = years * 100 + weeks
+        self.assertTrue(np.all(chronological_order[1:] >= chronological_order[:-1]))
+        self.assertEqual(y[0, 0], 1)
+        np.testing.assert_array_equal(y[1:, 0] - y[:-1, 0], chronological_order[1:] != chronological_order[:-1])
+
+        for i in range(x.shape[0]):
+            year, week, value, region, num_cases = self.instances[int(x[i, 0])]
+            self.assertEqual((years[i], weeks[i], y[i, 1]), (year, week, num_cases))
+            self.assertEqual(nominal_values[0][int(x[i, 2])], region)
+
+            if value == '':
+                self.assertTrue(np.isnan(x[i, 1]))
+            else:
+                self.assertEqual(x[i, 1], np.float32(value))
+
+    def test_num_threads(self):
+        expected = self.read(num_threads=1)
+
+        for num_threads in [2, 4, 16]:
+            with self.subTest(num_threads=num_threads):
+                for expected_value, value in zip(expected, self.read(num_threads=num_threads)):
+                    if isinstance(value, np.ndarray):
+                        np.testing.assert_array_equal(value, expected_value)
+                    else:
+                        self.assertEqual(value, expected_value)
+
+    def test_missing_column(self):
+        instance_file = os.path.join(self.temp_dir.name, 'instances.csv')
+        count_file = os.path.join(self.temp_dir.name, 'instances_counts.csv')
+
+        with self.assertRaises(ValueError):
+            CsvTimeSeriesReader(1).read(instance_file, count_file, ['id', 'missing'])
+
+    def test_missing_file(self):
+        with self.assertRaises(IOError):
+            CsvTimeSeriesReader(1).read(os.path.join(self.temp_dir.name, 'missing.csv'),
+                                        os.path.join(self.temp_dir.name, 'instances_counts.csv'), ['id'])
+
+
+class ArffReaderTest(unittest.TestCase):
+
+    def setUp(self):
+        self.temp_dir = TemporaryDirectory()
+        self.file_path = os.path.join(self.temp_dir.name, 'data.arff')
+        x, time_slots, values = create_data(num_time_slots=50)
+        self.x = np.where(x > 0.3, x, 0).astype(DTYPE_FLOAT32)
+        self.y = create_label_matrix(time_slots, values)
+        self.expected_matrix = np.column_stack((self.x, self.y)).astype(DTYPE_FLOAT32)
+
+    def tearDown(self):
+        self.temp_dir.cleanup()
+
+    def test_dense(self):
+        write_arff_file(self.file_path, self.x, self.y)
+
+        for num_threads in [1, 4]:
+            with self.subTest(num_threads=num_threads):
+                matrix, attributes = ArffReader(num_threads).read(self.file_path)
+                self.assertFalse(issparse(matrix))
+                self.assertTrue(matrix.flags.f_contiguous)
+                np.testing.assert_array_equal(matrix, self.expected_matrix)
+                self.assertEqual(attributes, [('X' + str(i), 'NUMERIC') for i in range(self.x.shape[1])]
+                                 + [('y0', 'NUMERIC'), ('y1', 'NUMERIC')])
+
+    def test_sparse(self):
+        write_arff_file(self.file_path, self.x, self.y, sparse=True)
+
+        for num_threads in [1, 4]:
+            with self.subTest(num_threads=num_threads):
+                matrix, _ = ArffReader(num_threads).read(self.file_path)
+                self.assertIsInstance(matrix, csc_matrix)
+                np.testing.assert_array_equal(matrix.toarray(), self.expected_matrix)
+
+    def test_nominal_and_missing_values(self):
+        with open(self.file_path, 'w') as f:
+            f.write('@relation test\n@attribute a numeric\n@attribute \'b c\' {x, \'y z\'}\n@data\n'
+                    + '1.5,x\n?,\'y z\'\n% comment\n\n-2,?\n')
+
+        matrix, attributes = ArffReader(1).read(self.file_path)
+        np.testing.assert_array_equal(matrix, np.array([[1.5, 0], [np.nan, 1], [-2, np.nan]], dtype=DTYPE_FLOAT32))
+        self.assertEqual(attributes, [('a', 'NUMERIC'), ('b c', ['x', 'y z'])])
+
+    def test_invalid_value(self):
+        with open(self.file_path, 'w') as f:
+            f.write('@relation test\n@attribute a numeric\n@data\nabc\n')
+
+        with self.assertRaises(ValueError):
+            ArffReader(1).read(self.file_path)
+
+    def test_missing_file(self):
+        with self.assertRaises(IOError):
+            ArffReader(1).read(self.file_path)
+
+
+class ArrowSchema(ctypes.Structure):
+    pass
+
+
+class ArrowArray(ctypes.Structure):
+    pass
+
+
+ARROW_SCHEMA_RELEASE = ctypes.CFUNCTYPE(None, ctypes.POINTER(ArrowSchema))
+
+ARROW_ARRAY_RELEASE = ctypes.CFUNCTYPE(None, ctypes.POINTER(ArrowArray))
+
+ArrowSchema._fields_ = [('format', ctypes.c_char_p), ('name', ctypes.c_char_p), ('metadata', ctypes.c_char_p),
+                        ('flags', ctypes.c_int64), ('n_children', ctypes.c_int64),
+                        ('children', ctypes.POINTER(ctypes.POINTER(ArrowSchema))),
+                        ('dictionary', ctypes.POINTER(ArrowSchema)), ('release', ARROW_SCHEMA_RELEASE),
+                        ('private_data', ctypes.c_void_p)]
+
+ArrowArray._fields_ = [('length', ctypes.c_int64), ('null_count', ctypes.c_int64), ('offset', ctypes.c_int64),
+                       ('n_buffers', ctypes.c_int64), ('n_children', ctypes.c_int64),
+                       ('buffers', ctypes.POINTER(ctypes.c_void_p)),
+                       ('children', ctypes.POINTER(ctypes.POINTER(ArrowArray))),
+                       ('dictionary', ctypes.POINTER(ArrowArray)), ('release', ARROW_ARRAY_RELEASE),
+                       ('private_data', ctypes.c_void_p)]
+
+
+@ARROW_SCHEMA_RELEASE
+def release_schema(schema):
+    # The memory is owned by the `RecordBatch`, i.e., it must only be marked as released...
+    schema.contents.release = ARROW_SCHEMA_RELEASE()
+
+
+@ARROW_ARRAY_RELEASE
+def release_array(array):
+    array.contents.release = ARROW_ARRAY_RELEASE()
+
+
+ARROW_FORMATS = {np.dtype(np.float32): b'f', np.dtype(np.float64): b'g', np.dtype(np.int32): b'i',
+                 np.dtype(np.int64): b'l', np.dtype(np.uint16): b'S', np.dtype(np.uint32): b'I'}
+
+
+class RecordBatch:
+    """
+    A record batch that can be exported via the Arrow C data interface using the method `_export_to_c`, in the same way
+    as a `pyarrow.RecordBatch`. The buffers that are exported are owned by the record batch, i.e., it must not be
+    garbage collected as long as they are used by the consumer.
+    """
+
+    def __init__(self, columns):
+        """
+        :param columns: A list that contains a tuple for each column, consisting of its name, a `numpy.ndarray` that
+                        stores its values, a `numpy.ndarray` of type `bool` that specifies which values are valid or
+                        None, if all values are valid, and a list that contains the values of the dictionary or None, if
+                        the column is not dictionary-encoded
+        """
+        self.columns = columns
+        self.objects = []
+
+    def __keep(self, obj):
+        self.objects.append(obj)
+        return obj
+
+    def __create_dictionary(self, values):
+        data = ''.join(values).encode('utf-8')
+        offsets = self.__keep(np.cumsum([0] + [len(value.encode('utf-8')) for value in values]).astype(np.int32))
+        data = self.__keep(ctypes.create_string_buffer(data, max(len(data), 1)))
+        schema = self.__keep(ArrowSchema(format=b'u', name=None, metadata=None, flags=0, n_children=0,
+                                         release=release_schema))
+        buffers = self.__keep((ctypes.c_void_p * 3)(None, offsets.ctypes.data, ctypes.addressof(data)))
+        array = self.__keep(ArrowArray(length=len(values), null_count=0, offset=0, n_buffers=3, n_children=0,
+                                       buffers=buffers, release=release_array))
+        return schema, array
+
+    def _export_to_c(self, array_address: int, schema_address: int):
+        child_schemas = []
+        child_arrays = []
+        num_rows = 0
+
+        for name, values, valid, dictionary in self.columns:
+            values = self.__keep(np.ascontiguousarray(values))
+            num_rows = values.shape[0]
+            validity = None if valid is None else self.__keep(np.packbits(valid, bitorder='little'))
+            schema = self.__keep(ArrowSchema(format=ARROW_FORMATS[values.dtype], name=self.__keep(name.encode('utf-8')),
+                                             metadata=None, flags=2, n_children=0, release=release_schema))
+            buffers = self.__keep((ctypes.c_void_p * 2)(None if validity is None else validity.ctypes.data,
+                                                        values.ctypes.data))
+            array = self.__keep(ArrowArray(length=num_rows, null_count=(0 if valid is None else int(np.sum(~valid))),
+                                           offset=0, n_buffers=2, n_children=0, buffers=buffers,
+                                           release=release_array))
+
+            if dictionary is not None:
+                dictionary_schema, dictionary_array = self.__create_dictionary(dictionary)
+                schema.dictionary = ctypes.pointer(dictionary_schema)
+                array.dictionary = ctypes.pointer(dictionary_array)
+
+            child_schemas.append(ctypes.pointer(schema))
+            child_arrays.append(ctypes.pointer(array))
+
+        num_cols = len(self.columns)
+        schema = ArrowSchema.from_address(schema_address)
+        schema.format = self.__keep(b'+s')
+        schema.name = None
+        schema.metadata = None
+        schema.flags = 0
+        schema.n_children = num_cols
+        schema.children = self.__keep((ctypes.POINTER(ArrowSchema) * num_cols)(*child_schemas))
+        schema.release = release_schema
+        array = ArrowArray.from_address(array_address)
+        array.length = num_rows
+        array.null_count = 0
+        array.offset = 0
+        array.n_buffers = 1
+        array.n_children = num_cols
+        array.buffers = self.__keep((ctypes.c_void_p * 1)(None))
+        array.children = self.__keep((ctypes.POINTER(ArrowArray) * num_cols)(*child_arrays))
+        array.release = release_array
+
+
+class ArrowTableTest(LearnerTestCase):
+
+    def setUp(self):
+        super().setUp()
+        self.valid = np.ones(self.x.shape, dtype=bool)
+        self.valid[::7, 1] = False
+        self.x_batch = RecordBatch([('X' + str(i), self.x[:, i], (self.valid[:, i] if i == 1 else None), None)
+                                    for i in range(self.x.shape[1])])
+        self.y_batch = RecordBatch([('time_slot', self.time_slots, None, None),
+                                    ('cases', self.values[self.time_slots].astype(np.int64), None, None)])
+
+    def test_fit(self):
+        x = np.where(self.valid, self.x, np.nan)
+        training_context = TrainingContext(ArrowTable(self.x_batch), ArrowTable(self.y_batch))
+        self.assertSameModel(self.fit(training_context), self.fit(x, self.y))
+
+    def test_columns(self):
+        table = ArrowTable(RecordBatch([('a', np.arange(4, dtype=np.int32), None, ['x', 'y', 'zz', 'x']),
+                                        ('b', np.arange(4, dtype=np.float64), None, None)]))
+        self.assertEqual(table.get_num_rows(), 4)
+        self.assertEqual(table.get_num_cols(), 2)
+        self.assertEqual(table.get_column_names(), ['a', 'b'])
+        self.assertEqual(table.get_nominal_values(), {0: ['x', 'y', 'zz', 'x']})
+
+    def test_invalid_labels(self):
+        valid = np.ones(self.time_slots.shape[0], dtype=bool)
+        valid[3] = False
+        table = ArrowTable(RecordBatch([('time_slot', self.time_slots, valid, None)]))
+
+        with self.assertRaises(ValueError):
+            table.to_label_array()
+
+    def test_invalid_data(self):
+        with self.assertRaises(ValueError):
+            ArrowTable(self.x)
+
+        with self.assertRaises(ValueError):
+            ArrowTable(RecordBatch([('a', np.arange(4, dtype=np.float32), None, ['x'])]))
+
+
+class CompactLabelMatrixTest(LearnerTestCase):
+
+    def test_time_slots_and_values(self):
+        reference = self.fit()
+
+        for dtype in [DTYPE_UINT16, DTYPE_UINT32, np.int64]:
+            with self.subTest(dtype=dtype):
+                self.assertSameModel(self.fit(TrainingContext(self.x, (self.time_slots.astype(dtype), self.values))),
+                                     reference)
+
+    def test_subset(self):
+        indices = np.flatnonzero((self.time_slots % 3) != 0)
+        training_context = TrainingContext(self.x, (self.time_slots, self.values))
+        self.assertSameModel(self.fit(training_context.subset(indices)), self.fit(self.x[indices], self.y[indices]))
+
+    def test_invalid_time_slots(self):
+        time_slots = self.time_slots.astype(np.int64)
+        decreasing_time_slots = time_slots.copy()
+        decreasing_time_slots[[10, 20]] = decreasing_time_slots[[20, 10]]
+        negative_time_slots = time_slots - 1
+        out_of_range_time_slots = time_slots.copy()
+        out_of_range_time_slots[-1] = self.values.shape[0]
+
+        for name, invalid_time_slots in [('decreasing', decreasing_time_slots), ('negative', negative_time_slots),
+                                         ('out of range', out_of_range_time_slots), ('too short', time_slots[1:]),
+                                         ('two-dimensional', time_slots.reshape(-1, 1))]:
+            with self.subTest(name=name):
+                with self.assertRaises(ValueError):
+                    TrainingContext(self.x, (invalid_time_slots, self.values))
+
+
+class TimeSlotIndexTypeTest(LearnerTestCase):
+
+    def test_time_slot_dtype(self):
+        self.assertEqual(get_time_slot_dtype(MAX_NUM_COMPACT_TIME_SLOTS), DTYPE_UINT16)
+        self.assertEqual(get_time_slot_dtype(MAX_NUM_COMPACT_TIME_SLOTS + 1), DTYPE_UINT32)
+        self.assertEqual(TrainingContext(self.x, self.y).time_slots.dtype, DTYPE_UINT16)
+
+    def test_compact_and_wide_indices(self):
+        # Time slots that are given as `uint32` are not converted, i.e., both types of indices must be supported...
+        compact_context = TrainingContext(self.x, (self.time_slots.astype(DTYPE_UINT16), self.values))
+        wide_context = TrainingContext(self.x, (self.time_slots.astype(DTYPE_UINT32), self.values))
+        self.assertEqual(compact_context.time_slots.dtype, DTYPE_UINT16)
+        self.assertEqual(wide_context.time_slots.dtype, DTYPE_UINT32)
+        self.assertSameModel(self.fit(compact_context), self.fit(wide_context))
+
+    def test_many_time_slots(self):
+        num_time_slots = MAX_NUM_COMPACT_TIME_SLOTS + 1
+        x, time_slots, values = create_data(num_time_slots=num_time_slots, num_examples_per_time_slot=1,
+                                            num_features=3)
+        y = create_label_matrix(time_slots, values)
+        training_context = TrainingContext(x, y)
+        self.assertEqual(training_context.time_slots.dtype, DTYPE_UINT32)
+        self.assertSameModel(self.fit(training_context, max_rules=3),
+                             self.fit(TrainingContext(x, (time_slots, values)), max_rules=3))
+
+        with self.assertRaises(ValueError):
+            TimeSlotLabelMatrix(time_slots.astype(DTYPE_UINT16), values)
+
+    def test_too_many_examples(self):
+        # Example indices are of type `uint32`. A sparse matrix allows to test this without allocating its values...
+        x = csc_matrix((MAX_NUM_EXAMPLES + 1, 1), dtype=DTYPE_FLOAT32)
+
+        with self.assertRaises(ValueError):
+            TrainingContext(x, (np.zeros(0), np.zeros(0)), feature_format='sparse')
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,88 @@
+#!/usr/bin/python
+
+"""
+@author: Michael Rapp (mrapp@ke.tu-darmstadt.de)
+
+Tests the algorithms for the induction of individual rules.
+"""
+import unittest
+
+from rl.tests.common import LearnerTestCase
+
+
+class TopDownRuleInductionTest(LearnerTestCase):
+
+    def test_consistent_predictions(self):
+        # The predictions are updated incrementally, based on the time slots that are affected by a new rule...
+        for kwargs in [{}, {'feature_sub_sampling': None}, {'max_conditions': 1}, {'min_support': 0.1}]:
+            with self.subTest(**kwargs):
+                self.assertConsistentPredictions(self.fit(max_rules=20, **kwargs))
+
+    def test_num_threads(self):
+        self.assertSameModel(self.fit(feature_sub_sampling=None),
+                             self.fit(feature_sub_sampling=None, num_threads_refinement=4))
+
+
+class BeamSearchRuleInductionTest(LearnerTestCase):
+
+    def test_num_threads(self):
+        self.assertSameModel(self.fit(beam_width=3), self.fit(beam_width=3, num_threads_refinement=4))
+
+    def test_consistent_predictions(self):
+        self.assertConsistentPredictions(self.fit(beam_width=3))
+
+    def test_invalid_beam_width(self):
+        with self.assertRaises(ValueError):
+            self.fit(beam_width=0)
+
+    def test_beam_width_and_batch_size(self):
+        with self.assertRaises(ValueError):
+            self.fit(beam_width=3, batch_size=3)
+
+
+class BatchRuleInductionTest(LearnerTestCase):
+
+    def test_num_threads(self):
+        for max_overlap in [0.0, 0.5]:
+            with self.subTest(max_overlap=max_overlap):
+                self.assertSameModel(self.fit(batch_size=3, max_overlap=max_overlap),
+                                     self.fit(batch_size=3, max_overlap=max_overlap, num_threads_refinement=4))
+
+    def test_consistent_predictions(self):
+        # The rules of a batch are re-evaluated exactly, after the preceding rules of the batch have been added...
+        for max_overlap in [0.0, 0.5]:
+            with self.subTest(max_overlap=max_overlap):
+                self.assertConsistentPredictions(self.fit(batch_size=3, max_overlap=max_overlap))
+
+    def test_invalid_arguments(self):
+        for kwargs in [{'batch_size': 0}, {'batch_size': 3, 'max_overlap': 1.5}]:
+            with self.subTest(**kwargs):
+                with self.assertRaises(ValueError):
+                    self.fit(**kwargs)
+
+
+class ScreeningRuleInductionTest(LearnerTestCase):
+
+    def test_all_features_screened(self):
+        # If all features are retained by the screening, the exact verification must result in the same rules...
+        num_features = self.x.shape[1]
+        self.assertSameModel(self.fit(feature_sub_sampling=None),
+                             self.fit(feature_sub_sampling=None, screening_sample_size=0.5,
+                                      num_screened_features=num_features))
+
+    def test_num_threads(self):
+        self.assertSameModel(self.fit(screening_sample_size=0.5, num_screened_features=2),
+                             self.fit(screening_sample_size=0.5, num_screened_features=2, num_threads_refinement=4))
+
+    def test_consistent_predictions(self):
+        self.assertConsistentPredictions(self.fit(screening_sample_size=0.5, num_screened_features=2))
+
+    def test_invalid_arguments(self):
+        for kwargs in [{'screening_sample_size': 0.0}, {'screening_sample_size': 0.5, 'num_screened_features': 0}]:
+            with self.subTest(**kwargs):
+                with self.assertRaises(ValueError):
+                    self.fit(**kwargs)
+
+
+if __name__ == '__main__':
+    unittest.main()
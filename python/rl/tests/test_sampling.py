@@ -0,0 +1,85 @@
+#!/usr/bin/python
+
+"""
+@author: Michael Rapp (mrapp@ke.tu-darmstadt.de)
+
+Tests the strategies for sub-sampling the features and training examples.
+"""
+import unittest
+
+from rl.tests.common import LearnerTestCase
+
+RANDOM_FEATURE_SELECTION = 'random-feature-selection{"sample_size":0.5}'
+
+ADAPTIVE_FEATURE_SELECTION = 'adaptive-feature-selection{"sample_size":0.5,"decay":0.8,"exploration_rate":0.2}'
+
+TIME_SLOT_SELECTION = 'time-slot-selection{"sample_size":0.5,"block_size":4}'
+
+
+class RandomFeatureSubSamplingTest(LearnerTestCase):
+
+    def test_same_random_state(self):
+        # The sampling buffers are reused, i.e., repeatedly fitting a learner must not depend on previous fits...
+        learner = self.fit(feature_sub_sampling=RANDOM_FEATURE_SELECTION)
+
+        for _ in range(3):
+            self.assertSameModel(learner, self.fit(feature_sub_sampling=RANDOM_FEATURE_SELECTION))
+
+    def test_different_random_state(self):
+        self.assertNotSameModel(self.fit(feature_sub_sampling=RANDOM_FEATURE_SELECTION),
+                                self.fit(feature_sub_sampling=RANDOM_FEATURE_SELECTION, random_state=2))
+
+    def test_num_threads(self):
+        self.assertSameModel(self.fit(feature_sub_sampling=RANDOM_FEATURE_SELECTION),
+                             self.fit(feature_sub_sampling=RANDOM_FEATURE_SELECTION, num_threads_refinement=4))
+
+    def test_invalid_sample_size(self):
+        with self.assertRaises(ValueError):
+            self.fit(feature_sub_sampling='random-feature-selection{"sample_size":1.0}')
+
+
+class AdaptiveFeatureSubSamplingTest(LearnerTestCase):
+
+    def test_same_random_state(self):
+        self.assertSameModel(self.fit(feature_sub_sampling=ADAPTIVE_FEATURE_SELECTION),
+                             self.fit(feature_sub_sampling=ADAPTIVE_FEATURE_SELECTION))
+
+    def test_num_threads(self):
+        # The gains that are reported by different threads must not affect the features that are sampled...
+        self.assertSameModel(self.fit(feature_sub_sampling=ADAPTIVE_FEATURE_SELECTION),
+                             self.fit(feature_sub_sampling=ADAPTIVE_FEATURE_SELECTION, num_threads_refinement=4))
+
+    def test_beam_search_and_batch(self):
+        for kwargs in [{'beam_width': 3}, {'batch_size': 3}]:
+            with self.subTest(**kwargs):
+                self.assertSameModel(self.fit(feature_sub_sampling=ADAPTIVE_FEATURE_SELECTION, **kwargs),
+                                     self.fit(feature_sub_sampling=ADAPTIVE_FEATURE_SELECTION, num_threads_refinement=4,
+                                              **kwargs))
+
+    def test_invalid_arguments(self):
+        for argument in ['"decay":1.5', '"exploration_rate":0.0']:
+            with self.subTest(argument=argument):
+                with self.assertRaises(ValueError):
+                    self.fit(feature_sub_sampling='adaptive-feature-selection{' + argument + '}')
+
+
+class TimeSlotSubSamplingTest(LearnerTestCase):
+
+    def test_same_random_state(self):
+        learner = self.fit(feature_sub_sampling=None, instance_sub_sampling=TIME_SLOT_SELECTION)
+        self.assertSameModel(learner, self.fit(feature_sub_sampling=None, instance_sub_sampling=TIME_SLOT_SELECTION))
+        self.assertNotSameModel(learner, self.fit(feature_sub_sampling=None))
+
+    def test_num_threads(self):
+        self.assertSameModel(self.fit(instance_sub_sampling=TIME_SLOT_SELECTION),
+                             self.fit(instance_sub_sampling=TIME_SLOT_SELECTION, num_threads_refinement=4))
+
+    def test_invalid_arguments(self):
+        for argument in ['"sample_size":1.0', '"block_size":0']:
+            with self.subTest(argument=argument):
+                with self.assertRaises(ValueError):
+                    self.fit(instance_sub_sampling='time-slot-selection{' + argument + '}')
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,103 @@
+#!/usr/bin/python
+
+"""
+@author: Michael Rapp (mrapp@ke.tu-darmstadt.de)
+
+Tests the criteria for stopping the induction of rules.
+"""
+import time
+import unittest
+from threading import Thread
+
+from rl.tests.common import LearnerTestCase, create_data, create_label_matrix, create_learner, get_rules
+
+HOLDOUT = 'time-slot-holdout{"holdout_set_size":0.3,"block_size":4}'
+
+
+class PlateauStoppingCriterionTest(LearnerTestCase):
+
+    def test_stops_early(self):
+        learner = self.fit(max_rules=50, early_stopping='plateau{"window_size":2,"min_improvement":0.5}')
+        rules = get_rules(learner)
+        reference_rules = get_rules(self.fit(max_rules=50))
+        self.assertLess(len(rules), len(reference_rules))
+        self.assertSameRules(rules, reference_rules[:len(rules)])
+
+    def test_invalid_arguments(self):
+        for argument in ['"window_size":0', '"min_improvement":-0.1']:
+            with self.subTest(argument=argument):
+                with self.assertRaises(ValueError):
+                    self.fit(early_stopping='plateau{' + argument + '}')
+
+
+class HoldoutStoppingCriterionTest(LearnerTestCase):
+
+    def test_stops_early(self):
+        learner = self.fit(max_rules=50, holdout=HOLDOUT, early_stopping='holdout{"patience":1}')
+        num_rules = learner.model_.get_num_rules()
+        num_used_rules = learner.model_.get_num_used_rules()
+        self.assertLess(num_rules, self.fit(max_rules=50, holdout=HOLDOUT).model_.get_num_rules())
+        self.assertGreaterEqual(num_used_rules, 1)
+        self.assertLessEqual(num_used_rules, num_rules)
+
+    def test_force_stop(self):
+        # If the induction of rules is not stopped, the best stopping point of the whole run is used...
+        learner = self.fit(max_rules=50, holdout=HOLDOUT, early_stopping='holdout{"patience":1,"force_stop":False}')
+        reference = self.fit(max_rules=50, holdout=HOLDOUT)
+        self.assertSameRules(get_rules(learner), get_rules(reference))
+        self.assertGreaterEqual(learner.model_.get_num_used_rules(), 1)
+        self.assertLessEqual(learner.model_.get_num_used_rules(), learner.model_.get_num_rules())
+
+    def test_invalid_arguments(self):
+        for kwargs in [{'early_stopping': 'holdout{"patience":0}'}, {'holdout': 'time-slot-holdout{"block_size":0}'},
+                       {'holdout': 'time-slot-holdout{"holdout_set_size":1.0}'}]:
+            with self.subTest(**kwargs):
+                with self.assertRaises(ValueError):
+                    self.fit(**kwargs)
+
+
+class CancellationTest(LearnerTestCase):
+
+    def setUp(self):
+        # The training data must be large enough for the induction of rules to be canceled before it has finished...
+        self.x, self.time_slots, self.values = create_data(num_time_slots=1000, num_examples_per_time_slot=20,
+                                                           num_features=30)
+        self.y = create_label_matrix(self.time_slots, self.values)
+
+    def test_cancel(self):
+        learner = create_learner(max_rules=1000)
+        thread = Thread(target=learner.fit, args=(self.x, self.y))
+        thread.start()
+
+        while thread.is_alive() and getattr(learner, 'cancellation_token_', None) is None:
+            time.sleep(0.001)
+
+        time.sleep(0.05)
+        learner.cancel()
+        thread.join()
+
+        # The rules that have been induced before the induction of rules has been canceled must be retained, whereas
+        # the incomplete rule must be discarded...
+        rules = get_rules(learner)
+        reference_rules = get_rules(self.fit(max_rules=1000))
+        self.assertLess(len(rules), len(reference_rules))
+        self.assertSameRules(rules, reference_rules[:len(rules)])
+
+    def test_cancel_unfitted_learner(self):
+        # If the induction of rules is canceled before the model is fit, the cancellation is applied once it is fit...
+        learner = create_learner()
+        learner.cancel()
+        learner.fit(self.x, self.y)
+        reference = self.fit()
+        self.assertLess(len(get_rules(learner)), len(get_rules(reference)))
+
+        # The cancellation must not affect the following calls of the function `fit`...
+        self.assertSameModel(learner.fit(self.x, self.y), reference)
+
+    def test_invalid_time_limit(self):
+        with self.assertRaises(ValueError):
+            self.fit(time_limit=0)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,78 @@
+#!/usr/bin/python
+
+"""
+@author: Michael Rapp (mrapp@ke.tu-darmstadt.de)
+
+Tests the different ways of storing the sorted feature vectors that are needed for finding the best refinements of
+rules.
+"""
+import os
+import unittest
+from tempfile import TemporaryDirectory
+
+import numpy as np
+from scipy.sparse import csc_matrix
+
+from rl.common.columnar import write_feature_matrix
+from rl.common.cython.input import MemoryMappedFeatureMatrix
+from rl.common.rule_learners import TrainingContext
+from rl.tests.common import LearnerTestCase
+
+
+class CompressedCacheTest(LearnerTestCase):
+
+    def test_compress_cache(self):
+        x = self.x.copy()
+        x[::5, 3] = 0
+        x[::9, 4] = np.nan
+        # The values of these features are stored as rank codes and runs of equal values, respectively...
+        x[:, 0] = np.round(x[:, 0], 3)
+        x[:, 5] = np.round(x[:, 5], 1)
+
+        for kwargs in [{}, {'beam_width': 3}, {'batch_size': 3}, {'num_threads_refinement': 4}]:
+            with self.subTest(**kwargs):
+                self.assertSameModel(self.fit(x, self.y, compress_cache=True, max_rules=20, **kwargs),
+                                     self.fit(x, self.y, max_rules=20, **kwargs))
+
+    def test_sparse(self):
+        x = csc_matrix(np.where(self.x > 0.3, self.x, 0))
+        self.assertSameModel(self.fit(x, self.y, feature_format='sparse', compress_cache=True),
+                             self.fit(x, self.y, feature_format='sparse'))
+
+
+class PrefetchingTest(LearnerTestCase):
+
+    def setUp(self):
+        super().setUp()
+        self.temp_dir = TemporaryDirectory()
+        self.file_path = os.path.join(self.temp_dir.name, 'features.rlfm')
+
+    def tearDown(self):
+        self.temp_dir.cleanup()
+
+    def test_prefetch_window(self):
+        write_feature_matrix(self.file_path, self.x, presort=True)
+        training_context = TrainingContext(MemoryMappedFeatureMatrix(self.file_path), self.y)
+        reference = self.fit(max_rules=20)
+
+        # If the feature vectors are fetched whenever they are needed, the same rules must be induced...
+        for kwargs in [{'prefetch_window': 1}, {'prefetch_window': 4}, {'prefetch_window': 100},
+                       {'prefetch_window': 4, 'compress_cache': True}]:
+            with self.subTest(**kwargs):
+                self.assertSameModel(self.fit(training_context, max_rules=20, **kwargs), reference)
+
+        self.assertSameModel(self.fit(training_context, max_rules=20, prefetch_window=4, beam_width=3),
+                             self.fit(max_rules=20, beam_width=3))
+
+    def test_unsorted_feature_matrix(self):
+        write_feature_matrix(self.file_path, self.x, presort=False)
+        training_context = TrainingContext(MemoryMappedFeatureMatrix(self.file_path), self.y)
+        self.assertSameModel(self.fit(training_context, prefetch_window=4), self.fit())
+
+    def test_invalid_prefetch_window(self):
+        with self.assertRaises(ValueError):
+            self.fit(prefetch_window=-1)
+
+
+if __name__ == '__main__':
+    unittest.main()
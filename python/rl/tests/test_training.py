@@ -0,0 +1,256 @@
+#!/usr/bin/python
+
+"""
+@author: Michael Rapp (mrapp@ke.tu-darmstadt.de)
+
+Tests the different ways of fitting learners, e.g., continuing existing models, resuming from checkpoints or fitting
+several learners to shared training data.
+"""
+import os
+import time
+import unittest
+from concurrent.futures import ThreadPoolExecutor
+from functools import partial
+from tempfile import TemporaryDirectory
+from threading import Thread
+
+import numpy as np
+from scipy.sparse import csc_matrix
+
+from rl.common.rule_learners import TrainingContext
+from rl.testbed.data import MetaData, Label, save_meta_data
+from rl.testbed.experiments import Experiment
+from rl.testbed.training import DataSet
+from rl.tests.common import LearnerTestCase, create_data, create_label_matrix, create_learner, get_rules, \
+    write_arff_file
+from rl.tsa.windows import TimeSeries, TimeWindow, RollingWindowTrainer
+
+
+class WarmStartTest(LearnerTestCase):
+
+    def setUp(self):
+        super().setUp()
+        x, time_slots, values = create_data(random_state=2)
+        self.new_x = x
+        self.new_y = create_label_matrix(time_slots, values)
+
+    def test_continue_model(self):
+        learner = self.fit(max_rules=5)
+        rules = get_rules(learner)
+        learner.set_params(warm_start=True, max_rules=10)
+        learner.fit(self.new_x, self.new_y)
+        self.assertSameRules(get_rules(learner)[:len(rules)], rules)
+        self.assertGreater(learner.model_.get_num_rules(), len(rules))
+
+    def test_max_inherited_rules(self):
+        learner = self.fit(max_rules=5)
+        rules = get_rules(learner)
+        learner.set_params(warm_start=True, max_rules=10, max_inherited_rules=2)
+        learner.fit(self.new_x, self.new_y)
+        new_rules = get_rules(learner)
+        self.assertSameRules(new_rules[:2], rules[:2])
+        self.assertGreater(len(new_rules), 2)
+
+    def test_without_warm_start(self):
+        learner = self.fit(max_rules=5)
+        learner.fit(self.new_x, self.new_y)
+        self.assertSameModel(learner, self.fit(self.new_x, self.new_y, max_rules=5))
+
+    def test_invalid_max_inherited_rules(self):
+        learner = self.fit(max_rules=5)
+        learner.set_params(warm_start=True, max_inherited_rules=0)
+
+        with self.assertRaises(ValueError):
+            learner.fit(self.new_x, self.new_y)
+
+
+class CheckpointTest(LearnerTestCase):
+
+    def setUp(self):
+        # The training data must be large enough for the induction of rules to be canceled before it has finished...
+        self.x, self.time_slots, self.values = create_data(num_time_slots=1000, num_examples_per_time_slot=20,
+                                                           num_features=30)
+        self.y = create_label_matrix(self.time_slots, self.values)
+        self.temp_dir = TemporaryDirectory()
+        self.checkpoint_path = os.path.join(self.temp_dir.name, 'checkpoint')
+
+    def tearDown(self):
+        self.temp_dir.cleanup()
+
+    def write_checkpoint(self, **kwargs):
+        """
+        Fits a learner until the first checkpoint has been written and cancels it afterwards.
+
+        :param kwargs:  Parameters of the learner that should differ from the default ones
+        :return:        The learner that has been canceled
+        """
+        learner = create_learner(checkpoint_path=self.checkpoint_path, **kwargs)
+        thread = Thread(target=learner.fit, args=(self.x, self.y))
+        thread.start()
+
+        while thread.is_alive() and not os.path.isfile(self.checkpoint_path):
+            time.sleep(0.001)
+
+        learner.cancel()
+        thread.join()
+        self.assertTrue(os.path.isfile(self.checkpoint_path))
+        return learner
+
+    def test_resume(self):
+        canceled_learner = self.write_checkpoint(max_rules=1000)
+        learner = self.fit(max_rules=1000, checkpoint_path=self.checkpoint_path)
+        reference = self.fit(max_rules=1000)
+        self.assertLess(canceled_learner.model_.get_num_rules(), reference.model_.get_num_rules())
+        self.assertSameModel(learner, reference)
+        np.testing.assert_array_equal(np.asarray(learner.predictions_.predictions),
+                                      np.asarray(reference.predictions_.predictions))
+
+        # Once the induction of rules has been completed, the checkpoint must be removed...
+        self.assertFalse(os.path.isfile(self.checkpoint_path))
+
+    def test_resume_checkpoint_interval(self):
+        self.write_checkpoint(max_rules=1000, checkpoint_interval=2)
+        learner = self.fit(max_rules=1000, checkpoint_path=self.checkpoint_path, checkpoint_interval=2)
+        self.assertSameModel(learner, self.fit(max_rules=1000))
+
+    def test_checkpoint_of_other_data(self):
+        # A checkpoint that has been written for different training data must not be used...
+        self.write_checkpoint(max_rules=1000)
+        x, time_slots, values = create_data(random_state=2)
+        y = create_label_matrix(time_slots, values)
+        self.assertSameModel(self.fit(x, y, checkpoint_path=self.checkpoint_path), self.fit(x, y))
+
+    def test_invalid_checkpoint_interval(self):
+        with self.assertRaises(ValueError):
+            self.fit(checkpoint_path=self.checkpoint_path, checkpoint_interval=0)
+
+
+class TrainingContextTest(LearnerTestCase):
+
+    def test_presort(self):
+        reference = self.fit()
+
+        for presort in [False, True]:
+            with self.subTest(presort=presort):
+                self.assertSameModel(self.fit(TrainingContext(self.x, self.y, presort=presort, num_threads=2)),
+                                     reference)
+
+    def test_sparse(self):
+        training_context = TrainingContext(csc_matrix(self.x), self.y, feature_format='sparse', presort=True)
+        self.assertSameModel(self.fit(training_context), self.fit())
+
+    def test_concurrent_learners(self):
+        # Learners that share the same context must not affect each other, if they are fit concurrently...
+        training_context = TrainingContext(self.x, self.y, presort=True)
+        parameters = [{'random_state': random_state, 'beam_width': beam_width} for random_state in [1, 2, 3]
+                      for beam_width in [1, 3]]
+
+        with ThreadPoolExecutor(max_workers=len(parameters)) as executor:
+            learners = list(executor.map(lambda kwargs: self.fit(training_context, **kwargs), parameters))
+
+        for kwargs, learner in zip(parameters, learners):
+            with self.subTest(**kwargs):
+                self.assertSameModel(learner, self.fit(**kwargs))
+
+    def test_subset(self):
+        indices = np.flatnonzero(self.time_slots >= 30)
+        training_context = TrainingContext(self.x, self.y, presort=True)
+        self.assertSameModel(self.fit(training_context.subset(indices)), self.fit(self.x[indices], self.y[indices]))
+
+        # The examples of a cross validation fold are not restricted to certain time slots...
+        indices = np.sort(np.random.RandomState(3).choice(self.x.shape[0], int(0.75 * self.x.shape[0]), replace=False))
+        subset = training_context.subset(indices)
+
+        for kwargs in [{}, {'instance_sub_sampling': 'time-slot-selection'}, {'holdout': 'time-slot-holdout'},
+                       {'min_support': 0.1}, {'beam_width': 3}]:
+            with self.subTest(**kwargs):
+                self.assertSameModel(self.fit(subset, **kwargs), self.fit(self.x[indices], self.y[indices], **kwargs))
+
+
+class ModelRecorder:
+    """
+    Records the models that are fit by an `Experiment`, instead of saving them to disk.
+    """
+
+    def __init__(self):
+        self.models = {}
+
+    def load_model(self, model_name: str, fold: int = None, raise_exception: bool = False):
+        return None
+
+    def save_model(self, model, model_name: str, fold: int = None):
+        self.models[fold] = model
+
+
+class ParallelCrossValidationTest(LearnerTestCase):
+
+    def setUp(self):
+        super().setUp()
+        self.temp_dir = TemporaryDirectory()
+        write_arff_file(os.path.join(self.temp_dir.name, 'data.arff'), self.x, self.y)
+        save_meta_data(self.temp_dir.name, 'data.xml', MetaData([], [Label('y0'), Label('y1')], labels_at_start=False))
+
+    def tearDown(self):
+        self.temp_dir.cleanup()
+
+    def run_experiment(self, num_parallel_folds: int) -> dict:
+        """
+        Performs a cross validation and returns the models that have been fit to the individual folds.
+
+        :param num_parallel_folds:  The number of cross validation folds to be performed concurrently
+        :return:                    A dictionary that contains the folds as keys and the fitted learners as values
+        """
+        model_recorder = ModelRecorder()
+        data_set = DataSet(data_dir=self.temp_dir.name, data_set_name='data', use_one_hot_encoding=False)
+        learner = create_learner(num_threads_refinement=4)
+        training_context_factory = partial(TrainingContext, feature_format=learner.feature_format, presort=True,
+                                           num_threads=num_parallel_folds)
+        experiment = Experiment(learner, data_set, num_folds=4, persistence=model_recorder,
+                                num_parallel_folds=num_parallel_folds,
+                                training_context_factory=training_context_factory)
+        experiment.run()
+        return model_recorder.models
+
+    def test_parallel_folds(self):
+        models = self.run_experiment(num_parallel_folds=1)
+        parallel_models = self.run_experiment(num_parallel_folds=4)
+        self.assertEqual(sorted(models.keys()), [0, 1, 2, 3])
+        self.assertEqual(sorted(parallel_models.keys()), [0, 1, 2, 3])
+
+        for fold, learner in models.items():
+            with self.subTest(fold=fold):
+                self.assertSameModel(parallel_models[fold], learner)
+                self.assertEqual(parallel_models[fold].num_threads_refinement, 1)
+
+
+class RollingWindowTrainerTest(LearnerTestCase):
+
+    def setUp(self):
+        super().setUp()
+        years = 2010 + self.time_slots // 20
+        weeks = 1 + self.time_slots % 20
+        self.time_series = TimeSeries(x=self.x, y=self.y, years=years, weeks=weeks,
+                                      feature_names=['feature' + str(i) for i in range(self.x.shape[1])],
+                                      nominal_attribute_indices=[], nominal_values=[])
+
+    def test_windows(self):
+        windows = [TimeWindow(2010, 2011), TimeWindow(2011, 2013, from_week=5, to_week=10), TimeWindow(2014, 2014)]
+
+        for num_threads in [1, 4]:
+            learners = RollingWindowTrainer(create_learner(), num_threads=num_threads).fit(self.time_series, windows)
+            self.assertEqual(len(learners), len(windows))
+
+            for window, learner in zip(windows, learners):
+                with self.subTest(num_threads=num_threads, from_year=window.from_year, to_year=window.to_year):
+                    indices = window.get_indices(self.time_series)
+                    self.assertEqual(learner.from_year, window.from_year)
+                    self.assertEqual(learner.to_year, window.to_year)
+                    self.assertSameModel(learner, self.fit(self.x[indices], self.y[indices]))
+
+    def test_empty_window(self):
+        with self.assertRaises(ValueError):
+            RollingWindowTrainer(create_learner()).fit(self.time_series, [TimeWindow(2020, 2021)])
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,62 @@
+from rl.common.cython._types cimport uint32, float32
+
+cimport numpy as npc
+
+from libcpp cimport bool
+from libcpp.memory cimport unique_ptr
+from libcpp.string cimport string
+from libcpp.vector cimport vector
+
+
+cdef extern from "tsa/input/time_series_reader.hpp" namespace "tsa" nogil:
+
+    cdef cppclass TimeSeriesImpl"tsa::TimeSeries":
+
+        # Functions:
+
+        uint32 getNumRows()
+
+        uint32 getNumCols()
+
+        float32* getFeatureValues()
+
+        uint32* getLabels()
+
+        uint32* getYears()
+
+        uint32* getWeeks()
+
+        bool isNominal(uint32 featureIndex)
+
+        const vector[string]& getNominalValues(uint32 featureIndex)
+
+
+    cdef cppclass CsvTimeSeriesReaderImpl"tsa::CsvTimeSeriesReader":
+
+        # Constructors:
+
+        CsvTimeSeriesReaderImpl(uint32 numThreads) except +
+
+        # Functions:
+
+        unique_ptr[TimeSeriesImpl] read(const string& instanceFile, const string& countFile,
+                                        const vector[string]& featureNames, string& error)
+
+
+cdef class TimeSeriesBuffer:
+
+    # Attributes:
+
+    cdef unique_ptr[TimeSeriesImpl] time_series_ptr
+
+    # Functions:
+
+    cdef object as_array(self, void* data, int type_num, int num_dimensions, npc.npy_intp num_rows,
+                         npc.npy_intp num_cols)
+
+
+cdef class CsvTimeSeriesReader:
+
+    # Attributes:
+
+    cdef unique_ptr[CsvTimeSeriesReaderImpl] reader_ptr
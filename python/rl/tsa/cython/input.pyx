@@ -0,0 +1,107 @@
+"""
+@author Michael Rapp (mrapp@ke.tu-darmstadt.de)
+"""
+from libcpp.memory cimport make_unique
+from libcpp.utility cimport move
+
+cimport numpy as npc
+
+npc.import_array()
+
+
+cdef class TimeSeriesBuffer:
+    """
+    Takes the ownership of a time series that has been read by a `CsvTimeSeriesReader`. It serves as the base of the
+    numpy arrays that provide access to the time series, such that the memory is not freed as long as any of them is
+    referenced.
+    """
+
+    cdef object as_array(self, void* data, int type_num, int num_dimensions, npc.npy_intp num_rows,
+                         npc.npy_intp num_cols):
+        """
+        Creates and returns a C-contiguous `numpy.ndarray` that uses an array of the time series without copying it.
+
+        :param data:            A pointer to the array
+        :param type_num:        The numpy type of the array's elements
+        :param num_dimensions:  The number of dimensions of the array. Must be 1 or 2
+        :param num_rows:        The number of rows in the array
+        :param num_cols:        The number of columns in the array. Ignored, if the array is one-dimensional
+        :return:                The `numpy.ndarray` that has been created
+        """
+        cdef npc.npy_intp shape[2]
+        shape[0] = num_rows
+        shape[1] = num_cols
+        cdef npc.ndarray array = npc.PyArray_SimpleNewFromData(num_dimensions, shape, type_num, data)
+        npc.set_array_base(array, self)
+        return array
+
+
+cdef class CsvTimeSeriesReader:
+    """
+    A wrapper for the C++ class `CsvTimeSeriesReader`.
+    """
+
+    def __cinit__(self, uint32 num_threads):
+        """
+        :param num_threads: The number of CPU threads to be used to parse the file that stores the instances in
+                            parallel. Must be at least 1
+        """
+        self.reader_ptr = make_unique[CsvTimeSeriesReaderImpl](num_threads)
+
+    def read(self, str instance_file, str count_file, list feature_names):
+        """
+        Reads a time series from CSV files.
+
+        :param instance_file:   The path of the CSV file that stores the instances
+        :param count_file:      The path of the CSV file that stores the number of cases in each week
+        :param feature_names:   A list that contains the names of the columns that correspond to the features to be
+                                used
+        :return:                A tuple that contains a Fortran-contiguous `numpy.ndarray`, shape
+                                `(num_examples, num_features)`, that stores the feature values of the instances, a
+                                C-contiguous `numpy.ndarray`, shape `(num_examples, 2)`, that stores the time slot and
+                                the number of cases that correspond to the individual instances, two `numpy.ndarray`s,
+                                shape `(num_examples)`, that store the year and week of each instance, as well as a
+                                list that contains the indices of all nominal features and a list that contains the
+                                values of each nominal feature
+        """
+        cdef vector[string] feature_name_vector
+        cdef string error
+
+        for name in feature_names:
+            feature_name_vector.push_back(name.encode('utf-8'))
+
+        cdef unique_ptr[TimeSeriesImpl] time_series_ptr = move(self.reader_ptr.get().read(
+            instance_file.encode('utf-8'), count_file.encode('utf-8'), feature_name_vector, error))
+
+        if not time_series_ptr:
+            message = error.decode('utf-8')
+
+            if message.startswith('Unable to read'):
+                raise IOError(message)
+
+            raise ValueError(message)
+
+        cdef TimeSeriesImpl* time_series = time_series_ptr.get()
+        cdef uint32 num_rows = time_series.getNumRows()
+        cdef uint32 num_cols = time_series.getNumCols()
+        cdef const vector[string]* values
+        cdef uint32 i, j
+
+        # The arrays are handed over to numpy without being copied...
+        cdef TimeSeriesBuffer buffer = TimeSeriesBuffer()
+        buffer.time_series_ptr = move(time_series_ptr)
+        x = buffer.as_array(time_series.getFeatureValues(), npc.NPY_FLOAT32, 2, num_cols, num_rows).T
+        y = buffer.as_array(time_series.getLabels(), npc.NPY_UINT32, 2, num_rows, 2)
+        years = buffer.as_array(time_series.getYears(), npc.NPY_UINT32, 1, num_rows, 0)
+        weeks = buffer.as_array(time_series.getWeeks(), npc.NPY_UINT32, 1, num_rows, 0)
+
+        nominal_attribute_indices = []
+        nominal_values = []
+
+        for i in range(num_cols):
+            if time_series.isNominal(i):
+                nominal_attribute_indices.append(i)
+                values = &time_series.getNominalValues(i)
+                nominal_values.append([values.at(j).decode('utf-8') for j in range(values.size())])
+
+        return x, y, years, weeks, nominal_attribute_indices, nominal_values
@@ -10,15 +10,23 @@ from rl.tsa.cython.model import RuleListBuilder
 from rl.tsa.cython.rule_evaluation_label_wise import RegularizedLabelWiseRuleEvaluationFactory
 from rl.tsa.cython.statistics_label_wise import LabelWiseStatisticsProviderFactory
 from rl.common.cython.head_refinement import NoHeadRefinementFactory, FullHeadRefinementFactory
-from rl.common.cython.model import ModelBuilder
-from rl.common.cython.rule_induction import TopDownRuleInduction, SequentialRuleModelInduction
-from rl.common.cython.sampling import NoInstanceSubSamplingFactory
-from rl.common.cython.sampling import NoPartitionSamplingFactory
+from rl.common.cython.model import ModelBuilder, RuleModel
+from rl.common.cython.input import NominalFeatureMask, FeatureMatrix, LabelMatrix
+from rl.common.cython.rule_induction import RuleInduction, TopDownRuleInduction, BeamSearchRuleInduction, \
+    BatchRuleInduction, ShardedRuleInduction, SequentialRuleModelInduction, ShardWorker
+from rl.common.cython.statistics import StatisticsProviderFactory
+from rl.common.cython.stopping import CancellationToken
+from rl.common.cython.thresholds import ThresholdsFactory
 from rl.common.cython.thresholds_exact import ExactThresholdsFactory
 from rl.common.rule_learners import FEATURE_SUB_SAMPLING_RANDOM
 from rl.common.rule_learners import MLRuleLearner, SparsePolicy
-from rl.common.rule_learners import create_feature_sub_sampling_factory, create_max_conditions, \
-    create_stopping_criteria, create_min_support, get_preferred_num_threads
+from rl.common.rule_learners import create_instance_sub_sampling_factory, create_feature_sub_sampling_factory, \
+    create_partition_sampling_factory, create_max_conditions, create_stopping_criteria, create_min_support, \
+    create_beam_width, create_batch_size, create_max_overlap, create_screening_sample_size, \
+    create_num_screened_features, create_max_inherited_rules, create_checkpoint_path, \
+    create_checkpoint_interval, create_prefetch_window, create_shard_socket_paths, get_preferred_num_threads
+
+SHARD_CONNECTION_TIMEOUT = 60
 
 
 class SyndromeLearner(MLRuleLearner, ClassifierMixin):
@@ -29,26 +37,95 @@ class SyndromeLearner(MLRuleLearner, ClassifierMixin):
 
     def __init__(self, from_year: int, from_week: int, to_year: int, to_week: int, random_state: int = 1,
                  feature_format: str = SparsePolicy.AUTO.value, max_rules: int = 1000, time_limit: int = -1,
+                 early_stopping: str = None, holdout: str = None, instance_sub_sampling: str = None,
                  feature_sub_sampling: str = FEATURE_SUB_SAMPLING_RANDOM, min_support: float = 0.0,
-                 max_conditions: int = -1, num_threads_refinement: int = 1):
+                 max_conditions: int = -1, beam_width: int = 1, batch_size: int = 1, max_overlap: float = 0.0,
+                 screening_sample_size: float = 1.0, num_screened_features: int = 10,
+                 num_threads_refinement: int = 1, warm_start: bool = False, max_inherited_rules: int = -1,
+                 verify_inherited_rules: bool = False, checkpoint_path: str = None, checkpoint_interval: int = 1,
+                 compress_cache: bool = False, prefetch_window: int = 0, shard_sockets: str = None):
         """
         :param max_rules:                           The maximum number of rules to be induced (including the default
                                                     rule)
         :param time_limit:                          The duration in seconds after which the induction of rules should be
-                                                    canceled
+                                                    canceled. The time limit is also checked while a rule is induced, in
+                                                    which case the incomplete rule is discarded
+        :param early_stopping:                      The strategy that is used for early stopping. Must be `plateau`,
+                                                    `holdout` or None, if no early stopping should be used. Additional
+                                                    arguments may be provided as a dictionary, e.g.
+                                                    `plateau{\"window_size\":20,\"min_improvement\":0.001}` or
+                                                    `holdout{\"patience\":10}`. The strategy `holdout` requires a
+                                                    holdout set to be used
+        :param holdout:                             The strategy that is used for splitting the training examples into a
+                                                    training set and a holdout set. Must be `time-slot-holdout` or None,
+                                                    if no holdout set should be used. Additional arguments may be
+                                                    provided as a dictionary, e.g.
+                                                    `time-slot-holdout{\"holdout_set_size\":0.2,\"block_size\":4}`
+        :param instance_sub_sampling:               The strategy that is used for sub-sampling the training examples
+                                                    each time a new classification rule is learned. Must be
+                                                    `time-slot-selection` or None, if no sub-sampling should be used.
+                                                    Additional arguments may be provided as a dictionary, e.g.
+                                                    `time-slot-selection{\"sample_size\":0.5,\"block_size\":4}`
         :param feature_sub_sampling:                The strategy that is used for sub-sampling the features each time a
-                                                    classification rule is refined. Must be `random-feature-selection`
-                                                    or None, if no sub-sampling should be used. Additional arguments may
-                                                    be provided as a dictionary, e.g.
-                                                    `random-feature-selection{\"sample_size\":0.5}`
+                                                    classification rule is refined. Must be `random-feature-selection`,
+                                                    `adaptive-feature-selection` or None, if no sub-sampling should be
+                                                    used. Additional arguments may be provided as a dictionary, e.g.
+                                                    `random-feature-selection{\"sample_size\":0.5}` or
+                                                    `adaptive-feature-selection{\"decay\":0.9,\"exploration_rate\":0.1}`
         :param min_support:                         The minimum fraction of the training examples that must be covered
                                                     by a rule. Must be in [0, 1)
         :param max_conditions:                      The maximum number of conditions to be included in a rule's body.
                                                     Must be at least 1 or -1, if the number of conditions should not be
                                                     restricted
+        :param beam_width:                          The number of rules to be retained at each iteration of the search
+                                                    for a new rule. Must be at least 1. If 1, a greedy search is used
+        :param batch_size:                          The maximum number of rules to be induced based on a single scan of
+                                                    the features. Must be at least 1. Cannot be combined with a beam
+                                                    width greater than 1
+        :param max_overlap:                         The maximum fraction of the examples covered by the first condition
+                                                    of a rule that may also be covered by the first conditions of the
+                                                    preceding rules in the same batch. Must be in [0, 1]
+        :param screening_sample_size:               The fraction of the examples to be used for screening the features
+                                                    before searching for the best refinement of a rule. Must be in
+                                                    (0, 1]. If 1, the features are not screened
+        :param num_screened_features:               The number of features with the best estimates to be retained by the
+                                                    screening. Must be at least 1
         :param num_threads_refinement:              The number of threads to be used to search for potential refinements
                                                     of rules or -1, if the number of cores that are available on the
                                                     machine should be used
+        :param warm_start:                          True, if the rules of the model that has been fit previously should
+                                                    be continued when the learner is fit again, e.g. on new data that
+                                                    uses the same features, False, if the rules should be induced from
+                                                    scratch
+        :param max_inherited_rules:                 The maximum number of rules to be inherited from the model that has
+                                                    been fit previously or -1, if all (used) rules should be inherited
+        :param verify_inherited_rules:              True, if rules that are inherited from the model that has been fit
+                                                    previously should only be retained if they improve the quality of
+                                                    the model with respect to the new training data, False otherwise
+        :param checkpoint_path:                     The path of a file, the state of the induction of rules should
+                                                    periodically be written to, or None, if no checkpoints should be
+                                                    written. If the file exists when the learner is fit, the induction
+                                                    of rules is resumed from the checkpoint. The file is removed once
+                                                    the induction of rules has been completed
+        :param checkpoint_interval:                 The number of rules after which a checkpoint should be written. Must
+                                                    be at least 1
+        :param compress_cache:                      True, if the sorted feature vectors that are cached while rules are
+                                                    induced should be stored in a compressed form, which reduces the
+                                                    memory footprint at the expense of decompressing them whenever they
+                                                    are accessed, unless they have been accessed recently, False
+                                                    otherwise
+        :param prefetch_window:                     The maximum number of sorted feature vectors to be prefetched in the
+                                                    background, if the feature vectors should not be kept in memory, but
+                                                    should be fetched from the feature matrix, e.g., a
+                                                    `MemoryMappedFeatureMatrix`, whenever they are needed, or 0, if they
+                                                    should be cached. If the feature vectors are not cached, the
+                                                    parameter `compress_cache` is ignored
+        :param shard_sockets:                       A comma-separated list of paths of Unix domain sockets, where
+                                                    workers that have been started via the function `serve_shard` of
+                                                    learners with the same parameters listen, if the features should
+                                                    be distributed among them, or None, if rules should be induced by a
+                                                    single process. Cannot be combined with a beam width or batch size
+                                                    greater than 1, with screening the features or with checkpoints
         """
         super().__init__(random_state, feature_format)
         self.from_year = from_year
@@ -57,10 +134,26 @@ class SyndromeLearner(MLRuleLearner, ClassifierMixin):
         self.to_week = to_week
         self.max_rules = max_rules
         self.time_limit = time_limit
+        self.early_stopping = early_stopping
+        self.holdout = holdout
+        self.instance_sub_sampling = instance_sub_sampling
         self.feature_sub_sampling = feature_sub_sampling
         self.min_support = min_support
         self.max_conditions = max_conditions
+        self.beam_width = beam_width
+        self.batch_size = batch_size
+        self.max_overlap = max_overlap
+        self.screening_sample_size = screening_sample_size
+        self.num_screened_features = num_screened_features
         self.num_threads_refinement = num_threads_refinement
+        self.warm_start = warm_start
+        self.max_inherited_rules = max_inherited_rules
+        self.verify_inherited_rules = verify_inherited_rules
+        self.checkpoint_path = checkpoint_path
+        self.checkpoint_interval = checkpoint_interval
+        self.compress_cache = compress_cache
+        self.prefetch_window = prefetch_window
+        self.shard_sockets = shard_sockets
 
     def get_name(self) -> str:
         name = 'from-year=' + str(self.from_year)
@@ -68,37 +161,146 @@ class SyndromeLearner(MLRuleLearner, ClassifierMixin):
             name += '_from-week=' + str(self.from_week)
         name += '_to-year=' + str(self.to_year)
         if self.to_week >= 0:
-            name += '_to-week=' + str(self.from_week)
+            name += '_to-week=' + str(self.to_week)
         name += '_max-rules=' + str(self.max_rules)
+        if self.early_stopping is not None:
+            name += '_early-stopping=' + str(self.early_stopping)
+        if self.holdout is not None:
+            name += '_holdout=' + str(self.holdout)
+        if self.instance_sub_sampling is not None:
+            name += '_instance-sub-sampling=' + str(self.instance_sub_sampling)
         if self.feature_sub_sampling is not None:
             name += '_feature-sub-sampling=' + str(self.feature_sub_sampling)
         if int(self.min_support) < 1:
             name += '_min-support=' + str(self.min_support)
         if int(self.max_conditions) != -1:
             name += '_max-conditions=' + str(self.max_conditions)
+        if int(self.beam_width) != 1:
+            name += '_beam-width=' + str(self.beam_width)
+        if int(self.batch_size) != 1:
+            name += '_batch-size=' + str(self.batch_size)
+            name += '_max-overlap=' + str(self.max_overlap)
+        if float(self.screening_sample_size) != 1.0:
+            name += '_screening-sample-size=' + str(self.screening_sample_size)
+            name += '_num-screened-features=' + str(self.num_screened_features)
+        if self.warm_start:
+            name += '_warm-start'
+            if int(self.max_inherited_rules) != -1:
+                name += '_max-inherited-rules=' + str(self.max_inherited_rules)
+            if self.verify_inherited_rules:
+                name += '_verify-inherited-rules'
+        if self.compress_cache:
+            name += '_compress-cache'
+        if int(self.prefetch_window) != 0:
+            name += '_prefetch-window=' + str(self.prefetch_window)
+        if self.shard_sockets is not None:
+            name += '_num-shards=' + str(len(create_shard_socket_paths(self.shard_sockets)))
         if int(self.random_state) != 1:
             name += '_random_state=' + str(self.random_state)
         return name
 
+    def cancel(self):
+        """
+        Cancels the induction of rules, while the model is being fit. The rules that have been induced so far are
+        retained, whereas the rule that is currently being induced is discarded. As the rules are induced without
+        holding the GIL, this function may be called from a different thread, e.g. from a signal handler in the main
+        thread, while the model is fit in a worker thread. If the model is not being fit, e.g., because the worker thread
+        has not started to fit it yet, the cancellation is retained and applied to the next call of the function `fit`.
+        """
+        self._cancel_requested = True
+        cancellation_token = getattr(self, 'cancellation_token_', None)
+
+        if cancellation_token is not None:
+            cancellation_token.cancel()
+
+    def _fit(self, x, y):
+        try:
+            return super()._fit(x, y)
+        finally:
+            # Once the model has been fit, a cancellation must not affect the token that has been used anymore, but must
+            # be retained for the next call of the function `fit`...
+            self.cancellation_token_ = None
+            self._cancel_requested = False
+
     def _create_model_builder(self) -> ModelBuilder:
         return RuleListBuilder()
 
+    def _get_initial_model(self) -> RuleModel:
+        return getattr(self, 'model_', None) if self.warm_start else None
+
     def _create_rule_model_induction(self, num_labels: int) -> SequentialRuleModelInduction:
-        stopping_criteria = create_stopping_criteria(int(self.max_rules), int(self.time_limit))
-        instance_sub_sampling_factory = NoInstanceSubSamplingFactory()
+        stopping_criteria = create_stopping_criteria(int(self.max_rules), int(self.time_limit), self.early_stopping)
+        self.cancellation_token_ = CancellationToken(max(int(self.time_limit), 0))
+
+        # If the induction of rules has been canceled before the token has been created, it is canceled right away...
+        if getattr(self, '_cancel_requested', False):
+            self.cancellation_token_.cancel()
+
+        instance_sub_sampling_factory = create_instance_sub_sampling_factory(self.instance_sub_sampling)
         feature_sub_sampling_factory = create_feature_sub_sampling_factory(self.feature_sub_sampling)
-        partition_sampling_factory = NoPartitionSamplingFactory()
+        partition_sampling_factory = create_partition_sampling_factory(self.holdout)
         default_rule_head_refinement_factory = NoHeadRefinementFactory()
         head_refinement_factory = FullHeadRefinementFactory()
-        rule_evaluation_factory = RegularizedLabelWiseRuleEvaluationFactory()
-        statistics_provider_factory = LabelWiseStatisticsProviderFactory(rule_evaluation_factory,
-                                                                         rule_evaluation_factory)
-        thresholds_factory = ExactThresholdsFactory()
-        min_support = create_min_support(self.min_support)
-        max_conditions = create_max_conditions(self.max_conditions)
+        statistics_provider_factory = self.__create_statistics_provider_factory()
+        thresholds_factory = self.__create_thresholds_factory()
+        rule_induction = self.__create_rule_induction()
+        max_inherited_rules = create_max_inherited_rules(self.max_inherited_rules)
         num_threads_refinement = get_preferred_num_threads(self.num_threads_refinement)
-        rule_induction = TopDownRuleInduction(min_support, max_conditions, num_threads_refinement)
+        checkpoint_path = create_checkpoint_path(self.checkpoint_path)
+        checkpoint_interval = create_checkpoint_interval(int(self.checkpoint_interval))
         return SequentialRuleModelInduction(statistics_provider_factory, thresholds_factory, rule_induction,
                                             default_rule_head_refinement_factory, head_refinement_factory,
                                             instance_sub_sampling_factory, feature_sub_sampling_factory,
-                                            partition_sampling_factory, stopping_criteria)
+                                            partition_sampling_factory, stopping_criteria, self.cancellation_token_,
+                                            max_inherited_rules, bool(self.verify_inherited_rules),
+                                            num_threads_refinement, checkpoint_path, checkpoint_interval)
+
+    def _create_shard_worker(self, nominal_feature_mask: NominalFeatureMask, feature_matrix: FeatureMatrix,
+                             label_matrix: LabelMatrix) -> ShardWorker:
+        statistics_provider_factory = self.__create_statistics_provider_factory()
+        thresholds_factory = self.__create_thresholds_factory()
+        head_refinement_factory = FullHeadRefinementFactory()
+        num_threads_refinement = get_preferred_num_threads(self.num_threads_refinement)
+        return ShardWorker(statistics_provider_factory, thresholds_factory, head_refinement_factory,
+                           nominal_feature_mask, feature_matrix, label_matrix, num_threads_refinement)
+
+    @staticmethod
+    def __create_statistics_provider_factory() -> StatisticsProviderFactory:
+        rule_evaluation_factory = RegularizedLabelWiseRuleEvaluationFactory()
+        return LabelWiseStatisticsProviderFactory(rule_evaluation_factory, rule_evaluation_factory)
+
+    def __create_thresholds_factory(self) -> ThresholdsFactory:
+        prefetch_window = create_prefetch_window(int(self.prefetch_window))
+        return ExactThresholdsFactory(bool(self.compress_cache), prefetch_window)
+
+    def __create_rule_induction(self) -> RuleInduction:
+        min_support = create_min_support(self.min_support)
+        max_conditions = create_max_conditions(self.max_conditions)
+        beam_width = create_beam_width(self.beam_width)
+        batch_size = create_batch_size(self.batch_size)
+        num_threads_refinement = get_preferred_num_threads(self.num_threads_refinement)
+        shard_socket_paths = create_shard_socket_paths(self.shard_sockets)
+
+        if len(shard_socket_paths) > 0:
+            if beam_width > 1 or batch_size > 1 or float(self.screening_sample_size) != 1.0:
+                raise ValueError('Parameter \'shard_sockets\' cannot be used together with parameters '
+                                 + '\'beam_width\', \'batch_size\' or \'screening_sample_size\'')
+
+            if len(create_checkpoint_path(self.checkpoint_path)) > 0:
+                raise ValueError('Parameter \'shard_sockets\' cannot be used together with parameter '
+                                 + '\'checkpoint_path\'')
+
+            return ShardedRuleInduction(shard_socket_paths, min_support, max_conditions, SHARD_CONNECTION_TIMEOUT)
+        elif beam_width > 1:
+            if batch_size > 1:
+                raise ValueError('Parameter \'batch_size\' cannot be used together with parameter \'beam_width\'')
+
+            return BeamSearchRuleInduction(beam_width, min_support, max_conditions, num_threads_refinement)
+        elif batch_size > 1:
+            max_overlap = create_max_overlap(self.max_overlap)
+            return BatchRuleInduction(batch_size, max_overlap, min_support, max_conditions, num_threads_refinement)
+
+        screening_sample_size = create_screening_sample_size(self.screening_sample_size)
+        num_screened_features = create_num_screened_features(self.num_screened_features)
+        return TopDownRuleInduction(min_support, max_conditions, screening_sample_size, num_screened_features,
+                                    num_threads_refinement)
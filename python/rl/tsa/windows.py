@@ -0,0 +1,353 @@
+#!/usr/bin/python
+
+"""
+@author: Michael Rapp (mrapp@ke.tu-darmstadt.de)
+"""
+import hashlib
+import json
+import logging as log
+import os
+from concurrent.futures import ThreadPoolExecutor
+from typing import List
+
+import numpy as np
+from sklearn.base import clone
+
+from rl.common.columnar import write_feature_matrix
+from rl.common.cython.input import MemoryMappedFeatureMatrix
+from rl.common.rule_learners import TrainingContext, get_preferred_num_threads
+from rl.tsa.cython.input import CsvTimeSeriesReader
+from rl.tsa.syndrome_learner import SyndromeLearner
+
+ENCODING = 'utf-8'
+
+CACHE_VERSION = 2
+
+
+class TimeSeries:
+    """
+    Stores the instances of all weeks of a time series in chronological order, as well as the number of cases in each
+    week.
+
+    Attributes
+        x                           A `numpy.ndarray`, shape `(num_examples, num_features)`, or a `FeatureMatrix` that
+                                    stores the feature values of the instances
+        y                           A `numpy.ndarray`, shape `(num_examples, 2)`, that stores the time slot and the
+                                    number of cases that correspond to the individual instances
+        years                       A `numpy.ndarray`, shape `(num_examples)`, that stores the year of each instance
+        weeks                       A `numpy.ndarray`, shape `(num_examples)`, that stores the week of each instance
+        feature_names               A list that contains the names of the features
+        nominal_attribute_indices   A list that contains the indices of all nominal features
+        nominal_values              A list that contains the values of each nominal feature, in the order of their
+                                    indices that are used as feature values
+    """
+
+    def __init__(self, x, y, years, weeks, feature_names: List[str], nominal_attribute_indices: List[int],
+                 nominal_values: List[List[str]]):
+        self.x = x
+        self.y = y
+        self.years = years
+        self.weeks = weeks
+        self.feature_names = feature_names
+        self.nominal_attribute_indices = nominal_attribute_indices
+        self.nominal_values = nominal_values
+
+
+class TimeWindow:
+    """
+    Specifies the first and last week of a time window.
+    """
+
+    def __init__(self, from_year: int, to_year: int, from_week: int = -1, to_week: int = -1):
+        """
+        :param from_year:   The first year (inclusive) of the time window
+        :param to_year:     The last year (inclusive) of the time window
+        :param from_week:   The first week (inclusive) of the first year or -1, if the entire year should be included
+        :param to_week:     The last week (inclusive) of the last year or -1, if the entire year should be included
+        """
+        self.from_year = from_year
+        self.to_year = to_year
+        self.from_week = from_week
+        self.to_week = to_week
+
+    def get_indices(self, time_series: TimeSeries):
+        """
+        Returns the indices of all instances of a time series that belong to the time window.
+
+        :param time_series: The time series
+        :return:            A `numpy.ndarray`, shape `(num_indices)`, that stores the indices in increasing order
+        """
+        years = time_series.years
+        weeks = time_series.weeks
+        mask = (years >= self.from_year) & (years <= self.to_year)
+
+        if self.from_week >= 0:
+            mask &= (years != self.from_year) | (weeks >= self.from_week)
+
+        if self.to_week >= 0:
+            mask &= (years != self.to_year) | (weeks <= self.to_week)
+
+        return np.flatnonzero(mask)
+
+
+def load_time_series(data_dir: str, dataset: str, feature_definition: str, count_file_name: str = None,
+                     cache_dir: str = None, num_threads: int = 1) -> TimeSeries:
+    """
+    Loads the instances of all available weeks, as well as the number of cases in each week, at once.
+
+    If a cache directory is given, the prepared time series is stored in the directory, together with a hash of the
+    files it has been created from, as well as their sizes and modification times. The feature values are stored in
+    the format that is expected by the class `MemoryMappedFeatureMatrix` with all features already being sorted. If the
+    files have not changed in a later run, the prepared time series is used instead of loading and preprocessing the
+    files again. The files are only hashed if their sizes or modification times have changed.
+
+    :param data_dir:            The path of the directory where the data is located
+    :param dataset:             The name of the CSV file that stores the instances (without suffix)
+    :param feature_definition:  The name of the text file that specifies the features to be used (without suffix)
+    :param count_file_name:     The name of the CSV file that stores the number of cases in each week (without suffix)
+                                or None, if the name `<dataset>_counts` should be used
+    :param cache_dir:           The path of the directory where the prepared time series should be cached or None, if
+                                it should not be cached
+    :param num_threads:         The number of CPU threads to be used to parse the CSV file that stores the instances in
+                                parallel or -1, if the number of cores available on the machine should be used
+    :return:                    The time series that has been loaded
+    """
+    count_file = os.path.join(data_dir, (count_file_name if count_file_name is not None else dataset + '_counts')
+                              + '.csv')
+    feature_file = os.path.join(data_dir, feature_definition + '.txt')
+    instance_file = os.path.join(data_dir, dataset + '.csv')
+
+    if cache_dir is None:
+        return __read_time_series(count_file, feature_file, instance_file, num_threads)
+
+    file_paths = [count_file, feature_file, instance_file]
+    file_stats = __get_file_stats(file_paths)
+    cache_file = os.path.join(cache_dir, dataset + '_' + feature_definition)
+    meta_data = __read_cached_meta_data(cache_file)
+    content_hash = None
+
+    # If the sizes or modification times of the files have changed, the cache is only outdated if their content has
+    # changed as well...
+    if meta_data is not None and meta_data.get('file_stats') != file_stats:
+        content_hash = __get_content_hash(file_paths)
+
+        if meta_data.get('hash') == content_hash:
+            meta_data['file_stats'] = file_stats
+            __write_cached_meta_data(cache_file, meta_data)
+        else:
+            log.info('Cached time series \'' + str(cache_file) + '\' is outdated')
+            meta_data = None
+
+    if meta_data is not None:
+        return __read_cached_time_series(cache_file, meta_data)
+
+    time_series = __read_time_series(count_file, feature_file, instance_file, num_threads)
+    content_hash = content_hash if content_hash is not None else __get_content_hash(file_paths)
+    __write_cached_time_series(cache_file, content_hash, file_stats, time_series)
+    time_series.x = MemoryMappedFeatureMatrix(cache_file + '.rlfm')
+    return time_series
+
+
+def __get_file_stats(file_paths: List[str]) -> List[list]:
+    """
+    Returns the paths, sizes and modification times of several files.
+
+    :param file_paths:  A list that contains the paths of the files
+    :return:            A list that contains the absolute path, the size in bytes and the modification time in
+                        nanoseconds of each file
+    """
+    file_stats = []
+
+    for file_path in file_paths:
+        stat = os.stat(file_path)
+        file_stats.append([os.path.abspath(file_path), stat.st_size, stat.st_mtime_ns])
+
+    return file_stats
+
+
+def __get_content_hash(file_paths: List[str]) -> str:
+    """
+    Computes a hash of the content of several files.
+
+    :param file_paths:  A list that contains the paths of the files
+    :return:            The hash that has been computed
+    """
+    content_hash = hashlib.sha256(str(CACHE_VERSION).encode(ENCODING))
+
+    for file_path in file_paths:
+        with open(file_path, 'rb') as f:
+            for chunk in iter(lambda: f.read(1 << 20), b''):
+                content_hash.update(chunk)
+
+    return content_hash.hexdigest()
+
+
+def __read_cached_meta_data(cache_file: str):
+    """
+    Reads the meta data of a prepared time series from a cache.
+
+    :param cache_file:  The path of the cache files (without suffix)
+    :return:            A dictionary that stores the meta data or None, if no time series is cached
+    """
+    meta_data_file = cache_file + '.json'
+
+    if not os.path.isfile(meta_data_file):
+        return None
+
+    with open(meta_data_file, 'r', encoding=ENCODING) as f:
+        return json.load(f)
+
+
+def __write_cached_meta_data(cache_file: str, meta_data):
+    """
+    Writes the meta data of a prepared time series to a cache. The file is replaced atomically, such that incomplete
+    meta data is never read.
+
+    :param cache_file:  The path of the cache files (without suffix)
+    :param meta_data:   A dictionary that stores the meta data
+    """
+    meta_data_file = cache_file + '.json'
+
+    with open(meta_data_file + '.tmp', 'w', encoding=ENCODING) as f:
+        json.dump(meta_data, f)
+
+    os.replace(meta_data_file + '.tmp', meta_data_file)
+
+
+def __read_cached_time_series(cache_file: str, meta_data) -> TimeSeries:
+    """
+    Reads a prepared time series from a cache.
+
+    :param cache_file:  The path of the cache files (without suffix)
+    :param meta_data:   A dictionary that stores the meta data of the time series
+    :return:            The time series that has been read
+    """
+    log.info('Loading cached time series \'' + str(cache_file) + '\'...')
+    arrays = np.load(cache_file + '.npz')
+    return TimeSeries(x=MemoryMappedFeatureMatrix(cache_file + '.rlfm'), y=arrays['y'], years=arrays['years'],
+                      weeks=arrays['weeks'], feature_names=meta_data['feature_names'],
+                      nominal_attribute_indices=meta_data['nominal_attribute_indices'],
+                      nominal_values=meta_data['nominal_values'])
+
+
+def __write_cached_time_series(cache_file: str, content_hash: str, file_stats: List[list], time_series: TimeSeries):
+    """
+    Writes a prepared time series to a cache.
+
+    :param cache_file:      The path of the cache files (without suffix)
+    :param content_hash:    The hash of the files the time series has been created from
+    :param file_stats:      A list that contains the paths, sizes and modification times of the files the time series
+                            has been created from
+    :param time_series:     The time series
+    """
+    log.info('Caching time series \'' + str(cache_file) + '\'...')
+    os.makedirs(os.path.dirname(cache_file), exist_ok=True)
+    meta_data_file = cache_file + '.json'
+
+    if os.path.isfile(meta_data_file):
+        os.remove(meta_data_file)
+
+    # The feature matrix is replaced instead of being overwritten, as an outdated version might still be mapped into
+    # memory...
+    write_feature_matrix(cache_file + '.rlfm.tmp', time_series.x, presort=True)
+    os.replace(cache_file + '.rlfm.tmp', cache_file + '.rlfm')
+    np.savez(cache_file + '.npz', y=time_series.y, years=time_series.years, weeks=time_series.weeks)
+    meta_data = {
+        'hash': content_hash,
+        'file_stats': file_stats,
+        'feature_names': time_series.feature_names,
+        'nominal_attribute_indices': time_series.nominal_attribute_indices,
+        'nominal_values': time_series.nominal_values
+    }
+
+    # The meta data is written last, such that incomplete caches are never used...
+    __write_cached_meta_data(cache_file, meta_data)
+
+
+def __read_time_series(count_file: str, feature_file: str, instance_file: str, num_threads: int) -> TimeSeries:
+    """
+    Reads a time series from CSV files.
+
+    :param count_file:      The path of the CSV file that stores the number of cases in each week
+    :param feature_file:    The path of the text file that specifies the features to be used
+    :param instance_file:   The path of the CSV file that stores the instances
+    :param num_threads:     The number of CPU threads to be used to parse the CSV file that stores the instances in
+                            parallel
+    :return:                The time series that has been read
+    """
+    log.info('Loading features names from file \'' + str(feature_file) + '\'...')
+
+    with open(feature_file, 'r') as f:
+        feature_names = [name.strip() for name in f.readlines()]
+
+    log.info('Loading time series data from files \'' + str(instance_file) + '\' and \'' + str(count_file) + '\'...')
+    reader = CsvTimeSeriesReader(get_preferred_num_threads(num_threads))
+    x, y, years, weeks, nominal_attribute_indices, nominal_values = reader.read(instance_file, count_file,
+                                                                                feature_names)
+    log.info('Time series data was loaded successfully!')
+    return TimeSeries(x=x, y=y, years=years, weeks=weeks, feature_names=feature_names,
+                      nominal_attribute_indices=nominal_attribute_indices, nominal_values=nominal_values)
+
+
+class RollingWindowTrainer:
+    """
+    Fits a separate model to each of several time windows of a time series. The feature values of all instances are
+    sorted only once and are shared by the models of all time windows, which are restricted to the instances that belong
+    to the respective time window. The models of different time windows are fit concurrently.
+    """
+
+    def __init__(self, base_learner: SyndromeLearner, num_threads: int = 1):
+        """
+        :param base_learner:    The learner, a copy of which should be fit to each time window. The time window of the
+                                learner is replaced by the one the copy is fit to
+        :param num_threads:     The total number of threads to be used. Each learner uses the number of threads
+                                specified by its parameter `num_threads_refinement` and as many learners as possible
+                                are fit concurrently. Must be at least 1 or -1, if the number of cores available on the
+                                machine should be used
+        """
+        self.base_learner = base_learner
+        self.num_threads = num_threads
+
+    def fit(self, time_series: TimeSeries, windows: List[TimeWindow]) -> List[SyndromeLearner]:
+        """
+        Fits a model to each of the given time windows.
+
+        :param time_series: The time series
+        :param windows:     A list that contains the time windows
+        :return:            A list that contains the fitted learners in the same order as the given time windows
+        """
+        base_learner = self.base_learner
+        num_threads = get_preferred_num_threads(self.num_threads)
+        num_threads_refinement = get_preferred_num_threads(base_learner.num_threads_refinement)
+        num_parallel_windows = max(min(num_threads // num_threads_refinement, len(windows)), 1)
+        x = time_series.x
+
+        # The feature values of a cached time series are already sorted...
+        presort = not isinstance(x, MemoryMappedFeatureMatrix)
+
+        if presort:
+            log.info('Sorting the feature values of %s instances...', time_series.y.shape[0])
+
+        training_context = TrainingContext(x, time_series.y, feature_format=base_learner.feature_format,
+                                           presort=presort, num_threads=num_threads)
+
+        def fit_window(window: TimeWindow) -> SyndromeLearner:
+            indices = window.get_indices(time_series)
+
+            if indices.shape[0] == 0:
+                raise ValueError('Time window from year ' + str(window.from_year) + ' to year ' + str(window.to_year)
+                                 + ' does not contain any instances')
+
+            learner = clone(base_learner)
+            learner.from_year = window.from_year
+            learner.from_week = window.from_week
+            learner.to_year = window.to_year
+            learner.to_week = window.to_week
+            learner.nominal_attribute_indices = time_series.nominal_attribute_indices
+            learner.fit(training_context.subset(indices), None)
+            log.info('Successfully fit model \"' + learner.get_name() + '\" to %s instances in %s seconds',
+                     indices.shape[0], learner.train_time_)
+            return learner
+
+        with ThreadPoolExecutor(max_workers=num_parallel_windows) as executor:
+            return list(executor.map(fit_window, windows))
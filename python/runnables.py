@@ -7,7 +7,9 @@ import logging as log
 import sys
 from abc import ABC, abstractmethod
 from argparse import ArgumentParser
+from functools import partial
 
+from rl.common.rule_learners import MLRuleLearner, TrainingContext
 from rl.testbed.experiments import Experiment
 from rl.testbed.persistence import ModelPersistence
 from rl.testbed.printing import RulePrinter, ModelPrinterLogOutput, ModelPrinterTxtOutput, PredictionPrinter, \
@@ -78,10 +80,19 @@ class RuleLearnerRunnable(Runnable, ABC):
             raise ValueError('Mandatory parameter \'--data-dir\' has not been specified')
         if args.dataset is None:
             raise ValueError('Mandatory parameter \'--dataset\' has not been specified')
-        data_dir, dataset = self._preprocess(args)
-        data_set = DataSet(data_dir=data_dir, data_set_name=dataset, use_one_hot_encoding=args.one_hot_encoding)
-        experiment = Experiment(learner, data_set=data_set, model_printer=model_printer,
-                                prediction_printer=prediction_printer, persistence=persistence)
+        data_set = self._create_data_set(args)
+
+        # The feature values are sorted once and shared by the learners of all folds, if supported...
+        if isinstance(learner, MLRuleLearner):
+            training_context_factory = partial(TrainingContext, feature_format=learner.feature_format, presort=True,
+                                               num_threads=args.num_parallel_folds)
+        else:
+            training_context_factory = None
+
+        experiment = Experiment(learner, data_set=data_set, num_folds=args.folds, current_fold=args.current_fold,
+                                model_printer=model_printer, prediction_printer=prediction_printer,
+                                persistence=persistence, num_parallel_folds=args.num_parallel_folds,
+                                training_context_factory=training_context_factory)
         experiment.random_state = args.random_state
         experiment.run()
 
@@ -96,12 +107,11 @@ class RuleLearnerRunnable(Runnable, ABC):
         pass
 
     @abstractmethod
-    def _preprocess(self, args) ->(str, str):
+    def _create_data_set(self, args) -> DataSet:
         """
-        Must be implemented by subclasses in order to preprocess the data.
+        Must be implemented by subclasses in order to create the data set.
 
         :param args:    The command line arguments
-        :return:        The path to the directory where the preprocessed data is located, as well as the file of the
-                        dataset (without suffix)
+        :return:        The data set that has been created
         """
         pass
@@ -62,8 +62,7 @@ setuptools.setup(
         'scipy>=1.7.0',
         'Cython>=0.29.0',
         'scikit-learn>=0.24.0',
-        'liac-arff>=2.5.0',
-        'pandas>=1.2.0'
+        'liac-arff>=2.5.0'
     ],
     python_requires='>=3.7',
     ext_modules=cythonize(extensions, language_level='3', annotate=ANNOTATE, compiler_directives=compiler_directives),